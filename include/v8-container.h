@@ -36,6 +36,17 @@ class V8_EXPORT Array : public Object {
    */
   static Local<Array> New(Isolate* isolate, Local<Value>* elements,
                           size_t length);
+
+  /**
+   * Creates a JavaScript array of numbers out of a C++ array with a known
+   * length. The elements are stored unboxed, so no handle is created per
+   * element. Arrays of int32_t values that all fit in a Smi get Smi
+   * elements, all other arrays get double elements.
+   */
+  static Local<Array> New(Isolate* isolate, const double* elements,
+                          size_t length);
+  static Local<Array> New(Isolate* isolate, const int32_t* elements,
+                          size_t length);
   V8_INLINE static Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
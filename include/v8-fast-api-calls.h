@@ -164,6 +164,8 @@
  *  - uint64_t
  *  - float32_t
  *  - float64_t
+ *  - const FastOneByteString&, for sequential one-byte strings; other strings
+ *    take the slow callback
  *
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
@@ -247,6 +249,7 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kSeqOneByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
     kAny,        // This is added to enable untyped representation of fast
@@ -416,6 +419,16 @@ class V8_EXPORT CFunctionInfo {
 struct FastApiCallbackOptions;
 
 // Provided for testing.
+/**
+ * A sequential one-byte string passed to a fast API call, see
+ * CTypeInfo::Type::kSeqOneByteString. The characters are Latin-1 and not
+ * null-terminated. They are only valid for the duration of the call.
+ */
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 struct AnyCType {
   AnyCType() : int64_value(0) {}
 
@@ -435,6 +448,7 @@ struct AnyCType {
     const FastApiTypedArray<uint64_t>* uint64_ta_value;
     const FastApiTypedArray<float>* float_ta_value;
     const FastApiTypedArray<double>* double_ta_value;
+    const FastOneByteString* string_value;
     FastApiCallbackOptions* options_value;
   };
 };
@@ -693,6 +707,18 @@ TYPED_ARRAY_C_TYPES(SPECIALIZE_GET_TYPE_INFO_HELPER_FOR_TA)
 
 #undef TYPED_ARRAY_C_TYPES
 
+template <>
+struct TypeInfoHelper<const FastOneByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqOneByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
 template <>
 struct TypeInfoHelper<v8::Local<v8::Array>> {
   static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
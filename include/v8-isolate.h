@@ -152,6 +152,19 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * The maximum amount of memory that flushable bytecode and baseline code
+   * should use. When it is exceeded, code of the least recently executed
+   * functions is flushed before it would otherwise be considered old. 0 means
+   * that there is no budget and code is only flushed by age.
+   */
+  size_t code_flushing_budget_in_bytes() const {
+    return code_flushing_budget_;
+  }
+  void set_code_flushing_budget_in_bytes(size_t budget) {
+    code_flushing_budget_ = budget;
+  }
+
  private:
   static constexpr size_t kMB = 1048576u;
   size_t code_range_size_ = 0;
@@ -159,6 +172,7 @@ class V8_EXPORT ResourceConstraints {
   size_t max_young_generation_size_ = 0;
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
+  size_t code_flushing_budget_ = 0;
   uint32_t* stack_limit_ = nullptr;
 };
 
@@ -791,6 +805,86 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Enables in-memory sampling of inline cache state transitions, which
+   * is cheap enough for production use: every {sample_interval}th
+   * transition is recorded per site. Discards the samples recorded so far.
+   * A {sample_interval} of 0 disables sampling.
+   */
+  void SetICTransitionSampleInterval(int sample_interval);
+
+  /**
+   * Returns the inline cache transitions sampled so far, sorted by the number
+   * of megamorphic and then polymorphic transitions, so that megamorphic
+   * sites come first. May need to reparse functions to compute source
+   * positions.
+   */
+  void GetICTransitionStatistics(
+      std::vector<ICTransitionStatistics>* statistics);
+
+  /**
+   * Returns statistics about the maps of all live JavaScript objects, grouped
+   * by constructor and sorted by the number of maps, so that constructors
+   * whose objects come in the most shapes come first. Walks the whole heap.
+   */
+  void GetMapStatistics(std::vector<MapStatistics>* statistics);
+
+  /**
+   * Enables or disables runtime call stats for all isolates in the process
+   * without requiring tracing or the --runtime-call-stats flag. Collection
+   * adds a timer to every runtime function, C++ builtin and API call, which
+   * is cheap enough to turn on for a while in production. Has no effect if
+   * V8 was built without runtime call stats.
+   */
+  static void SetRuntimeCallStatsEnabled(bool enabled);
+
+  /**
+   * Returns the runtime call stats gathered so far on this isolate and its
+   * background threads, sorted by time so that the most expensive counters
+   * come first. Counters that were never entered are omitted. Returns false
+   * if V8 was built without runtime call stats.
+   */
+  bool GetRuntimeCallStatistics(std::vector<RuntimeCallStatistics>* statistics);
+
+  /**
+   * Sets the number of receiver maps an inline cache site keeps track of
+   * before it goes megamorphic. The default is given by the
+   * --max-valid-polymorphic-map-count flag. Raising it keeps sites that see
+   * many object shapes, such as accesses to embedder objects of many
+   * different FunctionTemplates, on a fast path at the cost of a longer
+   * search on each access. Sites that already went megamorphic stay so.
+   */
+  void SetMaxPolymorphicMapCount(int count);
+
+  /**
+   * A function that was optimized by Maglev or TurboFan. Functions are
+   * identified across processes by a hash of the source of their script and
+   * their start position, i.e. the position of their parameter list.
+   */
+  struct TieringHint {
+    uint32_t script_hash;
+    int function_position;
+    bool reached_maglev;
+    bool reached_turbofan;
+  };
+
+  /**
+   * Returns the functions of all live scripts that were optimized in this
+   * isolate, e.g. to store them when the process shuts down.
+   */
+  void GetTieringHints(std::vector<TieringHint>* hints);
+
+  /**
+   * Makes the functions described by {hints}, e.g. the result of
+   * GetTieringHints() in a previous run of the same scripts, tier up as soon
+   * as they have collected some feedback, instead of waiting until the
+   * heuristics find them hot again. TurboFan compiles them in the background
+   * as usual. Hints only apply to functions that have not run long enough to
+   * allocate feedback yet, so this should be called before running the
+   * scripts. Replaces previously set hints.
+   */
+  void SetTieringHints(const std::vector<TieringHint>& hints);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -1680,6 +1774,41 @@ class V8_EXPORT Isolate {
   void ReportExternalAllocationLimitReached();
 };
 
+/**
+ * Keeps isolates, each with one context, ready for use, so that creating them
+ * from the snapshot does not add to the latency of the code that needs them.
+ * The pool creates its isolates on worker threads of the current platform and
+ * replaces each isolate that is taken out of it.
+ *
+ * Isolates handed out by the pool were created on another thread, so they must
+ * be used with a v8::Locker, which also sets them up for the current thread.
+ * Taken isolates belong to the caller and are disposed by it.
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  /**
+   * Creates a pool of {size} isolates created with {params}. Everything that
+   * {params} points to, e.g. the array buffer allocator, must outlive the
+   * pool and the isolates taken out of it.
+   */
+  IsolatePool(const Isolate::CreateParams& params, size_t size);
+  /** Waits for pending isolate creation and disposes the pooled isolates. */
+  ~IsolatePool();
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  /**
+   * Returns an isolate and sets {context} to its context. If the pool is
+   * empty, creates a new one on the calling thread. {context} must be reset
+   * before the isolate is disposed.
+   */
+  Isolate* Take(Global<Context>* context);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 void Isolate::SetData(uint32_t slot, void* data) {
   using I = internal::Internals;
   I::SetEmbedderData(this, slot, data);
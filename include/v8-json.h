@@ -5,6 +5,10 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -14,6 +18,10 @@ class Context;
 class Value;
 class String;
 
+namespace internal {
+class JsonChunkedSource;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -40,6 +48,38 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Parses UTF-8 encoded JSON text that arrives in chunks, for example from
+   * the network, without the embedder having to assemble the whole text
+   * first.
+   *
+   * Append() does not access the isolate and may be called on any thread,
+   * so receiving the input overlaps with the preparation for parsing it.
+   * Finish() must be called on the isolate's thread.
+   */
+  class V8_EXPORT StreamingParser final {
+   public:
+    StreamingParser();
+    ~StreamingParser();
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Appends the next |length| bytes of the input. Chunks may split UTF-8
+     * sequences.
+     */
+    void Append(const char* data, size_t length);
+
+    /**
+     * Parses the input appended so far, like Parse(), and returns the
+     * resulting value. Afterwards the parser is empty and can be reused.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    std::unique_ptr<internal::JsonChunkedSource> source_;
+  };
 };
 
 }  // namespace v8
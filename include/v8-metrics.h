@@ -236,6 +236,44 @@ struct V8_EXPORT LongTaskStats {
   int64_t v8_execute_us = 0;
 };
 
+/**
+ * Experimental API exposing the duration distribution of individual GC phases
+ * (GCTracer scopes such as marking, evacuation, pointer updating or sweeping)
+ * on the main thread and on background threads. Durations are only recorded
+ * with --gc-scope-histograms. The Get() method returns the histograms
+ * accumulated since the isolate was created; embedders that sample it
+ * periodically compute the difference between two samples.
+ *
+ * This API is experimental and may be removed/changed in the future.
+ */
+struct V8_EXPORT GarbageCollectionScopeHistograms {
+  static constexpr size_t kNumberOfBuckets = 24;
+
+  struct Histogram {
+    // Name of the scope as used in traces, e.g. "V8.GC_MC_MARK".
+    const char* name = nullptr;
+    int64_t count = 0;
+    int64_t total_duration_us = 0;
+    // Bucket 0 counts durations below 1us, bucket i > 0 counts durations in
+    // [2^(i-1), 2^i) us. The last bucket also holds all longer durations.
+    int64_t buckets[kNumberOfBuckets] = {};
+  };
+
+  /**
+   * Returns the exclusive upper bound in microseconds of the given bucket.
+   */
+  V8_INLINE static int64_t BucketUpperBoundUs(size_t bucket) {
+    return int64_t{1} << bucket;
+  }
+
+  /**
+   * Returns the histograms of all scopes that were entered at least once.
+   */
+  static GarbageCollectionScopeHistograms Get(Isolate* isolate);
+
+  std::vector<Histogram> histograms;
+};
+
 }  // namespace metrics
 }  // namespace v8
 
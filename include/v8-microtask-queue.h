@@ -15,6 +15,7 @@
 
 namespace v8 {
 
+class Context;
 class Function;
 
 namespace internal {
@@ -22,6 +23,15 @@ class Isolate;
 class MicrotaskQueue;
 }  // namespace internal
 
+/**
+ * Called at the end of a microtask checkpoint for each context that ran
+ * microtasks in it, with the number of microtasks and the wall time spent
+ * running them, see MicrotaskQueue::SetMicrotasksContextAccountingCallback().
+ */
+using MicrotasksContextAccountingCallback =
+    void (*)(Isolate* isolate, Local<Context> context, size_t microtask_count,
+             double run_time_ms, void* data);
+
 /**
  * Represents the microtask queue, where microtasks are stored and processed.
  * https://html.spec.whatwg.org/multipage/webappapis.html#microtask-queue
@@ -81,6 +91,20 @@ class V8_EXPORT MicrotaskQueue {
   virtual void RemoveMicrotasksCompletedCallback(
       MicrotasksCompletedCallbackWithData callback, void* data = nullptr) = 0;
 
+  /**
+   * Sets a callback that accounts the microtasks of each checkpoint to the
+   * contexts they ran in, so that an embedder running several tenants on one
+   * queue can tell which of them occupies the checkpoints, or nullptr to
+   * stop accounting. The callback is called before the microtasks completed
+   * callbacks and must not run scripts. Microtasks enqueued as a
+   * MicrotaskCallback are not accounted to any context.
+   *
+   * Accounting reads the clock whenever consecutive microtasks switch
+   * between contexts, it is disabled by default.
+   */
+  virtual void SetMicrotasksContextAccountingCallback(
+      MicrotasksContextAccountingCallback callback, void* data = nullptr) = 0;
+
   /**
    * Runs microtasks if no microtask is running on this MicrotaskQueue instance.
    */
@@ -420,6 +420,17 @@ class V8_EXPORT Object : public Value {
       Local<Context> context, PropertyFilter filter,
       KeyConversionMode key_conversion = KeyConversionMode::kKeepNumbers);
 
+  /**
+   * Reads the own properties named by |keys| into |values|, which must have
+   * room for |length| entries. Properties that are not present read as
+   * undefined, and accessors and interceptors are invoked as for Get().
+   * Compared to calling Get() once per key, the VM is entered only once for
+   * the whole batch.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> GetOwnPropertyValues(
+      Local<Context> context, const Local<Name>* keys, Local<Value>* values,
+      size_t length);
+
   /**
    * Get the prototype object.  This does not skip objects marked to
    * be skipped by __proto__ and it does not consult the security
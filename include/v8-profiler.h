@@ -284,6 +284,20 @@ class V8_EXPORT DiscardedSamplesDelegate {
   virtual void Notify() = 0;
 };
 
+/**
+ * A sample taken out of a running profile, see CpuProfiler::TakeSamples.
+ */
+struct CpuProfileSample {
+  /** The profile node of the sample's top frame. */
+  const CpuProfileNode* node;
+  /** Timestamp in microseconds, see CpuProfile::GetSampleTimestamp. */
+  int64_t timestamp;
+  /** State of the vm when the sample was captured. */
+  StateTag state;
+  /** State of the embedder when the sample was captured. */
+  EmbedderStateTag embedder_state;
+};
+
 /**
  * Optional profiling attributes.
  */
@@ -408,6 +422,20 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Moves the samples recorded so far by the running profile with the given
+   * title to |samples|, without stopping the profile. If the title given is
+   * empty, uses the last profile started. Returns false if no such profile is
+   * running.
+   *
+   * The nodes of the samples stay valid until the profile is deleted, and new
+   * nodes can be found by their ids. Calling this periodically allows exporting
+   * a profile incrementally while the memory for its samples stays bounded.
+   * Taken samples no longer count towards the profile's |max_samples|, and
+   * are not part of the profile returned by StopProfiling.
+   */
+  bool TakeSamples(Local<String> title, std::vector<CpuProfileSample>* samples);
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -38,8 +39,13 @@ enum class MeasureMemoryMode { kSummary, kDetailed };
  * happen after a while and is forced after some timeout.
  * The kEager mode starts incremental GC right away and is useful for testing.
  * The kLazy mode does not force GC.
+ * The kCached mode does not force GC either. It reports the sizes computed
+ * by the most recent full GC if all requested contexts have been measured
+ * before, and otherwise waits for the next GC like kLazy. Contexts requested
+ * with kCached keep being measured by every full GC, so frequent requests
+ * get up-to-date estimates without causing additional GCs.
  */
-enum class MeasureMemoryExecution { kDefault, kEager, kLazy };
+enum class MeasureMemoryExecution { kDefault, kEager, kLazy, kCached };
 
 /**
  * The delegate is used in Isolate::MeasureMemory API.
@@ -212,6 +218,103 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Sampled inline cache state transitions of one property access, call or
+ * other site with feedback, see Isolate::SetICTransitionSampleInterval().
+ */
+class V8_EXPORT ICTransitionStatistics {
+ public:
+  ICTransitionStatistics();
+  /** The id of the script that contains the site. */
+  int script_id() const { return script_id_; }
+  /**
+   * The offset of the site in the script source, or -1 if it could not be
+   * determined.
+   */
+  int position() const { return position_; }
+  /** The debug name of the function that contains the site. */
+  const std::string& function_name() const { return function_name_; }
+  /** The kind of inline cache, e.g. "LoadIC" or "KeyedStoreIC". */
+  const std::string& ic_type() const { return ic_type_; }
+  /** The most recently sampled state, e.g. "POLYMORPHIC". */
+  const char* state() const { return state_; }
+  /** The sampled number of transitions into each state. */
+  size_t monomorphic_transitions() const { return monomorphic_transitions_; }
+  size_t polymorphic_transitions() const { return polymorphic_transitions_; }
+  size_t megamorphic_transitions() const { return megamorphic_transitions_; }
+
+ private:
+  int script_id_;
+  int position_;
+  std::string function_name_;
+  std::string ic_type_;
+  const char* state_;
+  size_t monomorphic_transitions_;
+  size_t polymorphic_transitions_;
+  size_t megamorphic_transitions_;
+
+  friend class Isolate;
+};
+
+/**
+ * Statistics about the hidden classes (maps) of the objects created by one
+ * constructor, see Isolate::GetMapStatistics().
+ */
+class V8_EXPORT MapStatistics {
+ public:
+  MapStatistics();
+  /**
+   * The debug name of the constructor, or an empty string for objects that
+   * were not created by a JavaScript function, e.g. object literals share the
+   * "Object" constructor and API objects have none.
+   */
+  const std::string& constructor_name() const { return constructor_name_; }
+  /** The number of live maps. */
+  size_t map_count() const { return map_count_; }
+  /** Maps that were replaced by a more general map and wait to be migrated. */
+  size_t deprecated_map_count() const { return deprecated_map_count_; }
+  /** Maps of objects in dictionary mode. */
+  size_t dictionary_map_count() const { return dictionary_map_count_; }
+  /** The size of the maps and of the descriptor arrays they own. */
+  size_t map_and_descriptor_size() const { return map_and_descriptor_size_; }
+
+ private:
+  std::string constructor_name_;
+  size_t map_count_;
+  size_t deprecated_map_count_;
+  size_t dictionary_map_count_;
+  size_t map_and_descriptor_size_;
+
+  friend class Isolate;
+};
+
+/**
+ * Time spent in one runtime call stats counter, see
+ * Isolate::GetRuntimeCallStatistics().
+ */
+class V8_EXPORT RuntimeCallStatistics {
+ public:
+  RuntimeCallStatistics();
+  /**
+   * The name of the counter. Runtime functions, C++ builtins, API functions,
+   * IC handlers and GC phases are prefixed with "Runtime_", "Builtin_",
+   * "API_", "Handler_" and "GC_" respectively; parse and compile phases and
+   * other manually placed counters are not prefixed.
+   */
+  const char* name() const { return name_; }
+  /** The number of times the counter was entered. */
+  int64_t count() const { return count_; }
+  /** The time spent in the counter, excluding nested counters. */
+  int64_t time_in_microseconds() const { return time_in_microseconds_; }
+
+ private:
+  const char* name_;
+  int64_t count_;
+  int64_t time_in_microseconds_;
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
@@ -46,6 +46,14 @@ class V8_EXPORT CompiledWasmModule {
    */
   OwnedBuffer Serialize();
 
+  /**
+   * Serialize the compiled module again after more functions got tiered up,
+   * copying the code that was already serialized in {previous} instead of
+   * serializing it again. {previous} should be the result of an earlier
+   * serialization of this module; the result does not depend on it.
+   */
+  OwnedBuffer Serialize(MemorySpan<const uint8_t> previous);
+
   /**
    * Get the (wasm-encoded) wire bytes that were used to compile this module.
    */
@@ -9,6 +9,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>  // For move
 #include <vector>
 
@@ -30,6 +31,8 @@
 #include "src/api/api-natives.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
@@ -58,14 +61,17 @@
 #include "src/execution/messages.h"
 #include "src/execution/microtask-queue.h"
 #include "src/execution/simulator.h"
+#include "src/execution/tiering-manager.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/embedder-tracing.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-transition-sampler.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
@@ -122,8 +128,10 @@
 #include "src/snapshot/startup-serializer.h"  // For SerializedHandleChecker.
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
+#include "src/tracing/tracing-category-observer.h"
 #include "src/utils/detachable-vector.h"
 #include "src/utils/version.h"
 #include "src/web-snapshot/web-snapshot.h"
@@ -431,6 +439,90 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
 };
 #endif  // V8_SANDBOXED_POINTERS
 
+// Keeps freed backing stores of typical I/O buffer sizes around for reuse, so
+// that ArrayBuffers churned at a high rate do not go through mmap/munmap and
+// fresh page faults for every allocation. Lengths are rounded up to size
+// classes of kSizeClassGranularity bytes. Thread-safe, as backing stores are
+// freed from the concurrent ArrayBufferSweeper.
+class PooledArrayBufferAllocator final : public v8::ArrayBuffer::Allocator {
+ public:
+  PooledArrayBufferAllocator(std::unique_ptr<v8::ArrayBuffer::Allocator> inner,
+                             size_t max_pooled_bytes)
+      : inner_(std::move(inner)), max_pooled_bytes_(max_pooled_bytes) {}
+
+  ~PooledArrayBufferAllocator() override {
+    for (size_t size_class = 0; size_class < kNumSizeClasses; size_class++) {
+      for (void* data : pool_[size_class]) {
+        inner_->Free(data, SizeOfClass(size_class));
+      }
+    }
+  }
+
+  void* Allocate(size_t length) override {
+    if (!IsPooled(length)) return inner_->Allocate(length);
+    if (void* data = TryTake(length)) {
+      memset(data, 0, length);
+      return data;
+    }
+    return inner_->Allocate(SizeOfClass(SizeClass(length)));
+  }
+
+  void* AllocateUninitialized(size_t length) override {
+    if (!IsPooled(length)) return inner_->AllocateUninitialized(length);
+    if (void* data = TryTake(length)) return data;
+    return inner_->AllocateUninitialized(SizeOfClass(SizeClass(length)));
+  }
+
+  void Free(void* data, size_t length) override {
+    if (!IsPooled(length)) return inner_->Free(data, length);
+    const size_t size_class = SizeClass(length);
+    const size_t size = SizeOfClass(size_class);
+    {
+      base::MutexGuard guard(&mutex_);
+      if (pooled_bytes_ + size <= max_pooled_bytes_) {
+        pool_[size_class].push_back(data);
+        pooled_bytes_ += size;
+        return;
+      }
+    }
+    inner_->Free(data, size);
+  }
+
+ private:
+  static constexpr size_t kSizeClassGranularity = 16 * i::KB;
+  static constexpr size_t kMinPooledLength = 64 * i::KB;
+  static constexpr size_t kMaxPooledLength = 1 * i::MB;
+  static constexpr size_t kNumSizeClasses =
+      kMaxPooledLength / kSizeClassGranularity;
+
+  static bool IsPooled(size_t length) {
+    return length >= kMinPooledLength && length <= kMaxPooledLength;
+  }
+  static size_t SizeClass(size_t length) {
+    return (length - 1) / kSizeClassGranularity;
+  }
+  static size_t SizeOfClass(size_t size_class) {
+    return (size_class + 1) * kSizeClassGranularity;
+  }
+
+  void* TryTake(size_t length) {
+    const size_t size_class = SizeClass(length);
+    base::MutexGuard guard(&mutex_);
+    std::vector<void*>& blocks = pool_[size_class];
+    if (blocks.empty()) return nullptr;
+    void* data = blocks.back();
+    blocks.pop_back();
+    pooled_bytes_ -= SizeOfClass(size_class);
+    return data;
+  }
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> inner_;
+  const size_t max_pooled_bytes_;
+  base::Mutex mutex_;
+  size_t pooled_bytes_ = 0;
+  std::vector<void*> pool_[kNumSizeClasses];
+};
+
 struct SnapshotCreatorData {
   explicit SnapshotCreatorData(Isolate* isolate)
       : isolate_(isolate),
@@ -2481,6 +2573,15 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
               no_cache_reason, i::NOT_NATIVES_CODE);
       source->cached_data->rejected = cached_data->rejected();
     }
+  } else if (options == kConsumeCompileHints) {
+    Utils::ApiCheck(source->compile_hint_callback != nullptr,
+                    "v8::ScriptCompiler::Compile",
+                    "kConsumeCompileHints requires a compile hint callback");
+    maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+            isolate, str, script_details, source->compile_hint_callback,
+            source->compile_hint_callback_data, options, no_cache_reason,
+            i::NOT_NATIVES_CODE);
   } else {
     // Compile without any cache.
     maybe_function_info = i::Compiler::GetSharedFunctionInfoForScript(
@@ -3254,6 +3355,31 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+JSON::StreamingParser::StreamingParser()
+    : source_(new i::JsonChunkedSource()) {}
+
+JSON::StreamingParser::~StreamingParser() = default;
+
+void JSON::StreamingParser::Append(const char* data, size_t length) {
+  source_->Append(data, length);
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  i::Handle<i::String> source;
+  has_pending_exception = !source_->Finish(isolate).ToHandle(&source);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  source = i::String::Flatten(isolate, source);
+  i::Handle<i::Object> undefined = isolate->factory()->undefined_value();
+  auto maybe = source->IsOneByteRepresentation()
+                   ? i::JsonParser<uint8_t>::Parse(isolate, source, undefined)
+                   : i::JsonParser<uint16_t>::Parse(isolate, source, undefined);
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -4657,6 +4783,52 @@ MaybeLocal<Array> v8::Object::GetOwnPropertyNames(
                           v8::IndexFilter::kIncludeIndices, key_conversion);
 }
 
+namespace {
+
+// Collects the values into a FixedArray so that only a single handle has to
+// escape the API scope; the caller unpacks it in its own HandleScope.
+MaybeLocal<FixedArray> GetOwnPropertyValuesAsFixedArray(
+    Local<Context> context, i::Handle<i::JSReceiver> self,
+    const Local<Name>* keys, size_t length) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Object, GetOwnPropertyValues,
+           MaybeLocal<FixedArray>(), InternalEscapableScope);
+  i::Handle<i::FixedArray> result =
+      isolate->factory()->NewFixedArray(static_cast<int>(length));
+  for (size_t i = 0; i < length; ++i) {
+    i::HandleScope scope(isolate);
+    i::PropertyKey lookup_key(isolate, Utils::OpenHandle(*keys[i]));
+    i::LookupIterator it(isolate, self, lookup_key, self,
+                         i::LookupIterator::OWN);
+    i::Handle<i::Object> value;
+    has_pending_exception = !i::Object::GetProperty(&it).ToHandle(&value);
+    RETURN_ON_FAILED_EXECUTION(FixedArray);
+    result->set(static_cast<int>(i), *value);
+  }
+  RETURN_ESCAPED(Utils::FixedArrayToLocal(result));
+}
+
+}  // namespace
+
+Maybe<bool> v8::Object::GetOwnPropertyValues(Local<Context> context,
+                                             const Local<Name>* keys,
+                                             Local<Value>* values,
+                                             size_t length) {
+  Local<FixedArray> result;
+  if (!GetOwnPropertyValuesAsFixedArray(context, Utils::OpenHandle(this), keys,
+                                        length)
+           .ToLocal(&result)) {
+    return Nothing<bool>();
+  }
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  i::Handle<i::FixedArray> result_obj = Utils::OpenHandle(*result);
+  for (size_t i = 0; i < length; ++i) {
+    values[i] = Utils::ToLocal(
+        i::handle(result_obj->get(static_cast<int>(i)), isolate));
+  }
+  return Just(true);
+}
+
 MaybeLocal<String> v8::Object::ObjectProtoToString(Local<Context> context) {
   PREPARE_FOR_EXECUTION(context, Object, ObjectProtoToString, String);
   auto self = Utils::OpenHandle(this);
@@ -5565,16 +5737,20 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
     }
     // Write the characters to the stream.
     if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
-        memcpy(current_write, read_start + read_index, copy_length);
-        current_write += copy_length;
-        read_index = up_to;
-      } else {
-        for (; read_index < up_to; read_index++) {
+      // Simply memcpy runs of ASCII characters, which are found a word at a
+      // time, and only encode the word that contains a non-ASCII character.
+      while (read_index < up_to) {
+        int ascii_length = std::min(
+            i::NonAsciiStart(
+                reinterpret_cast<const uint8_t*>(read_start + read_index),
+                up_to - read_index),
+            up_to - read_index);
+        memcpy(current_write, read_start + read_index, ascii_length);
+        current_write += ascii_length;
+        read_index += ascii_length;
+        int encode_up_to =
+            std::min(up_to, read_index + static_cast<int>(i::kIntptrSize));
+        for (; read_index < encode_up_to; read_index++) {
           current_write += unibrow::Utf8::EncodeOneByte(
               current_write, static_cast<uint8_t>(read_start[read_index]));
           DCHECK(write_capacity == -1 ||
@@ -5584,6 +5760,13 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
     } else {
       for (; read_index < up_to; read_index++) {
         uint16_t character = read_start[read_index];
+        if (character <= unibrow::Utf8::kMaxOneByteChar) {
+          // ASCII characters encode as themselves whatever the previous
+          // character was.
+          *current_write++ = static_cast<char>(character);
+          prev_char = character;
+          continue;
+        }
         current_write += unibrow::Utf8::Encode(current_write, character,
                                                prev_char, replace_invalid_utf8);
         prev_char = character;
@@ -6153,6 +6336,23 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+ICTransitionStatistics::ICTransitionStatistics()
+    : script_id_(0),
+      position_(-1),
+      state_(""),
+      monomorphic_transitions_(0),
+      polymorphic_transitions_(0),
+      megamorphic_transitions_(0) {}
+
+MapStatistics::MapStatistics()
+    : map_count_(0),
+      deprecated_map_count_(0),
+      dictionary_map_count_(0),
+      map_and_descriptor_size_(0) {}
+
+RuntimeCallStatistics::RuntimeCallStatistics()
+    : name_(""), count_(0), time_in_microseconds_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -6602,6 +6802,12 @@ metrics::LongTaskStats metrics::LongTaskStats::Get(v8::Isolate* isolate) {
   return *i_isolate->GetCurrentLongTaskStats();
 }
 
+metrics::GarbageCollectionScopeHistograms
+metrics::GarbageCollectionScopeHistograms::Get(v8::Isolate* isolate) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  return i_isolate->heap()->tracer()->GetScopeDurationHistograms();
+}
+
 namespace {
 i::Address* GetSerializedDataFromFixedArray(i::Isolate* isolate,
                                             i::FixedArray list, size_t index) {
@@ -7336,6 +7542,58 @@ Local<v8::Array> v8::Array::New(Isolate* isolate, Local<Value>* elements,
       factory->NewJSArrayWithElements(result, i::PACKED_ELEMENTS, len));
 }
 
+namespace {
+
+template <typename T>
+i::Handle<i::JSArray> NewDoubleJSArray(i::Isolate* isolate, const T* elements,
+                                       int length) {
+  i::Factory* factory = isolate->factory();
+  i::Handle<i::FixedArrayBase> result = factory->NewFixedDoubleArray(length);
+  if (length > 0) {
+    // Use set() rather than a memcpy so that NaNs are canonicalized and
+    // cannot be mistaken for the hole.
+    i::FixedDoubleArray doubles = i::FixedDoubleArray::cast(*result);
+    for (int i = 0; i < length; i++) {
+      doubles.set(i, static_cast<double>(elements[i]));
+    }
+  }
+  return factory->NewJSArrayWithElements(result, i::PACKED_DOUBLE_ELEMENTS,
+                                         length);
+}
+
+}  // namespace
+
+Local<v8::Array> v8::Array::New(Isolate* isolate, const double* elements,
+                                size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, Array, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  return Utils::ToLocal(
+      NewDoubleJSArray(i_isolate, elements, static_cast<int>(length)));
+}
+
+Local<v8::Array> v8::Array::New(Isolate* isolate, const int32_t* elements,
+                                size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Factory* factory = i_isolate->factory();
+  LOG_API(i_isolate, Array, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  int len = static_cast<int>(length);
+
+  // With 31-bit Smis not every int32_t value fits; fall back to doubles.
+  for (int i = 0; i < len; i++) {
+    if (!i::Smi::IsValid(elements[i])) {
+      return Utils::ToLocal(NewDoubleJSArray(i_isolate, elements, len));
+    }
+  }
+  i::Handle<i::FixedArray> result = factory->NewFixedArray(len);
+  for (int i = 0; i < len; i++) {
+    result->set(i, i::Smi::FromInt(elements[i]));
+  }
+  return Utils::ToLocal(
+      factory->NewJSArrayWithElements(result, i::PACKED_SMI_ELEMENTS, len));
+}
+
 uint32_t v8::Array::Length() const {
   i::Handle<i::JSArray> obj = Utils::OpenHandle(this);
   i::Object length = obj->length();
@@ -7761,9 +8019,14 @@ CompiledWasmModule::CompiledWasmModule(
 }
 
 OwnedBuffer CompiledWasmModule::Serialize() {
+  return Serialize({nullptr, 0});
+}
+
+OwnedBuffer CompiledWasmModule::Serialize(MemorySpan<const uint8_t> previous) {
 #if V8_ENABLE_WEBASSEMBLY
   TRACE_EVENT0("v8.wasm", "wasm.SerializeModule");
-  i::wasm::WasmSerializer wasm_serializer(native_module_.get());
+  i::wasm::WasmSerializer wasm_serializer(
+      native_module_.get(), {previous.data(), previous.size()});
   size_t buffer_size = wasm_serializer.GetSerializedNativeModuleSize();
   std::unique_ptr<uint8_t[]> buffer(new uint8_t[buffer_size]);
   if (!wasm_serializer.SerializeNativeModule({buffer.get(), buffer_size}))
@@ -7885,6 +8148,11 @@ void* v8::ArrayBuffer::Allocator::Reallocate(void* data, size_t old_length,
 
 // static
 v8::ArrayBuffer::Allocator* v8::ArrayBuffer::Allocator::NewDefaultAllocator() {
+  if (i::FLAG_array_buffer_pool_size > 0) {
+    return new PooledArrayBufferAllocator(
+        std::make_unique<ArrayBufferAllocator>(),
+        i::FLAG_array_buffer_pool_size * i::MB);
+  }
   return new ArrayBufferAllocator();
 }
 
@@ -8686,6 +8954,99 @@ void Isolate::Dispose() {
   i::Isolate::Delete(isolate);
 }
 
+class IsolatePool::Impl {
+ public:
+  Impl(const Isolate::CreateParams& params, size_t size)
+      : params_(params), size_(size) {
+    base::MutexGuard guard(&mutex_);
+    ScheduleRefills();
+  }
+
+  ~Impl() {
+    base::MutexGuard guard(&mutex_);
+    while (pending_ > 0) pending_done_.Wait(&mutex_);
+    for (Entry& entry : entries_) {
+      {
+        Locker locker(entry.isolate);
+        entry.context.Reset();
+      }
+      entry.isolate->Dispose();
+    }
+  }
+
+  Isolate* Take(Global<Context>* context) {
+    Entry entry;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (!entries_.empty()) {
+        entry = std::move(entries_.back());
+        entries_.pop_back();
+      }
+      ScheduleRefills();
+    }
+    if (entry.isolate == nullptr) entry = CreateEntry();
+    *context = std::move(entry.context);
+    return entry.isolate;
+  }
+
+ private:
+  struct Entry {
+    Isolate* isolate = nullptr;
+    Global<Context> context;
+  };
+
+  class CreateTask : public Task {
+   public:
+    explicit CreateTask(Impl* pool) : pool_(pool) {}
+    void Run() override { pool_->AddEntry(pool_->CreateEntry()); }
+
+   private:
+    Impl* const pool_;
+  };
+
+  Entry CreateEntry() {
+    Entry entry;
+    entry.isolate = Isolate::New(params_);
+    Locker locker(entry.isolate);
+    Isolate::Scope isolate_scope(entry.isolate);
+    HandleScope handle_scope(entry.isolate);
+    entry.context.Reset(entry.isolate, Context::New(entry.isolate));
+    return entry;
+  }
+
+  void AddEntry(Entry entry) {
+    base::MutexGuard guard(&mutex_);
+    entries_.push_back(std::move(entry));
+    pending_--;
+    pending_done_.NotifyAll();
+  }
+
+  // Requires {mutex_}.
+  void ScheduleRefills() {
+    while (entries_.size() + pending_ < size_) {
+      pending_++;
+      i::V8::GetCurrentPlatform()->CallOnWorkerThread(
+          std::make_unique<CreateTask>(this));
+    }
+  }
+
+  const Isolate::CreateParams params_;
+  const size_t size_;
+  base::Mutex mutex_;
+  base::ConditionVariable pending_done_;
+  std::vector<Entry> entries_;
+  size_t pending_ = 0;
+};
+
+IsolatePool::IsolatePool(const Isolate::CreateParams& params, size_t size)
+    : impl_(std::make_unique<Impl>(params, size)) {}
+
+IsolatePool::~IsolatePool() = default;
+
+Isolate* IsolatePool::Take(Global<Context>* context) {
+  return impl_->Take(context);
+}
+
 void Isolate::DumpAndResetStats() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->DumpAndResetStats();
@@ -8945,7 +9306,10 @@ size_t Isolate::NumberOfTrackedHeapObjectTypes() {
 bool Isolate::GetHeapObjectStatisticsAtLastGC(
     HeapObjectStatistics* object_statistics, size_t type_index) {
   if (!object_statistics) return false;
-  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled())) return false;
+  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled() &&
+                i::FLAG_sample_gc_object_stats <= 0)) {
+    return false;
+  }
 
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = isolate->heap();
@@ -8988,6 +9352,152 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+void Isolate::SetICTransitionSampleInterval(int sample_interval) {
+  Utils::ApiCheck(sample_interval >= 0,
+                  "v8::Isolate::SetICTransitionSampleInterval",
+                  "Sample interval must not be negative");
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->SetICTransitionSampleInterval(sample_interval);
+}
+
+void Isolate::GetICTransitionStatistics(
+    std::vector<ICTransitionStatistics>* statistics) {
+  statistics->clear();
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::ICTransitionSampler* sampler = isolate->ic_transition_sampler();
+  if (sampler == nullptr) return;
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::HandleScope scope(isolate);
+  for (const i::ICTransitionSampler::SlotRecord* record :
+       sampler->GetRecords()) {
+    ICTransitionStatistics entry;
+    entry.script_id_ = record->script_id;
+    entry.position_ = record->position;
+    entry.function_name_ = record->function_name;
+    entry.ic_type_ = record->ic_type;
+    entry.state_ = i::InlineCacheState2String(record->state);
+    entry.monomorphic_transitions_ = record->monomorphic_count;
+    entry.polymorphic_transitions_ = record->polymorphic_count;
+    entry.megamorphic_transitions_ = record->megamorphic_count;
+    statistics->push_back(std::move(entry));
+  }
+}
+
+void Isolate::GetMapStatistics(std::vector<MapStatistics>* statistics) {
+  statistics->clear();
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  std::unordered_map<i::Address, size_t> index_by_constructor;
+  {
+    i::HeapObjectIterator iterator(isolate->heap());
+    for (i::HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!obj.IsMap()) continue;
+      i::Map map = i::Map::cast(obj);
+      if (!map.IsJSObjectMap()) continue;
+      i::Object constructor = map.GetConstructor();
+      auto it = index_by_constructor.find(constructor.ptr());
+      if (it == index_by_constructor.end()) {
+        MapStatistics entry;
+        if (constructor.IsJSFunction()) {
+          entry.constructor_name_ =
+              i::JSFunction::cast(constructor).shared().DebugNameCStr().get();
+        }
+        statistics->push_back(std::move(entry));
+        it = index_by_constructor
+                 .emplace(constructor.ptr(), statistics->size() - 1)
+                 .first;
+      }
+      MapStatistics& entry = (*statistics)[it->second];
+      entry.map_count_++;
+      if (map.is_deprecated()) entry.deprecated_map_count_++;
+      if (map.is_dictionary_map()) entry.dictionary_map_count_++;
+      entry.map_and_descriptor_size_ += map.Size();
+      if (map.owns_descriptors()) {
+        entry.map_and_descriptor_size_ += map.instance_descriptors().Size();
+      }
+    }
+  }
+  std::stable_sort(statistics->begin(), statistics->end(),
+                   [](const MapStatistics& a, const MapStatistics& b) {
+                     return a.map_count() > b.map_count();
+                   });
+}
+
+// static
+void Isolate::SetRuntimeCallStatsEnabled(bool enabled) {
+#ifdef V8_RUNTIME_CALL_STATS
+  if (enabled) {
+    i::TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_API,
+        std::memory_order_relaxed);
+  } else {
+    i::TracingFlags::runtime_stats.fetch_and(
+        ~v8::tracing::TracingCategoryObserver::ENABLED_BY_API,
+        std::memory_order_relaxed);
+  }
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
+bool Isolate::GetRuntimeCallStatistics(
+    std::vector<RuntimeCallStatistics>* statistics) {
+  statistics->clear();
+#ifdef V8_RUNTIME_CALL_STATS
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::RuntimeCallStats* stats = isolate->counters()->runtime_call_stats();
+  // Fold in what background threads recorded since the last call.
+  isolate->counters()->worker_thread_runtime_call_stats()->AddToMainTable(
+      stats);
+  if (stats->current_timer() != nullptr) stats->current_timer()->Snapshot();
+  for (int i = 0; i < i::RuntimeCallStats::kNumberOfCounters; i++) {
+    i::RuntimeCallCounter* counter = stats->GetCounter(i);
+    if (counter->count() == 0) continue;
+    RuntimeCallStatistics entry;
+    entry.name_ = counter->name();
+    entry.count_ = counter->count();
+    entry.time_in_microseconds_ = counter->time().InMicroseconds();
+    statistics->push_back(entry);
+  }
+  std::sort(statistics->begin(), statistics->end(),
+            [](const RuntimeCallStatistics& a, const RuntimeCallStatistics& b) {
+              return a.time_in_microseconds_ > b.time_in_microseconds_;
+            });
+  return true;
+#else
+  return false;
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
+void Isolate::SetMaxPolymorphicMapCount(int count) {
+  Utils::ApiCheck(count > 0, "v8::Isolate::SetMaxPolymorphicMapCount",
+                  "Map count must be positive");
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_max_valid_polymorphic_map_count(count);
+}
+
+void Isolate::GetTieringHints(std::vector<TieringHint>* hints) {
+  hints->clear();
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::HandleScope scope(isolate);
+  for (const i::TieringManager::TieringHint& hint :
+       isolate->tiering_manager()->GetTieringHints()) {
+    hints->push_back({hint.script_hash, hint.function_position, hint.maglev,
+                      hint.turbofan});
+  }
+}
+
+void Isolate::SetTieringHints(const std::vector<TieringHint>& hints) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  std::vector<i::TieringManager::TieringHint> internal_hints;
+  internal_hints.reserve(hints.size());
+  for (const TieringHint& hint : hints) {
+    internal_hints.push_back({hint.script_hash, hint.function_position,
+                              hint.reached_maglev, hint.reached_turbofan});
+  }
+  isolate->tiering_manager()->SetTieringHints(internal_hints);
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -9193,6 +9703,9 @@ void Isolate::LowMemoryNotification() {
     isolate->heap()->CollectAllAvailableGarbage(
         i::GarbageCollectionReason::kLowMemoryNotification);
   }
+#ifdef V8_INTL_SUPPORT
+  isolate->clear_cached_icu_objects();
+#endif  // V8_INTL_SUPPORT
 }
 
 int Isolate::ContextDisposedNotification(bool dependant_context) {
@@ -9941,6 +10454,23 @@ CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
           *Utils::OpenHandle(*title)));
 }
 
+bool CpuProfiler::TakeSamples(Local<String> title,
+                              std::vector<CpuProfileSample>* samples) {
+  std::deque<i::CpuProfile::SampleInfo> taken;
+  if (!reinterpret_cast<i::CpuProfiler*>(this)->TakeSamples(
+          *Utils::OpenHandle(*title), &taken)) {
+    return false;
+  }
+  samples->reserve(samples->size() + taken.size());
+  for (const i::CpuProfile::SampleInfo& sample : taken) {
+    samples->push_back(
+        {reinterpret_cast<const CpuProfileNode*>(sample.node),
+         sample.timestamp.since_origin().InMicroseconds(), sample.state_tag,
+         sample.embedder_state_tag});
+  }
+  return true;
+}
+
 void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* isolate) {
   reinterpret_cast<i::Isolate*>(isolate)
       ->SetDetailedSourcePositionsForProfiling(true);
@@ -35,6 +35,7 @@
 #include "src/heap/local-factory-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/objects.h"
+#include "src/objects/string-table.h"
 #include "src/objects/string.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
@@ -81,6 +82,26 @@ template EXPORT_TEMPLATE_DEFINE(
 template EXPORT_TEMPLATE_DEFINE(
     V8_EXPORT_PRIVATE) void AstRawString::Internalize(LocalIsolate* isolate);
 
+template <typename IsolateT>
+bool AstRawString::TryInternalizeExisting(IsolateT* isolate) {
+  DCHECK(!has_string_);
+  MaybeHandle<String> existing;
+  if (literal_bytes_.length() == 0) {
+    existing = isolate->factory()->empty_string();
+  } else if (is_one_byte()) {
+    OneByteStringKey key(raw_hash_field_, literal_bytes_);
+    existing = isolate->string_table()->TryLookupKey(isolate, &key);
+  } else {
+    TwoByteStringKey key(raw_hash_field_,
+                         base::Vector<const uint16_t>::cast(literal_bytes_));
+    existing = isolate->string_table()->TryLookupKey(isolate, &key);
+  }
+  Handle<String> string;
+  if (!existing.ToHandle(&string)) return false;
+  set_string(string);
+  return true;
+}
+
 bool AstRawString::AsArrayIndex(uint32_t* index) const {
   // The StringHasher will set up the hash. Bail out early if we know it
   // can't be convertible to an array index.
@@ -371,7 +392,28 @@ template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
   // Strings need to be internalized before values, because values refer to
   // strings.
+  //
+  // Many of the strings usually exist in the string table already. Resolve
+  // those first with lock-free lookups, and collect the rest so that string
+  // table space for all of them can be reserved with a single resize.
+  AstRawString* missing = nullptr;
+  AstRawString** missing_end = &missing;
+  int missing_count = 0;
   for (AstRawString* current = strings_; current != nullptr;) {
+    AstRawString* next = current->next();
+    if (!current->TryInternalizeExisting(isolate)) {
+      *missing_end = current;
+      missing_end = current->next_location();
+      missing_count++;
+    }
+    current = next;
+  }
+  *missing_end = nullptr;
+
+  if (missing_count >= kMinStringsForReservation) {
+    isolate->string_table()->ReserveForInsertions(isolate, missing_count);
+  }
+  for (AstRawString* current = missing; current != nullptr;) {
     AstRawString* next = current->next();
     current->Internalize(isolate);
     current = next;
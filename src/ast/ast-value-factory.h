@@ -111,6 +111,11 @@ class AstRawString final : public ZoneObject {
     return &next_;
   }
 
+  // Sets the string if an internalized copy already exists, without adding
+  // one to the string table. Returns whether it did.
+  template <typename IsolateT>
+  bool TryInternalizeExisting(IsolateT* isolate);
+
   void set_string(Handle<String> string) {
     DCHECK(!string.is_null());
     DCHECK(!has_string_);
@@ -399,6 +404,10 @@ class AstValueFactory {
   AstRawStringMap string_table_;
 
   AstRawString* strings_;
+  // Minimum number of new strings for which Internalize reserves string table
+  // space up front.
+  static constexpr int kMinStringsForReservation = 64;
+
   AstRawString** strings_end_;
 
   // Holds constant string values which are shared across the isolate.
@@ -4,6 +4,7 @@
 
 #include "src/ast/scopes.h"
 
+#include <algorithm>
 #include <set>
 
 #include "src/ast/ast.h"
@@ -183,6 +184,50 @@ ModuleScope::ModuleScope(Handle<ScopeInfo> scope_info,
   set_language_mode(LanguageMode::kStrict);
 }
 
+int ModuleScope::LookupModuleVariable(String name, VariableMode* mode,
+                                      InitializationFlag* init_flag,
+                                      MaybeAssignedFlag* maybe_assigned_flag) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(name.IsInternalizedString());
+  ScopeInfo info = *scope_info();
+  int count = info.ModuleVariableCount();
+  if (count < kModuleVariableTableThreshold) {
+    return info.ModuleIndex(name, mode, init_flag, maybe_assigned_flag);
+  }
+
+  if (module_variable_table_ == nullptr) {
+    module_variable_table_ = zone()->NewArray<ModuleVariableHash>(count);
+    for (int i = 0; i < count; ++i) {
+      String var_name;
+      info.ModuleVariable(i, &var_name, nullptr);
+      module_variable_table_[i] = {var_name.hash(), i};
+    }
+    std::sort(module_variable_table_, module_variable_table_ + count,
+              [](const ModuleVariableHash& a, const ModuleVariableHash& b) {
+                return a.hash < b.hash;
+              });
+  }
+
+  uint32_t hash = name.hash();
+  ModuleVariableHash* end = module_variable_table_ + count;
+  ModuleVariableHash* it = std::lower_bound(
+      module_variable_table_, end, hash,
+      [](const ModuleVariableHash& entry, uint32_t hash) {
+        return entry.hash < hash;
+      });
+  for (; it != end && it->hash == hash; ++it) {
+    String var_name;
+    info.ModuleVariable(it->index, &var_name, nullptr);
+    // Both names are internalized, so identity is equality.
+    if (var_name != name) continue;
+    int index;
+    info.ModuleVariable(it->index, nullptr, &index, mode, init_flag,
+                              maybe_assigned_flag);
+    return index;
+  }
+  return 0;
+}
+
 ClassScope::ClassScope(Zone* zone, Scope* outer_scope, bool is_anonymous)
     : Scope(zone, outer_scope, CLASS_SCOPE),
       rare_data_and_is_parsing_heritage_(nullptr),
@@ -970,9 +1015,9 @@ Variable* Scope::LookupInScopeInfo(const AstRawString* name, Scope* cache) {
 
   if (!found && is_module_scope()) {
     location = VariableLocation::MODULE;
-    index = scope_info.ModuleIndex(name_handle, &lookup_result.mode,
-                                   &lookup_result.init_flag,
-                                   &lookup_result.maybe_assigned_flag);
+    index = AsModuleScope()->LookupModuleVariable(
+        name_handle, &lookup_result.mode, &lookup_result.init_flag,
+        &lookup_result.maybe_assigned_flag);
     found = index != 0;
   }
 
@@ -1406,8 +1406,22 @@ class ModuleScope final : public DeclarationScope {
   // module's export table.
   void AllocateModuleVariables();
 
+  // Deserialized scopes only. Like ScopeInfo::ModuleIndex, but modules with
+  // many module variables are searched through a table sorted by name hash,
+  // built on first use, rather than scanned once per free variable.
+  int LookupModuleVariable(String name, VariableMode* mode,
+                           InitializationFlag* init_flag,
+                           MaybeAssignedFlag* maybe_assigned_flag);
+
  private:
+  struct ModuleVariableHash {
+    uint32_t hash;
+    int index;
+  };
+  static constexpr int kModuleVariableTableThreshold = 16;
+
   SourceTextModuleDescriptor* const module_descriptor_;
+  ModuleVariableHash* module_variable_table_ = nullptr;
 };
 
 class V8_EXPORT_PRIVATE ClassScope : public Scope {
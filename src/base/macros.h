@@ -257,6 +257,14 @@ struct Use {
 // have defined behavior.
 #define ITERATE_PACK(...) USE(0, ((__VA_ARGS__), 0)...)
 
+// Hints the CPU to bring the cache line holding |address| into the cache
+// ahead of reading from it.
+#if defined(__GNUC__) || defined(__clang__)
+#define V8_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define V8_PREFETCH(address) USE(address)
+#endif
+
 }  // namespace base
 }  // namespace v8
 
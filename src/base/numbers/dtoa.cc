@@ -11,14 +11,13 @@
 #include "src/base/numbers/double.h"
 #include "src/base/numbers/fast-dtoa.h"
 #include "src/base/numbers/fixed-dtoa.h"
+#include "src/base/numbers/ryu-dtoa.h"
 
 namespace v8 {
 namespace base {
 
 static BignumDtoaMode DtoaToBignumDtoaMode(DtoaMode dtoa_mode) {
   switch (dtoa_mode) {
-    case DTOA_SHORTEST:
-      return BIGNUM_DTOA_SHORTEST;
     case DTOA_FIXED:
       return BIGNUM_DTOA_FIXED;
     case DTOA_PRECISION:
@@ -54,11 +53,15 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
     return;
   }
 
+  if (mode == DTOA_SHORTEST) {
+    // Ryu always finds the shortest representation, without the bignum
+    // fallback that FastDtoa needs for a few percent of inputs.
+    RyuDtoa(v, buffer, length, point);
+    return;
+  }
+
   bool fast_worked;
   switch (mode) {
-    case DTOA_SHORTEST:
-      fast_worked = FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, length, point);
-      break;
     case DTOA_FIXED:
       fast_worked = FastFixedDtoa(v, requested_digits, buffer, length, point);
       break;
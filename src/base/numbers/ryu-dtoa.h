@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_RYU_DTOA_H_
+#define V8_BASE_NUMBERS_RYU_DTOA_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace base {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Provides the shortest decimal representation of v, using the Ryu algorithm
+// (Ulf Adams, "Ryū: fast float-to-string conversion", PLDI 2018). Unlike
+// FastDtoa it never fails, so no bignum fallback is needed.
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// The result satisfies v == (double) (buffer * 10^(point - length)), and the
+// digits in the buffer are the shortest representation possible. If several
+// representations of that length exist, the buffer contains the one closest
+// to v, and ties are broken towards an even last digit. There will be
+// *length digits inside the buffer followed by a null terminator. The buffer
+// must hold at least kRyuDtoaMaximalLength + 1 characters.
+V8_BASE_EXPORT void RyuDtoa(double v, Vector<char> buffer, int* length,
+                            int* decimal_point);
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_RYU_DTOA_H_
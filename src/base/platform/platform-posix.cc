@@ -606,6 +606,53 @@ bool OS::HasLazyCommits() {
 }
 #endif  // !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 
+// static
+bool OS::BindMemoryToCurrentNumaNode(void* address, size_t size) {
+#if V8_OS_LINUX && defined(__NR_mbind) && defined(__NR_getcpu)
+  // Values from <linux/mempolicy.h>, which is not always available.
+  constexpr int kMpolPreferred = 1;
+  constexpr unsigned kMpolMfMove = 1 << 1;
+  constexpr unsigned kMaxNumaNodes = 64;
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) != 0) return false;
+  if (node >= kMaxNumaNodes) return false;
+  uint64_t node_mask = uint64_t{1} << node;
+  // The kernel ignores the last bit of the node mask, hence the +1.
+  return syscall(__NR_mbind, address, size, kMpolPreferred, &node_mask,
+                 kMaxNumaNodes + 1, kMpolMfMove) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  constexpr uintptr_t kTransparentHugePageSize = uintptr_t{1} << 21;
+  const uintptr_t huge_start = RoundUp(reinterpret_cast<uintptr_t>(address),
+                                       kTransparentHugePageSize);
+  const uintptr_t huge_end = RoundDown(
+      reinterpret_cast<uintptr_t>(address) + size, kTransparentHugePageSize);
+  // Bail out in case the aligned addresses do not provide a block of at least
+  // one huge page.
+  if (huge_end <= huge_start) return false;
+  return madvise(reinterpret_cast<void*>(huge_start), huge_end - huge_start,
+                 MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::AdviseMergeable(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_MERGEABLE)
+  return madvise(address, size, MADV_MERGEABLE) == 0;
+#else
+  return false;
+#endif
+}
+
 const char* OS::GetGCFakeMMapFile() {
   return g_gc_fake_mmap;
 }
@@ -1002,6 +1049,7 @@ class Thread::PlatformData {
 Thread::Thread(const Options& options)
     : data_(new PlatformData),
       stack_size_(options.stack_size()),
+      priority_(options.priority()),
       start_semaphore_(nullptr) {
   const int min_stack_size = static_cast<int>(PTHREAD_STACK_MIN);
   if (stack_size_ > 0) stack_size_ = std::max(stack_size_, min_stack_size);
@@ -1040,6 +1088,30 @@ static void SetThreadName(const char* name) {
 }
 
 
+static void SetThreadPriority(Thread::Priority priority) {
+#if V8_OS_LINUX
+  // Threads have their own nice value on Linux. Only lower the priority of
+  // background threads, raising it requires privileges.
+  int nice_value = 0;
+  switch (priority) {
+    case Thread::Priority::kBestEffort:
+      nice_value = 10;
+      break;
+    case Thread::Priority::kUserVisible:
+      nice_value = 1;
+      break;
+    case Thread::Priority::kUserBlocking:
+    case Thread::Priority::kDefault:
+      return;
+  }
+  setpriority(PRIO_PROCESS, 0, nice_value);
+#else
+  // On Darwin the priority is set as a QoS class when the thread is created,
+  // see Thread::Start().
+  USE(priority);
+#endif  // V8_OS_LINUX
+}
+
 static void* ThreadEntry(void* arg) {
   Thread* thread = reinterpret_cast<Thread*>(arg);
   // We take the lock here to make sure that pthread_create finished first since
@@ -1047,6 +1119,7 @@ static void* ThreadEntry(void* arg) {
   // one).
   { MutexGuard lock_guard(&thread->data()->thread_creation_mutex_); }
   SetThreadName(thread->name());
+  SetThreadPriority(thread->priority());
   DCHECK_NE(thread->data()->thread_, kNoThread);
   thread->NotifyStartedAndRun();
   return nullptr;
@@ -1078,6 +1151,18 @@ bool Thread::Start() {
     result = pthread_attr_setstacksize(&attr, stack_size);
     if (result != 0) return pthread_attr_destroy(&attr), false;
   }
+#if V8_OS_DARWIN
+  if (priority_ != Priority::kDefault) {
+    qos_class_t qos_class = QOS_CLASS_USER_INITIATED;
+    if (priority_ == Priority::kBestEffort) {
+      qos_class = QOS_CLASS_BACKGROUND;
+    } else if (priority_ == Priority::kUserVisible) {
+      qos_class = QOS_CLASS_UTILITY;
+    }
+    result = pthread_attr_set_qos_class_np(&attr, qos_class, 0);
+    if (result != 0) return pthread_attr_destroy(&attr), false;
+  }
+#endif  // V8_OS_DARWIN
   {
     MutexGuard lock_guard(&data_->thread_creation_mutex_);
     result = pthread_create(&data_->thread_, &attr, ThreadEntry, this);
@@ -230,6 +230,14 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+bool OS::BindMemoryToCurrentNumaNode(void* address, size_t size) {
+  return false;
+}
+
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+bool OS::AdviseMergeable(void* address, size_t size) { return false; }
+
 void OS::Sleep(TimeDelta interval) { SbThreadSleep(interval.InMicroseconds()); }
 
 void OS::Abort() { SbSystemBreakIntoDebugger(); }
@@ -377,6 +385,7 @@ class Thread::PlatformData {
 Thread::Thread(const Options& options)
     : data_(new PlatformData),
       stack_size_(options.stack_size()),
+      priority_(options.priority()),
       start_semaphore_(nullptr) {
   set_name(options.name());
 }
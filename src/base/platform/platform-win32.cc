@@ -1074,6 +1074,17 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+// static
+bool OS::BindMemoryToCurrentNumaNode(void* address, size_t size) {
+  return false;
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+// static
+bool OS::AdviseMergeable(void* address, size_t size) { return false; }
+
 void OS::Sleep(TimeDelta interval) {
   ::Sleep(static_cast<DWORD>(interval.InMilliseconds()));
 }
@@ -1573,7 +1584,9 @@ class Thread::PlatformData {
 // handle until it is started.
 
 Thread::Thread(const Options& options)
-    : stack_size_(options.stack_size()), start_semaphore_(nullptr) {
+    : stack_size_(options.stack_size()),
+      priority_(options.priority()),
+      start_semaphore_(nullptr) {
   data_ = new PlatformData(kNoThread);
   set_name(options.name());
 }
@@ -1599,7 +1612,13 @@ bool Thread::Start() {
   uintptr_t result = _beginthreadex(nullptr, static_cast<unsigned>(stack_size_),
                                     ThreadEntry, this, 0, &data_->thread_id_);
   data_->thread_ = reinterpret_cast<HANDLE>(result);
-  return result != 0;
+  if (result == 0) return false;
+  if (priority_ == Priority::kBestEffort) {
+    SetThreadPriority(data_->thread_, THREAD_PRIORITY_LOWEST);
+  } else if (priority_ == Priority::kUserVisible) {
+    SetThreadPriority(data_->thread_, THREAD_PRIORITY_BELOW_NORMAL);
+  }
+  return true;
 }
 
 // Wait for thread to terminate.
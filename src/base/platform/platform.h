@@ -216,6 +216,22 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Advises the OS to back the already mapped range [address, address + size)
+  // with physical memory from the NUMA node of the calling thread, migrating
+  // pages that are already resident. Returns false if this is not supported.
+  static bool BindMemoryToCurrentNumaNode(void* address, size_t size);
+
+  // Advises the OS to back the 2 MB aligned parts of the mapped range
+  // [address, address + size) with transparent huge pages once they are
+  // committed. Returns false if this is not supported.
+  static bool AdviseHugePages(void* address, size_t size);
+
+  // Advises the OS that the mapped range [address, address + size) holds
+  // data that is likely identical in other processes, so that its pages may
+  // be deduplicated with theirs (e.g. by Linux KSM). Returns false if this is
+  // not supported.
+  static bool AdviseMergeable(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -483,18 +499,30 @@ class V8_BASE_EXPORT Thread {
   using LocalStorageKey = int32_t;
 #endif
 
+  // Scheduling priority of a thread. kDefault leaves the priority the
+  // operating system assigns to new threads unchanged; the others mirror
+  // v8::TaskPriority.
+  enum class Priority { kBestEffort, kUserVisible, kUserBlocking, kDefault };
+
   class Options {
    public:
-    Options() : name_("v8:<unknown>"), stack_size_(0) {}
+    Options()
+        : name_("v8:<unknown>"),
+          stack_size_(0),
+          priority_(Priority::kDefault) {}
     explicit Options(const char* name, int stack_size = 0)
-        : name_(name), stack_size_(stack_size) {}
+        : name_(name), stack_size_(stack_size), priority_(Priority::kDefault) {}
+    Options(const char* name, Priority priority, int stack_size = 0)
+        : name_(name), stack_size_(stack_size), priority_(priority) {}
 
     const char* name() const { return name_; }
     int stack_size() const { return stack_size_; }
+    Priority priority() const { return priority_; }
 
    private:
     const char* name_;
     int stack_size_;
+    Priority priority_;
   };
 
   // Create new thread.
@@ -523,6 +551,8 @@ class V8_BASE_EXPORT Thread {
     return name_;
   }
 
+  Priority priority() const { return priority_; }
+
   // Abstract method for run handler.
   virtual void Run() = 0;
 
@@ -567,6 +597,7 @@ class V8_BASE_EXPORT Thread {
 
   char name_[kMaxThreadNameLength];
   int stack_size_;
+  Priority priority_;
   Semaphore* start_semaphore_;
 };
 
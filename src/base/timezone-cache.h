@@ -23,6 +23,14 @@ class TimezoneCache {
   // https://github.com/tc39/ecma262/pull/778
   virtual double LocalTimeOffset(double time_ms, bool is_utc) = 0;
 
+  // Sets {transition_ms} to the first time after {time_ms} at which the local
+  // time offset may change, or to infinity if there is none. Returns false if
+  // the implementation can't tell; offsets then have to be queried one
+  // time value at a time.
+  virtual bool NextOffsetTransition(double time_ms, double* transition_ms) {
+    return false;
+  }
+
   /**
    * Time zone redetection indicator for Clear function.
    *
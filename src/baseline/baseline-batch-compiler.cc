@@ -11,6 +11,7 @@
 
 #include <algorithm>
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/isolate.h"
@@ -19,6 +20,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/logging/counters.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/locked-queue-inl.h"
@@ -51,10 +53,10 @@ class BaselineCompilerTask {
     }
   }
 
-  // Executed in the main thread.
-  void Install(Isolate* isolate) {
+  // Executed in the main thread. Returns true if the code was installed.
+  bool Install(Isolate* isolate) {
     Handle<Code> code;
-    if (!maybe_code_.ToHandle(&code)) return;
+    if (!maybe_code_.ToHandle(&code)) return false;
     if (FLAG_print_code) {
       code->Print();
     }
@@ -62,9 +64,10 @@ class BaselineCompilerTask {
     // already some baseline code installed.
     if (!shared_function_info_->is_compiled() ||
         shared_function_info_->HasBaselineCode()) {
-      return;
+      return false;
     }
     shared_function_info_->set_baseline_code(ToCodeT(*code), kReleaseStore);
+    shared_function_info_->set_has_baseline_code_at_least_once(true);
     if (V8_LIKELY(FLAG_use_osr)) {
       // Arm back edges for OSR
       shared_function_info_->GetBytecodeArray(isolate)
@@ -79,6 +82,7 @@ class BaselineCompilerTask {
       OFStream os(scope.file());
       os << ss.str();
     }
+    return true;
   }
 
  private:
@@ -91,6 +95,9 @@ class BaselineBatchCompilerJob {
  public:
   BaselineBatchCompilerJob(Isolate* isolate, Handle<WeakFixedArray> task_queue,
                            int batch_size) {
+    // Measures the time from dispatching the batch until its code is
+    // installed on the main thread.
+    time_to_baseline_.Start();
     handles_ = isolate->NewPersistentHandles();
     tasks_.reserve(batch_size);
     for (int i = 0; i < batch_size; i++) {
@@ -129,14 +136,27 @@ class BaselineBatchCompilerJob {
 
   // Executed in the main thread.
   void Install(Isolate* isolate) {
+    int installed = 0;
     for (auto& task : tasks_) {
-      task.Install(isolate);
+      if (task.Install(isolate)) installed++;
+    }
+    base::TimeDelta elapsed = time_to_baseline_.Elapsed();
+    isolate->counters()->sparkplug_time_to_baseline()->AddTimedSample(elapsed);
+    if (FLAG_trace_baseline_concurrent_compilation) {
+      CodeTracer::Scope scope(isolate->GetCodeTracer());
+      PrintF(scope.file(),
+             "[Concurrent Sparkplug] installed %d/%zu functions, "
+             "time to baseline: %.3f ms\n",
+             installed, tasks_.size(), elapsed.InMillisecondsF());
     }
   }
 
+  bool is_empty() const { return tasks_.empty(); }
+
  private:
   std::vector<BaselineCompilerTask> tasks_;
   std::unique_ptr<PersistentHandles> handles_;
+  base::ElapsedTimer time_to_baseline_;
 };
 
 class ConcurrentBaselineCompiler {
@@ -160,14 +180,20 @@ class ConcurrentBaselineCompiler {
       // we only switch back the memory chunks to RX at the end.
       CodePageCollectionMemoryModificationScope batch_alloc(isolate_->heap());
 
+      bool has_code_to_install = false;
       while (!incoming_queue_->IsEmpty() && !delegate->ShouldYield()) {
         std::unique_ptr<BaselineBatchCompilerJob> job;
         if (!incoming_queue_->Dequeue(&job)) break;
         DCHECK_NOT_NULL(job);
         job->Compile(&local_isolate);
         outgoing_queue_->Enqueue(std::move(job));
+        has_code_to_install = true;
+      }
+      // Installation happens on the main thread at its next interrupt check,
+      // so the main thread never waits for a batch to finish compiling.
+      if (has_code_to_install) {
+        isolate_->stack_guard()->RequestInstallBaselineCode();
       }
-      isolate_->stack_guard()->RequestInstallBaselineCode();
     }
 
     size_t GetMaxConcurrency(size_t worker_count) const override {
@@ -204,8 +230,13 @@ class ConcurrentBaselineCompiler {
   void CompileBatch(Handle<WeakFixedArray> task_queue, int batch_size) {
     DCHECK(FLAG_concurrent_sparkplug);
     RCS_SCOPE(isolate_, RuntimeCallCounterId::kCompileBaseline);
-    incoming_queue_.Enqueue(std::make_unique<BaselineBatchCompilerJob>(
-        isolate_, task_queue, batch_size));
+    std::unique_ptr<BaselineBatchCompilerJob> job =
+        std::make_unique<BaselineBatchCompilerJob>(isolate_, task_queue,
+                                                   batch_size);
+    // Every function of the batch might have been collected, flushed or
+    // compiled in the meantime; don't wake up a worker for nothing.
+    if (job->is_empty()) return;
+    incoming_queue_.Enqueue(std::move(job));
     job_handle_->NotifyConcurrencyIncrease();
   }
 
@@ -306,6 +337,12 @@ void BaselineBatchCompiler::InstallBatch() {
   concurrent_compiler_->InstallBatch();
 }
 
+void BaselineBatchCompiler::CompileBatchConcurrently(
+    Handle<WeakFixedArray> shared_infos, int batch_size) {
+  DCHECK(FLAG_concurrent_sparkplug);
+  concurrent_compiler_->CompileBatch(shared_infos, batch_size);
+}
+
 void BaselineBatchCompiler::EnsureQueueCapacity() {
   if (compilation_queue_.is_null()) {
     compilation_queue_ = isolate_->global_handles()->Create(
@@ -390,6 +427,11 @@ BaselineBatchCompiler::~BaselineBatchCompiler() {
 
 void BaselineBatchCompiler::InstallBatch() { UNREACHABLE(); }
 
+void BaselineBatchCompiler::CompileBatchConcurrently(
+    Handle<WeakFixedArray> shared_infos, int batch_size) {
+  UNREACHABLE();
+}
+
 }  // namespace baseline
 }  // namespace internal
 }  // namespace v8
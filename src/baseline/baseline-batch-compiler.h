@@ -31,6 +31,12 @@ class BaselineBatchCompiler {
 
   void InstallBatch();
 
+  // Compiles the first |batch_size| entries of |shared_infos|, weak references
+  // to SharedFunctionInfos, on a background thread. The code is installed by
+  // InstallBatch. Requires concurrent Sparkplug.
+  void CompileBatchConcurrently(Handle<WeakFixedArray> shared_infos,
+                                int batch_size);
+
  private:
   // Ensure there is enough space in the compilation queue to enqueue another
   // function, growing the queue if necessary.
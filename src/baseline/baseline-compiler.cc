@@ -29,6 +29,7 @@
 #include "src/interpreter/bytecode-flags.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/code.h"
+#include "src/objects/debug-objects-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/literal-objects-inl.h"
@@ -1914,29 +1915,36 @@ void BaselineCompiler::VisitCreateRestParameter() {
 }
 
 void BaselineCompiler::VisitJumpLoop() {
-  BaselineAssembler::ScratchRegisterScope scope(&basm_);
-  Register scratch = scope.AcquireScratch();
-  Label osr_not_armed;
+  Label* label = &labels_[iterator().GetJumpTargetOffset()]->unlinked;
+  int weight = iterator().GetRelativeJumpTargetOffset() -
+               iterator().current_bytecode_size_without_prefix();
+  // The back edge is already bound, and its weight is always negative.
+  DCHECK(label->is_bound());
+  DCHECK_LT(weight, 0);
+
+  // The budget update is the only check on the fast path. Back edges are armed
+  // for OSR either during a budget interrupt, or by code that also exhausts
+  // the budget, so the OSR check can live on the interrupt path.
+  __ AddToInterruptBudgetAndJumpIfNotExceeded(weight, label);
+  {
+    SaveAccumulatorScope accumulator_scope(&basm_);
+    CallRuntime(Runtime::kBytecodeBudgetInterruptWithStackCheck,
+                __ FunctionOperand());
+  }
+
   {
     ASM_CODE_COMMENT_STRING(&masm_, "OSR Check Armed");
-    Register osr_level = scratch;
+    BaselineAssembler::ScratchRegisterScope scope(&basm_);
+    Register osr_level = scope.AcquireScratch();
     __ LoadRegister(osr_level, interpreter::Register::bytecode_array());
     __ LoadByteField(osr_level, osr_level,
                      BytecodeArray::kOsrLoopNestingLevelOffset);
     int loop_depth = iterator().GetImmediateOperand(1);
     __ JumpIfByte(Condition::kUnsignedLessThanEqual, osr_level, loop_depth,
-                  &osr_not_armed);
+                  label);
     CallBuiltin<Builtin::kBaselineOnStackReplacement>();
   }
-
-  __ Bind(&osr_not_armed);
-  Label* label = &labels_[iterator().GetJumpTargetOffset()]->unlinked;
-  int weight = iterator().GetRelativeJumpTargetOffset() -
-               iterator().current_bytecode_size_without_prefix();
-  // We can pass in the same label twice since it's a back edge and thus already
-  // bound.
-  DCHECK(label->is_bound());
-  UpdateInterruptBudgetAndJumpToLabel(weight, label, label);
+  __ Jump(label);
 }
 
 void BaselineCompiler::VisitJump() {
@@ -2264,7 +2272,24 @@ void BaselineCompiler::VisitDebugger() {
   CallRuntime(Runtime::kHandleDebuggerStatement);
 }
 
+bool BaselineCompiler::IsBlockCounterCovered(int slot) {
+  // Block counters are only written on the main thread, so they can only be
+  // inspected when compiling there.
+  if (!local_isolate_->is_main_thread()) return false;
+  Isolate* isolate = local_isolate_->GetMainThreadIsolateUnsafe();
+  if (!isolate->is_block_binary_code_coverage()) return false;
+  if (!shared_function_info_->HasCoverageInfo()) return false;
+  CoverageInfo coverage_info =
+      CoverageInfo::cast(shared_function_info_->GetDebugInfo().coverage_info());
+  return coverage_info.slots_block_count(slot) != 0;
+}
+
 void BaselineCompiler::VisitIncBlockCounter() {
+  // Binary coverage only reports whether a block was reached at all, so once
+  // the counter has been hit there is nothing left to record. Since baseline
+  // code is shared by all closures of the function, as is the coverage info,
+  // the call can be left out entirely.
+  if (IsBlockCounterCovered(Index(0))) return;
   SaveAccumulatorScope accumulator_scope(&basm_);
   CallBuiltin<Builtin::kIncBlockCounter>(__ FunctionOperand(),
                                          IndexAsSmi(0));  // coverage array slot
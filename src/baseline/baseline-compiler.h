@@ -115,6 +115,11 @@ class BaselineCompiler {
 
   // Misc. helpers.
 
+  // Whether the block counter in the given coverage slot has already been hit
+  // while collecting binary block coverage, in which case it need not be
+  // incremented again.
+  bool IsBlockCounterCovered(int slot);
+
   void UpdateMaxCallArgs(int max_call_args) {
     max_call_args_ = std::max(max_call_args_, max_call_args);
   }
@@ -4,6 +4,8 @@
 
 #include "src/bigint/bigint-internal.h"
 
+#include <atomic>
+
 namespace v8 {
 namespace bigint {
 
@@ -26,6 +28,62 @@ Status ProcessorImpl::get_and_clear_status() {
   return result;
 }
 
+namespace {
+
+// The Platform of the ProcessorImpls that run the parts of a ParallelTask.
+// Parts may split their work further, e.g. when formatting both halves of a
+// huge number.
+class ForwardingPlatform final : public Platform {
+ public:
+  explicit ForwardingPlatform(Platform* platform) : platform_(platform) {}
+
+  bool InterruptRequested() override {
+    return platform_->InterruptRequested();
+  }
+
+  int MaxParallelism() override { return platform_->MaxParallelism(); }
+
+  void RunInParallel(Task* task, int count) override {
+    platform_->RunInParallel(task, count);
+  }
+
+ private:
+  Platform* platform_;
+};
+
+class ProcessorTask final : public Platform::Task {
+ public:
+  ProcessorTask(ParallelTask* task, Platform* platform)
+      : task_(task), platform_(platform) {}
+
+  void Run(int index) override {
+    // Once one part has been interrupted, the result is discarded anyway.
+    if (interrupted()) return;
+    ProcessorImpl processor(new ForwardingPlatform(platform_));
+    task_->Run(index, &processor);
+    if (processor.should_terminate()) {
+      interrupted_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  bool interrupted() const {
+    return interrupted_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  ParallelTask* task_;
+  Platform* platform_;
+  std::atomic<bool> interrupted_{false};
+};
+
+}  // namespace
+
+void ProcessorImpl::RunInParallel(ParallelTask* task, int count) {
+  ProcessorTask processor_task(task, platform_);
+  platform_->RunInParallel(&processor_task, count);
+  if (processor_task.interrupted()) status_ = Status::kInterrupted;
+}
+
 Processor* Processor::New(Platform* platform) {
   ProcessorImpl* impl = new ProcessorImpl(platform);
   return static_cast<Processor*>(impl);
@@ -16,14 +16,40 @@ constexpr int kKaratsubaThreshold = 34;
 constexpr int kToomThreshold = 193;
 constexpr int kFftThreshold = 1500;
 constexpr int kFftInnerThreshold = 200;
+// Total length of the FFT parts above which their pointwise multiplications
+// are spread over the Platform's threads.
+constexpr int kFftParallelThreshold = 16384;
 
 constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
 // kBarrettThreshold is defined in bigint.h.
 
 constexpr int kToStringFastThreshold = 43;
+// Input length above which the fast ToString algorithm formats the two halves
+// of a chunk in parallel, if the Platform supports it.
+constexpr int kToStringParallelThreshold = 2048;
+// Maximum length of the largest radix power that the fast ToString algorithm
+// keeps around for later conversions.
+constexpr int kToStringCacheMaxDivisorLength = 8192;
 constexpr int kFromStringLargeThreshold = 300;
 
+class ProcessorImpl;
+
+// Radix powers and their inverses computed by a previous fast ToString
+// conversion. Defined in tostring.cc.
+class RadixPowersCache;
+struct RadixPowersCacheDeleter {
+  void operator()(RadixPowersCache* cache) const;
+};
+
+// Work for {ProcessorImpl::RunInParallel}.
+class ParallelTask {
+ public:
+  virtual ~ParallelTask() = default;
+  // Computes the part {index}, using {processor} for all operations.
+  virtual void Run(int index, ProcessorImpl* processor) = 0;
+};
+
 class ProcessorImpl : public Processor {
  public:
   explicit ProcessorImpl(Platform* platform);
@@ -75,6 +101,18 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  RadixPowersCache* radix_powers_cache() { return radix_powers_cache_.get(); }
+  void set_radix_powers_cache(RadixPowersCache* cache) {
+    radix_powers_cache_.reset(cache);
+  }
+
+  int max_parallelism() { return platform_->MaxParallelism(); }
+
+  // Runs the parts [0, count) of {task} through the Platform, possibly
+  // concurrently. Each part gets its own ProcessorImpl, whose interrupt
+  // requests are forwarded to this one.
+  void RunInParallel(ParallelTask* task, int count);
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -96,6 +134,8 @@ class ProcessorImpl : public Processor {
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
+  std::unique_ptr<RadixPowersCache, RadixPowersCacheDeleter>
+      radix_powers_cache_;
 };
 
 // These constants are primarily needed for Barrett division in div-barrett.cc,
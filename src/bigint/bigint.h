@@ -189,8 +189,28 @@ class Platform {
 
   // If you want the ability to interrupt long-running operations, implement
   // a Platform subclass that overrides this method. It will be queried
-  // every now and then by long-running operations.
+  // every now and then by long-running operations, also from the threads
+  // that {RunInParallel} runs tasks on.
   virtual bool InterruptRequested() { return false; }
+
+  // Work that {RunInParallel} splits into parts.
+  class Task {
+   public:
+    virtual ~Task() = default;
+    // Computes the part {index}. Calls for different {index} values may
+    // happen concurrently.
+    virtual void Run(int index) = 0;
+  };
+
+  // If you want very large multiplications to use several threads,
+  // implement a Platform subclass that overrides these two methods.
+  // {MaxParallelism} returns how many threads {RunInParallel} can use,
+  // including the calling thread. {RunInParallel} must call {task->Run(i)}
+  // once for every i in [0, count), and return when all calls have returned.
+  virtual int MaxParallelism() { return 1; }
+  virtual void RunInParallel(Task* task, int count) {
+    for (int i = 0; i < count; i++) task->Run(i);
+  }
 };
 
 // These are the operations that this library supports.
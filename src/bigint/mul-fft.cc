@@ -464,7 +464,7 @@ class FFTContainer {
 
   void PointwiseMultiply(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -722,8 +722,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -734,11 +734,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -748,10 +748,40 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
   }
 }
 
+// Splits the pointwise multiplications into ranges of parts for
+// {ProcessorImpl::RunInParallel}. The ranges start at even parts, because
+// {DoPointwiseMultiplication} combines pairs of parts.
+class PointwiseMultiplicationTask final : public ParallelTask {
+ public:
+  PointwiseMultiplicationTask(FFTContainer* container,
+                              const FFTContainer& other, int n, int count)
+      : container_(container), other_(other), n_(n), count_(count) {}
+
+  void Run(int index, ProcessorImpl* processor) override {
+    int pairs = n_ / 2;
+    int start = 2 * (pairs * index / count_);
+    int end = 2 * (pairs * (index + 1) / count_);
+    Storage temp(2 * container_->length());
+    container_->DoPointwiseMultiplication(other_, start, end, temp.get(),
+                                          processor);
+  }
+
+ private:
+  FFTContainer* container_;
+  const FFTContainer& other_;
+  const int n_;
+  const int count_;
+};
+
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  int count = std::min(processor_->max_parallelism(), n_ / 2);
+  if (count > 1 && n_ * length_ >= kFftParallelThreshold) {
+    PointwiseMultiplicationTask task(this, other, n_, count);
+    return processor_->RunInParallel(&task, count);
+  }
+  DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
 }
 
 }  // namespace
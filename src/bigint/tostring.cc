@@ -178,6 +178,8 @@ class ToStringFormatter {
                      bool is_last_on_level);
 
  private:
+  class HalvesTask;
+
   // When processing the last (most significant) digit, don't write leading
   // zeros.
   char* BasecaseLast(digit_t digit, char* out) {
@@ -291,7 +293,7 @@ void ToStringFormatter::BasePowerOfTwo() {
 //              1234567890123
 //                    ↓
 //               %100000000 (a)              // RecursionLevel 2,
-//             /            \                // is_toplevel_ == true.
+//             /            \                // the top level.
 //         12345            67890123
 //           ↓                  ↓
 //    (e) %10000             %10000 (b)      // RecursionLevel 1
@@ -322,12 +324,17 @@ class RecursionLevel {
   static RecursionLevel* CreateLevels(digit_t base_divisor, int base_char_count,
                                       int target_bit_length,
                                       ProcessorImpl* processor);
+  // Like {CreateLevels}, but builds on top of the existing levels below
+  // {level}. Takes ownership of {level}.
+  static RecursionLevel* AddLevels(RecursionLevel* level, int target_bit_length,
+                                   ProcessorImpl* processor);
   ~RecursionLevel() { delete next_; }
 
   void ComputeInverse(ProcessorImpl* proc, int dividend_length = 0);
   Digits GetInverse(int dividend_length);
 
  private:
+  friend class ::v8::bigint::RadixPowersCache;
   friend class ToStringFormatter;
   RecursionLevel(digit_t base_divisor, int base_char_count)
       : char_count_(base_char_count), divisor_(1) {
@@ -336,19 +343,24 @@ class RecursionLevel {
   explicit RecursionLevel(RecursionLevel* next)
       : char_count_(next->char_count_ * 2),
         next_(next),
-        divisor_(next->divisor_.len() * 2) {
-    next->is_toplevel_ = false;
+        divisor_(next->divisor_.len() * 2) {}
+
+  // See {AddLevels} for why this isn't an exact check.
+  bool IsBigEnough(int target_bit_length) {
+    return bit_length_ * 2 - 1 > target_bit_length;
   }
 
   void LeftShiftDivisor() {
+    bit_length_ = BitLength(divisor_);
     leading_zero_shift_ = CountLeadingZeros(divisor_.msd());
     LeftShift(divisor_, divisor_, leading_zero_shift_);
   }
 
   int leading_zero_shift_{0};
+  // The bit length of the divisor before shifting.
+  int bit_length_{0};
   // The number of characters generated by *each half* of this level.
   int char_count_;
-  bool is_toplevel_{true};
   RecursionLevel* next_{nullptr};
   ScratchDigits divisor_;
   std::unique_ptr<Storage> inverse_storage_;
@@ -361,6 +373,14 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
                                              int target_bit_length,
                                              ProcessorImpl* processor) {
   RecursionLevel* level = new RecursionLevel(base_divisor, base_char_count);
+  level->LeftShiftDivisor();
+  return AddLevels(level, target_bit_length, processor);
+}
+
+// static
+RecursionLevel* RecursionLevel::AddLevels(RecursionLevel* level,
+                                          int target_bit_length,
+                                          ProcessorImpl* processor) {
   // We can stop creating levels when the next level's divisor, which is the
   // square of the current level's divisor, would be strictly bigger (in terms
   // of its numeric value) than the input we're formatting. Since computing that
@@ -371,26 +391,104 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
   //   is bigger, we have to aim for a strictly bigger bit length.
   // - when squaring, the bit length sometimes doubles (e.g. 0b11² == 0b1001),
   //   but usually we "lose" a bit (e.g. 0b10² == 0b100).
-  while (BitLength(level->divisor_) * 2 - 1 <= target_bit_length) {
+  while (!level->IsBigEnough(target_bit_length)) {
     RecursionLevel* prev = level;
     level = new RecursionLevel(prev);
+    // {prev}'s divisor is already left-shifted, so its square has to be
+    // shifted back by twice that amount.
     processor->Multiply(level->divisor_, prev->divisor_, prev->divisor_);
     if (processor->should_terminate()) {
       delete level;
       return nullptr;
     }
+    RightShift(level->divisor_, level->divisor_, prev->leading_zero_shift_);
+    RightShift(level->divisor_, level->divisor_, prev->leading_zero_shift_);
     level->divisor_.Normalize();
-    // Left-shifting the divisor must only happen after it's been used to
-    // compute the next divisor.
-    prev->LeftShiftDivisor();
-    prev->ComputeInverse(processor);
+    level->LeftShiftDivisor();
+    if (prev->inverse_.len() == 0) prev->ComputeInverse(processor);
   }
-  level->LeftShiftDivisor();
-  // Not calling info->ComputeInverse here so that it can take the input's
+  // Not calling level->ComputeInverse here so that it can take the input's
   // length into account to save some effort on inverse generation.
   return level;
 }
 
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+
+}  // namespace
+
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+
+// Keeps the RecursionLevels of the most recent conversion, because their
+// divisors and inverses only depend on the radix; subsequent conversions of
+// numbers of similar or smaller size can skip computing them.
+class RadixPowersCache {
+ public:
+  // Returns the top level for formatting an input of {target_bit_length}
+  // bits in {radix}, or nullptr if the computation was interrupted. The
+  // levels are owned by the cache.
+  static RecursionLevel* GetLevels(int radix, digit_t base_divisor,
+                                   int base_char_count, int target_bit_length,
+                                   ProcessorImpl* processor);
+
+ private:
+  RadixPowersCache(int radix, RecursionLevel* levels)
+      : radix_(radix), levels_(levels) {}
+
+  const int radix_;
+  std::unique_ptr<RecursionLevel> levels_;
+};
+
+// static
+RecursionLevel* RadixPowersCache::GetLevels(int radix, digit_t base_divisor,
+                                            int base_char_count,
+                                            int target_bit_length,
+                                            ProcessorImpl* processor) {
+  RadixPowersCache* cache = processor->radix_powers_cache();
+  RecursionLevel* levels;
+  if (cache == nullptr || cache->radix_ != radix) {
+    levels = RecursionLevel::CreateLevels(base_divisor, base_char_count,
+                                          target_bit_length, processor);
+  } else if (!cache->levels_->IsBigEnough(target_bit_length)) {
+    levels = RecursionLevel::AddLevels(cache->levels_.release(),
+                                       target_bit_length, processor);
+  } else {
+    // Use the smallest cached level that is big enough.
+    RecursionLevel* level = cache->levels_.get();
+    while (level->next_ != nullptr &&
+           level->next_->IsBigEnough(target_bit_length)) {
+      level = level->next_;
+    }
+    return level;
+  }
+  if (levels == nullptr) {
+    processor->set_radix_powers_cache(nullptr);
+    return nullptr;
+  }
+  // Cached levels always have a full inverse.
+  levels->ComputeInverse(processor);
+  if (processor->should_terminate()) {
+    delete levels;
+    processor->set_radix_powers_cache(nullptr);
+    return nullptr;
+  }
+  processor->set_radix_powers_cache(new RadixPowersCache(radix, levels));
+  return levels;
+}
+
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+
+void RadixPowersCacheDeleter::operator()(RadixPowersCache* cache) const {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  delete cache;
+#else
+  DCHECK(cache == nullptr);
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+}
+
+namespace {
+
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+
 // The top level might get by with a smaller inverse than we could maximally
 // compute, so the caller should provide the dividend length.
 void RecursionLevel::ComputeInverse(ProcessorImpl* processor,
@@ -419,12 +517,66 @@ Digits RecursionLevel::GetInverse(int dividend_length) {
 }
 
 void ToStringFormatter::Fast() {
-  std::unique_ptr<RecursionLevel> recursion_levels(RecursionLevel::CreateLevels(
-      chunk_divisor_, chunk_chars_, BitLength(digits_), processor_));
+  int target_bit_length = BitLength(digits_);
+  std::unique_ptr<RecursionLevel> uncached_levels;
+  RecursionLevel* recursion_levels;
+  // The largest divisor is about half as long as the input.
+  if (digits_.len() <= 2 * kToStringCacheMaxDivisorLength) {
+    recursion_levels =
+        RadixPowersCache::GetLevels(radix_, chunk_divisor_, chunk_chars_,
+                                    target_bit_length, processor_);
+  } else {
+    recursion_levels = RecursionLevel::CreateLevels(
+        chunk_divisor_, chunk_chars_, target_bit_length, processor_);
+    uncached_levels.reset(recursion_levels);
+  }
   if (processor_->should_terminate()) return;
-  out_ = ProcessLevel(recursion_levels.get(), digits_, out_, true);
+  out_ = ProcessLevel(recursion_levels, digits_, out_, true);
 }
 
+// Formats the two halves of a chunk, possibly in parallel.
+class ToStringFormatter::HalvesTask : public ParallelTask {
+ public:
+  HalvesTask(ToStringFormatter* formatter, RecursionLevel* level,
+             Digits right, Digits left, char* out, bool is_last_on_level)
+      : formatter_(formatter),
+        level_(level),
+        right_(right),
+        left_(left),
+        out_(out),
+        is_last_on_level_(is_last_on_level) {}
+
+  void Run(int index, ProcessorImpl* processor) override {
+    // The formatter's state is read-only while processing levels, so each
+    // half can use a copy with its own processor.
+    ToStringFormatter formatter = *formatter_;
+    formatter.processor_ = processor;
+    if (index == 0) {
+      char* end_of_right_part =
+          formatter.ProcessLevel(level_->next_, right_, out_, false);
+      DCHECK(processor->should_terminate() ||
+             end_of_right_part == out_ - level_->char_count_);
+      USE(end_of_right_part);
+    } else {
+      DCHECK(index == 1);
+      end_of_left_part_ =
+          formatter.ProcessLevel(level_->next_, left_,
+                                 out_ - level_->char_count_, is_last_on_level_);
+    }
+  }
+
+  char* end_of_left_part() const { return end_of_left_part_; }
+
+ private:
+  ToStringFormatter* formatter_;
+  RecursionLevel* level_;
+  Digits right_;
+  Digits left_;
+  char* out_;
+  bool is_last_on_level_;
+  char* end_of_left_part_{nullptr};
+};
+
 // Writes '0' characters right-to-left, starting at {out}-1, until the distance
 // from {right_boundary} to {out} equals the number of characters that {level}
 // is supposed to produce.
@@ -511,9 +663,9 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
     for (int i = 1; i < right.len(); i++) right[i] = 0;
   } else {
     ScratchDigits scratch(DivideBarrettScratchSpace(chunk.len()));
-    // The top level only computes its inverse when {chunk.len()} is
+    // An uncached top level only computes its inverse when {chunk.len()} is
     // available. Other levels have precomputed theirs.
-    if (level->is_toplevel_) {
+    if (level->inverse_.len() == 0) {
       level->ComputeInverse(processor_, chunk.len());
       if (processor_->should_terminate()) return out;
     }
@@ -530,14 +682,21 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
 #endif
 
   // Step 5: Recurse.
+  if (chunk.len() >= kToStringParallelThreshold &&
+      processor_->max_parallelism() > 1) {
+    HalvesTask task(this, level, right, left, out, is_last_on_level);
+    processor_->RunInParallel(&task, 2);
+    if (processor_->should_terminate()) return out;
+    return task.end_of_left_part();
+  }
   char* end_of_right_part = ProcessLevel(level->next_, right, out, false);
   // The recursive calls are required and hence designed to write exactly as
   // many characters as their level is responsible for.
   DCHECK(end_of_right_part == out - level->char_count_);
   USE(end_of_right_part);
   if (processor_->should_terminate()) return out;
-  // We intentionally don't use {end_of_right_part} here to be prepared for
-  // potential future multi-threaded execution.
+  // We intentionally don't use {end_of_right_part} here, so that the halves
+  // can also be formatted in parallel (see above).
   return ProcessLevel(level->next_, left, out - level->char_count_,
                       is_last_on_level);
 }
@@ -21,6 +21,10 @@
 #include "src/objects/property-details.h"
 #include "src/objects/prototype.h"
 
+#if V8_ENABLE_WEBASSEMBLY
+#include "src/wasm/wasm-js.h"
+#endif  // V8_ENABLE_WEBASSEMBLY
+
 namespace v8 {
 namespace internal {
 
@@ -796,5 +800,35 @@ Handle<AccessorInfo> Accessors::MakeErrorStackInfo(Isolate* isolate) {
                       &ErrorStackGetter, &ErrorStackSetter);
 }
 
+//
+// Accessors::WebAssembly
+//
+
+void Accessors::WebAssemblyGetter(
+    v8::Local<v8::Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+#if V8_ENABLE_WEBASSEMBLY
+  Isolate* isolate = reinterpret_cast<Isolate*>(info.GetIsolate());
+  HandleScope scope(isolate);
+  Handle<JSGlobalObject> global =
+      Handle<JSGlobalObject>::cast(Utils::OpenHandle(*info.Holder()));
+  {
+    // Install the JS API into the context the global object belongs to. This
+    // replaces the accessor with the {WebAssembly} object.
+    SaveAndSwitchContext save(isolate, global->native_context());
+    WasmJs::EnsureInstalled(isolate);
+  }
+  Handle<Object> webassembly =
+      JSObject::GetDataProperty(isolate, global, Utils::OpenHandle(*name));
+  info.GetReturnValue().Set(Utils::ToLocal(webassembly));
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
+Handle<AccessorInfo> Accessors::MakeWebAssemblyInfo(Isolate* isolate) {
+  return MakeAccessor(isolate, isolate->factory()->WebAssembly_string(),
+                      &WebAssemblyGetter, &ReconfigureToDataProperty);
+}
+
 }  // namespace internal
 }  // namespace v8
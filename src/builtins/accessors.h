@@ -44,7 +44,9 @@ class JavaScriptFrame;
     kHasSideEffectToReceiver)                                                 \
   V(_, function_prototype, FunctionPrototype, kHasNoSideEffect,               \
     kHasSideEffectToReceiver)                                                 \
-  V(_, string_length, StringLength, kHasNoSideEffect, kHasSideEffectToReceiver)
+  V(_, string_length, StringLength, kHasNoSideEffect,                         \
+    kHasSideEffectToReceiver)                                                 \
+  V(_, webassembly, WebAssembly, kHasNoSideEffect, kHasSideEffectToReceiver)
 
 #define ACCESSOR_SETTER_LIST(V) \
   V(ArrayLengthSetter)          \
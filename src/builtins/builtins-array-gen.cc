@@ -16,6 +16,7 @@
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/arguments-inl.h"
 #include "src/objects/property-cell.h"
+#include "src/objects/simd.h"
 
 namespace v8 {
 namespace internal {
@@ -609,6 +610,29 @@ class ArrayIncludesIndexofAssembler : public CodeStubAssembler {
     Return(value);
     BIND(&done);
   }
+
+  // Searches large arrays with one of the C functions in src/objects/simd.h,
+  // which return the index of the match or -1. Jumps to {if_small} if there
+  // are too few elements left to search.
+  TNode<IntPtrT> CallSearchFunction(ExternalReference function,
+                                    TNode<FixedArrayBase> elements,
+                                    TNode<IntPtrT> length,
+                                    TNode<IntPtrT> from_index,
+                                    TNode<Object> search_element,
+                                    Label* if_small) {
+    GotoIf(IntPtrLessThan(
+               IntPtrSub(length, from_index),
+               IntPtrConstant(kArrayIndexOfIncludesMinSearchLength)),
+           if_small);
+    MachineType type_tagged = MachineType::AnyTagged();
+    MachineType type_intptr = MachineType::IntPtr();
+    return UncheckedCast<IntPtrT>(CallCFunction(
+        ExternalConstant(function), type_intptr,
+        std::make_pair(type_tagged, elements),
+        std::make_pair(type_intptr, length),
+        std::make_pair(type_intptr, from_index),
+        std::make_pair(type_tagged, search_element)));
+  }
 };
 
 void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
@@ -703,6 +727,23 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
 
   BIND(&if_smiorobjects);
   {
+    // Arrays with Smi elements only contain a Smi search element if one of
+    // the elements is identical to it.
+    Label call_stub(this);
+    GotoIfNot(TaggedIsSmi(search_element), &call_stub);
+    GotoIfNot(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_SMI_ELEMENTS),
+              &call_stub);
+    TNode<IntPtrT> index = CallSearchFunction(
+        ExternalReference::array_indexof_includes_smi_or_object(), elements,
+        array_length_untagged, index_var.value(), search_element, &call_stub);
+    GotoIf(IntPtrLessThan(index, IntPtrConstant(0)), &return_not_found);
+    if (variant == kIncludes) {
+      args.PopAndReturn(TrueConstant());
+    } else {
+      args.PopAndReturn(SmiTag(index));
+    }
+
+    BIND(&call_stub);
     Callable callable = (variant == kIncludes)
                             ? Builtins::CallableFor(
                                   isolate(), Builtin::kArrayIncludesSmiOrObject)
@@ -765,8 +806,9 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
   TVARIABLE(Float64T, search_num);
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
-  Label ident_loop(this, &index_var), heap_num_loop(this, &search_num),
-      string_loop(this), bigint_loop(this, &index_var),
+  Label ident_search(this), ident_loop(this, &index_var),
+      heap_num_loop(this, &search_num), string_loop(this),
+      bigint_loop(this, &index_var),
       undef_loop(this, &index_var), not_smi(this), not_heap_num(this),
       return_found(this), return_not_found(this);
 
@@ -787,7 +829,16 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
   TNode<Uint16T> search_type = LoadMapInstanceType(map);
   GotoIf(IsStringInstanceType(search_type), &string_loop);
   GotoIf(IsBigIntInstanceType(search_type), &bigint_loop);
-  Goto(&ident_loop);
+  Goto(&ident_search);
+
+  BIND(&ident_search);
+  {
+    index_var = CallSearchFunction(
+        ExternalReference::array_indexof_includes_smi_or_object(), elements,
+        array_length_untagged, index_var.value(), search_element, &ident_loop);
+    Branch(IntPtrLessThan(index_var.value(), IntPtrConstant(0)),
+           &return_not_found, &return_found);
+  }
 
   BIND(&ident_loop);
   {
@@ -937,15 +988,15 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
   TVARIABLE(IntPtrT, index_var, SmiUntag(from_index));
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
-  Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
-      hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+  Label nan_loop(this, &index_var), not_nan_search(this),
+      not_nan_loop(this, &index_var), hole_loop(this, &index_var),
+      search_notnan(this), return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&not_nan_search);
 
   BIND(&search_notnan);
   GotoIfNot(IsHeapNumber(CAST(search_element)), &return_not_found);
@@ -953,7 +1004,17 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
   search_num = LoadHeapNumberValue(CAST(search_element));
 
   Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_search);
+
+  BIND(&not_nan_search);
+  {
+    index_var = CallSearchFunction(
+        ExternalReference::array_indexof_includes_double(), elements,
+        array_length_untagged, index_var.value(), search_element,
+        &not_nan_loop);
+    Branch(IntPtrLessThan(index_var.value(), IntPtrConstant(0)),
+           &return_not_found, &return_found);
+  }
 
   BIND(&not_nan_loop);
   {
@@ -1005,15 +1066,15 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   TVARIABLE(IntPtrT, index_var, SmiUntag(from_index));
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
-  Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
-      hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+  Label nan_loop(this, &index_var), not_nan_search(this),
+      not_nan_loop(this, &index_var), hole_loop(this, &index_var),
+      search_notnan(this), return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&not_nan_search);
 
   BIND(&search_notnan);
   if (variant == kIncludes) {
@@ -1024,7 +1085,17 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   search_num = LoadHeapNumberValue(CAST(search_element));
 
   Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_search);
+
+  BIND(&not_nan_search);
+  {
+    index_var = CallSearchFunction(
+        ExternalReference::array_indexof_includes_double(), elements,
+        array_length_untagged, index_var.value(), search_element,
+        &not_nan_loop);
+    Branch(IntPtrLessThan(index_var.value(), IntPtrConstant(0)),
+           &return_not_found, &return_found);
+  }
 
   BIND(&not_nan_loop);
   {
@@ -25,16 +25,27 @@ class AsyncFunctionBuiltinsAssembler : public AsyncBuiltinsAssembler {
   void AsyncFunctionAwaitResumeClosure(
       const TNode<Context> context, const TNode<Object> sent_value,
       JSGeneratorObject::ResumeMode resume_mode);
+  void AsyncFunctionAwaitResume(
+      const TNode<Context> context,
+      const TNode<JSAsyncFunctionObject> async_function_object,
+      const TNode<Object> sent_value,
+      JSGeneratorObject::ResumeMode resume_mode);
 };
 
 void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwaitResumeClosure(
     TNode<Context> context, TNode<Object> sent_value,
     JSGeneratorObject::ResumeMode resume_mode) {
-  DCHECK(resume_mode == JSGeneratorObject::kNext ||
-         resume_mode == JSGeneratorObject::kThrow);
-
   TNode<JSAsyncFunctionObject> async_function_object =
       CAST(LoadContextElement(context, Context::EXTENSION_INDEX));
+  AsyncFunctionAwaitResume(context, async_function_object, sent_value,
+                           resume_mode);
+}
+
+void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwaitResume(
+    TNode<Context> context, TNode<JSAsyncFunctionObject> async_function_object,
+    TNode<Object> sent_value, JSGeneratorObject::ResumeMode resume_mode) {
+  DCHECK(resume_mode == JSGeneratorObject::kNext ||
+         resume_mode == JSGeneratorObject::kThrow);
 
   // Push the promise for the {async_function_object} back onto the catch
   // prediction stack to handle exceptions thrown after resuming from the
@@ -222,6 +233,34 @@ TF_BUILTIN(AsyncFunctionAwaitResolveClosure, AsyncFunctionBuiltinsAssembler) {
   Return(UndefinedConstant());
 }
 
+// Runs an AsyncFunctionResumeJobTask, which stands in for the promise reaction
+// job of an await on an already settled native {promise}.
+TF_BUILTIN(AsyncFunctionResumeJob, AsyncFunctionBuiltinsAssembler) {
+  const auto async_function_object =
+      Parameter<JSAsyncFunctionObject>(Descriptor::kAsyncFunctionObject);
+  const auto promise = Parameter<JSPromise>(Descriptor::kPromise);
+  const auto context = Parameter<Context>(Descriptor::kContext);
+
+  const TNode<Object> result =
+      LoadObjectField(promise, JSPromise::kReactionsOrResultOffset);
+  const TNode<Uint32T> status = DecodeWord32<JSPromise::StatusBits>(
+      SmiToInt32(LoadObjectField<Smi>(promise, JSPromise::kFlagsOffset)));
+  CSA_DCHECK(this, Word32NotEqual(status, Int32Constant(v8::Promise::kPending)));
+  Label if_fulfilled(this), if_rejected(this, Label::kDeferred);
+  Branch(Word32Equal(status, Int32Constant(v8::Promise::kFulfilled)),
+         &if_fulfilled, &if_rejected);
+
+  BIND(&if_fulfilled);
+  AsyncFunctionAwaitResume(context, async_function_object, result,
+                           JSGeneratorObject::kNext);
+  Return(UndefinedConstant());
+
+  BIND(&if_rejected);
+  AsyncFunctionAwaitResume(context, async_function_object, result,
+                           JSGeneratorObject::kThrow);
+  Return(UndefinedConstant());
+}
+
 // ES#abstract-ops-async-function-await
 // AsyncFunctionAwait ( value )
 // Shared logic for the core of await. The parser desugars
@@ -238,14 +277,49 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait(
   auto value = Parameter<Object>(Descriptor::kValue);
   auto context = Parameter<Context>(Descriptor::kContext);
 
-  TNode<SharedFunctionInfo> on_resolve_sfi =
-      AsyncFunctionAwaitResolveSharedFunConstant();
-  TNode<SharedFunctionInfo> on_reject_sfi =
-      AsyncFunctionAwaitRejectSharedFunConstant();
   TNode<JSPromise> outer_promise = LoadObjectField<JSPromise>(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset);
-  Await(context, async_function_object, value, outer_promise, on_resolve_sfi,
-        on_reject_sfi, is_predicted_as_caught);
+
+  // If {value} is an already settled native promise that Await() would use
+  // as is, and there's no instrumentation that needs to observe the await,
+  // schedule a job that resumes the {async_function_object} directly instead
+  // of allocating the await closures and a PromiseReaction.
+  Label if_slow(this), done(this);
+  {
+    GotoIf(TaggedIsSmi(value), &if_slow);
+    const TNode<HeapObject> value_object = CAST(value);
+    const TNode<Map> value_map = LoadMap(value_object);
+    GotoIfNot(IsJSPromiseMap(value_map), &if_slow);
+    const TNode<JSPromise> promise = CAST(value_object);
+    const TNode<Uint32T> status = DecodeWord32<JSPromise::StatusBits>(
+        SmiToInt32(LoadObjectField<Smi>(promise, JSPromise::kFlagsOffset)));
+    GotoIf(Word32Equal(status, Int32Constant(v8::Promise::kPending)),
+           &if_slow);
+    const TNode<NativeContext> native_context = LoadNativeContext(context);
+    GotoIfNot(TaggedEqual(LoadMapPrototype(value_map),
+                          LoadContextElement(native_context,
+                                             Context::PROMISE_PROTOTYPE_INDEX)),
+              &if_slow);
+    GotoIf(IsPromiseSpeciesProtectorCellInvalid(), &if_slow);
+    GotoIf(NeedsAnyPromiseHooks(), &if_slow);
+
+    PerformPromiseThenResumeAsyncFunction(context, native_context, promise,
+                                          async_function_object);
+    Goto(&done);
+  }
+
+  BIND(&if_slow);
+  {
+    TNode<SharedFunctionInfo> on_resolve_sfi =
+        AsyncFunctionAwaitResolveSharedFunConstant();
+    TNode<SharedFunctionInfo> on_reject_sfi =
+        AsyncFunctionAwaitRejectSharedFunConstant();
+    Await(context, async_function_object, value, outer_promise, on_resolve_sfi,
+          on_reject_sfi, is_predicted_as_caught);
+    Goto(&done);
+  }
+
+  BIND(&done);
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
@@ -636,6 +636,16 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
   std::tuple<TNode<Object>, TNode<IntPtrT>, TNode<IntPtrT>> NextSkipHoles(
       TNode<TableType> table, TNode<IntPtrT> index, Label* if_end);
 
+  // Invokes {callback} for the entries of the collection {receiver}, starting
+  // at {initial_index} in {initial_table}, as Map.prototype.forEach and
+  // Set.prototype.forEach do. Also used to resume the loops inlined into
+  // optimized code.
+  template <typename TableType>
+  void ForEachEntry(TNode<Context> context, TNode<Object> receiver,
+                    TNode<Object> callback, TNode<Object> this_arg,
+                    TNode<TableType> initial_table,
+                    TNode<IntPtrT> initial_index);
+
   // Specialization for Smi.
   // The {result} variable will contain the entry index if the key was found,
   // or the hash code otherwise.
@@ -680,7 +690,7 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              Label* entry_found,
                                              Label* not_found);
   TNode<IntPtrT> ComputeStringHash(TNode<String> string_key);
-  void SameValueZeroString(TNode<String> key_string,
+  void SameValueZeroString(TNode<String> key_string, TNode<Uint32T> key_hash,
                            TNode<Object> candidate_key, Label* if_same,
                            Label* if_not_same);
 
@@ -1299,10 +1309,12 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   const TNode<IntPtrT> hash = ComputeStringHash(key_tagged);
   CSA_DCHECK(this, IntPtrGreaterThanOrEqual(hash, IntPtrConstant(0)));
   *result = hash;
+  const TNode<Uint32T> key_hash = Unsigned(TruncateIntPtrToInt32(hash));
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, key_hash, other_key, if_same,
+                            if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1372,12 +1384,23 @@ TNode<IntPtrT> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<Uint32T> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
+  GotoIf(TaggedEqual(key_string, candidate_key), if_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
 
+  // Strings with different hashes are not equal. Keys get their hash computed
+  // when they are added, so this avoids calling StringEqual for every other
+  // string in the bucket chain.
+  Label compare_contents(this);
+  GotoIf(Word32NotEqual(
+             LoadNameHash(CAST(candidate_key), &compare_contents), key_hash),
+         if_not_same);
+  Goto(&compare_contents);
+
+  BIND(&compare_contents);
   Branch(TaggedEqual(CallBuiltin(Builtin::kStringEqual, NoContextConstant(),
                                  key_string, candidate_key),
                      TrueConstant()),
@@ -1569,6 +1592,56 @@ CollectionsBuiltinsAssembler::NextSkipHoles(TNode<TableType> table,
       entry_key, entry_start_position, var_index.value()};
 }
 
+template <typename TableType>
+void CollectionsBuiltinsAssembler::ForEachEntry(TNode<Context> context,
+                                                TNode<Object> receiver,
+                                                TNode<Object> callback,
+                                                TNode<Object> this_arg,
+                                                TNode<TableType> initial_table,
+                                                TNode<IntPtrT> initial_index) {
+  TVARIABLE(IntPtrT, var_index, initial_index);
+  TVARIABLE(TableType, var_table, initial_table);
+  Label loop(this, {&var_index, &var_table}), done_loop(this);
+  Goto(&loop);
+  BIND(&loop);
+  {
+    // Transition {table} and {index} if there was any modification to
+    // the {receiver} while we're iterating.
+    TNode<IntPtrT> index = var_index.value();
+    TNode<TableType> table = var_table.value();
+    std::tie(table, index) = Transition<TableType>(
+        table, index, [](const TNode<TableType>, const TNode<IntPtrT>) {});
+
+    // Read the next entry from the {table}, skipping holes.
+    TNode<Object> entry_key;
+    TNode<IntPtrT> entry_start_position;
+    std::tie(entry_key, entry_start_position, index) =
+        NextSkipHoles<TableType>(table, index, &done_loop);
+
+    if (std::is_same<TableType, OrderedHashMap>::value) {
+      // Invoke the {callback} passing the entry value, the {entry_key} and
+      // the {receiver}.
+      TNode<Object> entry_value = LoadFixedArrayElement(
+          table, entry_start_position,
+          (OrderedHashMap::HashTableStartIndex() +
+           OrderedHashMap::kValueOffset) *
+              kTaggedSize);
+      Call(context, callback, this_arg, entry_value, entry_key, receiver);
+    } else {
+      // Invoke the {callback} passing the {entry_key} (twice) and the
+      // {receiver}.
+      Call(context, callback, this_arg, entry_key, entry_key, receiver);
+    }
+
+    // Continue with the next entry.
+    var_index = index;
+    var_table = table;
+    Goto(&loop);
+  }
+
+  BIND(&done_loop);
+}
+
 TF_BUILTIN(MapPrototypeGet, CollectionsBuiltinsAssembler) {
   const auto receiver = Parameter<Object>(Descriptor::kReceiver);
   const auto key = Parameter<Object>(Descriptor::kKey);
@@ -2012,43 +2085,10 @@ TF_BUILTIN(MapPrototypeForEach, CollectionsBuiltinsAssembler) {
   GotoIf(TaggedIsSmi(callback), &callback_not_callable);
   GotoIfNot(IsCallable(CAST(callback)), &callback_not_callable);
 
-  TVARIABLE(IntPtrT, var_index, IntPtrConstant(0));
-  TVARIABLE(OrderedHashMap, var_table,
-            CAST(LoadObjectField(CAST(receiver), JSMap::kTableOffset)));
-  Label loop(this, {&var_index, &var_table}), done_loop(this);
-  Goto(&loop);
-  BIND(&loop);
-  {
-    // Transition {table} and {index} if there was any modification to
-    // the {receiver} while we're iterating.
-    TNode<IntPtrT> index = var_index.value();
-    TNode<OrderedHashMap> table = var_table.value();
-    std::tie(table, index) = Transition<OrderedHashMap>(
-        table, index, [](const TNode<OrderedHashMap>, const TNode<IntPtrT>) {});
-
-    // Read the next entry from the {table}, skipping holes.
-    TNode<Object> entry_key;
-    TNode<IntPtrT> entry_start_position;
-    std::tie(entry_key, entry_start_position, index) =
-        NextSkipHoles<OrderedHashMap>(table, index, &done_loop);
-
-    // Load the entry value as well.
-    TNode<Object> entry_value = LoadFixedArrayElement(
-        table, entry_start_position,
-        (OrderedHashMap::HashTableStartIndex() + OrderedHashMap::kValueOffset) *
-            kTaggedSize);
-
-    // Invoke the {callback} passing the {entry_key}, {entry_value} and the
-    // {receiver}.
-    Call(context, callback, this_arg, entry_value, entry_key, receiver);
-
-    // Continue with the next entry.
-    var_index = index;
-    var_table = table;
-    Goto(&loop);
-  }
-
-  BIND(&done_loop);
+  ForEachEntry<OrderedHashMap>(
+      context, receiver, callback, this_arg,
+      CAST(LoadObjectField(CAST(receiver), JSMap::kTableOffset)),
+      IntPtrConstant(0));
   args.PopAndReturn(UndefinedConstant());
 
   BIND(&callback_not_callable);
@@ -2248,36 +2288,10 @@ TF_BUILTIN(SetPrototypeForEach, CollectionsBuiltinsAssembler) {
   GotoIf(TaggedIsSmi(callback), &callback_not_callable);
   GotoIfNot(IsCallable(CAST(callback)), &callback_not_callable);
 
-  TVARIABLE(IntPtrT, var_index, IntPtrConstant(0));
-  TVARIABLE(OrderedHashSet, var_table,
-            CAST(LoadObjectField(CAST(receiver), JSSet::kTableOffset)));
-  Label loop(this, {&var_index, &var_table}), done_loop(this);
-  Goto(&loop);
-  BIND(&loop);
-  {
-    // Transition {table} and {index} if there was any modification to
-    // the {receiver} while we're iterating.
-    TNode<IntPtrT> index = var_index.value();
-    TNode<OrderedHashSet> table = var_table.value();
-    std::tie(table, index) = Transition<OrderedHashSet>(
-        table, index, [](const TNode<OrderedHashSet>, const TNode<IntPtrT>) {});
-
-    // Read the next entry from the {table}, skipping holes.
-    TNode<Object> entry_key;
-    TNode<IntPtrT> entry_start_position;
-    std::tie(entry_key, entry_start_position, index) =
-        NextSkipHoles<OrderedHashSet>(table, index, &done_loop);
-
-    // Invoke the {callback} passing the {entry_key} (twice) and the {receiver}.
-    Call(context, callback, this_arg, entry_key, entry_key, receiver);
-
-    // Continue with the next entry.
-    var_index = index;
-    var_table = table;
-    Goto(&loop);
-  }
-
-  BIND(&done_loop);
+  ForEachEntry<OrderedHashSet>(
+      context, receiver, callback, this_arg,
+      CAST(LoadObjectField(CAST(receiver), JSSet::kTableOffset)),
+      IntPtrConstant(0));
   args.PopAndReturn(UndefinedConstant());
 
   BIND(&callback_not_callable);
@@ -2287,6 +2301,34 @@ TF_BUILTIN(SetPrototypeForEach, CollectionsBuiltinsAssembler) {
   }
 }
 
+TF_BUILTIN(MapForEachLoopLazyDeoptContinuation,
+           CollectionsBuiltinsAssembler) {
+  const auto context = Parameter<Context>(Descriptor::kContext);
+  const auto receiver = Parameter<Object>(Descriptor::kReceiver);
+  const auto callback = Parameter<Object>(Descriptor::kCallback);
+  const auto this_arg = Parameter<Object>(Descriptor::kThisArg);
+  const auto table = Parameter<OrderedHashMap>(Descriptor::kTable);
+  const auto index = Parameter<Smi>(Descriptor::kIndex);
+
+  ForEachEntry<OrderedHashMap>(context, receiver, callback, this_arg, table,
+                               SmiUntag(index));
+  Return(UndefinedConstant());
+}
+
+TF_BUILTIN(SetForEachLoopLazyDeoptContinuation,
+           CollectionsBuiltinsAssembler) {
+  const auto context = Parameter<Context>(Descriptor::kContext);
+  const auto receiver = Parameter<Object>(Descriptor::kReceiver);
+  const auto callback = Parameter<Object>(Descriptor::kCallback);
+  const auto this_arg = Parameter<Object>(Descriptor::kThisArg);
+  const auto table = Parameter<OrderedHashSet>(Descriptor::kTable);
+  const auto index = Parameter<Smi>(Descriptor::kIndex);
+
+  ForEachEntry<OrderedHashSet>(context, receiver, callback, this_arg, table,
+                               SmiUntag(index));
+  Return(UndefinedConstant());
+}
+
 TF_BUILTIN(SetPrototypeValues, CollectionsBuiltinsAssembler) {
   const auto receiver = Parameter<Object>(Descriptor::kReceiver);
   const auto context = Parameter<Context>(Descriptor::kContext);
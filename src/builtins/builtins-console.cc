@@ -189,9 +189,12 @@ void LogTimerEvent(Isolate* isolate, BuiltinArguments args,
 CONSOLE_METHOD_LIST(CONSOLE_BUILTIN_IMPLEMENTATION)
 #undef CONSOLE_BUILTIN_IMPLEMENTATION
 
+// The formatter only prepares the arguments for the console delegate, so it
+// is skipped entirely when there is nobody to receive them.
 #define CONSOLE_BUILTIN_IMPLEMENTATION(call, name, index)      \
   BUILTIN(Console##call) {                                     \
-    if (!Formatter(isolate, args, index)) {                    \
+    if (isolate->console_delegate() &&                         \
+        !Formatter(isolate, args, index)) {                    \
       return ReadOnlyRoots(isolate).exception();               \
     }                                                          \
     ConsoleCall(isolate, args, &debug::ConsoleDelegate::call); \
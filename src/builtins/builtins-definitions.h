@@ -441,6 +441,7 @@ namespace internal {
       kSentError)                                                              \
   TFJ(AsyncFunctionAwaitResolveClosure, kJSArgcReceiverSlots + 1, kReceiver,   \
       kSentValue)                                                              \
+  TFS(AsyncFunctionResumeJob, kAsyncFunctionObject, kPromise)                 \
                                                                                \
   /* BigInt */                                                                 \
   CPP(BigIntConstructor)                                                       \
@@ -695,6 +696,8 @@ namespace internal {
   TFJ(MapPrototypeGetSize, kJSArgcReceiverSlots, kReceiver)                    \
   /* ES #sec-map.prototype.forEach */                                          \
   TFJ(MapPrototypeForEach, kDontAdaptArgumentsSentinel)                        \
+  TFJ(MapForEachLoopLazyDeoptContinuation, kJSArgcReceiverSlots + 5,           \
+      kReceiver, kCallback, kThisArg, kTable, kIndex, kResult)                 \
   /* ES #sec-map.prototype.keys */                                             \
   TFJ(MapPrototypeKeys, kJSArgcReceiverSlots, kReceiver)                       \
   /* ES #sec-map.prototype.values */                                           \
@@ -870,6 +873,8 @@ namespace internal {
   TFJ(SetPrototypeGetSize, kJSArgcReceiverSlots, kReceiver)                    \
   /* ES #sec-set.prototype.foreach */                                          \
   TFJ(SetPrototypeForEach, kDontAdaptArgumentsSentinel)                        \
+  TFJ(SetForEachLoopLazyDeoptContinuation, kJSArgcReceiverSlots + 5,           \
+      kReceiver, kCallback, kThisArg, kTable, kIndex, kResult)                 \
   /* ES #sec-set.prototype.values */                                           \
   TFJ(SetPrototypeValues, kJSArgcReceiverSlots, kReceiver)                     \
   /* ES #sec-%setiteratorprototype%.next */                                    \
@@ -34,9 +34,24 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
                                            TNode<IntPtrT> start,
                                            TNode<IntPtrT> index);
 
-  void PrepareForContext(TNode<Context> microtask_context, Label* bailout);
+  // Consecutive microtasks of the same native context run as a batch, which
+  // enters the context only once. {var_batch_context} holds the native
+  // context of the current batch, or undefined. It is entered on top of
+  // {saved_entered_context_count} entered contexts.
+  void PrepareForContext(TNode<Context> microtask_context,
+                         TNode<RawPtrT> microtask_queue,
+                         TNode<IntPtrT> saved_entered_context_count,
+                         TVariable<Object>* var_batch_context, Label* bailout);
+  void LeaveBatchContext(TNode<RawPtrT> microtask_queue,
+                         TNode<IntPtrT> saved_entered_context_count,
+                         TVariable<Object>* var_batch_context);
+  void AccountMicrotaskContext(TNode<RawPtrT> microtask_queue,
+                               TNode<WordT> raw_native_context);
   void RunSingleMicrotask(TNode<Context> current_context,
-                          TNode<Microtask> microtask);
+                          TNode<Microtask> microtask,
+                          TNode<RawPtrT> microtask_queue,
+                          TNode<IntPtrT> saved_entered_context_count,
+                          TVariable<Object>* var_batch_context);
   void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
 
   TNode<Context> GetCurrentContext();
@@ -104,23 +119,78 @@ TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::CalculateRingBufferOffset(
 }
 
 void MicrotaskQueueBuiltinsAssembler::PrepareForContext(
-    TNode<Context> native_context, Label* bailout) {
+    TNode<Context> native_context, TNode<RawPtrT> microtask_queue,
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batch_context, Label* bailout) {
   CSA_DCHECK(this, IsNativeContext(native_context));
 
   // Skip the microtask execution if the associated context is shutdown.
   GotoIf(WordEqual(GetMicrotaskQueue(native_context), IntPtrConstant(0)),
          bailout);
 
-  EnterMicrotaskContext(native_context);
+  Label enter_context(this), done(this);
+  Branch(TaggedEqual(native_context, var_batch_context->value()), &done,
+         &enter_context);
+
+  BIND(&enter_context);
+  {
+    LeaveBatchContext(microtask_queue, saved_entered_context_count,
+                      var_batch_context);
+    EnterMicrotaskContext(native_context);
+    *var_batch_context = native_context;
+    AccountMicrotaskContext(microtask_queue,
+                            BitcastTaggedToWord(native_context));
+    Goto(&done);
+  }
+
+  BIND(&done);
   SetCurrentContext(native_context);
 }
 
+void MicrotaskQueueBuiltinsAssembler::LeaveBatchContext(
+    TNode<RawPtrT> microtask_queue, TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batch_context) {
+  Label done(this);
+  GotoIf(IsUndefined(var_batch_context->value()), &done);
+  AccountMicrotaskContext(microtask_queue, IntPtrConstant(kNullAddress));
+  RewindEnteredContext(saved_entered_context_count);
+  *var_batch_context = UndefinedConstant();
+  Goto(&done);
+  BIND(&done);
+}
+
+void MicrotaskQueueBuiltinsAssembler::AccountMicrotaskContext(
+    TNode<RawPtrT> microtask_queue, TNode<WordT> raw_native_context) {
+  Label if_accounting(this, Label::kDeferred), done(this);
+  TNode<RawPtrT> callback = Load<RawPtrT>(
+      microtask_queue,
+      IntPtrConstant(MicrotaskQueue::kContextAccountingCallbackOffset));
+  Branch(WordEqual(callback, IntPtrConstant(0)), &done, &if_accounting);
+
+  BIND(&if_accounting);
+  {
+    TNode<ExternalReference> function = ExternalConstant(
+        ExternalReference::call_account_microtask_context_function());
+    CallCFunction(function, MachineType::AnyTagged(),
+                  std::make_pair(MachineType::IntPtr(), microtask_queue),
+                  std::make_pair(MachineType::Pointer(), raw_native_context));
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
 void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
-    TNode<Context> current_context, TNode<Microtask> microtask) {
+    TNode<Context> current_context, TNode<Microtask> microtask,
+    TNode<RawPtrT> microtask_queue, TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batch_context) {
   CSA_DCHECK(this, TaggedIsNotSmi(microtask));
 
   StoreRoot(RootIndex::kCurrentMicrotask, microtask);
-  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
+  // After the microtask, leave the contexts that it entered, but stay in the
+  // context of the batch.
+  TNode<IntPtrT> batch_entered_context_count =
+      IntPtrAdd(saved_entered_context_count, IntPtrConstant(1));
   TNode<Map> microtask_map = LoadMap(microtask);
   TNode<Uint16T> microtask_type = LoadMapInstanceType(microtask_map);
 
@@ -130,15 +200,21 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
       is_promise_fulfill_reaction_job(this),
       is_promise_reject_reaction_job(this),
       is_promise_resolve_thenable_job(this),
+      is_async_function_resume_job(this),
       is_unreachable(this, Label::kDeferred), done(this);
 
-  int32_t case_values[] = {CALLABLE_TASK_TYPE, CALLBACK_TASK_TYPE,
+  int32_t case_values[] = {CALLABLE_TASK_TYPE,
+                           CALLBACK_TASK_TYPE,
                            PROMISE_FULFILL_REACTION_JOB_TASK_TYPE,
                            PROMISE_REJECT_REACTION_JOB_TASK_TYPE,
-                           PROMISE_RESOLVE_THENABLE_JOB_TASK_TYPE};
-  Label* case_labels[] = {
-      &is_callable, &is_callback, &is_promise_fulfill_reaction_job,
-      &is_promise_reject_reaction_job, &is_promise_resolve_thenable_job};
+                           PROMISE_RESOLVE_THENABLE_JOB_TASK_TYPE,
+                           ASYNC_FUNCTION_RESUME_JOB_TASK_TYPE};
+  Label* case_labels[] = {&is_callable,
+                          &is_callback,
+                          &is_promise_fulfill_reaction_job,
+                          &is_promise_reject_reaction_job,
+                          &is_promise_resolve_thenable_job,
+                          &is_async_function_resume_job};
   static_assert(arraysize(case_values) == arraysize(case_labels), "");
   Switch(microtask_type, &is_unreachable, case_values, case_labels,
          arraysize(case_labels));
@@ -149,7 +225,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context =
         LoadObjectField<Context>(microtask, CallableTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, microtask_queue,
+                      saved_entered_context_count, var_batch_context, &done);
 
     TNode<JSReceiver> callable =
         LoadObjectField<JSReceiver>(microtask, CallableTask::kCallableOffset);
@@ -157,13 +234,17 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
       ScopedExceptionHandler handler(this, &if_exception, &var_exception);
       Call(microtask_context, callable, UndefinedConstant());
     }
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batch_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
 
   BIND(&is_callback);
   {
+    // Callbacks do not run in a context, so make sure that the embedder does
+    // not see the one of the batch as entered.
+    LeaveBatchContext(microtask_queue, saved_entered_context_count,
+                      var_batch_context);
     const TNode<Object> microtask_callback =
         LoadObjectField(microtask, CallbackTask::kCallbackOffset);
     const TNode<Object> microtask_data =
@@ -193,7 +274,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseResolveThenableJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, microtask_queue,
+                      saved_entered_context_count, var_batch_context, &done);
 
     const TNode<Object> promise_to_resolve = LoadObjectField(
         microtask, PromiseResolveThenableJobTask::kPromiseToResolveOffset);
@@ -214,7 +296,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     RunAllPromiseHooks(PromiseHookType::kAfter, microtask_context,
                    CAST(promise_to_resolve));
 
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batch_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -225,7 +307,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, microtask_queue,
+                      saved_entered_context_count, var_batch_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -267,7 +350,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batch_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -278,7 +361,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, microtask_queue,
+                      saved_entered_context_count, var_batch_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -320,7 +404,53 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batch_entered_context_count);
+    SetCurrentContext(current_context);
+    Goto(&done);
+  }
+
+  BIND(&is_async_function_resume_job);
+  {
+    // Enter the context of the {microtask}.
+    TNode<NativeContext> native_context = LoadObjectField<NativeContext>(
+        microtask, AsyncFunctionResumeJobTask::kContextOffset);
+    PrepareForContext(native_context, microtask_queue,
+                      saved_entered_context_count, var_batch_context, &done);
+
+    const TNode<JSAsyncFunctionObject> async_function_object =
+        LoadObjectField<JSAsyncFunctionObject>(
+            microtask, AsyncFunctionResumeJobTask::kAsyncFunctionObjectOffset);
+    const TNode<JSPromise> promise = LoadObjectField<JSPromise>(
+        microtask, AsyncFunctionResumeJobTask::kPromiseOffset);
+
+    TNode<Object> preserved_embedder_data = LoadObjectField(
+        microtask,
+        AsyncFunctionResumeJobTask::kContinuationPreservedEmbedderDataOffset);
+    Label preserved_data_done(this);
+    GotoIf(IsUndefined(preserved_embedder_data), &preserved_data_done);
+    StoreContextElement(native_context,
+                        Context::CONTINUATION_PRESERVED_EMBEDDER_DATA_INDEX,
+                        preserved_embedder_data);
+    Goto(&preserved_data_done);
+    BIND(&preserved_data_done);
+
+    // There are no promise hooks to run, since the await closures would not
+    // have a promise to report either.
+    {
+      ScopedExceptionHandler handler(this, &if_exception, &var_exception);
+      CallBuiltin(Builtin::kAsyncFunctionResumeJob, native_context,
+                  async_function_object, promise);
+    }
+
+    Label preserved_data_reset_done(this);
+    GotoIf(IsUndefined(preserved_embedder_data), &preserved_data_reset_done);
+    StoreContextElement(native_context,
+                        Context::CONTINUATION_PRESERVED_EMBEDDER_DATA_INDEX,
+                        UndefinedConstant());
+    Goto(&preserved_data_reset_done);
+    BIND(&preserved_data_reset_done);
+
+    RewindEnteredContext(batch_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -333,7 +463,10 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     // Report unhandled exceptions from microtasks.
     CallRuntime(Runtime::kReportMessageFromMicrotask, GetCurrentContext(),
                 var_exception.value());
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(Select<IntPtrT>(
+        IsUndefined(var_batch_context->value()),
+        [=] { return saved_entered_context_count; },
+        [=] { return batch_entered_context_count; }));
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -585,7 +718,10 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   auto microtask_queue =
       UncheckedParameter<RawPtrT>(Descriptor::kMicrotaskQueue);
 
-  Label loop(this), done(this);
+  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
+  TVARIABLE(Object, var_batch_context, UndefinedConstant());
+
+  Label loop(this, &var_batch_context), done(this);
   Goto(&loop);
   BIND(&loop);
 
@@ -612,12 +748,16 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   SetMicrotaskQueueSize(microtask_queue, new_size);
   SetMicrotaskQueueStart(microtask_queue, new_start);
 
-  RunSingleMicrotask(current_context, microtask);
+  RunSingleMicrotask(current_context, microtask, microtask_queue,
+                     saved_entered_context_count, &var_batch_context);
   IncrementFinishedMicrotaskCount(microtask_queue);
   Goto(&loop);
 
   BIND(&done);
   {
+    LeaveBatchContext(microtask_queue, saved_entered_context_count,
+                      &var_batch_context);
+
     // Reset the "current microtask" on the isolate.
     StoreRoot(RootIndex::kCurrentMicrotask, UndefinedConstant());
     Return(UndefinedConstant());
@@ -292,16 +292,17 @@ TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::FastGetOwnValuesOrEntries(
       TNode<Uint32T> details =
           LoadDetailsByDescriptorEntry(descriptors, descriptor_entry);
 
+      // If desc is not undefined and desc.[[Enumerable]] is true, then skip to
+      // the next descriptor. Checking this first lets non-enumerable
+      // accessors stay on the fast path.
+      GotoIfNot(IsPropertyEnumerable(details), &next_descriptor);
+
       TNode<Uint32T> kind = LoadPropertyKind(details);
 
       // If property is accessor, we escape fast path and call runtime.
       GotoIf(IsPropertyKindAccessor(kind), if_call_runtime_with_fast_path);
       CSA_DCHECK(this, IsPropertyKindData(kind));
 
-      // If desc is not undefined and desc.[[Enumerable]] is true, then skip to
-      // the next descriptor.
-      GotoIfNot(IsPropertyEnumerable(details), &next_descriptor);
-
       TVARIABLE(Object, var_property_value, UndefinedConstant());
       TNode<IntPtrT> descriptor_name_index = ToKeyIndex<DescriptorArray>(
           Unsigned(TruncateIntPtrToInt32(var_descriptor_number.value())));
@@ -19,6 +19,7 @@
 #include "src/objects/js-regexp.h"
 #include "src/objects/regexp-match-info.h"
 #include "src/regexp/regexp-flags.h"
+#include "src/regexp/regexp-prefilter.h"
 
 namespace v8 {
 namespace internal {
@@ -561,6 +562,41 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
   GotoIf(TaggedIsSmi(var_code.value()), &runtime);
   TNode<CodeT> code = CAST(var_code.value());
 
+  // Skip the part of the subject that can't contain a match, or fail right
+  // away if it lacks the literal that every match contains.
+  TVARIABLE(IntPtrT, var_start_index, int_last_index);
+  {
+    Label next(this);
+    TNode<Object> required_literal = UnsafeLoadFixedArrayElement(
+        data, JSRegExp::kIrregexpRequiredLiteralIndex);
+    GotoIf(TaggedIsSmi(required_literal), &next);
+    GotoIf(IntPtrLessThan(IntPtrSub(int_string_length, int_last_index),
+                          IntPtrConstant(RegExpPrefilter::kMinInputLength)),
+           &next);
+
+    TNode<BoolT> is_one_byte =
+        IsOneByteStringInstanceType(to_direct.instance_type());
+    TNode<ExternalReference> function = ExternalConstant(
+        ExternalReference::re_prefilter_skip_for_call_from_js());
+    MachineType type_ptr = MachineType::Pointer();
+    TNode<IntPtrT> skip = UncheckedCast<IntPtrT>(CallCFunction(
+        function, MachineType::IntPtr(),
+        std::make_pair(type_ptr, isolate_address),
+        std::make_pair(MachineType::AnyTagged(), data),
+        std::make_pair(type_ptr, var_string_start.value()),
+        std::make_pair(type_ptr, var_string_end.value()),
+        std::make_pair(MachineType::Int32(), ChangeBoolToInt32(is_one_byte))));
+    GotoIf(IntPtrLessThan(skip, IntPtrConstant(0)), &if_failure);
+
+    var_start_index = IntPtrAdd(int_last_index, skip);
+    TNode<IntPtrT> skip_size = Select<IntPtrT>(
+        is_one_byte, [=] { return skip; }, [=] { return WordShl(skip, 1); });
+    var_string_start = RawPtrAdd(var_string_start.value(), skip_size);
+    Goto(&next);
+
+    BIND(&next);
+  }
+
   Label if_success(this), if_exception(this, Label::kDeferred);
   {
     IncrementCounter(isolate()->counters()->regexp_entry_native(), 1);
@@ -580,7 +616,7 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     // Argument 1: Previous index.
     MachineType arg1_type = type_int32;
-    TNode<Int32T> arg1 = TruncateIntPtrToInt32(int_last_index);
+    TNode<Int32T> arg1 = TruncateIntPtrToInt32(var_start_index.value());
 
     // Argument 2: Start of string data. This argument is ignored in the
     // interpreter.
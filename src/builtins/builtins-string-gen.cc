@@ -251,8 +251,35 @@ void StringBuiltinsAssembler::StringEqual_Loop(
   TNode<RawPtrT> lhs_data = DirectStringData(lhs, lhs_instance_type);
   TNode<RawPtrT> rhs_data = DirectStringData(rhs, rhs_instance_type);
 
-  // Loop over the {lhs} and {rhs} strings to see if they are equal.
   TVARIABLE(IntPtrT, var_offset, IntPtrConstant(0));
+  if (lhs_type == rhs_type &&
+      UnalignedLoadSupported(MachineType::PointerRepresentation())) {
+    // Strings of the same width can be compared a word at a time, leaving
+    // the remaining characters to the loop below.
+    const int char_size_log2 = ElementSizeLog2Of(lhs_type.representation());
+    TNode<IntPtrT> byte_length = WordShl(length, char_size_log2);
+    TVARIABLE(IntPtrT, var_byte_offset, IntPtrConstant(0));
+    Label word_loop(this, &var_byte_offset), word_loop_done(this);
+    Goto(&word_loop);
+    BIND(&word_loop);
+    {
+      TNode<IntPtrT> next_byte_offset = IntPtrAdd(
+          var_byte_offset.value(), IntPtrConstant(kSystemPointerSize));
+      GotoIf(IntPtrGreaterThan(next_byte_offset, byte_length),
+             &word_loop_done);
+      TNode<UintPtrT> lhs_word =
+          UnalignedLoad<UintPtrT>(lhs_data, var_byte_offset.value());
+      TNode<UintPtrT> rhs_word =
+          UnalignedLoad<UintPtrT>(rhs_data, var_byte_offset.value());
+      GotoIf(WordNotEqual(lhs_word, rhs_word), if_not_equal);
+      var_byte_offset = next_byte_offset;
+      Goto(&word_loop);
+    }
+    BIND(&word_loop_done);
+    var_offset = WordSar(var_byte_offset.value(), char_size_log2);
+  }
+
+  // Loop over the {lhs} and {rhs} strings to see if they are equal.
   Label loop(this, &var_offset);
   Goto(&loop);
   BIND(&loop);
@@ -376,6 +403,33 @@ TNode<String> StringBuiltinsAssembler::StringAdd(
     GotoIf(Uint32LessThan(new_length, Uint32Constant(ConsString::kMinLength)),
            &non_cons);
 
+    // Appending a short string to a rope that ends in a short segment, as
+    // repeated += does, merges both into one flat segment instead of adding
+    // another node; see FactoryBase::NewConsString.
+    Label make_cons(this);
+    GotoIfNot(
+        Uint32LessThan(right_length, Uint32Constant(ConsString::kMinLength)),
+        &make_cons);
+    GotoIfNot(IsConsStringInstanceType(LoadInstanceType(left)), &make_cons);
+    {
+      TNode<String> left_second =
+          LoadObjectField<String>(left, ConsString::kSecondOffset);
+      TNode<Uint32T> tail_length =
+          Uint32Add(LoadStringLengthAsWord32(left_second), right_length);
+      GotoIfNot(
+          Uint32LessThan(tail_length, Uint32Constant(ConsString::kMinLength)),
+          &make_cons);
+      // The tail is shorter than ConsString::kMinLength, so this makes a flat
+      // string.
+      TNode<String> tail = CAST(CallBuiltin(Builtin::kStringAdd_CheckNone,
+                                            context, left_second, right));
+      result = AllocateConsString(
+          new_length, LoadObjectField<String>(left, ConsString::kFirstOffset),
+          tail);
+      Goto(&done_native);
+    }
+
+    BIND(&make_cons);
     result =
         AllocateConsString(new_length, var_left.value(), var_right.value());
     Goto(&done_native);
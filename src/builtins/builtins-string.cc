@@ -357,6 +357,18 @@ V8_WARN_UNUSED_RESULT static Object ConvertCase(
   // might break in the future if we implement more context and locale
   // dependent upper/lower conversions.
   if (String::IsOneByteRepresentationUnderneath(*s)) {
+    {
+      // Avoid allocating a copy of strings that are already in the requested
+      // case.
+      DisallowGarbageCollection no_gc;
+      String::FlatContent flat_content = s->GetFlatContent(no_gc);
+      if (FastAsciiUnchangedPrefixLength<Converter::kIsToLower>(
+              reinterpret_cast<const char*>(
+                  flat_content.ToOneByteVector().begin()),
+              length) == length) {
+        return *s;
+      }
+    }
     // Same length as input.
     Handle<SeqOneByteString> result =
         isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
@@ -5,6 +5,8 @@
 #ifndef V8_BUILTINS_BUILTINS_H_
 #define V8_BUILTINS_BUILTINS_H_
 
+#include <vector>
+
 #include "src/base/flags.h"
 #include "src/builtins/builtins-definitions.h"
 #include "src/common/globals.h"
@@ -276,6 +278,12 @@ class Builtins {
     js_entry_handler_offset_ = offset;
   }
 
+  // The order in which builtins are laid out in the embedded blob. Empty means
+  // definition order (mksnapshot-only).
+  const std::vector<Builtin>& embedded_blob_order() const {
+    return embedded_blob_order_;
+  }
+
   // Returns given builtin's slot in the main builtin table.
   FullObjectSlot builtin_slot(Builtin builtin);
   // Returns given builtin's slot in the tier0 builtin table.
@@ -326,6 +334,9 @@ class Builtins {
   // during codegen (mksnapshot-only).
   int js_entry_handler_offset_ = 0;
 
+  // See embedded_blob_order() (mksnapshot-only).
+  std::vector<Builtin> embedded_blob_order_;
+
   friend class SetupIsolateDelegate;
 };
 
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/builtins/builtins.h"
 #include "src/builtins/profile-data-reader.h"
 #include "src/codegen/assembler-inl.h"
@@ -189,6 +191,36 @@ Code BuildWithCodeStubAssemblerCS(Isolate* isolate, Builtin builtin,
   return *code;
 }
 
+// Orders builtins by how often they were entered while profiling, so that the
+// hot ones end up next to each other in the embedded blob. The entry count is
+// the counter of the start block, which has id 0. Builtins without profile
+// data keep their relative order after the profiled ones. Bytecode handlers
+// are not moved, since they must form a contiguous range.
+std::vector<Builtin> ComputeEmbeddedBlobOrder() {
+  std::vector<double> entry_counts(Builtins::kBuiltinCount, 0);
+  std::vector<Builtin> order;
+  order.reserve(Builtins::kBuiltinCount);
+  for (Builtin builtin = Builtins::kFirst;
+       builtin < Builtin::kFirstBytecodeHandler; ++builtin) {
+    const ProfileDataFromFile* profile_data =
+        ProfileDataFromFile::TryRead(Builtins::name(builtin));
+    if (profile_data != nullptr) {
+      entry_counts[static_cast<int>(builtin)] = profile_data->GetCounter(0);
+    }
+    order.push_back(builtin);
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&entry_counts](Builtin a, Builtin b) {
+                     return entry_counts[static_cast<int>(a)] >
+                            entry_counts[static_cast<int>(b)];
+                   });
+  for (Builtin builtin = Builtin::kFirstBytecodeHandler;
+       builtin <= Builtins::kLast; ++builtin) {
+    order.push_back(builtin);
+  }
+  return order;
+}
+
 }  // anonymous namespace
 
 // static
@@ -354,6 +386,10 @@ void SetupIsolateDelegate::SetupBuiltinsInternal(Isolate* isolate) {
   BUILTIN_PROMISE_REJECTION_PREDICTION_LIST(SET_PROMISE_REJECTION_PREDICTION)
 #undef SET_PROMISE_REJECTION_PREDICTION
 
+  if (FLAG_reorder_builtins) {
+    builtins->embedded_blob_order_ = ComputeEmbeddedBlobOrder();
+  }
+
   builtins->MarkInitialized();
 }
 
@@ -25,6 +25,7 @@
 #include "src/objects/heap-number.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/js-generator.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/oddball.h"
 #include "src/objects/ordered-hash-table-inl.h"
 #include "src/objects/property-cell.h"
@@ -9360,6 +9361,117 @@ void CodeStubAssembler::TransitionLookup(TNode<Name> unique_name,
                           if_found, var_name_index, if_not_found);
 }
 
+void CodeStubAssembler::DescriptorLookupWithCache(
+    TNode<Name> unique_name, TNode<Map> map, TNode<DescriptorArray> descriptors,
+    TNode<Uint32T> bitfield3, Label* if_found,
+    TVariable<IntPtrT>* var_name_index, Label* if_not_found) {
+  Comment("DescriptorLookupWithCache");
+  TNode<Uint32T> nof =
+      DecodeWord32<Map::Bits3::NumberOfOwnDescriptorsBits>(bitfield3);
+
+  // A linear search over a handful of descriptors is cheaper than probing
+  // the cache, so only consult it for maps with more descriptors.
+  const int kMaxDescriptorsForUncachedLookup = 8;
+  TVARIABLE(IntPtrT, var_cache_index, IntPtrConstant(-1));
+  Label lookup(this, &var_cache_index), cache_miss(this);
+  GotoIf(Uint32LessThanOrEqual(
+             nof, Int32Constant(kMaxDescriptorsForUncachedLookup)),
+         &lookup);
+
+  // Implements DescriptorLookupCache::Hash().
+  TNode<Uint32T> name_hash = LoadNameHash(unique_name, &lookup);
+  TNode<Word32T> map_hash =
+      Word32Shr(TruncateIntPtrToInt32(BitcastTaggedToWord(map)),
+                Int32Constant(kTaggedSizeLog2));
+  TNode<IntPtrT> cache_index = Signed(ChangeUint32ToWord(
+      Word32And(Word32Xor(map_hash, name_hash),
+                Int32Constant(DescriptorLookupCache::kLength - 1))));
+
+  TNode<ExternalReference> keys = ExternalConstant(
+      ExternalReference::descriptor_lookup_cache_keys(isolate()));
+  TNode<ExternalReference> results = ExternalConstant(
+      ExternalReference::descriptor_lookup_cache_results(isolate()));
+  TNode<IntPtrT> key_offset =
+      IntPtrMul(cache_index, IntPtrConstant(DescriptorLookupCache::kKeySize));
+  TNode<IntPtrT> result_offset = IntPtrMul(
+      cache_index, IntPtrConstant(DescriptorLookupCache::kResultSize));
+
+  var_cache_index = cache_index;
+  TNode<RawPtrT> cached_map = Load<RawPtrT>(
+      keys,
+      IntPtrAdd(key_offset,
+                IntPtrConstant(DescriptorLookupCache::kKeySourceOffset)));
+  GotoIfNot(WordEqual(cached_map, BitcastTaggedToWord(map)), &lookup);
+  TNode<RawPtrT> cached_name = Load<RawPtrT>(
+      keys, IntPtrAdd(key_offset,
+                      IntPtrConstant(DescriptorLookupCache::kKeyNameOffset)));
+  GotoIfNot(WordEqual(cached_name, BitcastTaggedToWord(unique_name)), &lookup);
+
+  TNode<Int32T> cached_result = Load<Int32T>(results, result_offset);
+  CSA_DCHECK(this,
+             Word32NotEqual(cached_result,
+                            Int32Constant(DescriptorLookupCache::kAbsent)));
+  GotoIf(Word32Equal(cached_result, Int32Constant(DescriptorArray::kNotFound)),
+         if_not_found);
+  *var_name_index = ToKeyIndex<DescriptorArray>(Unsigned(cached_result));
+  Goto(if_found);
+
+  BIND(&lookup);
+  {
+    Label found(this), not_found(this), update_cache(this);
+    TVARIABLE(Int32T, var_result);
+    Lookup<DescriptorArray>(unique_name, descriptors, nof, &found,
+                            var_name_index, &not_found);
+
+    BIND(&found);
+    {
+      GotoIf(IntPtrLessThan(var_cache_index.value(), IntPtrConstant(0)),
+             if_found);
+      var_result = Int32Div(
+          TruncateIntPtrToInt32(
+              IntPtrSub(var_name_index->value(),
+                        IntPtrConstant(DescriptorArray::ToKeyIndex(0)))),
+          Int32Constant(DescriptorArray::kEntrySize));
+      Goto(&update_cache);
+    }
+
+    BIND(&not_found);
+    {
+      GotoIf(IntPtrLessThan(var_cache_index.value(), IntPtrConstant(0)),
+             if_not_found);
+      var_result = Int32Constant(DescriptorArray::kNotFound);
+      Goto(&update_cache);
+    }
+
+    // Implements DescriptorLookupCache::Update(). The cache is cleared before
+    // every mark-compact, so it holds raw pointers without write barriers.
+    BIND(&update_cache);
+    {
+      TNode<IntPtrT> update_key_offset =
+          IntPtrMul(var_cache_index.value(),
+                    IntPtrConstant(DescriptorLookupCache::kKeySize));
+      StoreNoWriteBarrier(
+          MachineType::PointerRepresentation(), keys,
+          IntPtrAdd(update_key_offset,
+                    IntPtrConstant(DescriptorLookupCache::kKeySourceOffset)),
+          BitcastTaggedToWord(map));
+      StoreNoWriteBarrier(
+          MachineType::PointerRepresentation(), keys,
+          IntPtrAdd(update_key_offset,
+                    IntPtrConstant(DescriptorLookupCache::kKeyNameOffset)),
+          BitcastTaggedToWord(unique_name));
+      StoreNoWriteBarrier(
+          MachineRepresentation::kWord32, results,
+          IntPtrMul(var_cache_index.value(),
+                    IntPtrConstant(DescriptorLookupCache::kResultSize)),
+          var_result.value());
+      Branch(Word32Equal(var_result.value(),
+                         Int32Constant(DescriptorArray::kNotFound)),
+             if_not_found, if_found);
+    }
+  }
+}
+
 template <typename Array>
 void CodeStubAssembler::Lookup(TNode<Name> unique_name, TNode<Array> array,
                                TNode<Uint32T> number_of_valid_entries,
@@ -129,6 +129,8 @@ enum class PrimitiveType { kBoolean, kNumber, kString, kSymbol };
   V(arguments_to_string, arguments_to_string, ArgumentsToString)             \
   V(Array_string, Array_string, ArrayString)                                 \
   V(array_to_string, array_to_string, ArrayToString)                         \
+  V(AsyncFunctionResumeJobTaskMap, async_function_resume_job_task_map,       \
+    AsyncFunctionResumeJobTaskMap)                                           \
   V(BooleanMap, boolean_map, BooleanMap)                                     \
   V(boolean_to_string, boolean_to_string, BooleanToString)                   \
   V(ConsOneByteStringMap, cons_one_byte_string_map, ConsOneByteStringMap)    \
@@ -3927,6 +3929,14 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
                         TVariable<IntPtrT>* var_name_index,
                         Label* if_not_found);
 
+  // Implements DescriptorArray::SearchWithCache(), i.e. DescriptorLookup()
+  // backed by the isolate's DescriptorLookupCache.
+  void DescriptorLookupWithCache(TNode<Name> unique_name, TNode<Map> map,
+                                 TNode<DescriptorArray> descriptors,
+                                 TNode<Uint32T> bitfield3, Label* if_found,
+                                 TVariable<IntPtrT>* var_name_index,
+                                 Label* if_not_found);
+
   // Implements TransitionArray::SearchName() - searches for first transition
   // entry with given name (note that there could be multiple entries with
   // the same name).
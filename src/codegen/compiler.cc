@@ -19,8 +19,11 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
+#include "src/codegen/process-script-cache.h"
+#include "src/codegen/script-disk-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/codegen/unoptimized-compilation-info.h"
+#include "src/codegen/unoptimized-metadata-cache.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -44,6 +47,7 @@
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/bootstrapper.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
@@ -574,6 +578,26 @@ void InstallInterpreterTrampolineCopy(
                                    script_name, line_num, column_num));
 }
 
+Handle<FeedbackMetadata> FinalizeUnoptimizedMetadata(
+    UnoptimizedCompilationInfo* compilation_info, Isolate* isolate) {
+  if (FLAG_dedupe_unoptimized_metadata) {
+    UnoptimizedMetadataCache::DeduplicateBytecodeArray(
+        isolate, compilation_info->bytecode_array());
+    return UnoptimizedMetadataCache::GetOrCreateFeedbackMetadata(
+        isolate, compilation_info->feedback_vector_spec());
+  }
+  return FeedbackMetadata::New(isolate,
+                               compilation_info->feedback_vector_spec());
+}
+
+Handle<FeedbackMetadata> FinalizeUnoptimizedMetadata(
+    UnoptimizedCompilationInfo* compilation_info, LocalIsolate* isolate) {
+  // The metadata cache lives on the main-thread heap, so off-thread
+  // finalization does not deduplicate.
+  return FeedbackMetadata::New(isolate,
+                               compilation_info->feedback_vector_spec());
+}
+
 template <typename IsolateT>
 void InstallUnoptimizedCode(UnoptimizedCompilationInfo* compilation_info,
                             Handle<SharedFunctionInfo> shared_info,
@@ -591,10 +615,10 @@ void InstallUnoptimizedCode(UnoptimizedCompilationInfo* compilation_info,
     }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
-    shared_info->set_bytecode_array(*compilation_info->bytecode_array());
+    Handle<FeedbackMetadata> feedback_metadata =
+        FinalizeUnoptimizedMetadata(compilation_info, isolate);
 
-    Handle<FeedbackMetadata> feedback_metadata = FeedbackMetadata::New(
-        isolate, compilation_info->feedback_vector_spec());
+    shared_info->set_bytecode_array(*compilation_info->bytecode_array());
     shared_info->set_feedback_metadata(*feedback_metadata, kReleaseStore);
   } else {
 #if V8_ENABLE_WEBASSEMBLY
@@ -879,6 +903,10 @@ void InsertCodeIntoOptimizedCodeCache(
   const CodeKind kind = compilation_info->code_kind();
   if (!CodeKindIsStoredInOptimizedCodeCache(kind)) return;
 
+  if (kind == CodeKind::TURBOFAN) {
+    compilation_info->shared_info()->set_has_optimized_at_least_once(true);
+  }
+
   if (compilation_info->function_context_specializing()) {
     // Function context specialization folds-in the function context, so no
     // sharing can occur. Make sure the optimized code cache is cleared.
@@ -955,7 +983,8 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
                            Isolate* isolate,
                            OptimizedCompilationInfo* compilation_info,
                            CodeKind code_kind, Handle<JSFunction> function) {
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable() &&
+      !isolate->optimizing_compile_dispatcher()->EvictColderJob(*function)) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -1004,6 +1033,34 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
   return true;
 }
 
+// Called when a concurrent OSR job has published its code in the OSR code
+// cache. The frame that requested the compilation typically still runs the
+// loop, so arm its back edge (and those of the enclosing loops) to enter the
+// new code on the next iteration instead of waiting for the next tick.
+void ArmBackEdgesForConcurrentOSR(Isolate* isolate,
+                                  OptimizedCompilationInfo* compilation_info) {
+  Handle<JSFunction> function = compilation_info->closure();
+  if (function->IsInOptimizationQueue()) function->ClearOptimizationMarker();
+  Handle<BytecodeArray> bytecode(
+      function->shared().GetBytecodeArray(isolate), isolate);
+  interpreter::BytecodeArrayIterator iterator(
+      bytecode, compilation_info->osr_offset().ToInt());
+  DCHECK_EQ(iterator.current_bytecode(), interpreter::Bytecode::JumpLoop);
+  int loop_depth = iterator.GetImmediateOperand(1);
+  bytecode->set_osr_loop_nesting_level(
+      std::max(bytecode->osr_loop_nesting_level(),
+               std::min(loop_depth + 1, AbstractCode::kMaxLoopNestingMarker)));
+  // Sparkplug code only checks the arming on budget interrupts.
+  function->raw_feedback_cell().set_interrupt_budget(0);
+  if (FLAG_trace_osr) {
+    CodeTracer::Scope scope(isolate->GetCodeTracer());
+    PrintF(scope.file(), "[OSR - Concurrent compilation of ");
+    function->PrintName(scope.file());
+    PrintF(scope.file(), " at OSR bytecode offset %d finished]\n",
+           compilation_info->osr_offset().ToInt());
+  }
+}
+
 // Returns the code object at which execution continues after a concurrent
 // optimization job has been started (but not finished).
 Handle<CodeT> ContinuationForConcurrentOptimization(
@@ -1030,8 +1087,8 @@ bool ShouldOptimize(CodeKind code_kind, Handle<SharedFunctionInfo> shared) {
     case CodeKind::TURBOFAN:
       return FLAG_opt && shared->PassesFilter(FLAG_turbo_filter);
     case CodeKind::MAGLEV:
-      // TODO(v8:7700): FLAG_maglev_filter.
-      return FLAG_maglev;
+      return FLAG_maglev && !shared->maglev_compilation_failed() &&
+             shared->PassesFilter(FLAG_maglev_filter);
     default:
       UNREACHABLE();
   }
@@ -1085,8 +1142,9 @@ MaybeHandle<CodeT> CompileMaglev(
     Isolate* isolate, Handle<JSFunction> function, ConcurrencyMode mode,
     BytecodeOffset osr_offset, JavaScriptFrame* osr_frame,
     GetOptimizedCodeResultHandling result_handling) {
-  // TODO(v8:7700): Add missing support.
-  CHECK(mode == ConcurrencyMode::kNotConcurrent);
+  // TODO(v8:7700): Add missing support. Until the graph builder can run off
+  // the main thread, concurrent requests are compiled synchronously.
+  USE(mode);
   CHECK(osr_offset.IsNone());
   CHECK(osr_frame == nullptr);
   CHECK(result_handling == GetOptimizedCodeResultHandling::kDefault);
@@ -1097,7 +1155,20 @@ MaybeHandle<CodeT> CompileMaglev(
   PostponeInterruptsScope postpone(isolate);
 
 #ifdef V8_ENABLE_MAGLEV
-  return Maglev::Compile(isolate, function);
+  MaybeHandle<CodeT> code = Maglev::Compile(isolate, function);
+  if (!code.is_null()) {
+    function->shared().set_has_maglev_code_at_least_once(true);
+  } else {
+    // Don't retry on every tick; let the function tier up to TurboFan.
+    function->shared().set_maglev_compilation_failed(true);
+    if (FLAG_trace_opt) {
+      CodeTracer::Scope scope(isolate->GetCodeTracer());
+      PrintF(scope.file(), "[maglev: compilation of ");
+      function->ShortPrint(scope.file());
+      PrintF(scope.file(), " failed, tiering up to turbofan instead]\n");
+    }
+  }
+  return code;
 #else
   return {};
 #endif
@@ -1433,6 +1504,16 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
       function_literal_id_(kFunctionLiteralIdTopLevel) {
   VMState<PARSER> state(isolate);
 
+  // Streamed scripts are typically large bundles whose top-level parse is the
+  // startup bottleneck. Preparse their eagerly compiled top-level functions
+  // (e.g. the IIFEs that wrap bundled modules) and hand the full parse and
+  // compile of each one to a worker of the lazy compile dispatcher, so that
+  // they proceed in parallel. The results attach to the same Script and the
+  // scope analysis of the preparser is reused by the workers.
+  if (FLAG_parallel_compile_tasks_for_streaming) {
+    flags_.set_post_parallel_compile_tasks_for_eager_toplevel(true);
+  }
+
   LOG(isolate, ScriptEvent(Logger::ScriptEventType::kStreamingCompile,
                            flags_.script_id()));
 }
@@ -2064,6 +2145,7 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
       return false;
     }
     shared->set_baseline_code(ToCodeT(*code), kReleaseStore);
+    shared->set_has_baseline_code_at_least_once(true);
 
     if (V8_LIKELY(FLAG_use_osr)) {
       // Arm back edges for OSR
@@ -2112,14 +2194,18 @@ bool Compiler::CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
   // Bytecode must be available for maglev compilation.
   DCHECK(is_compiled_scope->is_compiled());
   // TODO(v8:7700): Support concurrent compilation.
-  DCHECK_EQ(mode, ConcurrencyMode::kNotConcurrent);
+  USE(mode);
 
   // Maglev code needs a feedback vector.
   JSFunction::EnsureFeedbackVector(isolate, function, is_compiled_scope);
 
   MaybeHandle<CodeT> maybe_code = Maglev::Compile(isolate, function);
   Handle<CodeT> code;
-  if (!maybe_code.ToHandle(&code)) return false;
+  if (!maybe_code.ToHandle(&code)) {
+    function->shared().set_maglev_compilation_failed(true);
+    return false;
+  }
+  function->shared().set_has_maglev_code_at_least_once(true);
 
   DCHECK_EQ(code->kind(), CodeKind::MAGLEV);
   function->set_code(*code);
@@ -2720,11 +2806,15 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
     const UnoptimizedCompileFlags flags, Handle<String> source,
     const ScriptDetails& script_details, NativesFlag natives,
     v8::Extension* extension, Isolate* isolate,
-    IsCompiledScope* is_compiled_scope) {
+    IsCompiledScope* is_compiled_scope,
+    ScriptCompiler::CompileHintCallback compile_hint_callback = nullptr,
+    void* compile_hint_callback_data = nullptr) {
   UnoptimizedCompileState compile_state;
   ReusableUnoptimizedCompileState reusable_state(isolate);
   ParseInfo parse_info(isolate, flags, &compile_state, &reusable_state);
   parse_info.set_extension(extension);
+  parse_info.set_compile_hint_callback(compile_hint_callback,
+                                       compile_hint_callback_data);
 
   Handle<Script> script =
       NewScript(isolate, &parse_info, source, script_details, natives);
@@ -2875,6 +2965,8 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     Isolate* isolate, Handle<String> source,
     const ScriptDetails& script_details, v8::Extension* extension,
     AlignedCachedData* cached_data, BackgroundDeserializeTask* deserialize_task,
+    ScriptCompiler::CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data,
     ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason);
@@ -2883,6 +2975,11 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
       compile_options == ScriptCompiler::kEagerCompile) {
     DCHECK_NULL(cached_data);
     DCHECK_NULL(deserialize_task);
+    DCHECK_NULL(compile_hint_callback);
+  } else if (compile_options == ScriptCompiler::kConsumeCompileHints) {
+    DCHECK_NULL(cached_data);
+    DCHECK_NULL(deserialize_task);
+    DCHECK_NOT_NULL(compile_hint_callback);
   } else {
     DCHECK_EQ(compile_options, ScriptCompiler::kConsumeCodeCache);
     // Have to have exactly one of cached_data or deserialize_task.
@@ -2924,6 +3021,12 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
   // nor put the compilation result back into the cache.
   const bool use_compilation_cache =
       extension == nullptr && script_details.repl_mode == REPLMode::kNo;
+  // The process-wide and on-disk caches are only consulted if the embedder
+  // did not bring its own code cache.
+  const bool use_shared_caches =
+      use_compilation_cache && natives == NOT_NATIVES_CODE &&
+      compile_options != ScriptCompiler::kConsumeCodeCache &&
+      (ProcessScriptCache::IsEnabled() || ScriptDiskCache::IsEnabled());
   MaybeHandle<SharedFunctionInfo> maybe_result;
   IsCompiledScope is_compiled_scope;
   if (use_compilation_cache) {
@@ -2969,6 +3072,26 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else if (use_shared_caches) {
+      NestedTimedHistogramScope timer(
+          isolate->counters()->compile_deserialize());
+      RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileDeserialize);
+      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                   "V8.CompileDeserialize");
+      Handle<SharedFunctionInfo> result;
+      if ((ProcessScriptCache::IsEnabled() &&
+           ProcessScriptCache::Lookup(isolate, source, script_details)
+               .ToHandle(&result)) ||
+          (ScriptDiskCache::IsEnabled() &&
+           ScriptDiskCache::Lookup(isolate, source, script_details)
+               .ToHandle(&result))) {
+        is_compiled_scope = result->is_compiled_scope(isolate);
+        if (is_compiled_scope.is_compiled()) {
+          maybe_result = result;
+          // Promote to per-isolate compilation cache.
+          compilation_cache->PutScript(source, language_mode, result);
+        }
+      }
     }
   }
 
@@ -2992,9 +3115,10 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
 
       flags.set_is_eager(compile_options == ScriptCompiler::kEagerCompile);
 
-      maybe_result =
-          CompileScriptOnMainThread(flags, source, script_details, natives,
-                                    extension, isolate, &is_compiled_scope);
+      maybe_result = CompileScriptOnMainThread(
+          flags, source, script_details, natives, extension, isolate,
+          &is_compiled_scope, compile_hint_callback,
+          compile_hint_callback_data);
     }
 
     // Add the result to the isolate cache.
@@ -3002,6 +3126,14 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (use_shared_caches) {
+        if (ProcessScriptCache::IsEnabled()) {
+          ProcessScriptCache::Store(isolate, source, script_details, result);
+        }
+        if (ScriptDiskCache::IsEnabled()) {
+          ScriptDiskCache::Store(isolate, source, script_details, result);
+        }
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -3017,9 +3149,23 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     const ScriptDetails& script_details,
     ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, nullptr, nullptr, nullptr, nullptr,
+      nullptr, compile_options, no_cache_reason, natives);
+}
+
+MaybeHandle<SharedFunctionInfo>
+Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details,
+    ScriptCompiler::CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data,
+    ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
       isolate, source, script_details, nullptr, nullptr, nullptr,
-      compile_options, no_cache_reason, natives);
+      compile_hint_callback, compile_hint_callback_data, compile_options,
+      no_cache_reason, natives);
 }
 
 MaybeHandle<SharedFunctionInfo>
@@ -3028,8 +3174,9 @@ Compiler::GetSharedFunctionInfoForScriptWithExtension(
     const ScriptDetails& script_details, v8::Extension* extension,
     ScriptCompiler::CompileOptions compile_options, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
-      isolate, source, script_details, extension, nullptr, nullptr,
-      compile_options, ScriptCompiler::kNoCacheBecauseV8Extension, natives);
+      isolate, source, script_details, extension, nullptr, nullptr, nullptr,
+      nullptr, compile_options, ScriptCompiler::kNoCacheBecauseV8Extension,
+      natives);
 }
 
 MaybeHandle<SharedFunctionInfo>
@@ -3039,8 +3186,8 @@ Compiler::GetSharedFunctionInfoForScriptWithCachedData(
     ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
-      isolate, source, script_details, nullptr, cached_data, nullptr,
-      compile_options, no_cache_reason, natives);
+      isolate, source, script_details, nullptr, cached_data, nullptr, nullptr,
+      nullptr, compile_options, no_cache_reason, natives);
 }
 
 MaybeHandle<SharedFunctionInfo>
@@ -3052,7 +3199,7 @@ Compiler::GetSharedFunctionInfoForScriptWithDeserializeTask(
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
       isolate, source, script_details, nullptr, nullptr, deserialize_task,
-      compile_options, no_cache_reason, natives);
+      nullptr, nullptr, compile_options, no_cache_reason, natives);
 }
 
 // static
@@ -3285,11 +3432,11 @@ template Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
 // static
 MaybeHandle<CodeT> Compiler::GetOptimizedCodeForOSR(
     Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
-    JavaScriptFrame* osr_frame) {
+    JavaScriptFrame* osr_frame, ConcurrencyMode mode) {
   DCHECK(!osr_offset.IsNone());
-  DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(isolate, function, ConcurrencyMode::kNotConcurrent,
-                          CodeKindForOSR(), osr_offset, osr_frame);
+  DCHECK_EQ(osr_frame == nullptr, mode == ConcurrencyMode::kConcurrent);
+  return GetOptimizedCode(isolate, function, mode, CodeKindForOSR(),
+                          osr_offset, osr_frame);
 }
 
 // static
@@ -3331,8 +3478,12 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
       if (V8_LIKELY(use_result)) {
         InsertCodeIntoOptimizedCodeCache(compilation_info);
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
-        compilation_info->closure()->set_code(*compilation_info->code(),
-                                              kReleaseStore);
+        if (compilation_info->is_osr()) {
+          ArmBackEdgesForConcurrentOSR(isolate, compilation_info);
+        } else {
+          compilation_info->closure()->set_code(*compilation_info->code(),
+                                                kReleaseStore);
+        }
       }
       return CompilationJob::SUCCEEDED;
     }
@@ -3341,7 +3492,11 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
   DCHECK_EQ(job->state(), CompilationJob::State::kFailed);
   CompilerTracer::TraceAbortedJob(isolate, compilation_info);
   if (V8_LIKELY(use_result)) {
-    compilation_info->closure()->set_code(shared->GetCode(), kReleaseStore);
+    // OSR jobs never replaced the function's code, so there is nothing to
+    // restore for them.
+    if (!compilation_info->is_osr()) {
+      compilation_info->closure()->set_code(shared->GetCode(), kReleaseStore);
+    }
     // Clear the InOptimizationQueue marker, if it exists.
     if (compilation_info->closure()->IsInOptimizationQueue()) {
       compilation_info->closure()->ClearOptimizationMarker();
@@ -172,6 +172,18 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       ScriptCompiler::NoCacheReason no_cache_reason,
       NativesFlag is_natives_code);
 
+  // Create a shared function info object for a String source, compiling the
+  // functions selected by {compile_hint_callback} eagerly.
+  static MaybeHandle<SharedFunctionInfo>
+  GetSharedFunctionInfoForScriptWithCompileHints(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details,
+      ScriptCompiler::CompileHintCallback compile_hint_callback,
+      void* compile_hint_callback_data,
+      ScriptCompiler::CompileOptions compile_options,
+      ScriptCompiler::NoCacheReason no_cache_reason,
+      NativesFlag is_natives_code);
+
   // Create a shared function info object for a String source.
   static MaybeHandle<SharedFunctionInfo>
   GetSharedFunctionInfoForScriptWithExtension(
@@ -233,9 +245,14 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // In concurrent mode a background job is started unless cached OSR code is
+  // available, and the result is published in the OSR code cache once the
+  // job is finalized; {osr_frame} must be null in that case since the frame
+  // will be gone by then.
   V8_WARN_UNUSED_RESULT static MaybeHandle<CodeT> GetOptimizedCodeForOSR(
       Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame,
+      ConcurrencyMode mode = ConcurrencyMode::kNotConcurrent);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
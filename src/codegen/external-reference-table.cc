@@ -59,12 +59,16 @@ const char* const
         "Load StubCache::secondary_->key",
         "Load StubCache::secondary_->value",
         "Load StubCache::secondary_->map",
+        "Load StubCache::primary_mask_",
+        "Load StubCache::secondary_mask_",
         "Store StubCache::primary_->key",
         "Store StubCache::primary_->value",
         "Store StubCache::primary_->map",
         "Store StubCache::secondary_->key",
         "Store StubCache::secondary_->value",
         "Store StubCache::secondary_->map",
+        "Store StubCache::primary_mask_",
+        "Store StubCache::secondary_mask_",
         // Native code counters:
         STATS_COUNTER_NATIVE_CODE_LIST(ADD_STATS_COUNTER_NAME)
 };
@@ -272,6 +276,8 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
   Add(load_stub_cache->key_reference(StubCache::kSecondary).address(), index);
   Add(load_stub_cache->value_reference(StubCache::kSecondary).address(), index);
   Add(load_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kSecondary).address(), index);
 
   StubCache* store_stub_cache = isolate->store_stub_cache();
 
@@ -283,6 +289,9 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
   Add(store_stub_cache->value_reference(StubCache::kSecondary).address(),
       index);
   Add(store_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(store_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(store_stub_cache->mask_reference(StubCache::kSecondary).address(),
+      index);
 
   CHECK_EQ(kSizeIsolateIndependent + kExternalReferenceCountIsolateDependent +
                kIsolateAddressReferenceCount + kStubCacheReferenceCount,
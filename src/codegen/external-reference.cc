@@ -26,12 +26,15 @@
 #include "src/numbers/hash-seed-inl.h"
 #include "src/numbers/math-random.h"
 #include "src/objects/elements.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/object-type.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/ordered-hash-table.h"
+#include "src/objects/simd.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-interpreter.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
+#include "src/regexp/regexp-prefilter.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/strings/string-search.h"
 
@@ -347,6 +350,17 @@ ExternalReference ExternalReference::date_cache_stamp(Isolate* isolate) {
   return ExternalReference(isolate->date_cache()->stamp_address());
 }
 
+ExternalReference ExternalReference::descriptor_lookup_cache_keys(
+    Isolate* isolate) {
+  return ExternalReference(isolate->descriptor_lookup_cache()->keys_address());
+}
+
+ExternalReference ExternalReference::descriptor_lookup_cache_results(
+    Isolate* isolate) {
+  return ExternalReference(
+      isolate->descriptor_lookup_cache()->results_address());
+}
+
 // static
 ExternalReference
 ExternalReference::runtime_function_table_address_for_unittests(
@@ -760,6 +774,9 @@ FUNCTION_REFERENCE(re_match_for_call_from_js,
 FUNCTION_REFERENCE(re_experimental_match_for_call_from_js,
                    ExperimentalRegExp::MatchForCallFromJs)
 
+FUNCTION_REFERENCE(re_prefilter_skip_for_call_from_js,
+                   RegExpPrefilter::SkipForCallFromJs)
+
 FUNCTION_REFERENCE(re_case_insensitive_compare_unicode,
                    NativeRegExpMacroAssembler::CaseInsensitiveCompareUnicode)
 
@@ -895,6 +912,10 @@ ExternalReference ExternalReference::search_string_raw() {
   return ExternalReference(Redirect(FUNCTION_ADDR(f)));
 }
 
+FUNCTION_REFERENCE(array_indexof_includes_smi_or_object,
+                   ArrayIndexOfIncludesSmiOrObject)
+FUNCTION_REFERENCE(array_indexof_includes_double, ArrayIndexOfIncludesDouble)
+
 FUNCTION_REFERENCE(jsarray_array_join_concat_to_sequential_string,
                    JSArray::ArrayJoinConcatToSequentialString)
 
@@ -1138,6 +1159,9 @@ ExternalReference ExternalReference::stack_is_iterable_address(
 FUNCTION_REFERENCE(call_enqueue_microtask_function,
                    MicrotaskQueue::CallEnqueueMicrotask)
 
+FUNCTION_REFERENCE(call_account_microtask_context_function,
+                   MicrotaskQueue::CallAccountMicrotaskContext)
+
 static int64_t atomic_pair_load(intptr_t address) {
   return std::atomic_load(reinterpret_cast<std::atomic<int64_t>*>(address));
 }
@@ -33,6 +33,8 @@ class StatsCounter;
   V(interpreter_dispatch_counters, "Interpreter::dispatch_counters")           \
   V(interpreter_dispatch_table_address, "Interpreter::dispatch_table_address") \
   V(date_cache_stamp, "date_cache_stamp")                                      \
+  V(descriptor_lookup_cache_keys, "DescriptorLookupCache::keys_")              \
+  V(descriptor_lookup_cache_results, "DescriptorLookupCache::results_")        \
   V(stress_deopt_count, "Isolate::stress_deopt_count_address()")               \
   V(force_slow_path, "Isolate::force_slow_path_address()")                     \
   V(isolate_root, "Isolate::isolate_root()")                                   \
@@ -107,6 +109,9 @@ class StatsCounter;
   V(address_of_shared_string_table_flag, "FLAG_shared_string_table")           \
   V(address_of_the_hole_nan, "the_hole_nan")                                   \
   V(address_of_uint32_bias, "uint32_bias")                                     \
+  V(array_indexof_includes_double, "array_indexof_includes_double")            \
+  V(array_indexof_includes_smi_or_object,                                      \
+    "array_indexof_includes_smi_or_object")                                    \
   V(baseline_pc_for_bytecode_offset, "BaselinePCForBytecodeOffset")            \
   V(baseline_pc_for_next_executed_bytecode,                                    \
     "BaselinePCForNextExecutedBytecode")                                       \
@@ -253,6 +258,8 @@ class StatsCounter;
   V(supports_cetss_address, "CpuFeatures::supports_cetss_address")             \
   V(write_barrier_marking_from_code_function, "WriteBarrier::MarkingFromCode") \
   V(call_enqueue_microtask_function, "MicrotaskQueue::CallEnqueueMicrotask")   \
+  V(call_account_microtask_context_function,                                   \
+    "MicrotaskQueue::CallAccountMicrotaskContext")                             \
   V(call_enter_context_function, "call_enter_context_function")                \
   V(atomic_pair_load_function, "atomic_pair_load_function")                    \
   V(atomic_pair_store_function, "atomic_pair_store_function")                  \
@@ -297,6 +304,8 @@ class StatsCounter;
   V(re_grow_stack, "NativeRegExpMacroAssembler::GrowStack()")                  \
   V(re_word_character_map, "NativeRegExpMacroAssembler::word_character_map")   \
   V(re_match_for_call_from_js, "IrregexpInterpreter::MatchForCallFromJs")      \
+  V(re_prefilter_skip_for_call_from_js,                                        \
+    "RegExpPrefilter::SkipForCallFromJs")                                      \
   V(re_experimental_match_for_call_from_js,                                    \
     "ExperimentalRegExp::MatchForCallFromJs")                                  \
   EXTERNAL_REFERENCE_LIST_INTL(V)                                              \
@@ -0,0 +1,134 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/process-script-cache.h"
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/codegen/script-details.h"
+#include "src/codegen/script-disk-cache.h"
+#include "src/execution/isolate.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+using EntryData = std::shared_ptr<const std::vector<byte>>;
+
+class EntryTable {
+ public:
+  EntryData Get(const std::string& key) {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return {};
+    return it->second.data;
+  }
+
+  void Put(const std::string& key, EntryData data) {
+    if (data->size() > ProcessScriptCache::kMaxSize) return;
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) Erase(it);
+    while (size_ + data->size() > ProcessScriptCache::kMaxSize) {
+      DCHECK(!insertion_order_.empty());
+      std::pair<uint64_t, std::string> oldest =
+          std::move(insertion_order_.front());
+      insertion_order_.pop_front();
+      // Entries that were replaced or removed leave stale ids behind.
+      auto oldest_it = entries_.find(oldest.second);
+      if (oldest_it != entries_.end() && oldest_it->second.id == oldest.first) {
+        Erase(oldest_it);
+      }
+    }
+    uint64_t id = next_id_++;
+    size_ += data->size();
+    entries_.emplace(key, Entry{std::move(data), id});
+    insertion_order_.emplace_back(id, key);
+  }
+
+  // Removes the entry for {key} unless it was replaced since {data} was read.
+  void Remove(const std::string& key, const EntryData& data) {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end() && it->second.data == data) Erase(it);
+  }
+
+  void Clear() {
+    base::MutexGuard guard(&mutex_);
+    entries_.clear();
+    insertion_order_.clear();
+    size_ = 0;
+  }
+
+ private:
+  struct Entry {
+    EntryData data;
+    uint64_t id;
+  };
+  using EntryMap = std::unordered_map<std::string, Entry>;
+
+  void Erase(EntryMap::iterator it) {
+    size_ -= it->second.data->size();
+    entries_.erase(it);
+  }
+
+  base::Mutex mutex_;
+  EntryMap entries_;
+  // Ids and keys in the order the entries were put, for eviction.
+  std::deque<std::pair<uint64_t, std::string>> insertion_order_;
+  size_t size_ = 0;
+  uint64_t next_id_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(EntryTable, GetEntryTable)
+
+}  // namespace
+
+// static
+MaybeHandle<SharedFunctionInfo> ProcessScriptCache::Lookup(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details) {
+  DCHECK(IsEnabled());
+  std::string key = ScriptDiskCache::EntryName(isolate, source, script_details);
+  // Holding on to the data keeps it alive even if another isolate evicts the
+  // entry while this one deserializes it.
+  EntryData data = GetEntryTable()->Get(key);
+  if (!data) return {};
+
+  AlignedCachedData cached_data(data->data(), static_cast<int>(data->size()));
+  MaybeHandle<SharedFunctionInfo> result = CodeSerializer::Deserialize(
+      isolate, &cached_data, source, script_details.origin_options);
+  if (cached_data.rejected()) GetEntryTable()->Remove(key, data);
+  return result;
+}
+
+// static
+void ProcessScriptCache::Store(Isolate* isolate, Handle<String> source,
+                               const ScriptDetails& script_details,
+                               Handle<SharedFunctionInfo> toplevel) {
+  DCHECK(IsEnabled());
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(toplevel));
+  if (!cached_data) return;
+  EntryData data = std::make_shared<const std::vector<byte>>(
+      cached_data->data, cached_data->data + cached_data->length);
+  GetEntryTable()->Put(
+      ScriptDiskCache::EntryName(isolate, source, script_details),
+      std::move(data));
+}
+
+// static
+void ProcessScriptCache::Clear() { GetEntryTable()->Clear(); }
+
+}  // namespace internal
+}  // namespace v8
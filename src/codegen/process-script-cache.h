@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_PROCESS_SCRIPT_CACHE_H_
+#define V8_CODEGEN_PROCESS_SCRIPT_CACHE_H_
+
+#include "src/common/globals.h"
+#include "src/flags/flags.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+class String;
+struct ScriptDetails;
+
+// A cache of compiled top-level scripts shared by all isolates of the
+// process (see --process-script-cache). It sits below the per-isolate
+// CompilationCache, so that an isolate that loads a script another isolate
+// has already compiled deserializes it instead of parsing and compiling it
+// again.
+//
+// Heap objects cannot be shared between isolates, so entries are kept in the
+// code cache format of CodeSerializer in off-heap memory, keyed like the
+// entries of ScriptDiskCache. The cache holds at most kMaxSize bytes and
+// evicts the oldest entries first.
+class V8_EXPORT_PRIVATE ProcessScriptCache final : public AllStatic {
+ public:
+  static bool IsEnabled() { return FLAG_process_script_cache; }
+
+  // Returns the script deserialized from the entry for {source}, if there is
+  // one.
+  static MaybeHandle<SharedFunctionInfo> Lookup(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details);
+
+  // Serializes the freshly compiled {toplevel} into the entry for {source}.
+  static void Store(Isolate* isolate, Handle<String> source,
+                    const ScriptDetails& script_details,
+                    Handle<SharedFunctionInfo> toplevel);
+
+  // Drops all entries.
+  static void Clear();
+
+  static constexpr size_t kMaxSize = 64 * MB;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_PROCESS_SCRIPT_CACHE_H_
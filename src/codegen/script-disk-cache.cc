@@ -0,0 +1,158 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/script-disk-cache.h"
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <utility>
+
+#include "include/v8-platform.h"
+#include "src/base/functional.h"
+#include "src/base/platform/platform.h"
+#include "src/base/strings.h"
+#include "src/codegen/script-details.h"
+#include "src/execution/isolate.h"
+#include "src/init/v8.h"
+#include "src/objects/string-inl.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/snapshot/snapshot.h"
+#include "src/utils/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+size_t HashStringContents(Isolate* isolate, Handle<String> string) {
+  string = String::Flatten(isolate, string);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = string->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    return base::hash_range(chars.begin(), chars.end());
+  }
+  base::Vector<const base::uc16> chars = content.ToUC16Vector();
+  return base::hash_range(chars.begin(), chars.end());
+}
+
+size_t HashOrigin(Isolate* isolate, const ScriptDetails& script_details) {
+  size_t hash = base::hash_combine(script_details.line_offset,
+                                   script_details.column_offset,
+                                   script_details.origin_options.Flags());
+  Handle<Object> name;
+  if (script_details.name_obj.ToHandle(&name) && name->IsString()) {
+    hash = base::hash_combine(
+        hash, HashStringContents(isolate, Handle<String>::cast(name)));
+  }
+  return hash;
+}
+
+// Everything that makes serialized code incompatible without being part of
+// the script itself. The code serializer checks all of it again on
+// deserialization; hashing it into the file name just means that processes
+// with different configurations sharing the cache directory do not keep
+// overwriting each other's entries.
+uint32_t ConfigurationHash(Isolate* isolate) {
+  size_t hash = base::hash_combine(Version::Hash(), FlagList::Hash());
+  if (isolate->snapshot_available()) {
+    hash = base::hash_combine(
+        hash, Snapshot::GetExpectedChecksum(isolate->snapshot_blob()));
+  }
+  return static_cast<uint32_t>(hash);
+}
+
+class WriteEntryTask final : public v8::Task {
+ public:
+  WriteEntryTask(std::string path,
+                 std::unique_ptr<ScriptCompiler::CachedData> data)
+      : path_(std::move(path)), data_(std::move(data)) {}
+
+  void Run() override {
+    static std::atomic<int> next_temp_id{0};
+    // Write to a file that nobody else reads and rename it into place
+    // afterwards, so that readers never observe a partially written entry.
+    std::string temp_path = path_ + "." +
+                            std::to_string(base::OS::GetCurrentProcessId()) +
+                            "." + std::to_string(next_temp_id++) + ".tmp";
+    FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+    if (file == nullptr) return;
+    size_t length = static_cast<size_t>(data_->length);
+    bool success = fwrite(data_->data, 1, length, file) == length;
+    success = fclose(file) == 0 && success;
+    if (!success || std::rename(temp_path.c_str(), path_.c_str()) != 0) {
+      base::OS::Remove(temp_path.c_str());
+    }
+  }
+
+ private:
+  const std::string path_;
+  const std::unique_ptr<ScriptCompiler::CachedData> data_;
+};
+
+}  // namespace
+
+// static
+std::string ScriptDiskCache::EntryName(Isolate* isolate, Handle<String> source,
+                                       const ScriptDetails& script_details) {
+  char name[64];
+  base::SNPrintF(base::ArrayVector(name),
+                 "%016" PRIx64 "-%08x-%08x-%08x.v8cache",
+                 static_cast<uint64_t>(HashStringContents(isolate, source)),
+                 static_cast<uint32_t>(source->length()),
+                 static_cast<uint32_t>(HashOrigin(isolate, script_details)),
+                 ConfigurationHash(isolate));
+  return name;
+}
+
+// static
+std::string ScriptDiskCache::EntryPath(Isolate* isolate, Handle<String> source,
+                                       const ScriptDetails& script_details) {
+  std::string path(FLAG_script_cache_dir);
+  if (!path.empty() && !base::OS::isDirectorySeparator(path.back())) {
+    path += base::OS::DirectorySeparator();
+  }
+  return path + EntryName(isolate, source, script_details);
+}
+
+// static
+MaybeHandle<SharedFunctionInfo> ScriptDiskCache::Lookup(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details) {
+  DCHECK(IsEnabled());
+  std::string path = EntryPath(isolate, source, script_details);
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!file || file->size() == 0 || file->size() > kMaxInt) return {};
+
+  AlignedCachedData cached_data(static_cast<const byte*>(file->memory()),
+                                static_cast<int>(file->size()));
+  MaybeHandle<SharedFunctionInfo> result = CodeSerializer::Deserialize(
+      isolate, &cached_data, source, script_details.origin_options);
+  if (cached_data.rejected()) {
+    // The entry is corrupt or stems from a hash collision. Drop it so that it
+    // is replaced by the next Store.
+    file.reset();
+    base::OS::Remove(path.c_str());
+  }
+  return result;
+}
+
+// static
+void ScriptDiskCache::Store(Isolate* isolate, Handle<String> source,
+                            const ScriptDetails& script_details,
+                            Handle<SharedFunctionInfo> toplevel) {
+  DCHECK(IsEnabled());
+  std::unique_ptr<ScriptCompiler::CachedData> data(
+      CodeSerializer::Serialize(toplevel));
+  if (!data) return;
+  V8::GetCurrentPlatform()->CallOnWorkerThread(std::make_unique<WriteEntryTask>(
+      EntryPath(isolate, source, script_details), std::move(data)));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,61 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_SCRIPT_DISK_CACHE_H_
+#define V8_CODEGEN_SCRIPT_DISK_CACHE_H_
+
+#include <string>
+
+#include "src/common/globals.h"
+#include "src/flags/flags.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+class String;
+struct ScriptDetails;
+
+// A persistent cache of compiled top-level scripts, stored as code cache
+// files in the directory given by --script-cache-dir. It sits below the
+// per-isolate CompilationCache and provides the code caching that an
+// embedder would otherwise implement on top of ScriptCompiler::CachedData.
+//
+// Entries are keyed by a hash of the source contents and the script origin,
+// and the file name additionally encodes the V8 version, the flag hash and
+// the snapshot checksum, so that incompatible entries are never read. Reads
+// map the file into memory; writes happen on a worker thread and are made
+// visible atomically by renaming a temporary file, so that concurrent
+// processes sharing the directory only ever see complete entries.
+class V8_EXPORT_PRIVATE ScriptDiskCache final : public AllStatic {
+ public:
+  static bool IsEnabled() { return FLAG_script_cache_dir != nullptr; }
+
+  // Returns the script deserialized from the cache entry for {source}, if
+  // there is one.
+  static MaybeHandle<SharedFunctionInfo> Lookup(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details);
+
+  // Serializes the freshly compiled {toplevel} and writes it to the cache
+  // entry for {source} on a worker thread.
+  static void Store(Isolate* isolate, Handle<String> source,
+                    const ScriptDetails& script_details,
+                    Handle<SharedFunctionInfo> toplevel);
+
+  // Returns a name for {source} that is unique among all scripts and
+  // configurations, used as the file name of its entry.
+  static std::string EntryName(Isolate* isolate, Handle<String> source,
+                               const ScriptDetails& script_details);
+
+  // Returns the path of the cache entry for {source}. Exposed for testing.
+  static std::string EntryPath(Isolate* isolate, Handle<String> source,
+                               const ScriptDetails& script_details);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_SCRIPT_DISK_CACHE_H_
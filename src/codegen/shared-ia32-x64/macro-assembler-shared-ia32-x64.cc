@@ -363,10 +363,18 @@ void SharedTurboAssembler::I8x16SplatPreAvx2(XMMRegister dst, Op src,
                                              XMMRegister scratch) {
   ASM_CODE_COMMENT(this);
   DCHECK(!CpuFeatures::IsSupported(AVX2));
-  CpuFeatureScope ssse3_scope(this, SSSE3);
-  Movd(dst, src);
-  Xorps(scratch, scratch);
-  Pshufb(dst, scratch);
+  if (CpuFeatures::IsSupported(SSSE3)) {
+    CpuFeatureScope ssse3_scope(this, SSSE3);
+    Movd(dst, src);
+    Xorps(scratch, scratch);
+    Pshufb(dst, scratch);
+  } else {
+    // SSE2 only, for builtins that must run on any supported CPU.
+    Movd(dst, src);
+    Punpcklbw(dst, dst);
+    Pshuflw(dst, dst, uint8_t{0});
+    Pshufd(dst, dst, uint8_t{0});
+  }
 }
 
 void SharedTurboAssembler::I8x16Splat(XMMRegister dst, Register src,
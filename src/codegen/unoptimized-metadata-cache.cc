@@ -0,0 +1,186 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/unoptimized-metadata-cache.h"
+
+#include <cstring>
+
+#include "src/base/functional.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/read-only-heap.h"
+#include "src/objects/bytecode-array-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/heap-number-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+enum class EntryKind { kConstantPool, kHandlerTable, kFeedbackMetadata };
+
+FixedArray EnsureCache(Isolate* isolate) {
+  Heap* heap = isolate->heap();
+  FixedArray cache = heap->unoptimized_metadata_cache();
+  if (cache.length() == 0) {
+    // Allocate lazily so that isolates which never compile anything (or run
+    // with the cache disabled) do not pay for it.
+    cache = *isolate->factory()->NewFixedArray(
+        UnoptimizedMetadataCache::kCacheSize, AllocationType::kOld);
+    heap->SetRootUnoptimizedMetadataCache(cache);
+  }
+  return cache;
+}
+
+int IndexFor(EntryKind kind, size_t hash) {
+  return static_cast<int>(base::hash_combine(static_cast<int>(kind), hash) &
+                          (UnoptimizedMetadataCache::kCacheSize - 1));
+}
+
+// Constant pool entries may only be compared if they are not tied to the
+// function that owns the pool. Internalized strings and read-only objects are
+// compared by identity, heap numbers by value. Anything else (inner
+// SharedFunctionInfos, ScopeInfos, boilerplate descriptions) makes the pool
+// specific to its function.
+bool HashConstant(Object constant, size_t* hash) {
+  if (constant.IsSmi()) {
+    *hash = base::hash_value(Smi::ToInt(constant));
+    return true;
+  }
+  HeapObject object = HeapObject::cast(constant);
+  if (object.IsInternalizedString()) {
+    *hash = String::cast(object).EnsureHash();
+    return true;
+  }
+  if (object.IsHeapNumber()) {
+    *hash = base::hash_value(
+        HeapNumber::cast(object).value_as_bits(kRelaxedLoad));
+    return true;
+  }
+  if (ReadOnlyHeap::Contains(object)) {
+    *hash = base::hash_value(object.ptr());
+    return true;
+  }
+  return false;
+}
+
+bool ConstantsMatch(Object a, Object b) {
+  if (a == b) return true;
+  return a.IsHeapNumber() && b.IsHeapNumber() &&
+         HeapNumber::cast(a).value_as_bits(kRelaxedLoad) ==
+             HeapNumber::cast(b).value_as_bits(kRelaxedLoad);
+}
+
+bool HashConstantPool(FixedArray constant_pool, size_t* hash) {
+  size_t result = base::hash_value(constant_pool.length());
+  for (int i = 0; i < constant_pool.length(); ++i) {
+    size_t constant_hash;
+    if (!HashConstant(constant_pool.get(i), &constant_hash)) return false;
+    result = base::hash_combine(result, constant_hash);
+  }
+  *hash = result;
+  return true;
+}
+
+bool ConstantPoolsMatch(FixedArray a, FixedArray b) {
+  if (a.length() != b.length()) return false;
+  for (int i = 0; i < a.length(); ++i) {
+    if (!ConstantsMatch(a.get(i), b.get(i))) return false;
+  }
+  return true;
+}
+
+bool HandlerTablesMatch(ByteArray a, ByteArray b) {
+  return a.length() == b.length() &&
+         memcmp(a.GetDataStartAddress(), b.GetDataStartAddress(),
+                a.length()) == 0;
+}
+
+size_t HashFeedbackVectorSpec(const FeedbackVectorSpec* spec) {
+  size_t hash = base::hash_combine(spec->slot_count(),
+                                   spec->create_closure_slot_count());
+  for (int i = 0; i < spec->slot_count(); ++i) {
+    hash = base::hash_combine(
+        hash, static_cast<int>(spec->GetKind(FeedbackSlot(i))));
+  }
+  return hash;
+}
+
+}  // namespace
+
+// static
+void UnoptimizedMetadataCache::DeduplicateBytecodeArray(
+    Isolate* isolate, Handle<BytecodeArray> bytecode) {
+  FixedArray cache = EnsureCache(isolate);
+  DisallowGarbageCollection no_gc;
+
+  FixedArray constant_pool = bytecode->constant_pool();
+  size_t hash;
+  if (constant_pool.length() > 0 && HashConstantPool(constant_pool, &hash)) {
+    int index = IndexFor(EntryKind::kConstantPool, hash);
+    Object entry = cache.get(index);
+    if (entry.IsFixedArray() &&
+        ConstantPoolsMatch(FixedArray::cast(entry), constant_pool)) {
+      bytecode->set_constant_pool(FixedArray::cast(entry));
+    } else {
+      cache.set(index, constant_pool);
+    }
+  }
+
+  ByteArray handler_table = bytecode->handler_table();
+  if (handler_table.length() > 0) {
+    hash = base::hash_range(handler_table.GetDataStartAddress(),
+                            handler_table.GetDataEndAddress());
+    int index = IndexFor(EntryKind::kHandlerTable, hash);
+    Object entry = cache.get(index);
+    if (entry.IsByteArray() &&
+        HandlerTablesMatch(ByteArray::cast(entry), handler_table)) {
+      bytecode->set_handler_table(ByteArray::cast(entry));
+    } else {
+      cache.set(index, handler_table);
+    }
+  }
+}
+
+// static
+Handle<FeedbackMetadata> UnoptimizedMetadataCache::GetOrCreateFeedbackMetadata(
+    Isolate* isolate, const FeedbackVectorSpec* spec) {
+  // Empty metadata is canonical already.
+  if (spec == nullptr ||
+      (spec->slot_count() == 0 && spec->create_closure_slot_count() == 0)) {
+    return FeedbackMetadata::New(isolate, spec);
+  }
+
+  int index = IndexFor(EntryKind::kFeedbackMetadata,
+                       HashFeedbackVectorSpec(spec));
+  Handle<FixedArray> cache(EnsureCache(isolate), isolate);
+  Object entry = cache->get(index);
+  if (entry.IsFeedbackMetadata()) {
+    FeedbackMetadata metadata = FeedbackMetadata::cast(entry);
+    if (metadata.create_closure_slot_count() ==
+            spec->create_closure_slot_count() &&
+        !metadata.SpecDiffersFrom(spec)) {
+      return handle(metadata, isolate);
+    }
+  }
+
+  Handle<FeedbackMetadata> metadata = FeedbackMetadata::New(isolate, spec);
+  cache->set(index, *metadata);
+  return metadata;
+}
+
+// static
+void UnoptimizedMetadataCache::Clear(Heap* heap) {
+  FixedArray cache = heap->unoptimized_metadata_cache();
+  for (int i = 0; i < cache.length(); ++i) {
+    cache.set_undefined(i);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,54 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_UNOPTIMIZED_METADATA_CACHE_H_
+#define V8_CODEGEN_UNOPTIMIZED_METADATA_CACHE_H_
+
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class BytecodeArray;
+class FeedbackMetadata;
+class FeedbackVectorSpec;
+class Heap;
+
+// Shares the immutable metadata that the bytecode generator emits for every
+// function between functions for which it is identical: constant pools,
+// handler tables and feedback metadata. Many small functions (accessors,
+// callbacks, methods of generated code) produce exactly the same tables, and
+// keeping one copy of each saves old-space memory.
+//
+// The cache is direct-mapped and lives in a root on the main-thread heap. It
+// is cleared on every mark-compact, so it never keeps anything alive for
+// longer than one GC cycle and is only effective for functions finalized close
+// to each other, which is the common case during script load.
+//
+// The BytecodeArray itself is deliberately not shared: bytecode flushing turns
+// the array into UncompiledData in place, and lazily collected source
+// positions, which are absolute script offsets, are attached to the array and
+// read from it by frames that are already on the stack.
+class UnoptimizedMetadataCache final : public AllStatic {
+ public:
+  // Replaces the constant pool and handler table of {bytecode} with identical
+  // ones from the cache, or enters them into the cache.
+  static void DeduplicateBytecodeArray(Isolate* isolate,
+                                       Handle<BytecodeArray> bytecode);
+
+  // Returns cached feedback metadata matching {spec}, or creates new metadata
+  // and enters it into the cache.
+  static Handle<FeedbackMetadata> GetOrCreateFeedbackMetadata(
+      Isolate* isolate, const FeedbackVectorSpec* spec);
+
+  static void Clear(Heap* heap);
+
+  static constexpr int kCacheSize = 0x100;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_UNOPTIMIZED_METADATA_CACHE_H_
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <utility>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -15,6 +17,8 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
@@ -28,7 +32,10 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
                            bool restore_function_code) {
   if (restore_function_code) {
     Handle<JSFunction> function = job->compilation_info()->closure();
-    function->set_code(function->shared().GetCode(), kReleaseStore);
+    // OSR jobs never replace the function's code.
+    if (!job->compilation_info()->is_osr()) {
+      function->set_code(function->shared().GetCode(), kReleaseStore);
+    }
     if (function->IsInOptimizationQueue()) {
       function->ClearOptimizationMarker();
     }
@@ -100,13 +107,83 @@ OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  if (shortest_first_ || hotness_priority_) {
+    // Move the preferred job to the front, so that hot or small functions do
+    // not wait behind others. A job is passed over at most as many times as
+    // the queue has slots to avoid starving it.
+    InputQueueEntry& front = input_queue_[InputQueueIndex(0)];
+    if (front.times_passed_over < input_queue_capacity_) {
+      int preferred = 0;
+      for (int i = 1; i < input_queue_length_; i++) {
+        if (IsPreferred(input_queue_[InputQueueIndex(i)],
+                        input_queue_[InputQueueIndex(preferred)])) {
+          preferred = i;
+        }
+      }
+      if (preferred != 0) {
+        front.times_passed_over++;
+        std::swap(front, input_queue_[InputQueueIndex(preferred)]);
+      }
+    }
+  }
+  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)].job;
   DCHECK_NOT_NULL(job);
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
   return job;
 }
 
+bool OptimizingCompileDispatcher::IsPreferred(const InputQueueEntry& a,
+                                              const InputQueueEntry& b) const {
+  if (hotness_priority_ && a.hotness != b.hotness) {
+    return a.hotness > b.hotness;
+  }
+  return shortest_first_ && a.bytecode_length < b.bytecode_length;
+}
+
+// static
+int64_t OptimizingCompileDispatcher::HotnessOf(JSFunction function) {
+  if (!function.has_feedback_vector()) return 0;
+  FeedbackVector vector = function.feedback_vector();
+  // Profiler ticks reflect how much of the interrupt budget the function
+  // consumed and dominate the score. The invocation count breaks ties.
+  return (static_cast<int64_t>(vector.profiler_ticks()) << 32) |
+         static_cast<uint32_t>(vector.invocation_count());
+}
+
+bool OptimizingCompileDispatcher::EvictColderJob(JSFunction function) {
+  if (!hotness_priority_) return false;
+  OptimizedCompilationJob* evicted;
+  {
+    base::MutexGuard access_input_queue(&input_queue_mutex_);
+    if (input_queue_length_ < input_queue_capacity_) return true;
+    int coldest = 0;
+    for (int i = 1; i < input_queue_length_; i++) {
+      if (input_queue_[InputQueueIndex(i)].hotness <
+          input_queue_[InputQueueIndex(coldest)].hotness) {
+        coldest = i;
+      }
+    }
+    if (input_queue_[InputQueueIndex(coldest)].hotness >= HotnessOf(function)) {
+      return false;
+    }
+    evicted = input_queue_[InputQueueIndex(coldest)].job;
+    for (int i = coldest; i < input_queue_length_ - 1; i++) {
+      input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i + 1)];
+    }
+    input_queue_length_--;
+  }
+  if (FLAG_trace_concurrent_recompilation) {
+    PrintF("  ** Evicted ");
+    evicted->compilation_info()->closure()->ShortPrint();
+    PrintF(" from the compilation queue.\n");
+  }
+  // The compile task that was posted for the evicted job finds the queue one
+  // job shorter and the job that replaces it posts its own task.
+  DisposeCompilationJob(evicted, true);
+  return true;
+}
+
 void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
                                               LocalIsolate* local_isolate) {
   if (!job) return;
@@ -144,7 +221,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   while (input_queue_length_ > 0) {
-    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)].job;
     DCHECK_NOT_NULL(job);
     input_queue_shift_ = InputQueueIndex(1);
     input_queue_length_--;
@@ -233,7 +310,12 @@ void OptimizingCompileDispatcher::QueueForOptimization(
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    OptimizedCompilationInfo* info = job->compilation_info();
+    const int bytecode_length = info->has_bytecode_array()
+                                    ? info->bytecode_array()->length()
+                                    : 0;
+    input_queue_[InputQueueIndex(input_queue_length_)] = {
+        job, HotnessOf(*info->closure()), bytecode_length, 0};
     input_queue_length_++;
   }
   V8::GetCurrentPlatform()->CallOnWorkerThread(
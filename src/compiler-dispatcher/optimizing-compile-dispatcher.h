@@ -18,6 +18,7 @@
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class OptimizedCompilationJob;
 class RuntimeCallStats;
@@ -31,8 +32,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_length_(0),
         input_queue_shift_(0),
         ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+        recompilation_delay_(FLAG_concurrent_recompilation_delay),
+        shortest_first_(FLAG_concurrent_recompilation_shortest_first),
+        hotness_priority_(FLAG_concurrent_recompilation_hotness_priority) {
+    input_queue_ = NewArray<InputQueueEntry>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -51,6 +54,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
+  // With --concurrent-recompilation-hotness-priority, removes the coldest
+  // queued job from a full input queue if it is colder than {function}, so
+  // that {function} can be queued instead. Returns whether a slot was freed.
+  // This method must be called on the main thread.
+  bool EvictColderJob(JSFunction function);
+
   // This method must be called on the main thread.
   bool HasJobs();
 
@@ -68,12 +77,28 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    // Used to pick hot jobs first with
+    // --concurrent-recompilation-hotness-priority.
+    int64_t hotness;
+    // Used to pick short jobs first with
+    // --concurrent-recompilation-shortest-first.
+    int bytecode_length;
+    // Number of times a shorter job was picked while this one was at the
+    // front of the queue.
+    int times_passed_over;
+  };
+
   void FlushQueues(BlockingBehavior blocking_behavior,
                    bool restore_function_code);
   void FlushInputQueue();
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job, LocalIsolate* local_isolate);
   OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate);
+  // Whether {a} should be compiled before {b}.
+  bool IsPreferred(const InputQueueEntry& a, const InputQueueEntry& b) const;
+  static int64_t HotnessOf(JSFunction function);
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -85,7 +110,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   Isolate* isolate_;
 
   // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  InputQueueEntry* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
@@ -108,6 +133,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // is not safe to access them directly.
   int recompilation_delay_;
 
+  // Copies of the queue ordering flags, for the same reason.
+  const bool shortest_first_;
+  const bool hotness_priority_;
+
   bool finalize_ = true;
 };
 }  // namespace internal
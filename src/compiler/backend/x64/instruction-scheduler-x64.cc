@@ -2,12 +2,168 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Microarchitectures with their own latency tables. Numbers are taken from
+// Agner Fog's instruction tables and uops.info, rounded to the common case.
+enum class LatencyModel {
+  kGeneric,
+  kIntelSkylake,  // Skylake and its client derivatives up to Comet Lake.
+  kIntelIceLake,  // Ice Lake, Tiger Lake and later big cores.
+  kAmdZen,        // Zen and Zen 2.
+  kAmdZen3,       // Zen 3 and later.
+};
+
+LatencyModel DetectLatencyModel() {
+  if (!FLAG_turbo_instruction_scheduling_cpu_model) {
+    return LatencyModel::kGeneric;
+  }
+  base::CPU cpu;
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 0x6 &&
+      !cpu.is_atom()) {
+    switch (cpu.model()) {
+      case 0x4E:
+      case 0x5E:
+      case 0x55:
+      case 0x8E:
+      case 0x9E:
+      case 0xA5:
+      case 0xA6:
+        return LatencyModel::kIntelSkylake;
+      case 0x6A:
+      case 0x6C:
+      case 0x7D:
+      case 0x7E:
+      case 0x8C:
+      case 0x8D:
+      case 0x8F:
+      case 0x97:
+      case 0x9A:
+      case 0xB7:
+      case 0xBA:
+        return LatencyModel::kIntelIceLake;
+      default:
+        return LatencyModel::kGeneric;
+    }
+  }
+  if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 && cpu.family() == 0xF) {
+    // The effective family is 0xF plus the extended family.
+    int family = cpu.family() + cpu.ext_family();
+    if (family == 0x17) return LatencyModel::kAmdZen;
+    if (family >= 0x19) return LatencyModel::kAmdZen3;
+  }
+  return LatencyModel::kGeneric;
+}
+
+LatencyModel GetLatencyModel() {
+  static const LatencyModel model = DetectLatencyModel();
+  return model;
+}
+
+bool IsLoad(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+    case kX64MovqDecompressTaggedSigned:
+    case kX64MovqDecompressTaggedPointer:
+    case kX64MovqDecompressAnyTagged:
+      return instr->HasOutput() && instr->addressing_mode() != kMode_None;
+    default:
+      return false;
+  }
+}
+
+// Returns the latency of {instr} on {model}, or 0 if the generic table below
+// should be used.
+int GetModelLatency(const Instruction* instr, LatencyModel model) {
+  if (model == LatencyModel::kGeneric) return 0;
+  const bool intel = model == LatencyModel::kIntelSkylake ||
+                     model == LatencyModel::kIntelIceLake;
+  if (IsLoad(instr)) return intel ? 5 : 4;
+  switch (instr->arch_opcode()) {
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Mul:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
+      return intel ? 4 : 3;
+    case kSSEFloat32Div:
+      return intel ? 11 : 10;
+    case kSSEFloat64Div:
+      return intel ? 14 : 13;
+    case kSSEFloat32Sqrt:
+      return intel ? 12 : 14;
+    case kSSEFloat64Sqrt:
+      switch (model) {
+        case LatencyModel::kIntelSkylake:
+          return 18;
+        case LatencyModel::kIntelIceLake:
+          return 16;
+        case LatencyModel::kAmdZen:
+          return 20;
+        default:
+          return 15;
+      }
+    case kX64Idiv:
+    case kX64Udiv:
+      switch (model) {
+        case LatencyModel::kIntelSkylake:
+          return instr->arch_opcode() == kX64Idiv ? 42 : 35;
+        case LatencyModel::kAmdZen:
+          return 45;
+        default:
+          // Ice Lake and Zen 3 have much faster 64-bit dividers.
+          return 15;
+      }
+    case kX64Idiv32:
+    case kX64Udiv32:
+      switch (model) {
+        case LatencyModel::kIntelSkylake:
+          return 26;
+        case LatencyModel::kAmdZen:
+          return 29;
+        default:
+          return 12;
+      }
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToInt64:
+      return intel ? 6 : 4;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return intel ? 8 : 3;
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 int InstructionScheduler::GetTargetInstructionFlags(
@@ -446,6 +602,9 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  if (int latency = GetModelLatency(instr, GetLatencyModel())) {
+    return latency;
+  }
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
@@ -4995,6 +4995,42 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
         case CTypeInfo::Type::kFloat32: {
           return __ TruncateFloat64ToFloat32(node);
         }
+        case CTypeInfo::Type::kSeqOneByteString: {
+          // Check that the value is a HeapObject.
+          Node* value_is_smi = ObjectIsSmi(node);
+          __ GotoIf(value_is_smi, if_error);
+
+          // Check that the value is a sequential one-byte string. Other
+          // strings would have to be flattened, which may allocate.
+          Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+          Node* value_instance_type =
+              __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+          Node* encoding = __ Word32And(
+              value_instance_type,
+              __ Int32Constant(kStringRepresentationAndEncodingMask));
+          Node* value_is_seq_one_byte_string =
+              __ Word32Equal(encoding, __ Int32Constant(kSeqOneByteStringTag));
+          __ GotoIfNot(value_is_seq_one_byte_string, if_error);
+
+          Node* stack_slot = __ StackSlot(sizeof(FastOneByteString),
+                                          alignof(FastOneByteString));
+          Node* data_ptr = __ IntPtrAdd(
+              __ BitcastTaggedToWord(node),
+              __ IntPtrConstant(SeqOneByteString::kHeaderSize -
+                                kHeapObjectTag));
+          __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                       kNoWriteBarrier),
+                   stack_slot,
+                   static_cast<int>(offsetof(FastOneByteString, data)),
+                   data_ptr);
+          Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+          __ Store(StoreRepresentation(MachineRepresentation::kWord32,
+                                       kNoWriteBarrier),
+                   stack_slot,
+                   static_cast<int>(offsetof(FastOneByteString, length)),
+                   length);
+          return stack_slot;
+        }
         default: {
           return node;
         }
@@ -5367,6 +5403,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
           c_call_result, CheckForMinusZeroMode::kCheckForMinusZero);
       break;
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
     case CTypeInfo::Type::kApiObject:
       UNREACHABLE();
     case CTypeInfo::Type::kAny:
@@ -4,6 +4,7 @@
 
 #include "src/compiler/escape-analysis.h"
 
+#include "src/base/small-vector.h"
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-matchers.h"
@@ -503,6 +504,10 @@ VariableTracker::State VariableTracker::MergeInputs(Node* effect_phi) {
 
 namespace {
 
+// Loads with a non-constant index from virtual objects with at most this many
+// elements are replaced by a chain of Selects.
+constexpr int kMaxElementsForSelect = 4;
+
 int OffsetOfFieldAccess(const Operator* op) {
   DCHECK(op->opcode() == IrOpcode::kLoadField ||
          op->opcode() == IrOpcode::kStoreField);
@@ -643,9 +648,6 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
         if (length == 1 &&
             vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
             current->Get(var).To(&value) &&
@@ -656,38 +658,56 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           // one element of {object}.
           current->SetReplacement(value);
           break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
-            current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
-            break;
+        } else if (length >= 2 && length <= kMaxElementsForSelect) {
+          // Collect the values of all elements, bailing out if one of them
+          // doesn't have the type of the access.
+          base::SmallVector<Node*, kMaxElementsForSelect> values;
+          bool has_all_values = true;
+          for (int i = 0; i < length; ++i) {
+            Variable element_var;
+            Node* element_value;
+            if (!vobject->FieldAt(OffsetOfElementAt(access, i))
+                     .To(&element_var) ||
+                !current->Get(element_var).To(&element_value) ||
+                (element_value != nullptr &&
+                 !NodeProperties::GetType(element_value).Is(access.type))) {
+              values.clear();
+              break;
+            }
+            if (element_value == nullptr) has_all_values = false;
+            values.push_back(element_value);
+          }
+          if (values.size() == static_cast<size_t>(length)) {
+            if (has_all_values) {
+              // The {object} has only a few elements, so the LoadElement
+              // must return one of them. So we can turn the LoadElement
+              // into a chain of Select operations instead (still allowing
+              // the {object} to be scalar replaced), which is what makes
+              // small arrays indexed by a loop variable disappear. We must
+              // however mark the elements of the {object} itself as
+              // escaping.
+              Zone* zone = jsgraph->graph()->zone();
+              Node* replacement = values[length - 1];
+              for (int i = length - 2; i >= 0; --i) {
+                Node* constant = jsgraph->Constant(i);
+                NodeProperties::SetType(constant, Type::Constant(i, zone));
+                Node* check = jsgraph->graph()->NewNode(
+                    jsgraph->simplified()->NumberEqual(), index, constant);
+                NodeProperties::SetType(check, Type::Boolean());
+                replacement = jsgraph->graph()->NewNode(
+                    jsgraph->common()->Select(
+                        access.machine_type.representation()),
+                    check, values[i], replacement);
+                NodeProperties::SetType(replacement, access.type);
+              }
+              current->SetReplacement(replacement);
+              for (Node* value : values) current->SetEscaped(value);
+              break;
+            } else {
+              // If the variables have no values, we have
+              // not reached the fixed-point yet.
+              break;
+            }
           }
         }
       }
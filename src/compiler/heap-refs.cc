@@ -15,6 +15,7 @@
 #include "src/codegen/code-factory.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/compiler/per-isolate-compiler-cache.h"
 #include "src/execution/protectors-inl.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/descriptor-array.h"
@@ -949,8 +950,9 @@ void JSHeapBroker::InitializeAndStartSerializing() {
   // Throw away the dummy data that we created while disabled.
   feedback_.clear();
   refs_->Clear();
+  PerIsolateCompilerCache::Setup(isolate());
   refs_ =
-      zone()->New<RefsMap>(kInitialRefsBucketCount, AddressMatcher(), zone());
+      zone()->New<RefsMap>(InitialRefsBucketCount(), AddressMatcher(), zone());
 
   CollectArrayAndObjectPrototypes();
 
@@ -87,6 +87,8 @@ class JSCallReducerAssembler : public JSGraphAssembler {
   TNode<Object> ReduceMathBinary(const Operator* op);
   TNode<String> ReduceStringPrototypeSubstring();
   TNode<String> ReduceStringPrototypeSlice();
+  TNode<Object> ReduceCollectionPrototypeForEach(
+      CollectionKind collection_kind, const SharedFunctionInfoRef& shared);
 
   TNode<Object> TargetInput() const { return JSCallNode{node_ptr()}.target(); }
 
@@ -1321,6 +1323,176 @@ IteratingArrayBuiltinReducerAssembler::ReduceArrayPrototypeForEach(
 
 namespace {
 
+struct CollectionForEachFrameStateParams {
+  JSGraph* jsgraph;
+  SharedFunctionInfoRef shared;
+  CollectionKind collection_kind;
+  TNode<Context> context;
+  TNode<Object> target;
+  FrameState outer_frame_state;
+  TNode<Object> receiver;
+  TNode<Object> callback;
+  TNode<Object> this_arg;
+};
+
+FrameState CollectionForEachLoopLazyFrameState(
+    const CollectionForEachFrameStateParams& params, TNode<Object> table,
+    TNode<Object> index) {
+  Builtin builtin = params.collection_kind == CollectionKind::kMap
+                        ? Builtin::kMapForEachLoopLazyDeoptContinuation
+                        : Builtin::kSetForEachLoopLazyDeoptContinuation;
+  Node* checkpoint_params[] = {params.receiver, params.callback,
+                               params.this_arg, table, index};
+  return CreateJavaScriptBuiltinContinuationFrameState(
+      params.jsgraph, params.shared, builtin, params.target, params.context,
+      checkpoint_params, arraysize(checkpoint_params), params.outer_frame_state,
+      ContinuationFrameStateMode::LAZY);
+}
+
+}  // namespace
+
+TNode<Object> JSCallReducerAssembler::ReduceCollectionPrototypeForEach(
+    CollectionKind collection_kind, const SharedFunctionInfoRef& shared) {
+  FrameState outer_frame_state = FrameStateInput();
+  TNode<Context> context = ContextInput();
+  TNode<Object> target = TargetInput();
+  TNode<HeapObject> receiver = ReceiverInputAs<HeapObject>();
+  TNode<Object> fncallback = ArgumentOrUndefined(0);
+  TNode<Object> this_arg = ArgumentOrUndefined(1);
+
+  STATIC_ASSERT(OrderedHashMap::HashTableStartIndex() ==
+                OrderedHashSet::HashTableStartIndex());
+  const int entry_size = collection_kind == CollectionKind::kMap
+                             ? OrderedHashMap::kEntrySize
+                             : OrderedHashSet::kEntrySize;
+
+  CollectionForEachFrameStateParams frame_state_params{
+      jsgraph(),         shared,   collection_kind, context, target,
+      outer_frame_state, receiver, fncallback,      this_arg};
+
+  TNode<HeapObject> initial_table =
+      LoadField<HeapObject>(AccessBuilder::ForJSCollectionTable(), receiver);
+  ThrowIfNotCallable(fncallback,
+                     CollectionForEachLoopLazyFrameState(
+                         frame_state_params, initial_table, ZeroConstant()));
+
+  // The iteration state is just the {table} and the {index} into it, so that
+  // neither an iterator nor iterator results are allocated. The lazy deopt
+  // continuation picks up the loop from there.
+  auto done = MakeLabel();
+  {
+    GraphAssembler::LoopScope<MachineRepresentation::kTagged,
+                              MachineRepresentation::kTagged>
+        loop_scope(this);
+    auto loop_header = loop_scope.loop_header_label();
+    Goto(loop_header, initial_table, ZeroConstant());
+    Bind(loop_header);
+    TNode<HeapObject> table = loop_header->PhiAt<HeapObject>(0);
+    TNode<Number> index = loop_header->PhiAt<Number>(1);
+
+    // Migrate to the final table if the {receiver} was modified by the
+    // {fncallback}, healing the {index} on the way.
+    auto transitioned = MakeLabel(MachineRepresentation::kTagged,
+                                  MachineRepresentation::kTagged);
+    {
+      GraphAssembler::LoopScope<MachineRepresentation::kTagged,
+                                MachineRepresentation::kTagged>
+          transition_scope(this);
+      auto transition_header = transition_scope.loop_header_label();
+      Goto(transition_header, table, index);
+      Bind(transition_header);
+      TNode<HeapObject> current_table =
+          transition_header->PhiAt<HeapObject>(0);
+      TNode<Number> current_index = transition_header->PhiAt<Number>(1);
+      TNode<Object> next_table = LoadField<Object>(
+          AccessBuilder::ForOrderedHashMapOrSetNextTable(), current_table);
+      GotoIf(graph()->NewNode(simplified()->ObjectIsSmi(), next_table),
+             &transitioned, BranchHint::kTrue, current_table, current_index);
+
+      Callable const callable =
+          Builtins::CallableFor(isolate(), Builtin::kOrderedHashTableHealIndex);
+      auto call_descriptor = Linkage::GetStubCallDescriptor(
+          graph()->zone(), callable.descriptor(),
+          callable.descriptor().GetStackParameterCount(),
+          CallDescriptor::kNoFlags, Operator::kEliminatable);
+      TNode<Number> healed_index = TypeGuardFixedArrayLength(
+          Call(call_descriptor, HeapConstant(callable.code()), current_table,
+               current_index, NoContextConstant()));
+      Goto(transition_header, next_table, healed_index);
+    }
+    Bind(&transitioned);
+    table = transitioned.PhiAt<HeapObject>(0);
+    index = transitioned.PhiAt<Number>(1);
+
+    // Look for the next non-hole entry, starting from {index}.
+    TNode<Number> number_of_buckets = LoadField<Number>(
+        AccessBuilder::ForOrderedHashMapOrSetNumberOfBuckets(), table);
+    TNode<Number> number_of_elements = LoadField<Number>(
+        AccessBuilder::ForOrderedHashMapOrSetNumberOfElements(), table);
+    TNode<Number> number_of_deleted_elements = LoadField<Number>(
+        AccessBuilder::ForOrderedHashMapOrSetNumberOfDeletedElements(), table);
+    TNode<Number> used_capacity =
+        NumberAdd(number_of_elements, number_of_deleted_elements);
+
+    auto exhausted = MakeLabel();
+    auto found = MakeLabel(MachineRepresentation::kTagged,
+                           MachineRepresentation::kTagged,
+                           MachineRepresentation::kTagged);
+    {
+      GraphAssembler::LoopScope<MachineRepresentation::kTagged> hole_scope(
+          this);
+      auto hole_header = hole_scope.loop_header_label();
+      Goto(hole_header, index);
+      Bind(hole_header);
+      TNode<Number> current_index =
+          TypeGuardFixedArrayLength(hole_header->PhiAt<Number>(0));
+      GotoIfNot(NumberLessThan(current_index, used_capacity), &exhausted,
+                BranchHint::kTrue);
+
+      TNode<Number> entry_start_position = NumberAdd(
+          NumberAdd(TNode<Number>::UncheckedCast(graph()->NewNode(
+                        simplified()->NumberMultiply(), current_index,
+                        NumberConstant(entry_size))),
+                    number_of_buckets),
+          NumberConstant(OrderedHashMap::HashTableStartIndex()));
+      TNode<Object> entry_key = LoadElement<Object>(
+          AccessBuilder::ForFixedArrayElement(), table, entry_start_position);
+      TNode<Number> next_index = NumberAdd(current_index, OneConstant());
+      GotoIfNot(ReferenceEqual(entry_key, TheHoleConstant()), &found,
+                BranchHint::kFalse, entry_key, entry_start_position,
+                next_index);
+      Goto(hole_header, next_index);
+    }
+
+    Bind(&exhausted);
+    Goto(&done);
+
+    Bind(&found);
+    TNode<Object> entry_key = TypeGuardNonInternal(found.PhiAt<Object>(0));
+    TNode<Number> entry_start_position = found.PhiAt<Number>(1);
+    TNode<Number> next_index = found.PhiAt<Number>(2);
+
+    TNode<Object> entry_value = entry_key;
+    if (collection_kind == CollectionKind::kMap) {
+      entry_value = LoadElement<Object>(
+          AccessBuilder::ForFixedArrayElement(), table,
+          NumberAdd(entry_start_position,
+                    NumberConstant(OrderedHashMap::kValueOffset)));
+    }
+
+    JSCall3(fncallback, this_arg, entry_value, entry_key, receiver,
+            CollectionForEachLoopLazyFrameState(frame_state_params, table,
+                                                next_index));
+
+    Goto(loop_header, table, next_index);
+  }
+
+  Bind(&done);
+  return UndefinedConstant();
+}
+
+namespace {
+
 struct ReduceFrameStateParams {
   JSGraph* jsgraph;
   SharedFunctionInfoRef shared;
@@ -4761,6 +4933,9 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
     case Builtin::kMapPrototypeKeys:
       return ReduceCollectionIteration(node, CollectionKind::kMap,
                                        IterationKind::kKeys);
+    case Builtin::kMapPrototypeForEach:
+      return ReduceCollectionPrototypeForEach(node, CollectionKind::kMap,
+                                              shared);
     case Builtin::kMapPrototypeGetSize:
       return ReduceCollectionPrototypeSize(node, CollectionKind::kMap);
     case Builtin::kMapPrototypeValues:
@@ -4773,6 +4948,9 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
     case Builtin::kSetPrototypeEntries:
       return ReduceCollectionIteration(node, CollectionKind::kSet,
                                        IterationKind::kEntries);
+    case Builtin::kSetPrototypeForEach:
+      return ReduceCollectionPrototypeForEach(node, CollectionKind::kSet,
+                                              shared);
     case Builtin::kSetPrototypeGetSize:
       return ReduceCollectionPrototypeSize(node, CollectionKind::kSet);
     case Builtin::kSetPrototypeValues:
@@ -7360,6 +7538,29 @@ Reduction JSCallReducer::ReduceCollectionIteration(
   return Replace(js_create_iterator);
 }
 
+Reduction JSCallReducer::ReduceCollectionPrototypeForEach(
+    Node* node, CollectionKind collection_kind,
+    const SharedFunctionInfoRef& shared) {
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  // Only the instance type of the {receiver} matters, since the backing
+  // table is at the same offset for all JSMap and JSSet maps.
+  InstanceType type = InstanceTypeForCollectionKind(collection_kind);
+  MapInference inference(broker(), n.receiver(), n.effect());
+  if (!inference.HaveMaps() || !inference.AllOfInstanceTypesAre(type)) {
+    return NoChange();
+  }
+
+  JSCallReducerAssembler a(this, node);
+  TNode<Object> subgraph =
+      a.ReduceCollectionPrototypeForEach(collection_kind, shared);
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
 Reduction JSCallReducer::ReduceCollectionPrototypeSize(
     Node* node, CollectionKind collection_kind) {
   DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
@@ -193,6 +193,9 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
 
   Reduction ReduceMapPrototypeHas(Node* node);
   Reduction ReduceMapPrototypeGet(Node* node);
+  Reduction ReduceCollectionPrototypeForEach(
+      Node* node, CollectionKind collection_kind,
+      const SharedFunctionInfoRef& shared);
   Reduction ReduceCollectionIteration(Node* node,
                                       CollectionKind collection_kind,
                                       IterationKind iteration_kind);
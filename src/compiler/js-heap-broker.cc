@@ -10,6 +10,7 @@
 
 #include "src/codegen/code-factory.h"
 #include "src/codegen/optimized-compilation-info.h"
+#include "src/compiler/per-isolate-compiler-cache.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/ic/handler-configuration-inl.h"
@@ -36,6 +37,7 @@ namespace compiler {
 // This is, however, deprecated (and unnecessary) in C++17.
 const uint32_t JSHeapBroker::kMinimalRefsBucketCount;
 const uint32_t JSHeapBroker::kInitialRefsBucketCount;
+const uint32_t JSHeapBroker::kMaximalInitialRefsBucketCount;
 #endif
 
 void JSHeapBroker::IncrementTracingIndentation() { ++trace_indentation_; }
@@ -126,6 +128,21 @@ void JSHeapBroker::Retire() {
   CHECK_EQ(mode_, kSerialized);
   TRACE(this, "Retiring");
   mode_ = kRetired;
+  if (isolate()->compiler_cache() != nullptr) {
+    isolate()->compiler_cache()->RecordRefsOccupancy(refs_->occupancy());
+  }
+}
+
+uint32_t JSHeapBroker::InitialRefsBucketCount() const {
+  PerIsolateCompilerCache* cache = isolate()->compiler_cache();
+  if (cache == nullptr) return kInitialRefsBucketCount;
+  // The refs map grows once it is 80% full; leave some headroom on top of the
+  // expected number of refs so that a typical job never has to rehash.
+  uint32_t estimate = cache->refs_occupancy_estimate();
+  uint32_t capacity =
+      base::bits::RoundUpToPowerOfTwo32(estimate + estimate / 2 + 1);
+  return std::min(std::max(capacity, kInitialRefsBucketCount),
+                  kMaximalInitialRefsBucketCount);
 }
 
 void JSHeapBroker::SetTargetNativeContextRef(
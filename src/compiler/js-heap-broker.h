@@ -393,6 +393,9 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
       FeedbackSource const& source);
 
   void CollectArrayAndObjectPrototypes();
+  // Capacity for the refs map of a new job, based on how many refs previous
+  // jobs in this isolate created.
+  uint32_t InitialRefsBucketCount() const;
 
   void set_persistent_handles(
       std::unique_ptr<PersistentHandles> persistent_handles) {
@@ -465,6 +468,8 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   STATIC_ASSERT(base::bits::IsPowerOfTwo(kMinimalRefsBucketCount));
   static constexpr uint32_t kInitialRefsBucketCount = 1024;
   STATIC_ASSERT(base::bits::IsPowerOfTwo(kInitialRefsBucketCount));
+  static constexpr uint32_t kMaximalInitialRefsBucketCount = 16384;
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(kMaximalInitialRefsBucketCount));
 };
 
 class V8_NODISCARD TraceScope {
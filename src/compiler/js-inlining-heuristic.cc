@@ -8,6 +8,7 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/compiler/js-inlining-profile.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/objects/objects-inl.h"
@@ -246,11 +247,15 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     candidate.frequency = p.frequency();
   }
 
+  candidate.profiled_hot = IsProfiledHot(candidate, frame_shared_info);
+
   // Don't consider a {candidate} whose frequency is below the
   // threshold, i.e. a call site that is only hit once every N
-  // invocations of the caller.
+  // invocations of the caller. Call sites that were hot in the profile are
+  // kept, since the local feedback may stem from an untypical warm-up.
   if (candidate.frequency.IsKnown() &&
-      candidate.frequency.value() < FLAG_min_inlining_frequency) {
+      candidate.frequency.value() < FLAG_min_inlining_frequency &&
+      !candidate.profiled_hot) {
     return NoChange();
   }
 
@@ -298,7 +303,12 @@ void JSInliningHeuristic::Finalize() {
         candidate.total_size * FLAG_reserve_inline_budget_scale_factor;
     int total_size =
         total_inlined_bytecode_size_ + static_cast<int>(size_of_candidate);
-    if (total_size > max_inlined_bytecode_size_cumulative_) {
+    int budget = max_inlined_bytecode_size_cumulative_;
+    if (candidate.profiled_hot) {
+      budget = static_cast<int>(budget *
+                                FLAG_turbo_inlining_profile_budget_factor);
+    }
+    if (total_size > budget) {
       // Try if any smaller functions are available to inline.
       continue;
     }
@@ -786,8 +796,31 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   return Replace(value);
 }
 
+bool JSInliningHeuristic::IsProfiledHot(Candidate const& candidate,
+                                        Handle<SharedFunctionInfo> caller) {
+  const InliningProfile* profile = InliningProfile::Get();
+  if (profile == nullptr) return false;
+  std::string caller_name;
+  if (!caller.is_null()) caller_name = caller->DebugNameCStr().get();
+  for (int i = 0; i < candidate.num_functions; ++i) {
+    if (!candidate.can_inline_function[i]) continue;
+    SharedFunctionInfoRef shared = candidate.functions[i].has_value()
+                                       ? candidate.functions[i].value().shared()
+                                       : candidate.shared_info.value();
+    std::string callee_name = shared.object()->DebugNameCStr().get();
+    if (profile->IsHot(caller_name, callee_name)) {
+      TRACE("Call site #" << candidate.node->id() << " to " << callee_name
+                          << " is hot in the inlining profile");
+      return true;
+    }
+  }
+  return false;
+}
+
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
+  // Call sites that are hot in the inlining profile come first.
+  if (left.profiled_hot != right.profiled_hot) return left.profiled_hot;
   if (right.frequency.IsUnknown()) {
     if (left.frequency.IsUnknown()) {
       // If left and right are both unknown then the ordering is indeterminate,
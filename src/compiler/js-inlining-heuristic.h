@@ -65,6 +65,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
     int num_functions;
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
+    // Whether the inlining profile marks a call edge of this site as hot.
+    bool profiled_hot = false;
     int total_size = 0;
   };
 
@@ -90,6 +92,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Node* DuplicateStateValuesAndRename(Node* state_values, Node* from, Node* to,
                                       StateCloneMode mode);
   Candidate CollectFunctions(Node* node, int functions_size);
+  bool IsProfiledHot(Candidate const& candidate,
+                     Handle<SharedFunctionInfo> caller);
 
   CommonOperatorBuilder* common() const;
   Graph* graph() const;
@@ -0,0 +1,89 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-profile.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "src/flags/flags.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+InliningProfile* LoadProfileFromFlag() {
+  const char* filename = FLAG_turbo_inlining_profile;
+  if (filename == nullptr) return nullptr;
+  std::ifstream file(filename);
+  CHECK_WITH_MSG(file.good(), "Can't read inlining profile");
+  InliningProfile* profile = new InliningProfile();
+  profile->Parse(file);
+  if (FLAG_trace_turbo_inlining) {
+    PrintF("Read %zu call edges from inlining profile %s\n",
+           profile->edge_count(), filename);
+  }
+  return profile;
+}
+
+}  // namespace
+
+// static
+const InliningProfile* InliningProfile::Get() {
+  // Compilation jobs may ask for the profile concurrently, so rely on the
+  // thread-safe initialization of function-local statics. The profile lives
+  // for the rest of the process.
+  static const InliningProfile* profile = LoadProfileFromFlag();
+  return profile;
+}
+
+void InliningProfile::Parse(std::istream& stream) {
+  for (std::string line; std::getline(stream, line);) {
+    std::istringstream line_stream(line);
+    std::string caller, callee, count_token;
+    if (!std::getline(line_stream, caller, ',') ||
+        !std::getline(line_stream, callee, ',') ||
+        !std::getline(line_stream, count_token, ',') || callee.empty()) {
+      continue;
+    }
+    char* end = nullptr;
+    errno = 0;
+    double count = strtod(count_token.c_str(), &end);
+    if (errno != 0 || end == count_token.c_str() || count < 0) continue;
+    call_counts_[EdgeKey(caller, callee)] += count;
+  }
+}
+
+double InliningProfile::CallCount(const std::string& caller,
+                                  const std::string& callee) const {
+  double count = 0;
+  auto it = call_counts_.find(EdgeKey(caller, callee));
+  if (it != call_counts_.end()) count += it->second;
+  if (!caller.empty()) {
+    it = call_counts_.find(EdgeKey(std::string(), callee));
+    if (it != call_counts_.end()) count += it->second;
+  }
+  return count;
+}
+
+bool InliningProfile::IsHot(const std::string& caller,
+                            const std::string& callee) const {
+  return CallCount(caller, callee) >= FLAG_turbo_inlining_profile_hot_count;
+}
+
+// static
+std::string InliningProfile::EdgeKey(const std::string& caller,
+                                     const std::string& callee) {
+  // Debug names never contain a newline, which makes it a safe separator.
+  return caller + '\n' + callee;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,55 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_JS_INLINING_PROFILE_H_
+#define V8_COMPILER_JS_INLINING_PROFILE_H_
+
+#include <istream>
+#include <string>
+#include <unordered_map>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Call-graph profile supplied by the embedder through --turbo-inlining-profile,
+// typically recorded from a production workload. Every line of the file
+// describes one call edge:
+//
+//   <caller name>,<callee name>,<call count>
+//
+// Names are the debug names of the functions. An empty caller name matches
+// every caller. Counts for repeated edges are summed, so profiles from several
+// processes can be concatenated. The JSInliningHeuristic prefers call sites
+// whose edge count reaches --turbo-inlining-profile-hot-count and gives them a
+// larger share of the inlining budget.
+class V8_EXPORT_PRIVATE InliningProfile {
+ public:
+  // Returns the process-wide profile, or nullptr if no profile was given.
+  static const InliningProfile* Get();
+
+  // Adds the edges described in {stream}. Malformed lines are ignored.
+  void Parse(std::istream& stream);
+
+  // Returns the recorded number of calls from {caller} to {callee}.
+  double CallCount(const std::string& caller, const std::string& callee) const;
+
+  bool IsHot(const std::string& caller, const std::string& callee) const;
+
+  size_t edge_count() const { return call_counts_.size(); }
+
+ private:
+  static std::string EdgeKey(const std::string& caller,
+                             const std::string& callee);
+
+  std::unordered_map<std::string, double> call_counts_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_JS_INLINING_PROFILE_H_
@@ -22,6 +22,7 @@
 #include "src/compiler/property-access-builder.h"
 #include "src/compiler/type-cache.h"
 #include "src/execution/isolate-inl.h"
+#include "src/numbers/conversions-inl.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/field-index-inl.h"
 #include "src/objects/heap-number.h"
@@ -49,6 +50,16 @@ bool HasOnlyJSArrayMaps(JSHeapBroker* broker, ZoneVector<MapRef> const& maps) {
   return true;
 }
 
+// Returns true if {value} is statically known to be a value for which
+// Object::Share is the identity, so that storing it into a shared struct
+// doesn't need the shared value barrier.
+bool IsKnownSharedValue(Node* value) {
+  // TODO(v8:12547): Also handle shared strings and shared structs, which needs
+  // type information that isn't available yet at this point.
+  NumberMatcher m(value);
+  return m.HasResolvedValue() && IsSmiDouble(m.ResolvedValue());
+}
+
 }  // namespace
 
 JSNativeContextSpecialization::JSNativeContextSpecialization(
@@ -1157,16 +1168,33 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     }
   }
 
+  // Loads from and {in} checks on JSProxy instances call the proxy builtins
+  // directly instead of going through the IC.
+  if (!inferred_maps.empty() && receiver == lookup_start_object &&
+      (access_mode == AccessMode::kLoad || access_mode == AccessMode::kHas) &&
+      !feedback.name().object()->IsPrivate()) {
+    bool all_proxies = true;
+    for (const MapRef& map : inferred_maps) {
+      if (map.instance_type() != JS_PROXY_TYPE) all_proxies = false;
+    }
+    if (all_proxies) {
+      return ReduceNamedAccessOnProxy(node, feedback.name(), access_mode, key,
+                                      inferred_maps);
+    }
+  }
+
   ZoneVector<PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<PropertyAccessInfo> access_infos_for_feedback(zone());
     for (const MapRef& map : inferred_maps) {
       if (map.is_deprecated()) continue;
 
-      // TODO(v8:12547): Support writing to shared structs, which needs a write
-      // barrier that calls Object::Share to ensure the RHS is shared.
+      // TODO(v8:12547): Support writing arbitrary values to shared structs,
+      // which needs a write barrier that calls Object::Share to ensure the RHS
+      // is shared. Tagged field stores are already relaxed atomic, so values
+      // that are known to be shared can be stored directly.
       if (InstanceTypeChecker::IsJSSharedStruct(map.instance_type()) &&
-          access_mode == AccessMode::kStore) {
+          access_mode == AccessMode::kStore && !IsKnownSharedValue(value)) {
         return NoChange();
       }
 
@@ -1442,6 +1470,49 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   return Replace(value);
 }
 
+Reduction JSNativeContextSpecialization::ReduceNamedAccessOnProxy(
+    Node* node, NameRef const& name, AccessMode access_mode, Node* key,
+    ZoneVector<MapRef> const& proxy_maps) {
+  DCHECK(access_mode == AccessMode::kLoad || access_mode == AccessMode::kHas);
+  Node* receiver = NodeProperties::GetValueInput(node, 0);
+  Effect effect{NodeProperties::GetEffectInput(node)};
+  Control control{NodeProperties::GetControlInput(node)};
+
+  // Ensure that {key} matches the specified name (if {key} is given).
+  if (key != nullptr) {
+    effect = BuildCheckEqualsName(name, key, effect, control);
+  }
+
+  // Make sure {receiver} is one of the expected proxies.
+  PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
+  access_builder.BuildCheckMaps(receiver, &effect, control, proxy_maps);
+
+  // Morph {node} into a call to the ProxyGetProperty or ProxyHasProperty
+  // builtin, keeping the context, frame state and exception edges.
+  Callable callable = Builtins::CallableFor(
+      isolate(), access_mode == AccessMode::kLoad ? Builtin::kProxyGetProperty
+                                                  : Builtin::kProxyHasProperty);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState, Operator::kNoProperties);
+  for (int i = node->op()->ValueInputCount() - 1; i > 0; --i) {
+    node->RemoveInput(i);
+  }
+  node->InsertInput(graph()->zone(), 0,
+                    jsgraph()->HeapConstant(callable.code()));
+  node->InsertInput(graph()->zone(), 2, jsgraph()->Constant(name));
+  if (access_mode == AccessMode::kLoad) {
+    node->InsertInput(graph()->zone(), 3, receiver);
+    node->InsertInput(graph()->zone(), 4,
+                      jsgraph()->SmiConstant(
+                          static_cast<int>(OnNonExistent::kReturnUndefined)));
+  }
+  NodeProperties::ReplaceEffectInput(node, effect);
+  NodeProperties::ChangeOp(node, common()->Call(call_descriptor));
+  return Changed(node);
+}
+
 Reduction JSNativeContextSpecialization::ReduceJSLoadNamed(Node* node) {
   JSLoadNamedNode n(node);
   NamedAccess const& p = n.Parameters();
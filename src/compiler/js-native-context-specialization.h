@@ -116,6 +116,9 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
                                AccessMode access_mode, Node* key,
                                PropertyCellRef const& property_cell,
                                Node* effect = nullptr);
+  Reduction ReduceNamedAccessOnProxy(Node* node, NameRef const& name,
+                                     AccessMode access_mode, Node* key,
+                                     ZoneVector<MapRef> const& proxy_maps);
   Reduction ReduceElementLoadFromHeapConstant(Node* node, Node* key,
                                               AccessMode access_mode,
                                               KeyedAccessLoadMode load_mode);
@@ -4,9 +4,12 @@
 
 #include "src/compiler/load-elimination.h"
 
+#include <cmath>
+
 #include "src/compiler/access-builder.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/js-graph.h"
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/heap/factory.h"
 #include "src/objects/objects-inl.h"
@@ -69,6 +72,58 @@ bool MustAlias(Node* a, Node* b) {
   return ResolveRenames(a) == ResolveRenames(b);
 }
 
+// Decomposes an element {index} into a {base} node plus a constant {offset},
+// looking through bounds checks and additions of constants.
+void DecomposeIndex(Node* index, Node** base, double* offset) {
+  *offset = 0;
+  while (true) {
+    switch (index->opcode()) {
+      case IrOpcode::kCheckBounds:
+      case IrOpcode::kTypeGuard:
+        index = index->InputAt(0);
+        continue;
+      case IrOpcode::kNumberAdd:
+      case IrOpcode::kSpeculativeNumberAdd:
+      case IrOpcode::kSpeculativeSafeIntegerAdd: {
+        NumberMatcher right(index->InputAt(1));
+        if (right.HasResolvedValue() && std::isfinite(right.ResolvedValue())) {
+          *offset += right.ResolvedValue();
+          index = index->InputAt(0);
+          continue;
+        }
+        NumberMatcher left(index->InputAt(0));
+        if (left.HasResolvedValue() && std::isfinite(left.ResolvedValue())) {
+          *offset += left.ResolvedValue();
+          index = index->InputAt(1);
+          continue;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    *base = index;
+    return;
+  }
+}
+
+// Returns false if the element indices {a} and {b} cannot be equal, either
+// because their types don't overlap or because they are the same base plus
+// different constants (e.g. a[i] and a[i + 1]). Indices are bounds checked,
+// so the additions are exact.
+bool MayAliasIndex(Node* a, Node* b) {
+  if (!NodeProperties::GetType(a).Maybe(NodeProperties::GetType(b))) {
+    return false;
+  }
+  Node* base_a;
+  Node* base_b;
+  double offset_a;
+  double offset_b;
+  DecomposeIndex(a, &base_a, &offset_a);
+  DecomposeIndex(b, &base_b, &offset_b);
+  return base_a != base_b || offset_a == offset_b;
+}
+
 }  // namespace
 
 Reduction LoadElimination::Reduce(Node* node) {
@@ -173,8 +228,7 @@ LoadElimination::AbstractElements::Kill(Node* object, Node* index,
         DCHECK_NOT_NULL(element2.index);
         DCHECK_NOT_NULL(element2.value);
         if (!MayAlias(object, element2.object) ||
-            !NodeProperties::GetType(index).Maybe(
-                NodeProperties::GetType(element2.index))) {
+            !MayAliasIndex(index, element2.index)) {
           that->elements_[that->next_index_++] = element2;
         }
       }
@@ -4,11 +4,13 @@
 
 #include "src/compiler/loop-variable-optimizer.h"
 
+#include "src/compiler/all-nodes.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/node-marker.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
+#include "src/compiler/type-cache.h"
 #include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
@@ -345,6 +347,37 @@ void LoopVariableOptimizer::ChangeToPhisAndInsertGuards() {
   }
 }
 
+void LoopVariableOptimizer::EliminateRedundantBoundsChecks() {
+  const TypeCache* type_cache = TypeCache::Get();
+  AllNodes all(zone(), graph());
+  for (Node* node : all.reachable) {
+    if (node->opcode() != IrOpcode::kCheckBounds) continue;
+    Node* index = NodeProperties::GetValueInput(node, 0);
+    Node* length = NodeProperties::GetValueInput(node, 1);
+    Node* control = NodeProperties::GetControlInput(node);
+    if (!FindInductionVariable(index) || !reduced_.Get(control)) continue;
+    // The comparison below only bounds the index from above.
+    if (!NodeProperties::IsTyped(index) ||
+        !NodeProperties::GetType(index).Is(
+            type_cache->kPositiveSafeInteger)) {
+      continue;
+    }
+    for (Constraint constraint : limits_.Get(control)) {
+      if (constraint.left != index || constraint.right != length ||
+          constraint.kind != InductionVariable::kStrict) {
+        continue;
+      }
+      TRACE("Eliminating bounds check %i on induction variable %i\n",
+            node->id(), index->id());
+      // Keep the narrowed type of the check for the uses of its value.
+      Type type = NodeProperties::GetType(node);
+      node->RemoveInput(1);
+      NodeProperties::ChangeOp(node, common()->TypeGuard(type));
+      break;
+    }
+  }
+}
+
 #undef TRACE
 
 }  // namespace compiler
@@ -81,6 +81,13 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Replaces CheckBounds nodes whose index is a non-negative induction
+  // variable that is known to be strictly less than the checked length at the
+  // position of the check, e.g. because the loop condition compares the
+  // induction variable against the same length. Must run after Run() on a
+  // typed graph.
+  void EliminateRedundantBoundsChecks();
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
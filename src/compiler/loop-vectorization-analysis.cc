@@ -0,0 +1,167 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+int LanesForElementType(ExternalArrayType type) {
+  switch (type) {
+    case kExternalInt32Array:
+    case kExternalUint32Array:
+    case kExternalFloat32Array:
+      return 4;
+    case kExternalFloat64Array:
+      return 2;
+    default:
+      // Narrow integer types need saturation or wrap-around semantics that
+      // the element-wise JS operations do not express, and BigInt arrays
+      // produce heap numbers.
+      return 0;
+  }
+}
+
+bool IsIncrementByOne(Node* node, Node* phi) {
+  switch (node->opcode()) {
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+    case IrOpcode::kSpeculativeSafeIntegerAdd:
+      break;
+    default:
+      return false;
+  }
+  NumberBinopMatcher m(node);
+  return m.left().node() == phi && m.right().Is(1);
+}
+
+}  // namespace
+
+Node* LoopVectorizationAnalysis::FindInductionVariable(
+    const LoopTree::Loop* loop) {
+  Node* result = nullptr;
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    if (node->opcode() != IrOpcode::kPhi) continue;
+    // Only loops with a single back edge are considered, i.e. phis with
+    // exactly one entry and one back edge value.
+    if (node->op()->ValueInputCount() != 2) continue;
+    if (!IsIncrementByOne(node->InputAt(1), node)) continue;
+    // More than one induction variable would require keeping all of them in
+    // lock-step in the vectorized loop.
+    if (result != nullptr) return nullptr;
+    result = node;
+  }
+  return result;
+}
+
+LoopVectorizationAnalysis::Result LoopVectorizationAnalysis::Analyze(
+    const LoopTree::Loop* loop, Candidate* candidate) {
+  if (!loop->children().empty()) return Result::kHasNestedLoop;
+  if (loop->TotalSize() > kMaxLoopSize) return Result::kTooLarge;
+
+  Node* header = loop_tree_->HeaderNode(loop);
+  bool has_typed_array_access = false;
+  ExternalArrayType element_type = kExternalInt8Array;
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    const IrOpcode::Value opcode = node->opcode();
+    switch (opcode) {
+      case IrOpcode::kLoop:
+        if (node != header) return Result::kHasNestedLoop;
+        continue;
+      case IrOpcode::kCall:
+      case IrOpcode::kTailCall:
+        return Result::kHasCall;
+      case IrOpcode::kJSStackCheck:
+        // The vectorized loop keeps a single stack check per iteration.
+        continue;
+      case IrOpcode::kLoadTypedElement:
+      case IrOpcode::kStoreTypedElement: {
+        ExternalArrayType type = ExternalArrayTypeOf(node->op());
+        if (has_typed_array_access && type != element_type) {
+          return Result::kMixedElementTypes;
+        }
+        has_typed_array_access = true;
+        element_type = type;
+        continue;
+      }
+      default:
+        break;
+    }
+    // Any remaining JavaScript operator may call arbitrary code.
+    if (IrOpcode::IsJsOpcode(opcode)) return Result::kHasCall;
+    // Besides the typed array stores handled above, only operations without
+    // side effects on memory can be widened.
+    if (!IrOpcode::IsCommonOpcode(opcode) &&
+        !node->op()->HasProperty(Operator::kNoWrite)) {
+      return Result::kUnsupportedOperation;
+    }
+  }
+
+  if (!has_typed_array_access) return Result::kNoTypedArrayAccess;
+  const int lanes = LanesForElementType(element_type);
+  if (lanes == 0) return Result::kUnsupportedElementType;
+
+  Node* induction_variable = FindInductionVariable(loop);
+  if (induction_variable == nullptr) return Result::kNoInductionVariable;
+
+  candidate->header = header;
+  candidate->induction_variable = induction_variable;
+  candidate->element_type = element_type;
+  candidate->lanes = lanes;
+  return Result::kVectorizable;
+}
+
+void LoopVectorizationAnalysis::TraceInnermostLoops() {
+  for (const LoopTree::Loop* loop : loop_tree_->inner_loops()) {
+    Candidate candidate;
+    Result result = Analyze(loop, &candidate);
+    Node* header = loop_tree_->HeaderNode(loop);
+    if (result == Result::kVectorizable) {
+      PrintF(
+          "Loop with header #%d is vectorizable: induction variable #%d, "
+          "%d lanes\n",
+          header->id(), candidate.induction_variable->id(), candidate.lanes);
+    } else {
+      PrintF("Loop with header #%d is not vectorizable: %s\n", header->id(),
+             ResultToString(result));
+    }
+  }
+}
+
+// static
+const char* LoopVectorizationAnalysis::ResultToString(Result result) {
+  switch (result) {
+    case Result::kVectorizable:
+      return "vectorizable";
+    case Result::kHasNestedLoop:
+      return "has nested loop";
+    case Result::kTooLarge:
+      return "too large";
+    case Result::kHasCall:
+      return "has call";
+    case Result::kUnsupportedOperation:
+      return "unsupported operation";
+    case Result::kNoInductionVariable:
+      return "no induction variable";
+    case Result::kNoTypedArrayAccess:
+      return "no typed array access";
+    case Result::kMixedElementTypes:
+      return "mixed element types";
+    case Result::kUnsupportedElementType:
+      return "unsupported element type";
+  }
+  UNREACHABLE();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,68 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+#define V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+
+#include "src/common/globals.h"
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class Node;
+
+// Classifies innermost loops by whether they fit the shape a SIMD128 loop
+// vectorizer can handle: a single counted induction variable stepping by one,
+// element-wise typed array loads and stores of a single element type, and no
+// calls or other operations with unknown side effects. The analysis runs on
+// the typed JavaScript graph before simplified lowering and does not change
+// the graph.
+class V8_EXPORT_PRIVATE LoopVectorizationAnalysis {
+ public:
+  enum class Result {
+    kVectorizable,
+    kHasNestedLoop,
+    kTooLarge,
+    kHasCall,
+    kUnsupportedOperation,
+    kNoInductionVariable,
+    kNoTypedArrayAccess,
+    kMixedElementTypes,
+    kUnsupportedElementType,
+  };
+
+  struct Candidate {
+    Node* header = nullptr;
+    Node* induction_variable = nullptr;
+    ExternalArrayType element_type = kExternalInt8Array;
+    // Number of elements per SIMD128 register.
+    int lanes = 0;
+  };
+
+  // Loops with more nodes than this are not considered.
+  static constexpr uint32_t kMaxLoopSize = 200;
+
+  explicit LoopVectorizationAnalysis(LoopTree* loop_tree)
+      : loop_tree_(loop_tree) {}
+
+  Result Analyze(const LoopTree::Loop* loop, Candidate* candidate);
+
+  // Analyzes all innermost loops and prints the outcome for each of them.
+  void TraceInnermostLoops();
+
+  static const char* ResultToString(Result result);
+
+ private:
+  Node* FindInductionVariable(const LoopTree::Loop* loop);
+
+  LoopTree* const loop_tree_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
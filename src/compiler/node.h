@@ -203,6 +203,10 @@ class V8_EXPORT_PRIVATE Node final {
     using InlineField = base::BitField<bool, 0, 1>;
     using InputIndexField = base::BitField<unsigned, 1, 31>;
   };
+  // Every edge costs one input slot plus one {Use}; with compressed graph
+  // zones that is 16 bytes per edge instead of 32.
+  STATIC_ASSERT(!kCompressGraphZone || sizeof(Use) == 3 * sizeof(uint32_t));
+  STATIC_ASSERT(!kCompressGraphZone || sizeof(ZoneNodePtr) == sizeof(uint32_t));
 
   //============================================================================
   //== Memory layout ===========================================================
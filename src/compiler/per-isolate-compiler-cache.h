@@ -20,15 +20,21 @@ namespace compiler {
 class ObjectData;
 
 // This class serves as a container of data that should persist across all
-// (optimizing) compiler runs in an isolate. For now it stores serialized data
-// for various common objects such as builtins, so that these objects don't have
-// to be serialized in each compilation job. See JSHeapBroker::InitializeRefsMap
-// for details.
+// (optimizing) compiler runs in an isolate. It is only accessed from the main
+// thread. For now it keeps statistics that let JSHeapBroker size its refs map
+// up front, see JSHeapBroker::InitialRefsBucketCount.
 class PerIsolateCompilerCache : public ZoneObject {
  public:
   explicit PerIsolateCompilerCache(Zone* zone)
       : zone_(zone), refs_snapshot_(nullptr) {}
 
+  // Moving average of the number of refs that compilation jobs ended up with.
+  uint32_t refs_occupancy_estimate() const { return refs_occupancy_estimate_; }
+  void RecordRefsOccupancy(uint32_t occupancy) {
+    refs_occupancy_estimate_ =
+        refs_occupancy_estimate_ - refs_occupancy_estimate_ / 4 + occupancy / 4;
+  }
+
   bool HasSnapshot() const { return refs_snapshot_ != nullptr; }
   RefsMap* GetSnapshot() {
     DCHECK(HasSnapshot());
@@ -55,6 +61,7 @@ class PerIsolateCompilerCache : public ZoneObject {
  private:
   Zone* const zone_;
   RefsMap* refs_snapshot_;
+  uint32_t refs_occupancy_estimate_ = 0;
 };
 
 }  // namespace compiler
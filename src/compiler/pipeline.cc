@@ -58,6 +58,7 @@
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/loop-vectorization-analysis.h"
 #include "src/compiler/machine-graph-verifier.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/memory-optimizer.h"
@@ -1604,6 +1605,9 @@ struct LoopPeelingPhase {
 
     LoopTree* loop_tree = LoopFinder::BuildLoopTree(
         data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    if (V8_UNLIKELY(FLAG_trace_turbo_loop_vectorization)) {
+      LoopVectorizationAnalysis(loop_tree).TraceInnermostLoops();
+    }
     // We call the typer inside of PeelInnerLoopsOfTree which inspects heap
     // objects, so we need to unpark the local heap.
     UnparkedScopeIfNeeded scope(data->broker());
@@ -1883,6 +1887,17 @@ struct LoadEliminationPhase {
   }
 };
 
+struct LoopBoundsCheckEliminationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopBoundsCheckElimination)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopVariableOptimizer induction_vars(data->jsgraph()->graph(),
+                                         data->common(), temp_zone);
+    induction_vars.Run();
+    induction_vars.EliminateRedundantBoundsChecks();
+  }
+};
+
 struct MemoryOptimizationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(MemoryOptimization)
 
@@ -2694,6 +2709,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+
+  if (FLAG_turbo_loop_variable && FLAG_turbo_loop_bounds_check_elimination) {
+    Run<LoopBoundsCheckEliminationPhase>();
+    RunPrintAndVerify(LoopBoundsCheckEliminationPhase::phase_name(), true);
+  }
   data->DeleteTyper();
 
   if (FLAG_turbo_escape) {
@@ -3352,6 +3372,42 @@ void PipelineImpl::ComputeScheduledGraph() {
   TraceScheduleAndVerify(data->info(), data, data->schedule(), "schedule");
 }
 
+namespace {
+
+// Estimates the zone memory the top-tier register allocator needs for
+// {sequence}. The live-in and live-out sets hold one bit per virtual register
+// for every block, which makes them grow quadratically and dominate for huge
+// functions; live ranges and use positions only grow linearly.
+size_t EstimateTopTierRegisterAllocationZoneSize(
+    const InstructionSequence* sequence) {
+  size_t virtual_registers = sequence->VirtualRegisterCount();
+  size_t blocks = sequence->InstructionBlockCount();
+  size_t instructions = sequence->LastInstructionIndex() + 1;
+  size_t live_sets = 2 * blocks * RoundUp(virtual_registers, kBitsPerByte) /
+                     kBitsPerByte;
+  size_t live_ranges = virtual_registers * sizeof(TopLevelLiveRange);
+  size_t use_positions = 2 * instructions * sizeof(UsePosition);
+  return live_sets + live_ranges + use_positions;
+}
+
+// Returns true if {sequence} should be handed to the mid-tier register
+// allocator, which runs in linear time with one coarse live range per virtual
+// register, instead of risking a superlinear top-tier allocation. The zone
+// budget is checked up front because the top-tier phases rewrite the
+// instruction sequence and cannot be abandoned half-way.
+bool IsTooExpensiveForTopTierRegisterAllocation(
+    const InstructionSequence* sequence) {
+  if (sequence->VirtualRegisterCount() >
+      FLAG_turbo_top_tier_regalloc_max_virtual_registers) {
+    return true;
+  }
+  if (FLAG_turbo_top_tier_regalloc_zone_budget_mb == 0) return false;
+  return EstimateTopTierRegisterAllocationZoneSize(sequence) >
+         FLAG_turbo_top_tier_regalloc_zone_budget_mb * MB;
+}
+
+}  // namespace
+
 bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   auto call_descriptor = linkage->GetIncomingDescriptor();
   PipelineData* data = this->data_;
@@ -3448,19 +3504,12 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   bool run_verifier = FLAG_turbo_verify_allocation;
 
   // Allocate registers.
-
-  // This limit is chosen somewhat arbitrarily, by looking at a few bigger
-  // WebAssembly programs, and chosing the limit such that functions that take
-  // >100ms in register allocation are switched to mid-tier.
-  static int kTopTierVirtualRegistersLimit = 8192;
-
   const RegisterConfiguration* config = RegisterConfiguration::Default();
   std::unique_ptr<const RegisterConfiguration> restricted_config;
   bool use_mid_tier_register_allocator =
       FLAG_turbo_force_mid_tier_regalloc ||
       (FLAG_turbo_use_mid_tier_regalloc_for_huge_functions &&
-       data->sequence()->VirtualRegisterCount() >
-           kTopTierVirtualRegistersLimit);
+       IsTooExpensiveForTopTierRegisterAllocation(data->sequence()));
 
   if (call_descriptor->HasRestrictedAllocatableRegisters()) {
     RegList registers = call_descriptor->AllocatableRegisters();
@@ -526,6 +526,7 @@ WasmGraphBuilder::WasmGraphBuilder(
       zone_(zone),
       mcgraph_(mcgraph),
       env_(env),
+      bounds_checks_(zone),
       has_simd_(ContainsSimd(sig)),
       sig_(sig),
       source_position_table_(source_position_table),
@@ -3822,6 +3823,7 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   }
 
   // Convert the index to uintptr.
+  Node* wasm_index = index;
   if (!env_->module->is_memory64) {
     index = BuildChangeUint32ToUintPtr(index);
   } else if (kSystemPointerSize == kInt32Size) {
@@ -3865,6 +3867,12 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
     return {index, kTrapHandler};
   }
 
+  // Memories never shrink, so an earlier check of the same index covers all
+  // accesses up to its end offset.
+  if (HasDominatingBoundsCheck(wasm_index, end_offset)) {
+    return {index, kInBounds};
+  }
+
   Node* mem_size = instance_cache_->mem_size;
   Node* end_offset_node = mcgraph_->UintPtrConstant(end_offset);
   if (end_offset > env_->min_memory_size) {
@@ -3880,9 +3888,31 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   // Introduce the actual bounds check.
   Node* cond = gasm_->UintLessThan(index, effective_size);
   TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  bounds_checks_.emplace(control(), BoundsCheck{wasm_index, end_offset});
   return {index, kDynamicallyChecked};
 }
 
+bool WasmGraphBuilder::HasDominatingBoundsCheck(Node* index,
+                                                uintptr_t end_offset) {
+  // Walk up the dominating control nodes, stopping at merges. Loops are
+  // dominated by their entry. The walk is bounded to keep compilation linear.
+  static constexpr int kMaxControlNodes = 32;
+  Node* node = control();
+  for (int i = 0; i < kMaxControlNodes; i++) {
+    auto check = bounds_checks_.find(node);
+    if (check != bounds_checks_.end() && check->second.index == index &&
+        check->second.end_offset >= end_offset) {
+      return true;
+    }
+    if (node->opcode() != IrOpcode::kLoop &&
+        node->op()->ControlInputCount() != 1) {
+      return false;
+    }
+    node = NodeProperties::GetControlInput(node);
+  }
+  return false;
+}
+
 const Operator* WasmGraphBuilder::GetSafeLoadOperator(int offset,
                                                       wasm::ValueType type) {
   int alignment = offset % type.element_size_bytes();
@@ -5671,13 +5701,22 @@ Node* WasmGraphBuilder::ArrayNewWithRtt(uint32_t array_index,
 Node* WasmGraphBuilder::ArrayInit(const wasm::ArrayType* type, Node* rtt,
                                   base::Vector<Node*> elements) {
   wasm::ValueType element_type = type->element_type();
-  // TODO(7748): Consider using gasm_->Allocate().
-  Node* array =
-      gasm_->CallBuiltin(Builtin::kWasmAllocateArray_Uninitialized,
-                         Operator::kNoDeopt | Operator::kNoThrow, rtt,
-                         Int32Constant(static_cast<int32_t>(elements.size())),
-                         Int32Constant(element_type.element_size_bytes()));
-  for (int i = 0; i < static_cast<int>(elements.size()); i++) {
+  int length = static_cast<int>(elements.size());
+  // Allocate inline instead of calling {WasmAllocateArray_Uninitialized}, so
+  // that escape analysis can remove arrays which do not escape.
+  Node* array = gasm_->Allocate(
+      WasmArray::kHeaderSize +
+      RoundUp(length * element_type.element_size_bytes(), kTaggedSize));
+  gasm_->StoreMap(array, rtt);
+  gasm_->InitializeImmutableInObject(
+      ObjectAccess(MachineType::TaggedPointer(), kNoWriteBarrier), array,
+      wasm::ObjectAccess::ToTagged(JSReceiver::kPropertiesOrHashOffset),
+      LOAD_ROOT(EmptyFixedArray, empty_fixed_array));
+  gasm_->InitializeImmutableInObject(
+      ObjectAccess(MachineType::Uint32(), kNoWriteBarrier), array,
+      wasm::ObjectAccess::ToTagged(WasmArray::kLengthOffset),
+      Int32Constant(length));
+  for (int i = 0; i < length; i++) {
     Node* offset =
         gasm_->WasmArrayElementOffset(Int32Constant(i), element_type);
     if (type->mutability()) {
@@ -7781,6 +7820,11 @@ static bool IsSupportedWasmFastApiFunction(
     // Arg 0 is the receiver, skip over it since wasm doesn't
     // have a concept of receivers.
     CTypeInfo arg = info->ArgumentInfo(i + 1);
+    // Wasm has no strings to pass.
+    if (arg.GetType() == CTypeInfo::Type::kSeqOneByteString) {
+      log_imported_function_mismatch();
+      return false;
+    }
     if (NormalizeFastApiRepresentation(arg) !=
         expected_sig->GetParam(i).machine_type().representation()) {
       log_imported_function_mismatch();
@@ -22,6 +22,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-opcodes.h"
 #include "src/wasm/wasm-result.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -591,6 +592,10 @@ class WasmGraphBuilder {
                                                      wasm::WasmCodePosition,
                                                      EnforceBoundsCheck);
 
+  // Whether a bounds check of {index} for at least {end_offset} dominates the
+  // current control.
+  bool HasDominatingBoundsCheck(Node* index, uintptr_t end_offset);
+
   Node* CheckBoundsAndAlignment(int8_t access_size, Node* index,
                                 uint64_t offset, wasm::WasmCodePosition);
 
@@ -818,6 +823,13 @@ class WasmGraphBuilder {
 
   WasmInstanceCacheNodes* instance_cache_ = nullptr;
 
+  struct BoundsCheck {
+    Node* index;
+    uintptr_t end_offset;
+  };
+  // Explicit bounds checks by the control node they end in.
+  ZoneUnorderedMap<Node*, BoundsCheck> bounds_checks_;
+
   SetOncePointer<Node> stack_check_code_node_;
   SetOncePointer<const Operator> stack_check_call_operator_;
 
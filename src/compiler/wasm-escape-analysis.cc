@@ -26,17 +26,35 @@ Reduction WasmEscapeAnalysis::ReduceAllocateRaw(Node* node) {
 
   // Collect all value edges of {node} in this vector.
   std::vector<Edge> value_edges;
+  // Reference comparisons with {node}, e.g. null checks.
+  std::vector<Node*> comparisons;
   for (Edge edge : node->use_edges()) {
     if (NodeProperties::IsValueEdge(edge)) {
+      Node* use = edge.from();
+      if (use->opcode() == IrOpcode::kWord32Equal ||
+          use->opcode() == IrOpcode::kWord64Equal) {
+        comparisons.push_back(use);
+        continue;
+      }
       if (edge.index() != 0 ||
-          (edge.from()->opcode() != IrOpcode::kStoreToObject &&
-           edge.from()->opcode() != IrOpcode::kInitializeImmutableInObject)) {
+          (use->opcode() != IrOpcode::kStoreToObject &&
+           use->opcode() != IrOpcode::kInitializeImmutableInObject)) {
         return NoChange();
       }
       value_edges.push_back(edge);
     }
   }
 
+  // Since the object is not stored anywhere, no other value can be a reference
+  // to it.
+  for (Node* comparison : comparisons) {
+    if (comparison->IsDead()) continue;
+    bool equal = NodeProperties::GetValueInput(comparison, 0) ==
+                 NodeProperties::GetValueInput(comparison, 1);
+    ReplaceWithValue(comparison, mcgraph_->Int32Constant(equal ? 1 : 0));
+    comparison->Kill();
+  }
+
   // Remove all discovered stores from the effect chain.
   for (Edge edge : value_edges) {
     DCHECK(NodeProperties::IsValueEdge(edge));
@@ -17,9 +17,9 @@ namespace compiler {
 
 class MachineGraph;
 
-// Eliminate allocated objects which are only assigned to.
-// Current restrictions: Does not work for arrays (until they are also allocated
-// with AllocateRaw). Does not work if the allocated object is passed to a phi.
+// Eliminate allocated objects which are only assigned to and compared with.
+// Current restrictions: Does not work for arrays which are not allocated with
+// AllocateRaw. Does not work if the allocated object is passed to a phi.
 class WasmEscapeAnalysis final : public AdvancedReducer {
  public:
   WasmEscapeAnalysis(Editor* editor, MachineGraph* mcgraph)
@@ -52,6 +52,7 @@
 #include "src/handles/maybe-handles.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/v8.h"
+#include "src/interpreter/bytecode-dispatch-sampler.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters.h"
 #include "src/logging/log-utils.h"
@@ -3323,6 +3324,26 @@ void Shell::WriteIgnitionDispatchCountersFile(v8::Isolate* isolate) {
                    .ToLocalChecked());
 }
 
+void Shell::WriteIgnitionSampledDispatchesFile(v8::Isolate* isolate) {
+  i::interpreter::BytecodeDispatchSampler* sampler =
+      reinterpret_cast<i::Isolate*>(isolate)->interpreter()->dispatch_sampler();
+  if (sampler == nullptr) {
+    fprintf(stderr,
+            "--sample-ignition-dispatches-output-file requires "
+            "--sample-ignition-dispatches\n");
+    return;
+  }
+  HandleScope handle_scope(isolate);
+  Local<Context> context = Context::New(isolate);
+  Context::Scope context_scope(context);
+
+  std::ofstream samples_stream(i::FLAG_sample_ignition_dispatches_output_file);
+  samples_stream << *String::Utf8Value(
+      isolate,
+      JSON::Stringify(context, Utils::ToLocal(sampler->GetSamplesObject()))
+          .ToLocalChecked());
+}
+
 namespace {
 int LineFromOffset(Local<debug::Script> script, int offset) {
   debug::Location location = script->GetSourceLocation(offset);
@@ -3891,6 +3912,32 @@ bool ends_with(const char* input, const char* suffix) {
 }
 
 bool SourceGroup::Execute(Isolate* isolate) {
+  if (Shell::options.throughput_isolates == 0) return ExecuteSources(isolate);
+  isolate->AddGCPrologueCallback(OnGCPrologue, this);
+  isolate->AddGCEpilogueCallback(OnGCEpilogue, this);
+  base::TimeTicks start = base::TimeTicks::Now();
+  bool success = ExecuteSources(isolate);
+  execution_time_ms_ += (base::TimeTicks::Now() - start).InMillisecondsF();
+  isolate->RemoveGCPrologueCallback(OnGCPrologue, this);
+  isolate->RemoveGCEpilogueCallback(OnGCEpilogue, this);
+  return success;
+}
+
+// static
+void SourceGroup::OnGCPrologue(Isolate* isolate, GCType type,
+                               GCCallbackFlags flags, void* data) {
+  static_cast<SourceGroup*>(data)->gc_start_ = base::TimeTicks::Now();
+}
+
+// static
+void SourceGroup::OnGCEpilogue(Isolate* isolate, GCType type,
+                               GCCallbackFlags flags, void* data) {
+  SourceGroup* group = static_cast<SourceGroup*>(data);
+  group->gc_time_ms_ +=
+      (base::TimeTicks::Now() - group->gc_start_).InMillisecondsF();
+}
+
+bool SourceGroup::ExecuteSources(Isolate* isolate) {
   bool success = true;
 #ifdef V8_FUZZILLI
   if (fuzzilli_reprl) {
@@ -4533,6 +4580,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--repeat-compile=", 17) == 0) {
       options.repeat_compile = atoi(argv[i] + 17);
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-isolates=", 22) == 0) {
+      options.throughput_isolates = atoi(argv[i] + 22);
+      argv[i] = nullptr;
 #ifdef V8_FUZZILLI
     } else if (strcmp(argv[i], "--no-fuzzilli-enable-builtins-coverage") == 0) {
       options.fuzzilli_enable_builtins_coverage = false;
@@ -4601,6 +4651,13 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     FATAL("Flag --expose-fast-api is incompatible with --stress-snapshot.");
   }
 
+  if (options.throughput_isolates > 0) {
+    if (options.num_isolates > 1) {
+      FATAL("Flag --throughput-isolates is incompatible with --isolate.");
+    }
+    options.num_isolates = options.throughput_isolates;
+  }
+
   // Set up isolated source groups.
   options.isolate_sources = new SourceGroup[options.num_isolates];
   SourceGroup* current = options.isolate_sources;
@@ -4627,6 +4684,11 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     }
   }
   current->End(argc);
+  // With --throughput-isolates every isolate runs the same sources.
+  for (int i = 1; i < options.throughput_isolates; ++i) {
+    options.isolate_sources[i].Begin(argv, 1);
+    options.isolate_sources[i].End(argc);
+  }
 
   if (!logfile_per_isolate && options.num_isolates) {
     V8::SetFlagsFromString("--no-logfile-per-isolate");
@@ -4636,6 +4698,7 @@ bool Shell::SetOptions(int argc, char* argv[]) {
 }
 
 int Shell::RunMain(Isolate* isolate, bool last_run) {
+  base::TimeTicks start = base::TimeTicks::Now();
   for (int i = 1; i < options.num_isolates; ++i) {
     options.isolate_sources[i].StartExecuteInThread();
   }
@@ -4691,6 +4754,9 @@ int Shell::RunMain(Isolate* isolate, bool last_run) {
       options.isolate_sources[i].WaitForThread();
     }
   }
+  if (options.throughput_isolates > 0) {
+    PrintThroughput(base::TimeTicks::Now() - start);
+  }
   WaitForRunningWorkers();
   if (Shell::unhandled_promise_rejections_.load() > 0) {
     printf("%i pending unhandled Promise rejection(s) detected.\n",
@@ -4705,6 +4771,21 @@ int Shell::RunMain(Isolate* isolate, bool last_run) {
   return (success == Shell::options.expected_to_throw ? 1 : 0);
 }
 
+void Shell::PrintThroughput(base::TimeDelta wall_time) {
+  // The sources of every isolate are run once, so the number of runs equals
+  // the number of isolates. Comparing runs/s for different isolate counts
+  // shows how well the script scales across cores.
+  int isolates = options.throughput_isolates;
+  double wall_time_ms = wall_time.InMillisecondsF();
+  printf("Throughput with %d isolate(s): %.2f runs/s (%.3f ms wall time)\n",
+         isolates, isolates * 1000.0 / wall_time_ms, wall_time_ms);
+  for (int i = 0; i < isolates; ++i) {
+    const SourceGroup& group = options.isolate_sources[i];
+    printf("  isolate %d: %.3f ms execution, %.3f ms GC\n", i,
+           group.execution_time_ms(), group.gc_time_ms());
+  }
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     const double kLongIdlePauseInSeconds = 1.0;
@@ -5487,6 +5568,10 @@ int Shell::Main(int argc, char* argv[]) {
         WriteIgnitionDispatchCountersFile(isolate);
       }
 
+      if (i::FLAG_sample_ignition_dispatches_output_file != nullptr) {
+        WriteIgnitionSampledDispatchesFile(isolate);
+      }
+
       if (options.cpu_profiler) {
         CpuProfile* profile =
             cpu_profiler->StopProfiling(String::Empty(isolate));
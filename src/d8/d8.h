@@ -110,6 +110,11 @@ class SourceGroup {
   void WaitForThread();
   void JoinThread();
 
+  // Time spent in Execute() and in garbage collections during Execute(),
+  // summed over all runs. Only collected for --throughput-isolates.
+  double execution_time_ms() const { return execution_time_ms_; }
+  double gc_time_ms() const { return gc_time_ms_; }
+
  private:
   class IsolateThread : public base::Thread {
    public:
@@ -122,6 +127,12 @@ class SourceGroup {
   };
 
   void ExecuteInThread();
+  bool ExecuteSources(Isolate* isolate);
+
+  static void OnGCPrologue(Isolate* isolate, GCType type,
+                           GCCallbackFlags flags, void* data);
+  static void OnGCEpilogue(Isolate* isolate, GCType type,
+                           GCCallbackFlags flags, void* data);
 
   base::Semaphore next_semaphore_;
   base::Semaphore done_semaphore_;
@@ -132,6 +143,10 @@ class SourceGroup {
   const char** argv_;
   int begin_offset_;
   int end_offset_;
+
+  base::TimeTicks gc_start_;
+  double execution_time_ms_ = 0;
+  double gc_time_ms_ = 0;
 };
 
 class SerializationData {
@@ -466,6 +481,7 @@ class ShellOptions {
       "experimental-d8-web-snapshot-api", false};
   DisallowReassignment<bool> compile_only = {"compile-only", false};
   DisallowReassignment<int> repeat_compile = {"repeat-compile", 1};
+  DisallowReassignment<int> throughput_isolates = {"throughput-isolates", 0};
 #if V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> wasm_trap_handler = {"wasm-trap-handler", true};
 #endif  // V8_ENABLE_WEBASSEMBLY
@@ -501,6 +517,7 @@ class Shell : public i::AllStatic {
                                                  const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  static void PrintThroughput(base::TimeDelta wall_time);
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate, bool dispose);
@@ -714,6 +731,7 @@ class Shell : public i::AllStatic {
   static std::atomic<bool> valid_fuzz_script_;
 
   static void WriteIgnitionDispatchCountersFile(v8::Isolate* isolate);
+  static void WriteIgnitionSampledDispatchesFile(v8::Isolate* isolate);
   // Append LCOV coverage data to file.
   static void WriteLcovData(v8::Isolate* isolate, const char* file);
   static Counter* GetCounter(const char* name, bool is_histogram);
@@ -4,6 +4,8 @@
 
 #include "src/date/date.h"
 
+#include <algorithm>
+
 #include "src/base/overflowing-math.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
@@ -17,12 +19,10 @@ namespace internal {
 static const int kDaysIn4Years = 4 * 365 + 1;
 static const int kDaysIn100Years = 25 * kDaysIn4Years - 1;
 static const int kDaysIn400Years = 4 * kDaysIn100Years + 1;
-static const int kDays1970to2000 = 30 * 365 + 7;
-static const int kDaysOffset =
-    1000 * kDaysIn400Years + 5 * kDaysIn400Years - kDays1970to2000;
+// Days from March 1 of year -kYearsOffset to January 1, 1970.
 static const int kYearsOffset = 400000;
-static const char kDaysInMonths[] = {31, 28, 31, 30, 31, 30,
-                                     31, 31, 30, 31, 30, 31};
+static const int kDaysOffset =
+    (kYearsOffset / 400) * kDaysIn400Years + 719468;
 
 DateCache::DateCache()
     : stamp_(kNullAddress),
@@ -57,6 +57,9 @@ void DateCache::ResetDateCache(
     local_offset_ms_ = kInvalidLocalOffsetInMs;
 #ifdef V8_INTL_SUPPORT
   }
+  offset_transitions_state_ = OffsetTransitionsState::kNotBuilt;
+  offset_transitions_queries_ = 0;
+  offset_transitions_.clear();
 #endif
   tz_cache_->Clear(time_zone_detection);
   tz_name_ = nullptr;
@@ -93,68 +96,34 @@ void DateCache::YearMonthDayFromDays(int days, int* year, int* month,
       return;
     }
   }
-  int save_days = days;
-
-  days += kDaysOffset;
-  *year = 400 * (days / kDaysIn400Years) - kYearsOffset;
-  days %= kDaysIn400Years;
-
-  DCHECK_EQ(save_days, DaysFromYearMonth(*year, 0) + days);
-
-  days--;
-  int yd1 = days / kDaysIn100Years;
-  days %= kDaysIn100Years;
-  *year += 100 * yd1;
-
-  days++;
-  int yd2 = days / kDaysIn4Years;
-  days %= kDaysIn4Years;
-  *year += 4 * yd2;
-
-  days--;
-  int yd3 = days / 365;
-  days %= 365;
-  *year += yd3;
-
-  bool is_leap = (!yd1 || yd2) && !yd3;
-
-  DCHECK_GE(days, -1);
-  DCHECK(is_leap || (days >= 0));
-  DCHECK((days < 365) || (is_leap && (days < 366)));
-  DCHECK(is_leap == ((*year % 4 == 0) && (*year % 100 || (*year % 400 == 0))));
-  DCHECK(is_leap || ((DaysFromYearMonth(*year, 0) + days) == save_days));
-  DCHECK(!is_leap || ((DaysFromYearMonth(*year, 0) + days + 1) == save_days));
-
-  days += is_leap;
-
-  // Check if the date is after February.
-  if (days >= 31 + 28 + (is_leap ? 1 : 0)) {
-    days -= 31 + 28 + (is_leap ? 1 : 0);
-    // Find the date starting from March.
-    for (int i = 2; i < 12; i++) {
-      if (days < kDaysInMonths[i]) {
-        *month = i;
-        *day = days + 1;
-        break;
-      }
-      days -= kDaysInMonths[i];
-    }
-  } else {
-    // Check January and February.
-    if (days < 31) {
-      *month = 0;
-      *day = days + 1;
-    } else {
-      *month = 1;
-      *day = days - 31 + 1;
-    }
-  }
-  DCHECK(DaysFromYearMonth(*year, *month) + *day - 1 == save_days);
+  // Count the days from March 1 of year -400000, so that leap days are at
+  // the end of the (shifted) year and all quantities are positive. This
+  // computes the fields without loops or branches on the month, see Howard
+  // Hinnant's "chrono-Compatible Low-Level Date Algorithms".
+  unsigned shifted_days = static_cast<unsigned>(days + kDaysOffset);
+  unsigned cycle = shifted_days / kDaysIn400Years;
+  unsigned day_of_cycle = shifted_days - cycle * kDaysIn400Years;
+  unsigned year_of_cycle =
+      (day_of_cycle - day_of_cycle / (kDaysIn4Years - 1) +
+       day_of_cycle / kDaysIn100Years - day_of_cycle / (kDaysIn400Years - 1)) /
+      365;
+  unsigned day_of_year =
+      day_of_cycle - (365 * year_of_cycle + year_of_cycle / 4 -
+                      year_of_cycle / 100);
+  // Months of the shifted year have a repeating pattern of 31, 30, 31, 30,
+  // 31 days, which this linear function maps to.
+  unsigned shifted_month = (5 * day_of_year + 2) / 153;
+  *day = static_cast<int>(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+  *month = static_cast<int>(shifted_month < 10 ? shifted_month + 2
+                                                : shifted_month - 10);
+  *year = static_cast<int>(year_of_cycle + cycle * 400) - kYearsOffset +
+          (*month <= 1 ? 1 : 0);
+  DCHECK(DaysFromYearMonth(*year, *month) + *day - 1 == days);
   ymd_valid_ = true;
   ymd_year_ = *year;
   ymd_month_ = *month;
   ymd_day_ = *day;
-  ymd_days_ = save_days;
+  ymd_days_ = days;
 }
 
 int DateCache::DaysFromYearMonth(int year, int month) {
@@ -215,7 +184,13 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   double offset;
 #ifdef V8_INTL_SUPPORT
   if (FLAG_icu_timezone_data) {
-    offset = tz_cache_->LocalTimeOffset(static_cast<double>(time_ms), is_utc);
+    int offset_ms;
+    if (LookUpOffsetTransitions(time_ms, is_utc, &offset_ms)) {
+      offset = offset_ms;
+    } else {
+      offset =
+          tz_cache_->LocalTimeOffset(static_cast<double>(time_ms), is_utc);
+    }
   } else {
 #endif
     // When ICU timezone data is not used, we need to compute the timezone
@@ -274,6 +249,121 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   return static_cast<int>(offset);
 }
 
+#ifdef V8_INTL_SUPPORT
+bool DateCache::LookUpOffsetTransitions(int64_t time_ms, bool is_utc,
+                                        int* offset_ms) {
+  if (offset_transitions_state_ == OffsetTransitionsState::kUnavailable) {
+    return false;
+  }
+  if (offset_transitions_state_ == OffsetTransitionsState::kNotBuilt &&
+      ++offset_transitions_queries_ < kOffsetTransitionsMinQueries) {
+    return false;
+  }
+  // Local times can be up to a day away from the corresponding UTC times.
+  int64_t margin = is_utc ? 0 : kMsPerDay;
+  if (!ExtendOffsetTransitions(time_ms - margin) ||
+      !ExtendOffsetTransitions(time_ms + margin)) {
+    return false;
+  }
+  auto next = std::upper_bound(
+      offset_transitions_.begin(), offset_transitions_.end(), time_ms,
+      [is_utc](int64_t time, const OffsetTransition& transition) {
+        return time < (is_utc ? transition.utc_ms : transition.local_ms);
+      });
+  DCHECK(next != offset_transitions_.begin());
+  *offset_ms = (next - 1)->offset_ms;
+  return true;
+}
+
+bool DateCache::ExtendOffsetTransitions(int64_t time_ms) {
+  if (offset_transitions_state_ == OffsetTransitionsState::kBuilt &&
+      offset_transitions_start_ms_ <= time_ms &&
+      time_ms < offset_transitions_end_ms_) {
+    return true;
+  }
+  int year, month, day;
+  YearMonthDayFromDays(DaysFromTime(time_ms), &year, &month, &day);
+  if (year < FLAG_icu_timezone_transitions_from_year ||
+      year >= FLAG_icu_timezone_transitions_to_year) {
+    return false;
+  }
+  // Extend the table by whole years, and keep it contiguous.
+  int64_t year_start_ms = DaysFromYearMonth(year, 0) * kMsPerDay;
+  int64_t year_end_ms = DaysFromYearMonth(year + 1, 0) * kMsPerDay;
+  bool success;
+  if (offset_transitions_state_ == OffsetTransitionsState::kNotBuilt) {
+    success = AppendOffsetTransitions(&offset_transitions_, year_start_ms,
+                                      year_end_ms);
+    offset_transitions_start_ms_ = year_start_ms;
+    offset_transitions_end_ms_ = year_end_ms;
+    offset_transitions_state_ = OffsetTransitionsState::kBuilt;
+  } else if (time_ms >= offset_transitions_end_ms_) {
+    success = AppendOffsetTransitions(
+        &offset_transitions_, offset_transitions_end_ms_, year_end_ms);
+    offset_transitions_end_ms_ = year_end_ms;
+  } else {
+    DCHECK_LT(time_ms, offset_transitions_start_ms_);
+    std::vector<OffsetTransition> transitions;
+    success = AppendOffsetTransitions(&transitions, year_start_ms,
+                                      offset_transitions_start_ms_);
+    if (success) {
+      // The first old entry only describes the offset at the old start.
+      OffsetTransition first = offset_transitions_.front();
+      const OffsetTransition& last = transitions.back();
+      auto rest = offset_transitions_.begin() + 1;
+      if (first.offset_ms != last.offset_ms) {
+        first.local_ms =
+            first.utc_ms + std::max(last.offset_ms, first.offset_ms);
+        success = first.local_ms > last.local_ms &&
+                  (rest == offset_transitions_.end() ||
+                   first.local_ms < rest->local_ms);
+        transitions.push_back(first);
+      }
+      transitions.insert(transitions.end(), rest, offset_transitions_.end());
+      offset_transitions_.swap(transitions);
+      offset_transitions_start_ms_ = year_start_ms;
+    }
+  }
+  if (!success || offset_transitions_.size() > kMaxOffsetTransitions) {
+    offset_transitions_.clear();
+    offset_transitions_state_ = OffsetTransitionsState::kUnavailable;
+    return false;
+  }
+  return true;
+}
+
+bool DateCache::AppendOffsetTransitions(
+    std::vector<OffsetTransition>* transitions, int64_t start_ms,
+    int64_t end_ms) {
+  if (transitions->empty()) {
+    int offset_ms = static_cast<int>(
+        tz_cache_->LocalTimeOffset(static_cast<double>(start_ms), true));
+    transitions->push_back({start_ms, start_ms + offset_ms, offset_ms});
+  }
+  // Otherwise the last entry describes the offset until {start_ms}, so a
+  // transition at exactly {start_ms} has to be found as well.
+  double time = static_cast<double>(start_ms - 1);
+  while (true) {
+    double next;
+    if (!tz_cache_->NextOffsetTransition(time, &next)) return false;
+    if (next >= static_cast<double>(end_ms)) return true;
+    if (!(next > time)) return false;
+    time = next;
+    int64_t next_ms = static_cast<int64_t>(next);
+    int next_offset_ms =
+        static_cast<int>(tz_cache_->LocalTimeOffset(next, true));
+    const OffsetTransition& last = transitions->back();
+    // The backend may report changes that keep the offset, e.g. of the time
+    // zone name.
+    if (next_offset_ms == last.offset_ms) continue;
+    int64_t local_ms = next_ms + std::max(last.offset_ms, next_offset_ms);
+    // Give up on transitions too close to each other for local lookups.
+    if (local_ms <= last.local_ms) return false;
+    transitions->push_back({next_ms, local_ms, next_offset_ms});
+  }
+}
+#endif  // V8_INTL_SUPPORT
+
 void DateCache::ExtendTheAfterSegment(int time_sec, int offset_ms) {
   if (after_->offset_ms == offset_ms &&
       after_->start_sec - kDefaultDSTDeltaInSec <= time_sec &&
@@ -5,6 +5,8 @@
 #ifndef V8_DATE_DATE_H_
 #define V8_DATE_DATE_H_
 
+#include <vector>
+
 #include "src/base/timezone-cache.h"
 #include "src/common/globals.h"
 #include "src/objects/smi.h"
@@ -186,6 +188,41 @@ class V8_EXPORT_PRIVATE DateCache {
     int last_used;
   };
 
+#ifdef V8_INTL_SUPPORT
+  // Number of ICU offset queries after which the transition table is used,
+  // so that isolates that hardly use dates don't pay for it.
+  static const int kOffsetTransitionsMinQueries = 64;
+  static const size_t kMaxOffsetTransitions = 16 * 1024;
+
+  // A change of the local time offset, precomputed for the years given by
+  // --icu-timezone-transitions-from-year and --icu-timezone-transitions-to-year
+  // so that offsets can be looked up without calling into ICU.
+  struct OffsetTransition {
+    // The UTC time at which {offset_ms} takes effect.
+    int64_t utc_ms;
+    // The first local time that maps to {offset_ms}. Local times that the
+    // transition skips or repeats map to the previous offset, like they do
+    // in ICU with UCAL_TZ_LOCAL_FORMER.
+    int64_t local_ms;
+    int offset_ms;
+  };
+
+  enum class OffsetTransitionsState { kNotBuilt, kBuilt, kUnavailable };
+
+  // Looks up the local time offset for the given time in the transition
+  // table, extending it if needed. Returns false if the time is not covered.
+  bool LookUpOffsetTransitions(int64_t time_ms, bool is_utc, int* offset_ms);
+
+  // Extends the transition table by the year of the given UTC time. Returns
+  // false if that year is not covered.
+  bool ExtendOffsetTransitions(int64_t time_ms);
+
+  // Appends the transitions in [start_ms, end_ms) to {transitions}. Returns
+  // false if the backend can't provide them.
+  bool AppendOffsetTransitions(std::vector<OffsetTransition>* transitions,
+                               int64_t start_ms, int64_t end_ms);
+#endif  // V8_INTL_SUPPORT
+
   // Computes the daylight savings offset for the given time.
   // ECMA 262 - 15.9.1.8
   int DaylightSavingsOffsetInMs(int64_t time_ms);
@@ -233,6 +270,16 @@ class V8_EXPORT_PRIVATE DateCache {
   const char* tz_name_;
   const char* dst_tz_name_;
 
+#ifdef V8_INTL_SUPPORT
+  // Local time offset transitions between offset_transitions_start_ms_ and
+  // offset_transitions_end_ms_, sorted by time.
+  OffsetTransitionsState offset_transitions_state_;
+  int offset_transitions_queries_;
+  int64_t offset_transitions_start_ms_;
+  int64_t offset_transitions_end_ms_;
+  std::vector<OffsetTransition> offset_transitions_;
+#endif  // V8_INTL_SUPPORT
+
   base::TimezoneCache* tz_cache_;
 };
 
@@ -759,6 +759,11 @@ void Coverage::SelectMode(Isolate* isolate, debug::CoverageMode mode) {
     // not safe to flush bytecode. Set a flag here, so we can disable bytecode
     // flushing.
     isolate->set_disable_bytecode_flushing(true);
+    // Baseline code compiled for binary block coverage leaves out counters
+    // that had already been hit, so it must not survive into other modes.
+    if (isolate->is_block_binary_code_coverage()) {
+      isolate->debug()->DiscardAllBaselineCode();
+    }
   }
 
   switch (mode) {
@@ -1533,11 +1533,17 @@ void Debug::PrepareFunctionForDebugExecution(
 
   // Have to discard baseline code before installing debug bytecode, since the
   // bytecode array field on the baseline code object is immutable.
-  if (debug_info->CanBreakAtEntry()) {
-    // Deopt everything in case the function is inlined anywhere.
+  if (debug_info->CanBreakAtEntry() && shared->IsApiFunction()) {
+    // Optimized code may call the API callback directly rather than through
+    // the function's code, and such calls are not recorded as inlinings.
+    // Deopt everything so that every call goes through the trampoline. API
+    // functions have no baseline code that would need discarding.
     Deoptimizer::DeoptimizeAll(isolate_);
-    DiscardAllBaselineCode();
   } else {
+    // Only code that inlines this function needs to go. Baseline code and
+    // unrelated optimized code call the function through its code field,
+    // which will point to the debug bytecode or the debug break trampoline,
+    // so they can stay as they are.
     DeoptimizeFunction(shared);
   }
 
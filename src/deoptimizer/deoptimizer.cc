@@ -288,15 +288,52 @@ class ActivationsFinder : public ThreadVisitor {
   bool safe_to_deopt_;
 #endif
 };
+
+// Moves the marked code of {native_context} from its optimized code list to
+// its deoptimized code list, and adds it to {codes}.
+void UnlinkMarkedCode(Isolate* isolate, NativeContext native_context,
+                      std::set<Code>* codes) {
+  Code prev;
+  Object element = native_context.OptimizedCodeListHead();
+  while (!element.IsUndefined(isolate)) {
+    Code code = FromCodeT(CodeT::cast(element));
+    CHECK(CodeKindCanDeoptimize(code.kind()));
+    Object next = code.next_code_link();
+
+    if (code.marked_for_deoptimization()) {
+      codes->insert(code);
+
+      if (!prev.is_null()) {
+        // Skip this code in the optimized code list.
+        prev.set_next_code_link(next);
+      } else {
+        // There was no previous node, the next node is the new head.
+        native_context.SetOptimizedCodeListHead(next);
+      }
+
+      // Move the code to the _deoptimized_ code list.
+      code.set_next_code_link(native_context.DeoptimizedCodeListHead());
+      native_context.SetDeoptimizedCodeListHead(ToCodeT(code));
+    } else {
+      // Not marked; preserve this element.
+      prev = code;
+    }
+    element = next;
+  }
+}
+
 }  // namespace
 
-// Move marked code from the optimized code list to the deoptimized code list,
-// and replace pc on the stack for codes marked for deoptimization.
+// Replaces the pc on the stack for activations of code marked for
+// deoptimization, in all threads, and removes the deoptimization data of the
+// unlinked {codes} that have no activations.
 // static
-void Deoptimizer::DeoptimizeMarkedCodeForContext(NativeContext native_context) {
-  DisallowGarbageCollection no_gc;
+void Deoptimizer::DeoptimizeActivations(Isolate* isolate,
+                                        std::set<Code>* codes) {
+  // Code that was unlinked before has no new activations, since marked code
+  // bails out on entry. So there is nothing to patch if {codes} is empty.
+  if (codes->empty()) return;
 
-  Isolate* isolate = native_context.GetIsolate();
   Code topmost_optimized_code;
   bool safe_to_deopt_topmost_optimized_code = false;
 #ifdef DEBUG
@@ -327,41 +364,7 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(NativeContext native_context) {
   }
 #endif
 
-  // We will use this set to mark those Code objects that are marked for
-  // deoptimization and have not been found in stack frames.
-  std::set<Code> codes;
-
-  // Move marked code from the optimized code list to the deoptimized code list.
-  // Walk over all optimized code objects in this native context.
-  Code prev;
-  Object element = native_context.OptimizedCodeListHead();
-  while (!element.IsUndefined(isolate)) {
-    Code code = FromCodeT(CodeT::cast(element));
-    CHECK(CodeKindCanDeoptimize(code.kind()));
-    Object next = code.next_code_link();
-
-    if (code.marked_for_deoptimization()) {
-      codes.insert(code);
-
-      if (!prev.is_null()) {
-        // Skip this code in the optimized code list.
-        prev.set_next_code_link(next);
-      } else {
-        // There was no previous node, the next node is the new head.
-        native_context.SetOptimizedCodeListHead(next);
-      }
-
-      // Move the code to the _deoptimized_ code list.
-      code.set_next_code_link(native_context.DeoptimizedCodeListHead());
-      native_context.SetDeoptimizedCodeListHead(ToCodeT(code));
-    } else {
-      // Not marked; preserve this element.
-      prev = code;
-    }
-    element = next;
-  }
-
-  ActivationsFinder visitor(&codes, topmost_optimized_code,
+  ActivationsFinder visitor(codes, topmost_optimized_code,
                             safe_to_deopt_topmost_optimized_code);
   // Iterate over the stack of this thread.
   visitor.VisitThread(isolate, isolate->thread_local_top());
@@ -373,12 +376,25 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(NativeContext native_context) {
   // If there's no activation of a code in any stack then we can remove its
   // deoptimization data. We do this to ensure that code objects that are
   // unlinked don't transitively keep objects alive unnecessarily.
-  for (Code code : codes) {
+  for (Code code : *codes) {
     isolate->heap()->InvalidateCodeDeoptimizationData(code);
   }
+}
 
-  native_context.GetOSROptimizedCodeCache().EvictMarkedCode(
-      native_context.GetIsolate());
+// Move marked code from the optimized code list to the deoptimized code list,
+// and replace pc on the stack for codes marked for deoptimization.
+// static
+void Deoptimizer::DeoptimizeMarkedCodeForContext(NativeContext native_context) {
+  DisallowGarbageCollection no_gc;
+
+  Isolate* isolate = native_context.GetIsolate();
+  // We will use this set to mark those Code objects that are marked for
+  // deoptimization and have not been found in stack frames.
+  std::set<Code> codes;
+  UnlinkMarkedCode(isolate, native_context, &codes);
+  DeoptimizeActivations(isolate, &codes);
+
+  native_context.GetOSROptimizedCodeCache().EvictMarkedCode(isolate);
 }
 
 void Deoptimizer::DeoptimizeAll(Isolate* isolate) {
@@ -388,15 +404,18 @@ void Deoptimizer::DeoptimizeAll(Isolate* isolate) {
   TraceDeoptAll(isolate);
   isolate->AbortConcurrentOptimization(BlockingBehavior::kBlock);
   DisallowGarbageCollection no_gc;
-  // For all contexts, mark all code, then deoptimize.
+  // For all contexts, mark all code, then deoptimize. The stacks are only
+  // walked once for all contexts.
+  std::set<Code> codes;
   Object context = isolate->heap()->native_contexts_list();
   while (!context.IsUndefined(isolate)) {
     NativeContext native_context = NativeContext::cast(context);
     MarkAllCodeForContext(native_context);
     OSROptimizedCodeCache::Clear(native_context);
-    DeoptimizeMarkedCodeForContext(native_context);
+    UnlinkMarkedCode(isolate, native_context, &codes);
     context = native_context.next_context_link();
   }
+  DeoptimizeActivations(isolate, &codes);
 }
 
 void Deoptimizer::DeoptimizeMarkedCode(Isolate* isolate) {
@@ -405,11 +424,21 @@ void Deoptimizer::DeoptimizeMarkedCode(Isolate* isolate) {
   TRACE_EVENT0("v8", "V8.DeoptimizeCode");
   TraceDeoptMarked(isolate);
   DisallowGarbageCollection no_gc;
-  // For all contexts, deoptimize code already marked.
+  // For all contexts, unlink code already marked, then deoptimize its
+  // activations with a single walk over the stacks.
+  std::set<Code> codes;
   Object context = isolate->heap()->native_contexts_list();
   while (!context.IsUndefined(isolate)) {
     NativeContext native_context = NativeContext::cast(context);
-    DeoptimizeMarkedCodeForContext(native_context);
+    UnlinkMarkedCode(isolate, native_context, &codes);
+    context = native_context.next_context_link();
+  }
+  DeoptimizeActivations(isolate, &codes);
+
+  context = isolate->heap()->native_contexts_list();
+  while (!context.IsUndefined(isolate)) {
+    NativeContext native_context = NativeContext::cast(context);
+    native_context.GetOSROptimizedCodeCache().EvictMarkedCode(isolate);
     context = native_context.next_context_link();
   }
 }
@@ -5,6 +5,7 @@
 #ifndef V8_DEOPTIMIZER_DEOPTIMIZER_H_
 #define V8_DEOPTIMIZER_DEOPTIMIZER_H_
 
+#include <set>
 #include <vector>
 
 #include "src/builtins/builtins.h"
@@ -185,6 +186,10 @@ class Deoptimizer : public Malloced {
 
   static void MarkAllCodeForContext(NativeContext native_context);
   static void DeoptimizeMarkedCodeForContext(NativeContext native_context);
+  // Replaces the pc on the stack for activations of code marked for
+  // deoptimization, in all threads, and removes the deoptimization data of the
+  // unlinked {codes} that have no activations.
+  static void DeoptimizeActivations(Isolate* isolate, std::set<Code>* codes);
   // Searches the list of known deoptimizing code for a Code object
   // containing the given address (which is supposedly faster than
   // searching all code objects).
@@ -1506,6 +1506,9 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK_EQ(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex),
                uninitialized);
       CHECK_EQ(arr.get(JSRegExp::kIrregexpBacktrackLimit), uninitialized);
+      CHECK_EQ(arr.get(JSRegExp::kIrregexpRequiredLiteralIndex), uninitialized);
+      CHECK_EQ(arr.get(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex),
+               uninitialized);
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -1543,6 +1546,12 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(arr.get(JSRegExp::kIrregexpMaxRegisterCountIndex).IsSmi());
       CHECK(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex).IsSmi());
       CHECK(arr.get(JSRegExp::kIrregexpBacktrackLimit).IsSmi());
+      Object required_literal =
+          arr.get(JSRegExp::kIrregexpRequiredLiteralIndex);
+      CHECK((required_literal.IsSmi() &&
+             Smi::ToInt(required_literal) == JSRegExp::kUninitializedValue) ||
+            required_literal.IsString());
+      CHECK(arr.get(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex).IsSmi());
       break;
     }
     default:
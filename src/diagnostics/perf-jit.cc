@@ -91,6 +91,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -126,6 +136,9 @@ uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
+// Maps the instruction start of logged code to the code id of its load
+// record, which "perf inject" needs to resolve move records.
+std::unordered_map<Address, uint64_t>* PerfJitLogger::code_ids_ = nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -151,12 +164,15 @@ void PerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  code_ids_ = new std::unordered_map<Address, uint64_t>();
 }
 
 void PerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
+  delete code_ids_;
+  code_ids_ = nullptr;
 }
 
 void* PerfJitLogger::OpenMarkerFile(int fd) {
@@ -278,6 +294,7 @@ void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  (*code_ids_)[reinterpret_cast<Address>(code_pointer)] = code_index_;
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
@@ -344,14 +361,18 @@ void PerfJitLogger::LogWriteDebugInfo(Handle<Code> code,
   uint32_t entry_count = 0;
   Object last_script = Smi::zero();
   std::vector<base::Vector<const char>> script_names;
+  // Keeps the names that had to be copied alive until they are written.
+  std::vector<std::unique_ptr<char[]>> script_name_storage;
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
     SourcePositionInfo info(
         GetSourcePositionInfo(code, shared, iterator.source_position()));
     Object current_script = *info.script;
     if (current_script != last_script) {
+      // Positions inside inlined functions refer to the inlinee's script.
       std::unique_ptr<char[]> name_storage;
-      auto name = GetScriptName(shared->script(), &name_storage, no_gc);
+      auto name = GetScriptName(current_script, &name_storage, no_gc);
+      if (name_storage) script_name_storage.push_back(std::move(name_storage));
       script_names.push_back(name);
       // Add the size of the name after each entry.
       size += name.size() + sizeof(kStringTerminator);
@@ -512,10 +533,37 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
   LogWriteBytes(padding_bytes, static_cast<int>(padding_size));
 }
 
+void PerfJitLogger::WriteJitCodeMoveEntry(Address from, Address to,
+                                          uint32_t code_size) {
+  auto it = code_ids_->find(from);
+  // Code that was created before the logger was attached has no load record.
+  if (it == code_ids_->end()) return;
+  uint64_t code_id = it->second;
+  code_ids_->erase(it);
+  (*code_ids_)[to] = code_id;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ = static_cast<uint32_t>(process_id_);
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = to;
+  code_move.old_code_address_ = from;
+  code_move.new_code_address_ = to;
+  code_move.code_size_ = code_size;
+  code_move.code_id_ = code_id;
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from.IsBytecodeArray());
+  // Bytecode is not logged, only the interpreter entry trampolines are.
+  if (from.IsBytecodeArray()) return;
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+  if (perf_output_handle_ == nullptr) return;
+  WriteJitCodeMoveEntry(from.InstructionStart(), to.InstructionStart(),
+                        to.InstructionSize());
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
@@ -33,6 +33,8 @@
 // {PerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
@@ -73,6 +75,7 @@ class PerfJitLogger : public CodeEventLogger {
 
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
                              const char* name, int name_length);
+  void WriteJitCodeMoveEntry(Address from, Address to, uint32_t code_size);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
@@ -135,6 +138,7 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+  static std::unordered_map<Address, uint64_t>* code_ids_;
   static int process_id_;
 };
 
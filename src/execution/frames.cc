@@ -561,6 +561,26 @@ namespace {
 Code GetContainingCode(Isolate* isolate, Address pc) {
   return isolate->inner_pointer_to_code_cache()->GetCacheEntry(pc)->code;
 }
+
+// Frames of these types are only set up by builtins and the C++ entry code, so
+// looking up the code of their pc can't change the type given by the marker.
+bool IsBuiltinFrameTypeMarker(intptr_t marker) {
+  if (!StackFrame::IsTypeMarker(marker)) return false;
+  switch (StackFrame::MarkerToType(marker)) {
+    case StackFrame::ENTRY:
+    case StackFrame::CONSTRUCT_ENTRY:
+    case StackFrame::EXIT:
+    case StackFrame::BUILTIN_EXIT:
+    case StackFrame::BUILTIN_CONTINUATION:
+    case StackFrame::JAVA_SCRIPT_BUILTIN_CONTINUATION:
+    case StackFrame::JAVA_SCRIPT_BUILTIN_CONTINUATION_WITH_CATCH:
+    case StackFrame::INTERNAL:
+    case StackFrame::CONSTRUCT:
+      return true;
+    default:
+      return false;
+  }
+}
 }  // namespace
 
 Code StackFrame::LookupCode() const {
@@ -629,6 +649,8 @@ StackFrame::Type StackFrame::ComputeType(const StackFrameIteratorBase* iterator,
         return OPTIMIZED;
       }
     }
+  } else if (IsBuiltinFrameTypeMarker(marker)) {
+    // Skip the code lookups below, which are comparatively expensive.
   } else {
 #if V8_ENABLE_WEBASSEMBLY
     // If the {pc} does not point into WebAssembly code we can rely on the
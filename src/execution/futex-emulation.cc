@@ -5,8 +5,10 @@
 #include "src/execution/futex-emulation.h"
 
 #include <limits>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
+#include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/execution/isolate.h"
@@ -24,12 +26,38 @@ namespace internal {
 
 using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
+// The wait lists are split into buckets by wait location. Each bucket is a
+// FutexWaitList with its own mutex, so that waiters and notifiers of different
+// locations do not contend.
 class FutexWaitList {
  public:
   FutexWaitList() = default;
   FutexWaitList(const FutexWaitList&) = delete;
   FutexWaitList& operator=(const FutexWaitList&) = delete;
 
+  struct HeadAndTail {
+    FutexWaitListNode* head;
+    FutexWaitListNode* tail;
+  };
+
+  // Returns the bucket responsible for |wait_location|.
+  static FutexWaitList* ForLocation(int8_t* wait_location);
+
+  // Locks the mutexes of all buckets. Used to reach a node whose wait location
+  // can change concurrently, and to visit all nodes.
+  class V8_NODISCARD AllBucketsGuard {
+   public:
+    AllBucketsGuard();
+    ~AllBucketsGuard();
+    AllBucketsGuard(const AllBucketsGuard&) = delete;
+    AllBucketsGuard& operator=(const AllBucketsGuard&) = delete;
+
+   private:
+    DisallowGarbageCollection no_gc_;
+  };
+
+  base::Mutex* mutex() { return &mutex_; }
+
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
@@ -76,39 +104,68 @@ class FutexWaitList {
 
   // For checking the internal consistency of the FutexWaitList.
   void Verify();
+  // Checks the lists of nodes waiting for their Promises to be resolved.
+  static void VerifyPromisesToResolve();
   // Verifies the local consistency of |node|. If it's the first node of its
   // list, it must be |head|, and if it's the last node, it must be |tail|.
-  void VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
-                  FutexWaitListNode* tail);
+  static void VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
+                         FutexWaitListNode* tail);
   // Returns true if |node| is on the linked list starting with |head|.
   static bool NodeIsOnList(FutexWaitListNode* node, FutexWaitListNode* head);
 
  private:
   friend class FutexEmulation;
 
-  struct HeadAndTail {
-    FutexWaitListNode* head;
-    FutexWaitListNode* tail;
-  };
+  // Protects the composition of |location_lists_| (i.e. no elements may be
+  // added or removed without holding this mutex), as well as the `waiting_`
+  // and `interrupted_` fields of the nodes on them. It must be the mutex used
+  // together with the `cond_` condition variable of such nodes.
+  base::Mutex mutex_;
+
   // Location inside a shared buffer -> linked list of Nodes waiting on that
   // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
-
-  // Isolate* -> linked list of Nodes which are waiting for their Promises to
-  // be resolved.
-  std::map<Isolate*, HeadAndTail> isolate_promises_to_resolve_;
+  std::unordered_map<int8_t*, HeadAndTail> location_lists_;
 };
 
 namespace {
-// `g_mutex` protects the composition of `g_wait_list` (i.e. no elements may be
-// added or removed without holding this mutex), as well as the `waiting_`
-// and `interrupted_` fields for each individual list node that is currently
-// part of the list. It must be the mutex used together with the `cond_`
-// condition variable of such nodes.
-base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
-base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
+
+constexpr size_t kNumFutexWaitListBuckets = 64;
+
+struct FutexWaitListBuckets {
+  FutexWaitList buckets[kNumFutexWaitListBuckets];
+};
+
+base::LazyInstance<FutexWaitListBuckets>::type g_wait_lists =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Isolate* -> linked list of Nodes which are waiting for their Promises to be
+// resolved. Protected by `g_promises_mutex`; code that also needs a bucket
+// mutex must acquire the bucket mutex first.
+using PromisesToResolve = std::map<Isolate*, FutexWaitList::HeadAndTail>;
+base::LazyMutex g_promises_mutex = LAZY_MUTEX_INITIALIZER;
+base::LazyInstance<PromisesToResolve>::type g_promises_to_resolve =
+    LAZY_INSTANCE_INITIALIZER;
+
 }  // namespace
 
+// static
+FutexWaitList* FutexWaitList::ForLocation(int8_t* wait_location) {
+  size_t hash = base::hash_value(reinterpret_cast<uintptr_t>(wait_location));
+  return &g_wait_lists.Pointer()->buckets[hash % kNumFutexWaitListBuckets];
+}
+
+FutexWaitList::AllBucketsGuard::AllBucketsGuard() {
+  for (FutexWaitList& bucket : g_wait_lists.Pointer()->buckets) {
+    bucket.mutex_.Lock();
+  }
+}
+
+FutexWaitList::AllBucketsGuard::~AllBucketsGuard() {
+  for (FutexWaitList& bucket : g_wait_lists.Pointer()->buckets) {
+    bucket.mutex_.Unlock();
+  }
+}
+
 FutexWaitListNode::~FutexWaitListNode() {
   // Assert that the timeout task was cancelled.
   DCHECK_EQ(CancelableTaskManager::kInvalidTaskId, timeout_task_id_);
@@ -125,12 +182,14 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  // Lock the FutexEmulation mutexes before notifying. We know that the mutex
+  // of the bucket we wait on will have been unlocked if we are currently
+  // waiting on the condition variable. The mutex will not be locked if
+  // FutexEmulation::Wait hasn't locked it yet. In that case, we set the
+  // interrupted_ flag to true, which will be tested after the mutex locked by a
+  // future wait. Since the wait location of this node changes with every wait,
+  // lock the mutexes of all buckets; interrupts are rare.
+  FutexWaitList::AllBucketsGuard lock_guard;
 
   // if not waiting, this will not have any effect.
   cond_.NotifyOne();
@@ -168,18 +227,20 @@ class AsyncWaiterTimeoutTask : public CancelableTask {
 void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // This function can run in any thread.
 
-  g_mutex.Pointer()->AssertHeld();
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(node->wait_location_);
+  wait_list->mutex()->AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
   // woken up ones.
   node->async_timeout_time_ = base::TimeTicks();
 
-  g_wait_list.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
 
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  base::MutexGuard promises_guard(g_promises_mutex.Pointer());
+  auto& isolate_map = *g_promises_to_resolve.Pointer();
   auto it = isolate_map.find(node->isolate_for_async_waiters_);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
@@ -194,6 +255,7 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
     it->second.tail->next_ = node;
     it->second.tail = node;
   }
+  FutexWaitList::VerifyPromisesToResolve();
 }
 
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
@@ -247,7 +309,7 @@ void AtomicsWaitWakeHandle::Wake() {
   // The split lock by itself isn’t an issue, as long as the caller properly
   // synchronizes this with the closing `AtomicsWaitCallback`.
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList::AllBucketsGuard lock_guard;
     stopped_ = true;
   }
   isolate_->futex_wait_list_node()->NotifyWake();
@@ -381,16 +443,17 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
   do {  // Not really a loop, just makes it easier to break out early.
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
     DCHECK(backing_store);
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
-    auto wait_location =
-        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->wait_location_ = wait_location;
     node->waiting_ = true;
 
@@ -421,7 +484,7 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
       timeout_time = current_time + rel_timeout;
     }
 
-    g_wait_list.Pointer()->AddNode(node);
+    wait_list->AddNode(node);
 
     while (true) {
       bool interrupted = node->interrupted_;
@@ -482,16 +545,16 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
         bool wait_for_result =
-            node->cond_.WaitFor(g_mutex.Pointer(), time_until_timeout);
+            node->cond_.WaitFor(wait_list->mutex(), time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(g_mutex.Pointer());
+        node->cond_.Wait(wait_list->mutex());
       }
 
       // Spurious wakeup, interrupt or timeout.
     }
 
-    g_wait_list.Pointer()->RemoveNode(node);
+    wait_list->RemoveNode(node);
   } while (false);
 
   isolate->RunAtomicsWaitCallback(callback_result, array_buffer, addr, value,
@@ -543,15 +606,17 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
   enum class ResultKind { kNotEqual, kTimedOut, kAsync };
   ResultKind result_kind;
   {
-    // 16. Perform EnterCriticalSection(WL).
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
+    int8_t* wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+
+    // 16. Perform EnterCriticalSection(WL).
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
     // 17. Let w be ! AtomicLoad(typedArray, i).
-    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(
-        static_cast<int8_t*>(backing_store->buffer_start()) + addr);
+    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
     // If loading a Wasm value, it needs to be reversed on Big Endian platforms.
@@ -579,7 +644,7 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
             std::move(task), rel_timeout.InSecondsF());
       }
 
-      g_wait_list.Pointer()->AddNode(node);
+      wait_list->AddNode(node);
     }
 
     // Leaving the block collapses the following steps:
@@ -659,9 +724,10 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  auto& location_lists = wait_list->location_lists_;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -730,7 +796,7 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
     if (delete_this_node) {
       auto old_node = node;
       node = node->next_;
-      g_wait_list.Pointer()->RemoveNode(old_node);
+      wait_list->RemoveNode(old_node);
       DCHECK_EQ(CancelableTaskManager::kInvalidTaskId,
                 old_node->timeout_task_id_);
       delete old_node;
@@ -744,7 +810,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
 
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding g_mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any of
+  // the wait list mutexes.
 
   DCHECK(node->IsAsync());
 
@@ -820,9 +887,9 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
 
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    NoGarbageCollectionMutexGuard lock_guard(g_promises_mutex.Pointer());
 
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    auto& isolate_map = *g_promises_to_resolve.Pointer();
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -853,7 +920,8 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList* wait_list = FutexWaitList::ForLocation(node->wait_location_);
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
     node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
     if (!node->waiting_) {
@@ -861,7 +929,7 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
       // resolved. Ignore the timeout.
       return;
     }
-    g_wait_list.Pointer()->RemoveNode(node);
+    wait_list->RemoveNode(node);
   }
 
   // "node" has been taken out of the lists, so it's ok to access it without
@@ -874,14 +942,14 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList::AllBucketsGuard lock_guard;
 
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  for (FutexWaitList& wait_list : g_wait_lists.Pointer()->buckets) {
+    auto& location_lists = wait_list.location_lists_;
     auto it = location_lists.begin();
     while (it != location_lists.end()) {
       FutexWaitListNode*& head = it->second.head;
@@ -890,15 +958,17 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       // head and tail are either both nullptr or both non-nullptr.
       DCHECK_EQ(head == nullptr, tail == nullptr);
       if (head == nullptr) {
-        location_lists.erase(it++);
+        it = location_lists.erase(it);
       } else {
         ++it;
       }
     }
+    wait_list.Verify();
   }
 
   {
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    base::MutexGuard promises_guard(g_promises_mutex.Pointer());
+    auto& isolate_map = *g_promises_to_resolve.Pointer();
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
       auto node = it->second.head;
@@ -909,9 +979,8 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       }
       isolate_map.erase(it);
     }
+    FutexWaitList::VerifyPromisesToResolve();
   }
-
-  g_wait_list.Pointer()->Verify();
 }
 
 Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
@@ -919,10 +988,11 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->byte_length());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+
+  auto& location_lists = wait_list->location_lists_;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -943,16 +1013,18 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
 }
 
 Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList::AllBucketsGuard lock_guard;
 
   int waiters = 0;
-  for (const auto& it : g_wait_list.Pointer()->location_lists_) {
-    FutexWaitListNode* node = it.second.head;
-    while (node != nullptr) {
-      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-        waiters++;
+  for (const FutexWaitList& wait_list : g_wait_lists.Pointer()->buckets) {
+    for (const auto& it : wait_list.location_lists_) {
+      FutexWaitListNode* node = it.second.head;
+      while (node != nullptr) {
+        if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+          waiters++;
+        }
+        node = node->next_;
       }
-      node = node->next_;
     }
   }
 
@@ -964,10 +1036,10 @@ Object FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   DCHECK_LT(addr, array_buffer->byte_length());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  NoGarbageCollectionMutexGuard lock_guard(g_promises_mutex.Pointer());
 
   int waiters = 0;
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  auto& isolate_map = *g_promises_to_resolve.Pointer();
   for (const auto& it : isolate_map) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
@@ -1011,6 +1083,7 @@ void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
 
 void FutexWaitList::Verify() {
 #ifdef DEBUG
+  mutex_.AssertHeld();
   for (const auto& it : location_lists_) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
@@ -1018,8 +1091,13 @@ void FutexWaitList::Verify() {
       node = node->next_;
     }
   }
+#endif  // DEBUG
+}
 
-  for (const auto& it : isolate_promises_to_resolve_) {
+void FutexWaitList::VerifyPromisesToResolve() {
+#ifdef DEBUG
+  g_promises_mutex.Pointer()->AssertHeld();
+  for (const auto& it : *g_promises_to_resolve.Pointer()) {
     auto node = it.second.head;
     while (node != nullptr) {
       VerifyNode(node, it.second.head, it.second.tail);
@@ -96,7 +96,9 @@ class FutexWaitListNode {
   CancelableTaskManager* cancelable_task_manager_ = nullptr;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // prev_ and next_ are protected by the mutex of the FutexWaitList bucket of
+  // wait_location_ while the node is waiting, and by the mutex of the promise
+  // lists after it has been notified.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -113,9 +115,9 @@ class FutexWaitListNode {
   // update the head and tail of the list).
   int8_t* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
-  // if this node is currently contained in FutexEmulation::wait_list_
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ and interrupted_ are protected by the mutex of the FutexWaitList
+  // bucket of wait_location_ if this node is currently contained in that
+  // bucket or an AtomicsWaitWakeHandle has access to it.
   bool waiting_ = false;
   bool interrupted_ = false;
 
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -65,6 +66,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-transition-sampler.h"
 #include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/setup-isolate.h"
@@ -712,7 +714,8 @@ class CallSiteBuilder {
     // framework and library code, and stack depth tends to be more than
     // a dozen frames, so we over-allocate a bit here to avoid growing
     // the elements array in the common case.
-    elements_ = isolate->factory()->NewFixedArray(std::min(64, limit));
+    elements_ = isolate->factory()->NewFixedArray(
+        std::min(64, limit) * CallSiteInfo::kFrameRecordSize);
   }
 
   bool Visit(FrameSummary const& summary) {
@@ -812,8 +815,10 @@ class CallSiteBuilder {
 
   bool Full() { return index_ >= limit_; }
 
+  // Returns the frame records, see CallSiteInfo::EnsureCallSiteInfos().
   Handle<FixedArray> Build() {
-    return FixedArray::ShrinkOrEmpty(isolate_, elements_, index_);
+    return FixedArray::ShrinkOrEmpty(
+        isolate_, elements_, index_ * CallSiteInfo::kFrameRecordSize);
   }
 
  private:
@@ -883,9 +888,22 @@ class CallSiteBuilder {
       // (e.g. the receiver in RegExp constructor frames).
       receiver_or_instance = isolate_->factory()->undefined_value();
     }
-    auto info = isolate_->factory()->NewCallSiteInfo(
-        receiver_or_instance, function, code, offset, flags, parameters);
-    elements_ = FixedArray::SetAndGrow(isolate_, elements_, index_++, info);
+    // Only record the frame here, the CallSiteInfo is created once the stack
+    // trace is used. Store the last slot of the record first, so that the
+    // {elements_} are grown to hold the whole record.
+    int record = index_++ * CallSiteInfo::kFrameRecordSize;
+    elements_ = FixedArray::SetAndGrow(
+        isolate_, elements_, record + CallSiteInfo::kFrameRecordParametersIndex,
+        parameters);
+    elements_->set(record + CallSiteInfo::kFrameRecordFlagsIndex,
+                   Smi::FromInt(flags));
+    elements_->set(record + CallSiteInfo::kFrameRecordCodeOffsetIndex,
+                   Smi::FromInt(offset));
+    elements_->set(record + CallSiteInfo::kFrameRecordReceiverOrInstanceIndex,
+                   *receiver_or_instance);
+    elements_->set(record + CallSiteInfo::kFrameRecordFunctionIndex,
+                   *function);
+    elements_->set(record + CallSiteInfo::kFrameRecordCodeObjectIndex, *code);
   }
 
   Isolate* isolate_;
@@ -1090,6 +1108,17 @@ void CaptureAsyncStackTrace(Isolate* isolate, CallSiteBuilder* builder) {
         CaptureAsyncStackTrace(isolate, promise, builder);
       }
     }
+  } else if (current_microtask->IsAsyncFunctionResumeJobTask()) {
+    // An await on an already settled promise resumes the async function
+    // directly, without going through the await closures.
+    Handle<AsyncFunctionResumeJobTask> async_function_resume_job_task =
+        Handle<AsyncFunctionResumeJobTask>::cast(current_microtask);
+    Handle<JSAsyncFunctionObject> async_function_object(
+        async_function_resume_job_task->async_function_object(), isolate);
+    if (async_function_object->is_executing()) {
+      Handle<JSPromise> promise(async_function_object->promise(), isolate);
+      CaptureAsyncStackTrace(isolate, promise, builder);
+    }
   }
 }
 
@@ -1248,7 +1277,8 @@ Handle<FixedArray> Isolate::GetSimpleStackTrace(
   Handle<Object> error_stack = JSReceiver::GetDataProperty(
       this, error_object, factory()->error_stack_symbol());
   if (error_stack->IsFixedArray()) {
-    return Handle<FixedArray>::cast(error_stack);
+    return CallSiteInfo::EnsureCallSiteInfos(
+        this, Handle<FixedArray>::cast(error_stack));
   }
   if (!error_stack->IsErrorStackData()) {
     return factory()->empty_fixed_array();
@@ -1258,7 +1288,10 @@ Handle<FixedArray> Isolate::GetSimpleStackTrace(
   if (!error_stack_data->HasCallSiteInfos()) {
     return factory()->empty_fixed_array();
   }
-  return handle(error_stack_data->call_site_infos(), this);
+  Handle<FixedArray> call_site_infos = CallSiteInfo::EnsureCallSiteInfos(
+      this, handle(error_stack_data->call_site_infos(), this));
+  error_stack_data->set_call_site_infos(*call_site_infos);
+  return call_site_infos;
 }
 
 Address Isolate::GetAbstractPC(int* line, int* column) {
@@ -2305,8 +2338,9 @@ Object Isolate::PromoteScheduledException() {
 }
 
 void Isolate::PrintCurrentStackTrace(std::ostream& out) {
-  Handle<FixedArray> frames = CaptureSimpleStackTrace(
-      this, FixedArray::kMaxLength, SKIP_NONE, factory()->undefined_value());
+  Handle<FixedArray> frames = CallSiteInfo::EnsureCallSiteInfos(
+      this, CaptureSimpleStackTrace(this, FixedArray::kMaxLength, SKIP_NONE,
+                                    factory()->undefined_value()));
 
   IncrementalStringBuilder builder(this);
   for (int i = 0; i < frames->length(); ++i) {
@@ -3813,17 +3847,60 @@ using MapOfLoadsAndStoresPerFunction =
              std::pair<uint64_t /* loads */, uint64_t /* stores */>>;
 MapOfLoadsAndStoresPerFunction* stack_access_count_map = nullptr;
 
+// Runs the parts of a bigint::Platform::Task on the platform's worker
+// threads and the joining thread.
+class BigIntJob final : public JobTask {
+ public:
+  BigIntJob(bigint::Platform::Task* task, int count)
+      : task_(task), count_(count) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      int index = next_index_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= count_) return;
+      task_->Run(index);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    int remaining = count_ - next_index_.load(std::memory_order_relaxed);
+    return static_cast<size_t>(std::max(remaining, 0));
+  }
+
+ private:
+  bigint::Platform::Task* const task_;
+  const int count_;
+  std::atomic<int> next_index_{0};
+};
+
 class BigIntPlatform : public bigint::Platform {
  public:
   explicit BigIntPlatform(Isolate* isolate) : isolate_(isolate) {}
   ~BigIntPlatform() override = default;
 
   bool InterruptRequested() override {
+    // The stack limit check only works on the isolate's thread; parallel
+    // tasks ask the stack guard directly.
+    if (isolate_->thread_id() != ThreadId::Current()) {
+      return isolate_->stack_guard()->HasTerminationRequest();
+    }
     StackLimitCheck interrupt_check(isolate_);
     return (interrupt_check.InterruptRequested() &&
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  int MaxParallelism() override {
+    if (FLAG_single_threaded) return 1;
+    return V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
+  }
+
+  void RunInParallel(Task* task, int count) override {
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                  std::make_unique<BigIntJob>(task, count))
+        ->Join();
+  }
+
  private:
   Isolate* isolate_;
 };
@@ -3885,6 +3962,9 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     lazy_compile_dispatcher_ = std::make_unique<LazyCompileDispatcher>(
         this, V8::GetCurrentPlatform(), FLAG_stack_size);
   }
+  if (FLAG_ic_transition_sample_interval > 0) {
+    SetICTransitionSampleInterval(FLAG_ic_transition_sample_interval);
+  }
   baseline_batch_compiler_ = new baseline::BaselineBatchCompiler(this);
 #ifdef V8_ENABLE_MAGLEV
   maglev_concurrent_dispatcher_ = new maglev::MaglevConcurrentDispatcher(this);
@@ -4158,6 +4238,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
 #ifdef V8_ENABLE_WEBASSEMBLY
   if (FLAG_experimental_wasm_stack_switching) {
+    wasm_stack_pool_ = std::make_unique<wasm::StackPool>();
     std::unique_ptr<wasm::StackMemory> stack(
         wasm::StackMemory::GetCurrentStackView(this));
     this->wasm_stacks() = stack.get();
@@ -4349,6 +4430,15 @@ bool Isolate::NeedsSourcePositionsForProfiling() const {
       is_profiling() || debug_->is_active() || logger_->is_logging();
 }
 
+void Isolate::SetICTransitionSampleInterval(int sample_interval) {
+  if (sample_interval > 0) {
+    ic_transition_sampler_ =
+        std::make_unique<ICTransitionSampler>(this, sample_interval);
+  } else {
+    ic_transition_sampler_.reset();
+  }
+}
+
 void Isolate::SetFeedbackVectorsForProfilingTools(Object value) {
   DCHECK(value.IsUndefined(this) || value.IsArrayList());
   heap()->set_feedback_vectors_for_profiling_tools(value);
@@ -5313,21 +5403,33 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              Handle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
+  ICUObjectCacheEntry* entries =
       icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (int i = 0; i < kICUObjectCacheSize && entries[i].obj; i++) {
+    if (!StringEqualsLocales(this, entries[i].locales, locales)) continue;
+    // Move the entry to the front.
+    std::rotate(entries, entries + i, entries + i + 1);
+    return entries[0].obj.get();
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  // Evict the least recently accessed entry.
+  ICUObjectCacheEntry* entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  std::move_backward(entries, entries + kICUObjectCacheSize - 1,
+                     entries + kICUObjectCacheSize);
+  entries[0] = {GetStringFromLocales(this, locales), std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  for (ICUObjectCacheEntry& entry :
+       icu_object_cache_[static_cast<int>(cache_type)]) {
+    entry = ICUObjectCacheEntry{};
+  }
 }
 
 void Isolate::clear_cached_icu_objects() {
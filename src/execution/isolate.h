@@ -112,6 +112,7 @@ class GlobalSafepoint;
 class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
+class ICTransitionSampler;
 class InnerPointerToCodeCache;
 class LazyCompileDispatcher;
 class LocalIsolate;
@@ -164,6 +165,7 @@ class Recorder;
 
 namespace wasm {
 class StackMemory;
+class StackPool;
 }
 
 #define RETURN_FAILURE_IF_SCHEDULED_EXCEPTION(isolate) \
@@ -1744,6 +1746,24 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return lazy_compile_dispatcher_.get();
   }
 
+  // The maximum number of valid maps an IC tracks in POLYMORPHIC state before
+  // going MEGAMORPHIC, see v8::Isolate::SetMaxPolymorphicMapCount().
+  int max_valid_polymorphic_map_count() const {
+    return max_valid_polymorphic_map_count_;
+  }
+  void set_max_valid_polymorphic_map_count(int count) {
+    DCHECK_GT(count, 0);
+    max_valid_polymorphic_map_count_ = count;
+  }
+
+  // Returns nullptr unless IC transition sampling is enabled.
+  ICTransitionSampler* ic_transition_sampler() const {
+    return ic_transition_sampler_.get();
+  }
+  // Replaces the IC transition sampler, discarding the samples recorded so
+  // far. A {sample_interval} of 0 disables sampling.
+  void SetICTransitionSampleInterval(int sample_interval);
+
   bool IsInAnyContext(Object object, uint32_t index);
 
   void ClearKeptObjects();
@@ -1934,6 +1954,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
 #ifdef V8_ENABLE_WEBASSEMBLY
   wasm::StackMemory*& wasm_stacks() { return wasm_stacks_; }
+  wasm::StackPool* wasm_stack_pool() { return wasm_stack_pool_.get(); }
 #endif
 
  private:
@@ -2158,8 +2179,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the kICUObjectCacheSize most recently accessed
+  // {locales,obj} pairs for each cache type, most recently accessed first, so
+  // that code alternating between a few locales does not recreate the ICU
+  // objects on every call.
+  static constexpr int kICUObjectCacheSize = 4;
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2169,7 +2193,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount]
+                                       [kICUObjectCacheSize];
 #endif  // V8_INTL_SUPPORT
 
   // true if being profiled. Causes collection of extra compile info.
@@ -2224,6 +2249,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Zone* compiler_zone_ = nullptr;
 
   std::unique_ptr<LazyCompileDispatcher> lazy_compile_dispatcher_;
+  std::unique_ptr<ICTransitionSampler> ic_transition_sampler_;
+  int max_valid_polymorphic_map_count_ = FLAG_max_valid_polymorphic_map_count;
   baseline::BaselineBatchCompiler* baseline_batch_compiler_ = nullptr;
 #ifdef V8_ENABLE_MAGLEV
   maglev::MaglevConcurrentDispatcher* maglev_concurrent_dispatcher_ = nullptr;
@@ -2387,6 +2414,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
 #ifdef V8_ENABLE_WEBASSEMBLY
   wasm::StackMemory* wasm_stacks_;
+  std::unique_ptr<wasm::StackPool> wasm_stack_pool_;
 #endif
 
   // Enables the host application to provide a mechanism for recording a
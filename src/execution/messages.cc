@@ -1009,8 +1009,10 @@ MaybeHandle<Object> ErrorUtils::GetFormattedStack(
     Handle<Object> formatted_stack;
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, formatted_stack,
-        FormatStackTrace(isolate, error_object,
-                         handle(error_stack_data->call_site_infos(), isolate)),
+        FormatStackTrace(
+            isolate, error_object,
+            CallSiteInfo::EnsureCallSiteInfos(
+                isolate, handle(error_stack_data->call_site_infos(), isolate))),
         Object);
     error_stack_data->set_formatted_stack(*formatted_stack);
     return formatted_stack;
@@ -1021,7 +1023,8 @@ MaybeHandle<Object> ErrorUtils::GetFormattedStack(
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, formatted_stack,
         FormatStackTrace(isolate, error_object,
-                         Handle<FixedArray>::cast(error_stack)),
+                         CallSiteInfo::EnsureCallSiteInfos(
+                             isolate, Handle<FixedArray>::cast(error_stack))),
         Object);
     RETURN_ON_EXCEPTION(
         isolate,
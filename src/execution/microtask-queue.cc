@@ -27,6 +27,8 @@ const size_t MicrotaskQueue::kSizeOffset = OFFSET_OF(MicrotaskQueue, size_);
 const size_t MicrotaskQueue::kStartOffset = OFFSET_OF(MicrotaskQueue, start_);
 const size_t MicrotaskQueue::kFinishedMicrotaskCountOffset =
     OFFSET_OF(MicrotaskQueue, finished_microtask_count_);
+const size_t MicrotaskQueue::kContextAccountingCallbackOffset =
+    OFFSET_OF(MicrotaskQueue, context_accounting_callback_);
 
 const intptr_t MicrotaskQueue::kMinimumCapacity = 8;
 
@@ -77,6 +79,14 @@ Address MicrotaskQueue::CallEnqueueMicrotask(Isolate* isolate,
   return Smi::zero().ptr();
 }
 
+// static
+Address MicrotaskQueue::CallAccountMicrotaskContext(
+    intptr_t microtask_queue_pointer, Address raw_native_context) {
+  reinterpret_cast<MicrotaskQueue*>(microtask_queue_pointer)
+      ->AccountMicrotaskContext(raw_native_context);
+  return Smi::zero().ptr();
+}
+
 void MicrotaskQueue::EnqueueMicrotask(v8::Isolate* v8_isolate,
                                       v8::Local<Function> function) {
   Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
@@ -160,6 +170,9 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
 
   MaybeHandle<Object> maybe_result;
 
+  context_accounts_.clear();
+  current_context_account_ = -1;
+
   int processed_microtask_count;
   {
     SetIsRunningMicrotasks scope(&is_running_microtasks_);
@@ -174,6 +187,11 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
                                                  &maybe_exception);
       processed_microtask_count =
           static_cast<int>(finished_microtask_count_ - base_count);
+      // The builtin leaves the context of the last batch unless it was
+      // terminated.
+      if (current_context_account_ >= 0) {
+        AccountMicrotaskContext(kNullAddress);
+      }
     }
     TRACE_EVENT_END1("v8.execute", "RunMicrotasks", "microtask_count",
                      processed_microtask_count);
@@ -188,10 +206,12 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     start_ = 0;
     DCHECK(isolate->has_scheduled_exception());
     isolate->OnTerminationDuringRunMicrotasks();
+    ReportContextAccounting(isolate);
     OnCompleted(isolate);
     return -1;
   }
   DCHECK_EQ(0, size());
+  ReportContextAccounting(isolate);
   OnCompleted(isolate);
 
   return processed_microtask_count;
@@ -210,6 +230,11 @@ void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
                                                static_cast<intptr_t>(0))));
   }
 
+  for (ContextAccount& account : context_accounts_) {
+    visitor->VisitRootPointer(Root::kStrongRoots, nullptr,
+                              FullObjectSlot(&account.native_context));
+  }
+
   if (capacity_ <= kMinimumCapacity) {
     return;
   }
@@ -244,6 +269,66 @@ void MicrotaskQueue::RemoveMicrotasksCompletedCallback(
   microtasks_completed_callbacks_.erase(pos);
 }
 
+void MicrotaskQueue::SetMicrotasksContextAccountingCallback(
+    MicrotasksContextAccountingCallback callback, void* data) {
+  context_accounting_callback_ = callback;
+  context_accounting_data_ = data;
+}
+
+void MicrotaskQueue::AccountMicrotaskContext(Address native_context) {
+  DisallowGarbageCollection no_gc;
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (current_context_account_ >= 0) {
+    ContextAccount& account = context_accounts_[current_context_account_];
+    account.microtask_count +=
+        finished_microtask_count_ - current_context_start_count_;
+    account.run_time += now - current_context_start_time_;
+    current_context_account_ = -1;
+  }
+  if (native_context == kNullAddress) return;
+
+  // There are few contexts per queue, so a linear search is fine.
+  auto it = std::find_if(context_accounts_.begin(), context_accounts_.end(),
+                         [=](const ContextAccount& account) {
+                           return account.native_context == native_context;
+                         });
+  if (it == context_accounts_.end()) {
+    context_accounts_.push_back({native_context, 0, base::TimeDelta()});
+    it = context_accounts_.end() - 1;
+  }
+  current_context_account_ = it - context_accounts_.begin();
+  current_context_start_count_ = finished_microtask_count_;
+  current_context_start_time_ = now;
+}
+
+void MicrotaskQueue::ReportContextAccounting(Isolate* isolate) {
+  DCHECK_LT(current_context_account_, 0);
+  if (context_accounts_.empty()) return;
+  if (context_accounting_callback_ == nullptr) {
+    context_accounts_.clear();
+    return;
+  }
+
+  HandleScope scope(isolate);
+  std::vector<std::pair<Handle<Context>, ContextAccount>> accounts;
+  accounts.reserve(context_accounts_.size());
+  for (const ContextAccount& account : context_accounts_) {
+    accounts.emplace_back(
+        handle(Context::cast(Object(account.native_context)), isolate),
+        account);
+  }
+  context_accounts_.clear();
+
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
+  MicrotasksContextAccountingCallback callback = context_accounting_callback_;
+  void* data = context_accounting_data_;
+  for (const auto& account : accounts) {
+    callback(v8_isolate, Utils::ToLocal(account.first),
+             static_cast<size_t>(account.second.microtask_count),
+             account.second.run_time.InMillisecondsF(), data);
+  }
+}
+
 void MicrotaskQueue::OnCompleted(Isolate* isolate) const {
   std::vector<CallbackWithData> callbacks(microtasks_completed_callbacks_);
   for (auto& callback : callbacks) {
@@ -13,6 +13,7 @@
 #include "include/v8-internal.h"  // For Address.
 #include "include/v8-microtask-queue.h"
 #include "src/base/macros.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace internal {
@@ -36,6 +37,13 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
                                       intptr_t microtask_queue_pointer,
                                       Address raw_microtask);
 
+  // Called by the RunMicrotasks builtin while context accounting is enabled
+  // whenever it enters the native context of a batch of microtasks, or leaves
+  // it with a {raw_native_context} of kNullAddress.
+  // Returns Smi::kZero due to CallCFunction.
+  static Address CallAccountMicrotaskContext(intptr_t microtask_queue_pointer,
+                                             Address raw_native_context);
+
   // v8::MicrotaskQueue implementations.
   void EnqueueMicrotask(v8::Isolate* isolate,
                         v8::Local<Function> microtask) override;
@@ -56,6 +64,8 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
       MicrotasksCompletedCallbackWithData callback, void* data) override;
   void RemoveMicrotasksCompletedCallback(
       MicrotasksCompletedCallbackWithData callback, void* data) override;
+  void SetMicrotasksContextAccountingCallback(
+      MicrotasksContextAccountingCallback callback, void* data) override;
   bool IsRunningMicrotasks() const override { return is_running_microtasks_; }
 
   // Runs all queued Microtasks.
@@ -110,6 +120,7 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   static const size_t kSizeOffset;
   static const size_t kStartOffset;
   static const size_t kFinishedMicrotaskCountOffset;
+  static const size_t kContextAccountingCallbackOffset;
 
   static const intptr_t kMinimumCapacity;
 
@@ -118,6 +129,9 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
 
   void OnCompleted(Isolate* isolate) const;
 
+  void AccountMicrotaskContext(Address native_context);
+  void ReportContextAccounting(Isolate* isolate);
+
   MicrotaskQueue();
   void ResizeBuffer(intptr_t new_capacity);
 
@@ -132,6 +146,21 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
 
+  // Microtasks and run time per native context in the current checkpoint, if
+  // context accounting is enabled. The contexts are strong roots.
+  struct ContextAccount {
+    Address native_context;
+    intptr_t microtask_count;
+    base::TimeDelta run_time;
+  };
+  MicrotasksContextAccountingCallback context_accounting_callback_ = nullptr;
+  void* context_accounting_data_ = nullptr;
+  std::vector<ContextAccount> context_accounts_;
+  // The account of the native context that is currently entered, or -1.
+  intptr_t current_context_account_ = -1;
+  intptr_t current_context_start_count_ = 0;
+  base::TimeTicks current_context_start_time_;
+
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
   MicrotaskQueue* next_ = nullptr;
@@ -4,6 +4,9 @@
 
 #include "src/execution/tiering-manager.h"
 
+#include <algorithm>
+
+#include "src/base/functional.h"
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/baseline/baseline.h"
@@ -17,6 +20,8 @@
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
 #include "src/interpreter/interpreter.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/string-inl.h"
 #include "src/tracing/trace-event.h"
 
 namespace v8 {
@@ -177,13 +182,17 @@ void TieringManager::AttemptOnStackReplacement(UnoptimizedFrame* frame,
 
 namespace {
 
-bool TiersUpToMaglev(CodeKind code_kind) {
+bool TiersUpToMaglev(SharedFunctionInfo shared, CodeKind code_kind) {
   // TODO(v8:7700): Flip the UNLIKELY when appropriate.
-  return V8_UNLIKELY(FLAG_maglev) && CodeKindIsUnoptimizedJSFunction(code_kind);
+  return V8_UNLIKELY(FLAG_maglev) &&
+         CodeKindIsUnoptimizedJSFunction(code_kind) &&
+         !shared.maglev_compilation_failed() &&
+         shared.PassesFilter(FLAG_maglev_filter);
 }
 
-bool TiersUpToMaglev(base::Optional<CodeKind> code_kind) {
-  return code_kind.has_value() && TiersUpToMaglev(code_kind.value());
+bool TiersUpToMaglev(SharedFunctionInfo shared,
+                     base::Optional<CodeKind> code_kind) {
+  return code_kind.has_value() && TiersUpToMaglev(shared, code_kind.value());
 }
 
 }  // namespace
@@ -191,9 +200,18 @@ bool TiersUpToMaglev(base::Optional<CodeKind> code_kind) {
 // static
 int TieringManager::InterruptBudgetFor(Isolate* isolate, JSFunction function) {
   if (function.has_feedback_vector()) {
-    return TiersUpToMaglev(function.GetActiveTier())
-               ? FLAG_interrupt_budget_for_maglev
-               : FLAG_interrupt_budget;
+    if (!TiersUpToMaglev(function.shared(), function.GetActiveTier())) {
+      return FLAG_interrupt_budget;
+    }
+    // A function that reached Maglev in the run that produced its code cache
+    // is likely hot again, so request Maglev code sooner, unless it has been
+    // deoptimizing in this run.
+    if (FLAG_tier_up_previously_optimized &&
+        function.shared().has_maglev_code_at_least_once() &&
+        function.feedback_vector().deopt_count() == 0) {
+      return FLAG_interrupt_budget_for_maglev_warm_start;
+    }
+    return FLAG_interrupt_budget_for_maglev;
   }
 
   DCHECK(!function.has_feedback_vector());
@@ -258,6 +276,10 @@ bool TieringManager::MaybeOSR(JSFunction function, UnoptimizedFrame* frame) {
 
 namespace {
 
+// Caps the reoptimization backoff at 2^kMaxBackoffShift times the regular
+// tick budget.
+constexpr int kMaxBackoffShift = 4;
+
 bool ShouldOptimizeAsSmallFunction(int bytecode_size, bool any_ic_changed) {
   return !any_ic_changed &&
          bytecode_size < FLAG_max_bytecode_size_for_early_opt;
@@ -270,7 +292,7 @@ OptimizationDecision TieringManager::ShouldOptimize(JSFunction function,
                                                     JavaScriptFrame* frame) {
   DCHECK_EQ(code_kind, function.GetActiveTier().value());
 
-  if (TiersUpToMaglev(code_kind)) {
+  if (TiersUpToMaglev(function.shared(), code_kind)) {
     return OptimizationDecision::Maglev();
   } else if (code_kind == CodeKind::TURBOFAN) {
     // Already in the top tier.
@@ -304,12 +326,26 @@ OptimizationDecision TieringManager::ShouldOptimize(JSFunction function,
     }
   }
   const int ticks = function.feedback_vector().profiler_ticks();
-  const int ticks_for_optimization =
+  int ticks_for_optimization =
       FLAG_ticks_before_optimization +
       (bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
+  if (FLAG_tier_up_previously_optimized &&
+      function.shared().has_optimized_at_least_once()) {
+    // The function was hot enough to be optimized before, possibly in the
+    // process that produced its code cache. Collect one tick worth of
+    // feedback and then optimize without waiting for the full budget.
+    ticks_for_optimization = std::min(ticks_for_optimization, 1);
+  }
+  // Back off exponentially from reoptimizing functions whose optimized code
+  // keeps getting invalidated, so that flapping feedback has time to settle.
+  const int deopt_count = function.feedback_vector().deopt_count();
+  if (FLAG_reoptimization_backoff && deopt_count > 0) {
+    ticks_for_optimization <<= std::min(deopt_count, kMaxBackoffShift);
+  }
   if (ticks >= ticks_for_optimization) {
     return OptimizationDecision::TurbofanHotAndStable();
-  } else if (ShouldOptimizeAsSmallFunction(bytecode.length(),
+  } else if ((!FLAG_reoptimization_backoff || deopt_count == 0) &&
+             ShouldOptimizeAsSmallFunction(bytecode.length(),
                                            any_ic_changed_)) {
     // If no IC was patched since the last tick and this function is very
     // small, optimistically optimize it now.
@@ -354,6 +390,8 @@ void TieringManager::OnInterruptTick(Handle<JSFunction> function) {
   if (had_feedback_vector) {
     function->SetInterruptBudget(isolate_);
   } else {
+    // Apply the hint before the vector computes the next interrupt budget.
+    ApplyTieringHint(function->shared());
     JSFunction::CreateAndAttachFeedbackVector(isolate_, function,
                                               &is_compiled_scope);
     DCHECK(is_compiled_scope.is_compiled());
@@ -408,5 +446,81 @@ void TieringManager::OnInterruptTick(Handle<JSFunction> function) {
   MaybeOptimizeFrame(function_obj, it.frame(), code_kind);
 }
 
+namespace {
+
+uint64_t TieringHintKey(uint32_t script_hash, int function_position) {
+  return (static_cast<uint64_t>(script_hash) << 32) |
+         static_cast<uint32_t>(function_position);
+}
+
+}  // namespace
+
+// static
+uint32_t TieringManager::ScriptHash(Script script) {
+  if (!script.source().IsString()) return 0;
+  String source = String::cast(script.source());
+  // Hashing must not allocate; sources are flattened for parsing anyway.
+  if (!source.IsFlat()) return 0;
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  int length = source.length();
+  size_t hash = base::hash_value(length);
+  for (int i = 0; i < length; i++) {
+    hash = base::hash_combine(hash, static_cast<size_t>(content.Get(i)));
+  }
+  return static_cast<uint32_t>(hash);
+}
+
+std::vector<TieringManager::TieringHint> TieringManager::GetTieringHints() {
+  std::vector<Handle<Script>> scripts;
+  {
+    Script::Iterator iterator(isolate_);
+    for (Script script = iterator.Next(); !script.is_null();
+         script = iterator.Next()) {
+      if (!script.IsUserJavaScript() || !script.source().IsString()) continue;
+      scripts.push_back(handle(script, isolate_));
+    }
+  }
+  std::vector<TieringHint> hints;
+  for (Handle<Script> script : scripts) {
+    String::Flatten(isolate_,
+                    handle(String::cast(script->source()), isolate_));
+    uint32_t script_hash = ScriptHash(*script);
+    SharedFunctionInfo::ScriptIterator infos(isolate_, *script);
+    for (SharedFunctionInfo info = infos.Next(); !info.is_null();
+         info = infos.Next()) {
+      bool maglev = info.has_maglev_code_at_least_once();
+      bool turbofan = info.has_optimized_at_least_once();
+      if (!maglev && !turbofan) continue;
+      hints.push_back({script_hash, info.StartPosition(), maglev, turbofan});
+    }
+  }
+  return hints;
+}
+
+void TieringManager::SetTieringHints(const std::vector<TieringHint>& hints) {
+  tiering_hints_.clear();
+  script_hashes_.clear();
+  for (const TieringHint& hint : hints) {
+    tiering_hints_[TieringHintKey(hint.script_hash, hint.function_position)] =
+        hint;
+  }
+}
+
+void TieringManager::ApplyTieringHint(SharedFunctionInfo shared) {
+  if (V8_LIKELY(tiering_hints_.empty())) return;
+  if (!shared.script().IsScript()) return;
+  Script script = Script::cast(shared.script());
+  auto script_hash = script_hashes_.find(script.id());
+  if (script_hash == script_hashes_.end()) {
+    script_hash = script_hashes_.emplace(script.id(), ScriptHash(script)).first;
+  }
+  auto hint = tiering_hints_.find(
+      TieringHintKey(script_hash->second, shared.StartPosition()));
+  if (hint == tiering_hints_.end()) return;
+  if (hint->second.maglev) shared.set_has_maglev_code_at_least_once(true);
+  if (hint->second.turbofan) shared.set_has_optimized_at_least_once(true);
+}
+
 }  // namespace internal
 }  // namespace v8
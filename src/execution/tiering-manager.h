@@ -5,6 +5,9 @@
 #ifndef V8_EXECUTION_TIERING_MANAGER_H_
 #define V8_EXECUTION_TIERING_MANAGER_H_
 
+#include <unordered_map>
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/utils/allocation.h"
@@ -18,6 +21,8 @@ class UnoptimizedFrame;
 class JavaScriptFrame;
 class JSFunction;
 class OptimizationDecision;
+class Script;
+class SharedFunctionInfo;
 enum class CodeKind : uint8_t;
 enum class OptimizationReason : uint8_t;
 
@@ -40,7 +45,26 @@ class TieringManager {
   // For use when no JSFunction is available.
   static int InitialInterruptBudget();
 
+  // A function that reached Maglev or TurboFan, identified across processes by
+  // the hash of its script source and its start position.
+  struct TieringHint {
+    uint32_t script_hash;
+    int function_position;
+    bool maglev;
+    bool turbofan;
+  };
+
+  // Collects the optimized functions of all live scripts.
+  std::vector<TieringHint> GetTieringHints();
+  // Functions matching {hints} are treated like functions that were optimized
+  // before once they allocate their feedback vector, and thus tier up early
+  // (see --tier-up-previously-optimized). Replaces earlier hints.
+  void SetTieringHints(const std::vector<TieringHint>& hints);
+
  private:
+  static uint32_t ScriptHash(Script script);
+  void ApplyTieringHint(SharedFunctionInfo shared);
+
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
   void MaybeOptimizeFrame(JSFunction function, JavaScriptFrame* frame,
@@ -67,6 +91,10 @@ class TieringManager {
 
   Isolate* const isolate_;
   bool any_ic_changed_ = false;
+  // Tiering hints keyed by script hash and function position.
+  std::unordered_map<uint64_t, TieringHint> tiering_hints_;
+  // Source hashes of the scripts looked up in {tiering_hints_}, by script id.
+  std::unordered_map<int, uint32_t> script_hashes_;
 };
 
 }  // namespace internal
@@ -6,6 +6,7 @@
 
 #include "include/v8-locker.h"
 #include "src/api/api.h"
+#include "src/base/platform/yield-processor.h"
 #include "src/debug/debug.h"
 #include "src/execution/execution.h"
 #include "src/execution/isolate-inl.h"
@@ -151,7 +152,16 @@ bool ThreadManager::RestoreThread() {
 }
 
 void ThreadManager::Lock() {
-  mutex_.Lock();
+  // Isolates that are handed from one thread to the next are typically only
+  // held for a short time by the previous owner. Spin for a bit before
+  // blocking so that the handoff does not pay for a futex wait and wakeup.
+  static constexpr int kSpinCount = 100;
+  bool locked = mutex_.TryLock();
+  for (int i = 0; !locked && i < kSpinCount; ++i) {
+    YIELD_PROCESSOR;
+    locked = mutex_.TryLock();
+  }
+  if (!locked) mutex_.Lock();
   mutex_owner_.store(ThreadId::Current(), std::memory_order_relaxed);
   DCHECK(IsLockedByCurrentThread());
 }
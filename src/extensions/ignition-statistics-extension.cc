@@ -8,6 +8,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
 #include "src/execution/isolate.h"
+#include "src/interpreter/bytecode-dispatch-sampler.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/interpreter/interpreter.h"
 
@@ -17,6 +18,11 @@ namespace internal {
 v8::Local<v8::FunctionTemplate>
 IgnitionStatisticsExtension::GetNativeFunctionTemplate(
     v8::Isolate* isolate, v8::Local<v8::String> name) {
+  if (strcmp(*v8::String::Utf8Value(isolate, name),
+             "getIgnitionSampledDispatches") == 0) {
+    return v8::FunctionTemplate::New(
+        isolate, IgnitionStatisticsExtension::GetIgnitionSampledDispatches);
+  }
   DCHECK_EQ(strcmp(*v8::String::Utf8Value(isolate, name),
                    "getIgnitionDispatchCounters"),
             0);
@@ -25,7 +31,8 @@ IgnitionStatisticsExtension::GetNativeFunctionTemplate(
 }
 
 const char* const IgnitionStatisticsExtension::kSource =
-    "native function getIgnitionDispatchCounters();";
+    "native function getIgnitionDispatchCounters();"
+    "native function getIgnitionSampledDispatches();";
 
 void IgnitionStatisticsExtension::GetIgnitionDispatchCounters(
     const v8::FunctionCallbackInfo<v8::Value>& args) {
@@ -35,5 +42,17 @@ void IgnitionStatisticsExtension::GetIgnitionDispatchCounters(
                          ->GetDispatchCountersObject()));
 }
 
+void IgnitionStatisticsExtension::GetIgnitionSampledDispatches(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(args.GetIsolate());
+  interpreter::BytecodeDispatchSampler* sampler =
+      isolate->interpreter()->dispatch_sampler();
+  if (sampler == nullptr) {
+    args.GetReturnValue().SetUndefined();
+    return;
+  }
+  args.GetReturnValue().Set(Utils::ToLocal(sampler->GetSamplesObject()));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -24,6 +24,9 @@ class IgnitionStatisticsExtension : public v8::Extension {
 
   static void GetIgnitionDispatchCounters(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  // Returns undefined unless --sample-ignition-dispatches is enabled.
+  static void GetIgnitionSampledDispatches(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
 
  private:
   static const char* const kSource;
@@ -382,6 +382,12 @@ DEFINE_BOOL(enable_sharedarraybuffer_per_context, false,
 
 #ifdef V8_INTL_SUPPORT
 DEFINE_BOOL(icu_timezone_data, true, "get information about timezones from ICU")
+DEFINE_INT(icu_timezone_transitions_from_year, 1900,
+           "first year covered by the precomputed local time zone offset "
+           "transitions")
+DEFINE_INT(icu_timezone_transitions_to_year, 2100,
+           "year after the last year covered by the precomputed local time "
+           "zone offset transitions")
 #endif
 
 #ifdef V8_ENABLE_DOUBLE_CONST_STORE_CHECK
@@ -520,6 +526,8 @@ DEFINE_BOOL_READONLY(maglev, false, "enable the maglev optimizing compiler")
 #endif  // V8_ENABLE_MAGLEV
 
 DEFINE_STRING(maglev_filter, "*", "optimization filter for the maglev compiler")
+DEFINE_BOOL(maglev_inline_accessors, true,
+            "inline monomorphic calls to trivial field getters in maglev")
 DEFINE_BOOL(maglev_break_on_entry, false, "insert an int3 on maglev entries")
 DEFINE_BOOL(print_maglev_graph, false, "print maglev graph")
 DEFINE_BOOL(print_maglev_code, false, "print maglev code")
@@ -599,6 +607,9 @@ DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
 DEFINE_BOOL(trace_pretenuring_statistics, false,
             "trace allocation site pretenuring statistics")
+DEFINE_INT(trace_pretenuring_top_sites, 0,
+           "after each GC, print the given number of allocation sites with "
+           "the highest memento survival ratio and their pretenuring decision")
 DEFINE_BOOL(track_field_types, true, "track field types")
 DEFINE_BOOL(trace_block_coverage, false,
             "trace collected block coverage information")
@@ -633,6 +644,9 @@ DEFINE_INT(interrupt_budget_factor_for_feedback_allocation, 8,
 // overall budget (including the multiple required ticks).
 DEFINE_INT(interrupt_budget_for_maglev, 40 * KB,
            "interrupt budget which should be used for the profiler counter")
+DEFINE_INT(interrupt_budget_for_maglev_warm_start, 4 * KB,
+           "interrupt budget for functions that had maglev code in the run "
+           "that produced their code cache")
 
 // Tiering: Turbofan.
 DEFINE_INT(interrupt_budget, 132 * KB,
@@ -646,10 +660,33 @@ DEFINE_INT(bytecode_size_allowance_per_tick, 1100,
 DEFINE_INT(
     max_bytecode_size_for_early_opt, 81,
     "Maximum bytecode length for a function to be optimized on the first tick")
+DEFINE_BOOL(reoptimization_backoff, true,
+            "double the ticks needed to reoptimize a function after each "
+            "deoptimization that invalidated its optimized code")
+DEFINE_INT(max_deopts_before_disabling_optimization, 0,
+           "disable optimization of a function after this many "
+           "deoptimizations invalidated its code (0 means never, at most 15)")
+DEFINE_BOOL(trace_deopt_loops, false,
+            "trace deoptimizations that count towards reoptimization backoff")
+DEFINE_BOOL(tier_up_previously_optimized, true,
+            "optimize functions after a single tick if they were optimized "
+            "before, e.g. in the run that produced their code cache")
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the number of entries in the primary tables of the "
+           "megamorphic stub caches (4 to 16)")
+DEFINE_INT(stub_cache_secondary_table_bits, 9,
+           "log2 of the number of entries in the secondary tables of the "
+           "megamorphic stub caches (4 to 16)")
 DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
+DEFINE_BOOL(feedback_vector_warm_start, true,
+            "allocate feedback vectors right away for functions that had one "
+            "before, e.g. in the run that produced their code cache")
+DEFINE_BOOL(dedupe_unoptimized_metadata, true,
+            "share identical constant pools, handler tables and feedback "
+            "metadata between functions")
 
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
@@ -660,6 +697,9 @@ DEFINE_BOOL(ignition_filter_expression_positions, true,
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(ignition_trim_generator_registers, false,
+            "only save and restore the registers that are live across each "
+            "suspend point of generators and async functions")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
@@ -690,6 +730,13 @@ DEFINE_STRING(
     trace_ignition_dispatches_output_file, nullptr,
     "write the bytecode handler dispatch table to the specified file (d8 only) "
     "(requires building with v8_enable_ignition_dispatch_counting)")
+DEFINE_BOOL(sample_ignition_dispatches, false,
+            "approximate per-function bytecode histograms and dispatch counts "
+            "by sampling on bytecode budget interrupts (works in release "
+            "builds)")
+DEFINE_STRING(sample_ignition_dispatches_output_file, nullptr,
+              "write the sampled bytecode dispatches to the specified file "
+              "(d8 only)")
 
 DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
@@ -714,9 +761,8 @@ DEFINE_BOOL(baseline_batch_compilation, true, "batch compile Sparkplug code")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #else
-DEFINE_BOOL(concurrent_sparkplug, false,
+DEFINE_BOOL(concurrent_sparkplug, true,
             "compile Sparkplug code in a background thread")
-DEFINE_WEAK_IMPLICATION(future, concurrent_sparkplug)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sparkplug)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_sparkplug)
 DEFINE_NEG_IMPLICATION(jitless, concurrent_sparkplug)
@@ -730,6 +776,9 @@ DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
+DEFINE_BOOL(sparkplug_code_cache_warm_start, true,
+            "compile functions deserialized from the code cache with "
+            "Sparkplug if they had baseline code when the cache was created")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
@@ -765,6 +814,12 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_recompilation_shortest_first, false,
+            "let background threads pick the queued function with the "
+            "smallest bytecode first")
+DEFINE_BOOL(concurrent_recompilation_hotness_priority, false,
+            "let background threads pick the hottest queued function first "
+            "and let hot functions evict colder ones from a full queue")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -820,6 +875,8 @@ DEFINE_BOOL(trace_turbo_trimming, false, "trace TurboFan's graph trimmer")
 DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
 DEFINE_BOOL(trace_turbo_loop, false, "trace TurboFan's loop optimizations")
+DEFINE_BOOL(trace_turbo_loop_vectorization, false,
+            "trace which innermost loops TurboFan could vectorize")
 DEFINE_BOOL(trace_turbo_alloc, false, "trace TurboFan's register allocator")
 DEFINE_BOOL(trace_all_uses, false, "trace all use positions")
 DEFINE_BOOL(trace_representation, false, "trace representation types")
@@ -870,6 +927,14 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_STRING(turbo_inlining_profile, nullptr,
+              "file with call edges (caller,callee,count) that guides "
+              "TurboFan's inlining decisions")
+DEFINE_FLOAT(turbo_inlining_profile_hot_count, 1000,
+             "minimum call count for a profiled call edge to be hot")
+DEFINE_FLOAT(turbo_inlining_profile_budget_factor, 2.0,
+             "scale factor of the cumulative inlining budget for call sites "
+             "that are hot in the inlining profile")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -884,6 +949,9 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile OSR code on a background thread and enter it at the next "
+            "back edge once it is ready")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -905,12 +973,18 @@ DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
+DEFINE_BOOL(turbo_loop_bounds_check_elimination, true,
+            "eliminate bounds checks on induction variables that are implied "
+            "by the loop condition")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_BOOL(turbo_instruction_scheduling_cpu_model, true,
+            "use latency tables for the host microarchitecture when "
+            "scheduling instructions, where available")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
@@ -932,6 +1006,16 @@ DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
 DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
             "always use the mid-tier register allocator (for testing)")
+// This limit is chosen somewhat arbitrarily, by looking at a few bigger
+// WebAssembly programs, and chosing the limit such that functions that take
+// >100ms in register allocation are switched to mid-tier.
+DEFINE_INT(turbo_top_tier_regalloc_max_virtual_registers, 8192,
+           "maximum number of virtual registers for the top-tier register "
+           "allocator before falling back to the mid-tier one")
+DEFINE_SIZE_T(turbo_top_tier_regalloc_zone_budget_mb, 256,
+              "estimated zone budget (in MB) for the top-tier register "
+              "allocator before falling back to the mid-tier one (0 means "
+              "no budget)")
 
 DEFINE_BOOL(turbo_optimize_apply, true, "optimize Function.prototype.apply")
 
@@ -991,6 +1075,12 @@ DEFINE_NEG_NEG_IMPLICATION(liftoff, wasm_dynamic_tiering)
 DEFINE_WEAK_IMPLICATION(future, wasm_dynamic_tiering)
 DEFINE_INT(wasm_tiering_budget, 1800000,
            "budget for dynamic tiering (rough approximation of bytes executed")
+DEFINE_BOOL(wasm_tiering_profile_to_file, false,
+            "write the dynamic tiering profile of each wasm module to a "
+            "profile-wasm-<hash> file when the module is freed")
+DEFINE_BOOL(wasm_tiering_profile_from_file, false,
+            "read dynamic tiering profiles from profile-wasm-<hash> files, and "
+            "compile the functions that were hot with TurboFan right away")
 DEFINE_INT(
     wasm_caching_threshold, 1000000,
     "the amount of wasm top tier code that triggers the next caching event")
@@ -1124,12 +1214,21 @@ DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
+DEFINE_BOOL(wasm_lazy_compile_callees, false,
+            "compile the direct callees of lazily compiled wasm functions in "
+            "the background")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
+DEFINE_INT(wasm_code_aging_epochs, 0,
+           "number of wasm code GCs after which Liftoff code that did not run "
+           "is replaced by a lazy compile stub (0 to disable)")
+DEFINE_INT(wasm_code_commit_batch_size, 256,
+           "commit this many KB of wasm code space ahead of allocations, to "
+           "save permission changes (0 to commit only what is needed)")
 DEFINE_INT(wasm_max_initial_code_space_reservation, 0,
            "maximum size of the initial wasm code space reservation (in MB)")
 
@@ -1178,6 +1277,9 @@ DEFINE_SIZE_T(
     "both max_semi_space_size and max_old_space_size take precedence. "
     "All three flags cannot be specified at the same time.")
 DEFINE_SIZE_T(initial_heap_size, 0, "initial size of the heap (in Mbytes)")
+DEFINE_SIZE_T(process_heap_budget, 0,
+              "old generation budget shared by all isolates of the process, "
+              "distributed by allocation rate (in Mbytes, 0 to disable)")
 DEFINE_BOOL(huge_max_old_generation_size, true,
             "Increase max size of the old space to 4 GB for x64 systems with"
             "the physical memory bigger than 16 GB")
@@ -1196,6 +1298,9 @@ DEFINE_BOOL(trace_gc, false,
 DEFINE_BOOL(trace_gc_nvp, false,
             "print one detailed trace line in name=value format "
             "after each garbage collection")
+DEFINE_BOOL(gc_scope_histograms, false,
+            "record duration histograms of GC phases for "
+            "v8::metrics::GarbageCollectionScopeHistograms")
 DEFINE_BOOL(trace_gc_ignore_scavenger, false,
             "do not print trace line after scavenger collection")
 DEFINE_BOOL(trace_idle_notification, false,
@@ -1279,7 +1384,14 @@ DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
+DEFINE_BOOL(concurrent_marking_prefetch, false,
+            "prefetch a window of objects ahead of visiting them in "
+            "concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(allocation_aware_sweeping, true,
+            "let concurrent sweeper tasks start with the pages that have the "
+            "fewest free bytes, leaving the most promising pages to the "
+            "allocator")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
@@ -1293,6 +1405,11 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_INT(sample_gc_object_stats, 0,
+           "record live object counts and sizes per instance type on every "
+           "n-th old generation page during full GCs, making them available "
+           "through v8::Isolate::GetHeapObjectStatisticsAtLastGC without "
+           "gc stats tracing (0 disables sampling)")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -1301,6 +1418,9 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 0,
+              "maximum size in KB of freed zone segments that are kept for "
+              "reuse by later zones (0 disables pooling)")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1339,11 +1459,28 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_SIZE_T(array_buffer_pool_size, 0,
+              "size of the pool of freed ArrayBuffer backing stores the "
+              "default allocator keeps for reuse (in Mbytes)")
+DEFINE_BOOL(numa_local_heap_pages, false,
+            "place committed data pages on the NUMA node of the allocating "
+            "thread (Linux only)")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back the code range, the pointer compression "
+            "cage and wasm code spaces with transparent huge pages (Linux "
+            "only)")
+DEFINE_BOOL(merge_read_only_pages, false,
+            "advise the OS that sealed read-only space pages may be "
+            "deduplicated with identical pages of other processes (Linux only)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
 DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
+DEFINE_SIZE_T(code_space_evacuation_quota, 0,
+              "Maximum amount of live code in KB evacuated by a single full "
+              "collection; remaining fragmented code pages are compacted by "
+              "subsequent collections (0 means no separate quota)")
 DEFINE_BOOL(compact_maps, false,
             "Perform compaction on maps on full collections.")
 DEFINE_BOOL(use_map_space, true, "Use separate space for maps.")
@@ -1366,6 +1503,9 @@ DEFINE_BOOL(flush_baseline_code, false,
             "flush of baseline code when it has not been executed recently")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
+DEFINE_SIZE_T(code_flushing_budget_mb, 0,
+              "flush least recently executed bytecode and baseline code early "
+              "to keep flushable code below this size (0 means no budget)")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -1507,8 +1647,8 @@ DEFINE_BOOL(expose_externalize_string, false,
             "expose externalize string extension")
 DEFINE_BOOL(expose_trigger_failure, false, "expose trigger-failure extension")
 DEFINE_BOOL(expose_ignition_statistics, false,
-            "expose ignition-statistics extension (requires building with "
-            "v8_enable_ignition_dispatch_counting)")
+            "expose ignition-statistics extension (exact dispatch counters "
+            "require building with v8_enable_ignition_dispatch_counting)")
 DEFINE_INT(stack_trace_limit, 10, "number of stack frames to capture")
 DEFINE_BOOL(builtins_in_stack_traces, false,
             "show built-in functions in stack traces")
@@ -1577,6 +1717,12 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_BOOL(process_script_cache, false,
+            "share compiled top-level scripts between the isolates of a "
+            "process")
+DEFINE_STRING(script_cache_dir, nullptr,
+              "directory of a persistent cache of compiled scripts, shared "
+              "between processes (disabled if not set)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1594,6 +1740,14 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_streaming, false,
+            "spawn parallel compile tasks for eagerly compiled, top-level "
+            "functions of streamed scripts")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_streaming,
+                   lazy_compile_dispatcher)
+DEFINE_INT(parallel_compile_eval_min_length, 16 * KB,
+           "minimum source length of eval and Function constructor code for "
+           "which parallel compile tasks are spawned")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -1661,6 +1815,9 @@ DEFINE_IMPLICATION(log_ic, log_code)
 DEFINE_GENERIC_IMPLICATION(
     log_ic, TracingFlags::ic_stats.store(
                 v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_INT(ic_transition_sample_interval, 0,
+           "record every n-th inline cache state transition in memory, see "
+           "v8::Isolate::SetICTransitionSampleInterval (0 = disabled)")
 DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
@@ -1672,6 +1829,10 @@ DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
 DEFINE_BOOL(super_ic, true, "use an IC for super property loads")
 
 DEFINE_BOOL(enable_mega_dom_ic, false, "use MegaDOM IC state for API objects")
+DEFINE_INT(mega_dom_ic_map_threshold, 0,
+           "number of receiver maps at which a polymorphic API accessor site "
+           "switches to the MegaDOM state (0 = once the polymorphism limit is "
+           "exceeded)")
 
 // objects.cc
 DEFINE_BOOL(trace_prototype_users, false,
@@ -1785,6 +1946,9 @@ DEFINE_BOOL(verify_snapshot_checksum, true,
             "checksum creation and verification for code caches.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "decompress the chunks of compressed snapshots on background "
+            "threads")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
@@ -1802,6 +1966,12 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_async_tier_up, false,
+            "tier up regexps in a foreground task, and keep interpreting them "
+            "until the native code is installed")
+DEFINE_BOOL(regexp_prefilter, true,
+            "search for a literal that every match contains before running "
+            "irregexp code")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -1821,6 +1991,9 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_dfa_filter, true,
+            "let the experimental regexp engine find out whether and where "
+            "the next match can start using a lazily built DFA")
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -1869,6 +2042,10 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_BOOL(reorder_builtins, false,
+            "Lay out builtins in the embedded blob by how often they were "
+            "called according to --turbo-profiling-log-file, so that hot "
+            "builtins are adjacent. (mksnapshot only)")
 
 // On some platforms, the .text section only has execute permissions.
 DEFINE_BOOL(text_is_readable, true,
@@ -1881,8 +2058,12 @@ DEFINE_NEG_NEG_IMPLICATION(text_is_readable, partial_constant_pool)
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_BOOL(cppgc_young_generation, false,
+            "run a young generation GC of the attached CppHeap after every "
+            "young generation GC (requires cppgc_enable_young_generation)")
 DEFINE_BOOL(minor_mc_sweeping, false,
             "perform sweeping in young generation mark compact GCs")
+DEFINE_IMPLICATION(minor_mc_sweeping, minor_mc)
 
 //
 // Dev shell flags
@@ -2067,7 +2248,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 #if !MUST_WRITE_PROTECT_CODE_MEMORY
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
@@ -2186,6 +2366,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_streaming)
 
 DEFINE_BOOL(predictable_gc_schedule, false,
             "Predictable garbage collection schedule. Fixes heap growing, "
@@ -2207,6 +2388,8 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_streaming)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_snapshot_decompression)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
@@ -39,6 +39,10 @@ enum class HandleHolder { kLive, kDead };
 
 constexpr size_t kBlockSize = 256;
 
+// Lists of young nodes are only shrunk after a scavenge once they use at most
+// a quarter of their capacity, and never below this capacity.
+constexpr size_t kMinYoungNodeListCapacityToShrink = 1024;
+
 }  // namespace
 
 template <class _NodeType>
@@ -1535,7 +1539,13 @@ void GlobalHandles::UpdateAndCompactListOfYoungNode(
   }
   DCHECK_LE(last, node_list->size());
   node_list->resize(last);
-  node_list->shrink_to_fit();
+  // Shrinking on every scavenge copies all surviving entries into a new
+  // backing store, only for the list to grow again as new handles are
+  // created. Give memory back only once the list has shrunk substantially.
+  if (node_list->capacity() > kMinYoungNodeListCapacityToShrink &&
+      last < node_list->capacity() / 4) {
+    node_list->shrink_to_fit();
+  }
 }
 
 void GlobalHandles::UpdateListOfYoungNodes() {
@@ -0,0 +1,33 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/code-flushing-budget.h"
+
+namespace v8 {
+namespace internal {
+
+void CodeFlushingBudget::UpdateFlushingAge() {
+  flushing_age_ = BytecodeArray::kIsOldBytecodeAge;
+  if (is_enabled()) {
+    // Code that was executed since the last GC (age 0) is never flushed early.
+    // Otherwise, pick the oldest flushing age for which the code that is kept
+    // fits into the budget.
+    size_t kept_size = size_by_age_[BytecodeArray::kNoAgeBytecodeAge].load(
+        std::memory_order_relaxed);
+    int age = BytecodeArray::kNoAgeBytecodeAge + 1;
+    for (; age < BytecodeArray::kIsOldBytecodeAge; ++age) {
+      size_t size = size_by_age_[age].load(std::memory_order_relaxed);
+      if (kept_size + size > budget_in_bytes_) break;
+      kept_size += size;
+    }
+    flushing_age_ = static_cast<Age>(age);
+  }
+}
+
+void CodeFlushingBudget::ResetSizes() {
+  for (auto& size : size_by_age_) size.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,70 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CODE_FLUSHING_BUDGET_H_
+#define V8_HEAP_CODE_FLUSHING_BUDGET_H_
+
+#include <atomic>
+
+#include "src/base/macros.h"
+#include "src/objects/code.h"
+
+namespace v8 {
+namespace internal {
+
+// Caps the amount of memory used by flushable bytecode and baseline code.
+//
+// Bytecode ages by one step in every full GC that doesn't see it executed, and
+// is flushed once it gets old. Marking records how much flushable code there
+// is for each age, and at the end of the GC the budget picks the age at which
+// code is considered old during the next GC: it is lowered from the default
+// until the code younger than that age fits into the budget. With no budget
+// set, the default age is always used.
+class V8_EXPORT_PRIVATE CodeFlushingBudget final {
+ public:
+  using Age = BytecodeArray::Age;
+
+  CodeFlushingBudget() { ResetSizes(); }
+  CodeFlushingBudget(const CodeFlushingBudget&) = delete;
+  CodeFlushingBudget& operator=(const CodeFlushingBudget&) = delete;
+
+  // A budget of 0 disables the budget.
+  void set_budget_in_bytes(size_t budget) { budget_in_bytes_ = budget; }
+  size_t budget_in_bytes() const { return budget_in_bytes_; }
+  bool is_enabled() const { return budget_in_bytes_ > 0; }
+
+  // The age at which code is flushed during the current GC. Only changes
+  // between GCs.
+  Age flushing_age() const { return flushing_age_; }
+
+  // Records |size| bytes of flushable code of the given age. Called by the
+  // main thread and concurrent markers.
+  void RecordFlushableCode(Age age, size_t size) {
+    DCHECK(is_enabled());
+    DCHECK_GE(age, BytecodeArray::kFirstBytecodeAge);
+    DCHECK_LE(age, BytecodeArray::kLastBytecodeAge);
+    size_by_age_[age].fetch_add(size, std::memory_order_relaxed);
+  }
+
+  // Forgets the sizes recorded during the previous marking. Called when
+  // marking starts.
+  void ResetSizes();
+
+  // Computes the flushing age for the next GC from the sizes recorded during
+  // marking. Called in the atomic pause once marking is done.
+  void UpdateFlushingAge();
+
+ private:
+
+  static constexpr int kNumberOfAges = BytecodeArray::kAfterLastBytecodeAge;
+
+  size_t budget_in_bytes_ = 0;
+  Age flushing_age_ = BytecodeArray::kIsOldBytecodeAge;
+  std::atomic<size_t> size_by_age_[kNumberOfAges];
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CODE_FLUSHING_BUDGET_H_
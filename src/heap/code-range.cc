@@ -134,6 +134,13 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
 
   if (!VirtualMemoryCage::InitReservation(params)) return false;
 
+  if (FLAG_transparent_huge_pages) {
+    // This is advisory; regular pages are used if the OS refuses.
+    USE(base::OS::AdviseHugePages(
+        reinterpret_cast<void*>(reservation()->address()),
+        reservation()->size()));
+  }
+
   if (V8_EXTERNAL_CODE_SPACE_BOOL) {
     // Ensure that the code range does not cross the 4Gb boundary and thus
     // default compression scheme of truncating the Code pointers to 32-bit
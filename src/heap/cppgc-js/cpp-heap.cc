@@ -602,16 +602,21 @@ void CppHeap::TraceEpilogue() {
     marker_->LeaveAtomicPause();
   }
   marker_.reset();
-  if (isolate_) {
-    auto* tracer = isolate_->heap()->local_embedder_heap_tracer();
-    DCHECK_NOT_NULL(tracer);
-    tracer->UpdateRemoteStats(
-        stats_collector_->marked_bytes(),
-        stats_collector_->marking_time().InMillisecondsF());
-  }
-  // The allocated bytes counter in v8 was reset to the current marked bytes, so
-  // any pending allocated bytes updates should be discarded.
-  buffered_allocated_bytes_ = 0;
+  // Minor GCs only mark young objects, so their marked bytes are not a
+  // meaningful baseline for the global heap limits.
+  if (*collection_type_ ==
+      cppgc::internal::GarbageCollector::Config::CollectionType::kMajor) {
+    if (isolate_) {
+      auto* tracer = isolate_->heap()->local_embedder_heap_tracer();
+      DCHECK_NOT_NULL(tracer);
+      tracer->UpdateRemoteStats(
+          stats_collector_->marked_bytes(),
+          stats_collector_->marking_time().InMillisecondsF());
+    }
+    // The allocated bytes counter in v8 was reset to the current marked bytes,
+    // so any pending allocated bytes updates should be discarded.
+    buffered_allocated_bytes_ = 0;
+  }
   const size_t bytes_allocated_in_prefinalizers = ExecutePreFinalizers();
 #if CPPGC_VERIFY_HEAP
   UnifiedHeapMarkingVerifier verifier(*this, *collection_type_);
@@ -824,6 +829,31 @@ CppHeap::MetricRecorderAdapter* CppHeap::GetMetricRecorder() const {
 
 void CppHeap::FinishSweepingIfRunning() { sweeper_.FinishIfRunning(); }
 
+void CppHeap::RunMinorGCIfNeeded() {
+#if defined(CPPGC_YOUNG_GENERATION)
+  if (!FLAG_cppgc_young_generation) return;
+  if (in_no_gc_scope()) return;
+  // Minor GCs are not nested in major GCs. Young objects are reclaimed by the
+  // ongoing major GC anyways.
+  if (IsMarking()) return;
+
+  // Finish sweeping in case it is still running.
+  sweeper_.FinishIfRunning();
+
+  SetStackEndOfCurrentGC(v8::base::Stack::GetCurrentStackPosition());
+  InitializeTracing(
+      cppgc::internal::GarbageCollector::Config::CollectionType::kMinor,
+      GarbageCollectionFlagValues::kNoFlags);
+  StartTracing();
+  // V8 -> cppgc references are traced from the remembered V8 wrappers when
+  // entering the final pause. The stack is scanned conservatively since the
+  // GC is triggered from within V8.
+  EnterFinalPause(cppgc::EmbedderStackState::kMayContainHeapPointers);
+  AdvanceTracing(std::numeric_limits<double>::infinity());
+  TraceEpilogue();
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+}
+
 std::unique_ptr<CppMarkingState> CppHeap::CreateCppMarkingState() {
   DCHECK(IsMarking());
   return std::make_unique<CppMarkingState>(
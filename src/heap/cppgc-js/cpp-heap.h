@@ -119,6 +119,10 @@ class V8_EXPORT_PRIVATE CppHeap final
 
   void FinishSweepingIfRunning();
 
+  // Runs an atomic young generation GC with --cppgc-young-generation. Called
+  // by V8 after its own young generation GCs.
+  void RunMinorGCIfNeeded();
+
   void InitializeTracing(
       cppgc::internal::GarbageCollector::Config::CollectionType,
       GarbageCollectionFlags);
@@ -192,8 +192,13 @@ void ObjectAllocator::RefillLinearAllocationBuffer(NormalPageSpace& space,
     if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
   }
 
-  sweeper.FinishIfRunning();
-  // TODO(chromium:1056170): Make use of the synchronously freed memory.
+  if (sweeper.IsSweepingInProgress()) {
+    sweeper.FinishIfRunning();
+    // Finishing sweeping also finalizes pages that were swept concurrently,
+    // which may have returned a suitable block to the free list of this space.
+    // Use it in bulk for the LAB instead of growing the heap.
+    if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
+  }
 
   auto* new_page = NormalPage::Create(page_backend_, space);
   space.AddPage(new_page);
@@ -222,7 +222,10 @@ void StatsCollector::NotifySweepingCompleted() {
   gc_state_ = GarbageCollectionState::kNotRunning;
   previous_ = std::move(current_);
   current_ = Event();
-  if (metric_recorder_) {
+  // Only full cycles are reported. Young generation cycles are folded into the
+  // young generation cycles of the attached V8 heap.
+  if (metric_recorder_ &&
+      previous_.collection_type == CollectionType::kMajor) {
     MetricRecorder::FullCycle event = GetFullCycleEventForMetricRecorder(
         previous_.scope_data[kAtomicMark].InMicroseconds(),
         previous_.scope_data[kAtomicWeak].InMicroseconds(),
@@ -758,6 +758,26 @@ MaybeHandle<String> FactoryBase<Impl>::NewConsString(
     return result;
   }
 
+  // Appending a short string to a rope that ends in a short segment, as
+  // repeated += does, merges both into one flat segment instead of adding
+  // another node. This keeps ropes built from many small pieces smaller and
+  // cheaper to flatten. Keep in sync with StringBuiltinsAssembler::StringAdd.
+  if (right_length < ConsString::kMinLength && left->IsConsString()) {
+    Handle<ConsString> left_cons = Handle<ConsString>::cast(left);
+    Handle<String> tail(left_cons->second(), isolate());
+    if (tail->length() + right_length < ConsString::kMinLength) {
+      Handle<String> first(left_cons->first(), isolate());
+      if (first->IsThinString()) {
+        first = handle(ThinString::cast(*first).actual(), isolate());
+      }
+      tail = NewConsString(tail, right, allocation).ToHandleChecked();
+      return NewConsString(
+          first, tail, length,
+          first->IsOneByteRepresentation() && tail->IsOneByteRepresentation(),
+          allocation);
+    }
+  }
+
   return NewConsString(left, right, length, is_one_byte, allocation);
 }
 
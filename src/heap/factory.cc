@@ -512,8 +512,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector.InitializeOptimizationState();
   vector.set_closure_feedback_cell_array(*closure_feedback_cell_array);
 
-  // TODO(leszeks): Initialize based on the feedback metadata.
-  MemsetTagged(ObjectSlot(vector.slots_start()), *undefined_value(), length);
+  vector.InitializeSlots(shared->feedback_metadata(), read_only_roots());
   return handle(vector, isolate());
 }
 
@@ -3594,6 +3593,8 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store.set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store.set(JSRegExp::kIrregexpTicksUntilTierUpIndex, ticks_until_tier_up);
   store.set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+  store.set(JSRegExp::kIrregexpRequiredLiteralIndex, uninitialized);
+  store.set(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex, uninitialized);
   regexp->set_data(store);
 }
 
@@ -3618,6 +3619,8 @@ void Factory::SetRegExpExperimentalData(Handle<JSRegExp> regexp,
   store.set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store.set(JSRegExp::kIrregexpTicksUntilTierUpIndex, uninitialized);
   store.set(JSRegExp::kIrregexpBacktrackLimit, uninitialized);
+  store.set(JSRegExp::kIrregexpRequiredLiteralIndex, uninitialized);
+  store.set(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex, uninitialized);
   regexp->set_data(store);
 }
 
@@ -4,10 +4,12 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <algorithm>
 #include <cstdarg>
 
 #include "include/v8-metrics.h"
 #include "src/base/atomic-utils.h"
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -90,6 +92,10 @@ GCTracer::Scope::Scope(GCTracer* tracer, ScopeId scope, ThreadKind thread_kind)
 GCTracer::Scope::~Scope() {
   double duration_ms = tracer_->MonotonicallyIncreasingTimeInMs() - start_time_;
 
+  if (V8_UNLIKELY(FLAG_gc_scope_histograms)) {
+    tracer_->RecordScopeDuration(scope_, duration_ms);
+  }
+
   if (thread_kind_ == ThreadKind::kMain) {
 #if DEBUG
     AssertMainThread();
@@ -1304,6 +1310,49 @@ void GCTracer::AddScopeSampleBackground(Scope::ScopeId scope, double duration) {
   counter.total_duration_ms += duration;
 }
 
+void GCTracer::RecordScopeDuration(Scope::ScopeId scope, double duration_ms) {
+  DCHECK_LT(scope, Scope::NUMBER_OF_SCOPES);
+  constexpr size_t kNumberOfBuckets =
+      v8::metrics::GarbageCollectionScopeHistograms::kNumberOfBuckets;
+  const uint64_t duration_us = static_cast<uint64_t>(
+      std::max(0.0, duration_ms) * base::Time::kMicrosecondsPerMillisecond);
+  // Durations in [2^(i-1), 2^i) us go to bucket i, durations below 1us go to
+  // bucket 0.
+  const size_t bucket =
+      std::min<size_t>(kNumberOfBuckets - 1,
+                       64 - base::bits::CountLeadingZeros(duration_us));
+
+  base::MutexGuard guard(&scope_duration_histograms_mutex_);
+  if (!scope_duration_histograms_) {
+    scope_duration_histograms_ =
+        std::make_unique<ScopeDurationHistogram[]>(Scope::NUMBER_OF_SCOPES);
+  }
+  ScopeDurationHistogram& histogram = scope_duration_histograms_[scope];
+  histogram.count++;
+  histogram.total_duration_ms += duration_ms;
+  histogram.buckets[bucket]++;
+}
+
+v8::metrics::GarbageCollectionScopeHistograms
+GCTracer::GetScopeDurationHistograms() {
+  v8::metrics::GarbageCollectionScopeHistograms result;
+  base::MutexGuard guard(&scope_duration_histograms_mutex_);
+  if (!scope_duration_histograms_) return result;
+  for (int id = 0; id < Scope::NUMBER_OF_SCOPES; id++) {
+    const ScopeDurationHistogram& histogram = scope_duration_histograms_[id];
+    if (histogram.count == 0) continue;
+    v8::metrics::GarbageCollectionScopeHistograms::Histogram entry;
+    entry.name = Scope::Name(static_cast<Scope::ScopeId>(id));
+    entry.count = histogram.count;
+    entry.total_duration_us = static_cast<int64_t>(
+        histogram.total_duration_ms * base::Time::kMicrosecondsPerMillisecond);
+    std::copy(std::begin(histogram.buckets), std::end(histogram.buckets),
+              std::begin(entry.buckets));
+    result.histograms.push_back(entry);
+  }
+  return result;
+}
+
 void GCTracer::RecordGCPhasesHistograms(RecordGCPhasesInfo::Mode mode) {
   Counters* counters = heap_->isolate()->counters();
   if (mode == RecordGCPhasesInfo::Mode::Finalize) {
@@ -411,6 +411,9 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddScopeSampleBackground(Scope::ScopeId scope, double duration);
 
+  // Returns the duration histograms recorded with --gc-scope-histograms.
+  v8::metrics::GarbageCollectionScopeHistograms GetScopeDurationHistograms();
+
   void RecordGCPhasesHistograms(RecordGCPhasesInfo::Mode mode);
 
   void RecordEmbedderSpeed(size_t bytes, double duration);
@@ -443,11 +446,23 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
+  FRIEND_TEST(GCTracerTest, ScopeDurationHistograms);
 
   struct BackgroundCounter {
     double total_duration_ms;
   };
 
+  struct ScopeDurationHistogram {
+    int64_t count = 0;
+    double total_duration_ms = 0;
+    int64_t buckets[v8::metrics::GarbageCollectionScopeHistograms::
+                        kNumberOfBuckets] = {};
+  };
+
+  // Adds a single scope duration to the histograms. Called from the main
+  // thread and from background threads.
+  void RecordScopeDuration(Scope::ScopeId scope, double duration_ms);
+
   // Returns the average speed of the events in the buffer.
   // If the buffer is empty, the result is 0.
   // Otherwise, the result is between 1 byte/ms and 1 GB/ms.
@@ -579,6 +594,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   base::Mutex background_counter_mutex_;
   BackgroundCounter background_counter_[Scope::NUMBER_OF_SCOPES];
+
+  // Allocated on first use with --gc-scope-histograms.
+  base::Mutex scope_duration_histograms_mutex_;
+  std::unique_ptr<ScopeDurationHistogram[]> scope_duration_histograms_;
 };
 
 }  // namespace internal
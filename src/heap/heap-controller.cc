@@ -4,6 +4,7 @@
 
 #include "src/heap/heap-controller.h"
 
+#include "src/base/lazy-instance.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/spaces.h"
 
@@ -165,6 +166,47 @@ size_t MemoryController<Trait>::CalculateAllocationLimit(
   return result;
 }
 
+// static
+ProcessHeapBudget* ProcessHeapBudget::Get() {
+  static base::LeakyObject<ProcessHeapBudget> object;
+  return object.get();
+}
+
+size_t ProcessHeapBudget::UpdateAndComputeMaxSize(
+    Heap* heap, size_t budget, size_t current_size,
+    double allocation_throughput) {
+  // Heaps without throughput samples still get a small share of the headroom.
+  constexpr double kMinAllocationThroughput = 1.0;
+  base::MutexGuard guard(&mutex_);
+  Entry& entry = entries_[heap];
+  entry.size = current_size;
+  entry.allocation_throughput =
+      std::max(allocation_throughput, kMinAllocationThroughput);
+
+  size_t total_size = 0;
+  double total_throughput = 0;
+  for (const auto& it : entries_) {
+    total_size += it.second.size;
+    total_throughput += it.second.allocation_throughput;
+  }
+  if (total_size >= budget) return current_size;
+  const double share = entry.allocation_throughput / total_throughput;
+  const size_t headroom =
+      static_cast<size_t>((budget - total_size) * std::min(1.0, share));
+  if (FLAG_trace_gc_verbose) {
+    Isolate::FromHeap(heap)->PrintWithTimestamp(
+        "[ProcessHeapBudget] heaps: %zu, used: %zu KB, budget: %zu KB, "
+        "headroom: %zu KB (%.2f)\n",
+        entries_.size(), total_size / KB, budget / KB, headroom / KB, share);
+  }
+  return current_size + headroom;
+}
+
+void ProcessHeapBudget::RemoveHeap(Heap* heap) {
+  base::MutexGuard guard(&mutex_);
+  entries_.erase(heap);
+}
+
 template class V8_EXPORT_PRIVATE MemoryController<V8HeapTrait>;
 template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 
@@ -6,6 +6,9 @@
 #define V8_HEAP_HEAP_CONTROLLER_H_
 
 #include <cstddef>
+#include <unordered_map>
+
+#include "src/base/platform/mutex.h"
 #include "src/heap/heap.h"
 #include "src/utils/allocation.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
@@ -56,6 +59,32 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Shares an old generation budget between all heaps of the process (see
+// --process-heap-budget). Heaps report their size and allocation throughput
+// when recomputing limits. The budget not yet used by any heap is handed out
+// in proportion to the allocation throughput, so that busy heaps get room
+// from idle ones instead of every heap sizing itself in isolation.
+class V8_EXPORT_PRIVATE ProcessHeapBudget final {
+ public:
+  static ProcessHeapBudget* Get();
+
+  // Records |current_size| and |allocation_throughput| (bytes/ms) for |heap|
+  // and returns the maximum old generation size |heap| may grow to.
+  size_t UpdateAndComputeMaxSize(Heap* heap, size_t budget, size_t current_size,
+                                 double allocation_throughput);
+
+  void RemoveHeap(Heap* heap);
+
+ private:
+  struct Entry {
+    size_t size;
+    double allocation_throughput;
+  };
+
+  base::Mutex mutex_;
+  std::unordered_map<Heap*, Entry> entries_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
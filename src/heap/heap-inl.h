@@ -151,6 +151,10 @@ void Heap::SetPendingOptimizeForTestBytecode(Object hash_table) {
   roots_table()[RootIndex::kPendingOptimizeForTestBytecode] = hash_table.ptr();
 }
 
+void Heap::SetRootUnoptimizedMetadataCache(FixedArray cache) {
+  roots_table()[RootIndex::kUnoptimizedMetadataCache] = cache.ptr();
+}
+
 PagedSpace* Heap::paged_space(int idx) {
   DCHECK(idx == OLD_SPACE || idx == CODE_SPACE || idx == MAP_SPACE);
   return static_cast<PagedSpace*>(space_[idx]);
@@ -4,12 +4,14 @@
 
 #include "src/heap/heap.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cinttypes>
 #include <iomanip>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "include/v8-locker.h"
 #include "src/api/api-inl.h"
@@ -22,6 +24,7 @@
 #include "src/builtins/accessors.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/unoptimized-metadata-cache.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
@@ -37,6 +40,7 @@
 #include "src/heap/barrier.h"
 #include "src/heap/base/stack.h"
 #include "src/heap/basic-memory-chunk.h"
+#include "src/heap/code-flushing-budget.h"
 #include "src/heap/code-object-registry.h"
 #include "src/heap/code-range.h"
 #include "src/heap/code-stats.h"
@@ -102,6 +106,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -212,7 +217,8 @@ Heap::Heap()
       allocation_type_for_in_place_internalizable_strings_(
           isolate()->OwnsStringTable() ? AllocationType::kOld
                                        : AllocationType::kSharedOld),
-      collection_barrier_(new CollectionBarrier(this)) {
+      collection_barrier_(new CollectionBarrier(this)),
+      code_flushing_budget_(new CodeFlushingBudget()) {
   // Ensure old_generation_size_ is a multiple of kPageSize.
   DCHECK_EQ(0, max_old_generation_size() & (Page::kPageSize - 1));
 
@@ -1269,6 +1275,18 @@ void Heap::ProcessPretenuringFeedback() {
 
     AllocationSite site;
 
+    // Feedback of the sites with the highest survival ratio, collected for
+    // --trace-pretenuring-top-sites before the counters are reset.
+    struct SiteFeedback {
+      Address site;
+      int create_count;
+      int found_count;
+      double ratio;
+      AllocationSite::PretenureDecision old_decision;
+      AllocationSite::PretenureDecision new_decision;
+    };
+    std::vector<SiteFeedback> top_sites;
+
     // Step 1: Digest feedback for recorded allocation sites.
     bool maximum_size_scavenge = MaximumSizeScavenge();
     for (auto& site_and_count : global_pretenuring_feedback_) {
@@ -1284,9 +1302,21 @@ void Heap::ProcessPretenuringFeedback() {
         DCHECK(site.IsAllocationSite());
         active_allocation_sites++;
         allocation_mementos_found += found_count;
+        if (V8_UNLIKELY(FLAG_trace_pretenuring_top_sites > 0)) {
+          int create_count = site.memento_create_count();
+          top_sites.push_back(
+              {site.ptr(), create_count, found_count,
+               create_count > 0
+                   ? static_cast<double>(found_count) / create_count
+                   : 0.0,
+               site.pretenure_decision(), AllocationSite::kUndecided});
+        }
         if (DigestPretenuringFeedback(isolate_, site, maximum_size_scavenge)) {
           trigger_deoptimization = true;
         }
+        if (V8_UNLIKELY(FLAG_trace_pretenuring_top_sites > 0)) {
+          top_sites.back().new_decision = site.pretenure_decision();
+        }
         if (site.GetAllocationType() == AllocationType::kOld) {
           tenure_decisions++;
         } else {
@@ -1295,6 +1325,30 @@ void Heap::ProcessPretenuringFeedback() {
       }
     }
 
+    if (V8_UNLIKELY(!top_sites.empty())) {
+      size_t count = std::min(
+          top_sites.size(),
+          static_cast<size_t>(FLAG_trace_pretenuring_top_sites));
+      std::partial_sort(top_sites.begin(), top_sites.begin() + count,
+                        top_sites.end(),
+                        [](const SiteFeedback& a, const SiteFeedback& b) {
+                          if (a.ratio != b.ratio) return a.ratio > b.ratio;
+                          return a.found_count > b.found_count;
+                        });
+      PrintIsolate(isolate(), "pretenuring: top %zu of %zu active sites\n",
+                   count, top_sites.size());
+      for (size_t i = 0; i < count; i++) {
+        const SiteFeedback& entry = top_sites[i];
+        PrintIsolate(isolate(),
+                     "pretenuring:   AllocationSite(%p): (created, found, "
+                     "ratio) (%d, %d, %f) %s => %s\n",
+                     reinterpret_cast<void*>(entry.site), entry.create_count,
+                     entry.found_count, entry.ratio,
+                     AllocationSite::PretenureDecisionName(entry.old_decision),
+                     AllocationSite::PretenureDecisionName(entry.new_decision));
+      }
+    }
+
     // Step 2: Pretenure allocation sites for manual requests.
     if (allocation_sites_to_pretenure_) {
       while (!allocation_sites_to_pretenure_->empty()) {
@@ -2286,6 +2340,10 @@ size_t Heap::PerformGarbageCollection(
       break;
   }
 
+  if (IsYoungGenerationCollector(collector) && cpp_heap()) {
+    CppHeap::From(cpp_heap())->RunMinorGCIfNeeded();
+  }
+
   ProcessPretenuringFeedback();
 
   UpdateSurvivalStatistics(static_cast<int>(start_young_generation_size));
@@ -2465,14 +2523,29 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
   size_t new_space_capacity = NewSpaceCapacity();
   HeapGrowingMode mode = CurrentHeapGrowingMode();
 
+  size_t max_old_gen_size = max_old_generation_size();
+  if (FLAG_process_heap_budget > 0) {
+    // Always leave room for a minimal growing step so that heaps do not GC on
+    // every allocation once the process-wide budget is exhausted.
+    const size_t min_max_size =
+        old_gen_size +
+        2 * MemoryController<V8HeapTrait>::MinimumAllocationLimitGrowingStep(
+                mode);
+    const size_t budgeted_size =
+        ProcessHeapBudget::Get()->UpdateAndComputeMaxSize(
+            this, FLAG_process_heap_budget * MB, old_gen_size,
+            v8_mutator_speed);
+    max_old_gen_size =
+        std::min(max_old_gen_size, std::max(budgeted_size, min_max_size));
+  }
+
   if (collector == GarbageCollector::MARK_COMPACTOR) {
     external_memory_.ResetAfterGC();
 
     set_old_generation_allocation_limit(
         MemoryController<V8HeapTrait>::CalculateAllocationLimit(
-            this, old_gen_size, min_old_generation_size_,
-            max_old_generation_size(), new_space_capacity, v8_growing_factor,
-            mode));
+            this, old_gen_size, min_old_generation_size_, max_old_gen_size,
+            new_space_capacity, v8_growing_factor, mode));
     if (UseGlobalMemoryScheduling()) {
       DCHECK_GT(global_growing_factor, 0);
       global_allocation_limit_ =
@@ -2487,9 +2560,8 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
              old_generation_size_configured_) {
     size_t new_old_generation_limit =
         MemoryController<V8HeapTrait>::CalculateAllocationLimit(
-            this, old_gen_size, min_old_generation_size_,
-            max_old_generation_size(), new_space_capacity, v8_growing_factor,
-            mode);
+            this, old_gen_size, min_old_generation_size_, max_old_gen_size,
+            new_space_capacity, v8_growing_factor, mode);
     if (new_old_generation_limit < old_generation_allocation_limit()) {
       set_old_generation_allocation_limit(new_old_generation_limit);
     }
@@ -2612,6 +2684,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->descriptor_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  UnoptimizedMetadataCache::Clear(this);
 
   isolate_->compilation_cache()->MarkCompactPrologue();
 
@@ -4203,6 +4276,10 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                static_cast<int>(level));
   MemoryPressureLevel previous =
       memory_pressure_level_.exchange(level, std::memory_order_relaxed);
+  if (level != MemoryPressureLevel::kNone) {
+    // Pooled zone segments are only kept to speed up compile jobs.
+    isolate()->allocator()->TrimSegmentPool();
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
@@ -5235,6 +5312,12 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
 
   code_range_size_ = constraints.code_range_size_in_bytes();
 
+  size_t code_flushing_budget = constraints.code_flushing_budget_in_bytes();
+  if (FLAG_code_flushing_budget_mb > 0) {
+    code_flushing_budget = FLAG_code_flushing_budget_mb * MB;
+  }
+  code_flushing_budget_->set_budget_in_bytes(code_flushing_budget);
+
   configured_ = true;
 }
 
@@ -6002,6 +6085,10 @@ void Heap::StartTearDown() {
 void Heap::TearDown() {
   DCHECK_EQ(gc_state(), TEAR_DOWN);
 
+  if (FLAG_process_heap_budget > 0) {
+    ProcessHeapBudget::Get()->RemoveHeap(this);
+  }
+
   if (FLAG_concurrent_marking || FLAG_parallel_marking)
     concurrent_marking_->Pause();
 
@@ -7065,7 +7152,10 @@ size_t Heap::EmbedderAllocationCounter() const {
 }
 
 void Heap::CreateObjectStats() {
-  if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
+  if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled() &&
+                FLAG_sample_gc_object_stats <= 0)) {
+    return;
+  }
   if (!live_object_stats_) {
     live_object_stats_.reset(new ObjectStats(this));
   }
@@ -70,6 +70,7 @@ using v8::MemoryPressureLevel;
 class ArrayBufferCollector;
 class ArrayBufferSweeper;
 class BasicMemoryChunk;
+class CodeFlushingBudget;
 class CodeLargeObjectSpace;
 class CodeRange;
 class CollectionBarrier;
@@ -871,6 +872,10 @@ class Heap {
     return array_buffer_sweeper_.get();
   }
 
+  CodeFlushingBudget* code_flushing_budget() {
+    return code_flushing_budget_.get();
+  }
+
   // The potentially overreserved address space region reserved by the code
   // range if it exists or empty region otherwise.
   const base::AddressRegion& code_region();
@@ -901,6 +906,7 @@ class Heap {
   V8_INLINE void SetRootNoScriptSharedFunctionInfos(Object value);
   V8_INLINE void SetMessageListeners(TemplateList value);
   V8_INLINE void SetPendingOptimizeForTestBytecode(Object bytecode);
+  V8_INLINE void SetRootUnoptimizedMetadataCache(FixedArray cache);
 
   StrongRootsEntry* RegisterStrongRoots(const char* label, FullObjectSlot start,
                                         FullObjectSlot end);
@@ -2380,6 +2386,8 @@ class Heap {
 
   std::unique_ptr<CollectionBarrier> collection_barrier_;
 
+  std::unique_ptr<CodeFlushingBudget> code_flushing_budget_;
+
   int ignore_local_gc_requests_depth_ = 0;
 
   int gc_callbacks_depth_ = 0;
@@ -21,6 +21,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/basic-memory-chunk.h"
+#include "src/heap/code-flushing-budget.h"
 #include "src/heap/code-object-registry.h"
 #include "src/heap/concurrent-allocator.h"
 #include "src/heap/evacuation-allocator-inl.h"
@@ -590,6 +591,7 @@ void MarkCompactCollector::StartMarking() {
     }
   }
   code_flush_mode_ = Heap::GetCodeFlushMode(isolate());
+  heap()->code_flushing_budget()->ResetSizes();
   marking_worklists()->CreateContextWorklists(contexts);
   auto* cpp_heap = CppHeap::From(heap_->cpp_heap());
   local_marking_worklists_ = std::make_unique<MarkingWorklists::Local>(
@@ -784,6 +786,14 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   compacted.
     ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
                                 &max_evacuated_bytes);
+    if (space->identity() == CODE_SPACE && FLAG_code_space_evacuation_quota) {
+      // Evacuating code is more expensive than evacuating data since
+      // relocation info has to be patched and instruction caches flushed.
+      // Bound the work per atomic pause and spread the compaction of a
+      // fragmented code space over several GCs instead.
+      max_evacuated_bytes = std::min(max_evacuated_bytes,
+                                     FLAG_code_space_evacuation_quota * KB);
+    }
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
 
@@ -2298,7 +2308,12 @@ void MarkCompactCollector::ProcessTopOptimizedFrame(ObjectVisitor* visitor,
 }
 
 void MarkCompactCollector::RecordObjectStats() {
-  if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
+  if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) {
+    if (V8_UNLIKELY(FLAG_sample_gc_object_stats > 0)) {
+      RecordSampledObjectStats();
+    }
+    return;
+  }
   // Cannot run during bootstrapping due to incomplete objects.
   if (isolate()->bootstrapper()->IsActive()) return;
   heap()->CreateObjectStats();
@@ -2323,6 +2338,15 @@ void MarkCompactCollector::RecordObjectStats() {
   heap()->dead_object_stats_->ClearObjectStats();
 }
 
+void MarkCompactCollector::RecordSampledObjectStats() {
+  if (isolate()->bootstrapper()->IsActive()) return;
+  heap()->CreateObjectStats();
+  ObjectStatsCollector collector(heap(), heap()->live_object_stats_.get(),
+                                 heap()->dead_object_stats_.get());
+  collector.CollectSampled(FLAG_sample_gc_object_stats);
+  heap()->live_object_stats_->CheckpointObjectStats();
+}
+
 void MarkCompactCollector::MarkLiveObjects() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_MARK);
   // The recursive GC marker detects when it is nearing stack overflow,
@@ -2482,6 +2506,12 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // code object on the JSFunction.
     ProcessOldCodeCandidates();
     ProcessFlushedBaselineCandidates();
+    heap()->code_flushing_budget()->UpdateFlushingAge();
+    if (FLAG_trace_flush_bytecode &&
+        heap()->code_flushing_budget()->is_enabled()) {
+      PrintIsolate(isolate(), "[code flushing] flushing age for next GC: %d\n",
+                   heap()->code_flushing_budget()->flushing_age());
+    }
   }
 
   {
@@ -5549,11 +5579,23 @@ class YoungGenerationMarkingTask {
     }
   }
 
-  void EmptyMarkingWorklist() {
+  void EmptyMarkingWorklist(JobDelegate* delegate) {
     HeapObject object;
+    size_t objects = 0;
     while (marking_worklist_local_.Pop(&object)) {
       const int size = visitor_.Visit(object);
       IncrementLiveBytes(object, size);
+      if (delegate && ((++objects % kInterruptThreshold) == 0)) {
+        // Make the local segments available for stealing when other markers
+        // have run out of work, and let the platform spawn additional ones.
+        if (!marking_worklist_local_.IsLocalEmpty() &&
+            marking_worklist_local_.IsGlobalEmpty()) {
+          marking_worklist_local_.Publish();
+        }
+        if (!marking_worklist_local_.IsGlobalEmpty()) {
+          delegate->NotifyConcurrencyIncrease();
+        }
+      }
     }
   }
 
@@ -5568,6 +5610,8 @@ class YoungGenerationMarkingTask {
   }
 
  private:
+  static const int kInterruptThreshold = 128;
+
   MinorMarkCompactCollector::MarkingWorklist::Local marking_worklist_local_;
   MinorMarkCompactCollector::MarkingState* marking_state_;
   YoungGenerationMarkingVisitor visitor_;
@@ -5690,8 +5734,8 @@ class YoungGenerationMarkingJob : public v8::JobTask {
     {
       TimedScope scope(&marking_time);
       YoungGenerationMarkingTask task(isolate_, collector_, global_worklist_);
-      ProcessMarkingItems(&task);
-      task.EmptyMarkingWorklist();
+      ProcessMarkingItems(&task, delegate);
+      task.EmptyMarkingWorklist(delegate);
       task.FlushLiveBytes();
     }
     if (FLAG_trace_minor_mc_parallel_marking) {
@@ -5700,7 +5744,8 @@ class YoungGenerationMarkingJob : public v8::JobTask {
     }
   }
 
-  void ProcessMarkingItems(YoungGenerationMarkingTask* task) {
+  void ProcessMarkingItems(YoungGenerationMarkingTask* task,
+                           JobDelegate* delegate) {
     while (remaining_marking_items_.load(std::memory_order_relaxed) > 0) {
       base::Optional<size_t> index = generator_.GetNext();
       if (!index) return;
@@ -5708,7 +5753,7 @@ class YoungGenerationMarkingJob : public v8::JobTask {
         auto& work_item = marking_items_[i];
         if (!work_item.TryAcquire()) break;
         work_item.Process(task);
-        task->EmptyMarkingWorklist();
+        task->EmptyMarkingWorklist(delegate);
         if (remaining_marking_items_.fetch_sub(1, std::memory_order_relaxed) <=
             1) {
           return;
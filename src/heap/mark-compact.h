@@ -620,6 +620,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                    size_t* max_evacuated_bytes);
 
   void RecordObjectStats();
+  void RecordSampledObjectStats();
 
   // Finishes GC, performs heap verification if enabled.
   void Finish();
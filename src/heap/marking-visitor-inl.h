@@ -160,7 +160,8 @@ template <typename ConcreteVisitor, typename MarkingState>
 int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitJSFunction(
     Map map, JSFunction js_function) {
   int size = concrete_visitor()->VisitJSObjectSubclass(map, js_function);
-  if (js_function.ShouldFlushBaselineCode(code_flush_mode_)) {
+  if (js_function.ShouldFlushBaselineCode(code_flush_mode_,
+                                          code_flushing_age_)) {
     DCHECK(IsBaselineCodeFlushingEnabled(code_flush_mode_));
     local_weak_objects_->baseline_flushing_candidates_local.Push(js_function);
   } else {
@@ -185,7 +186,9 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitSharedFunctionInfo(
   this->VisitMapPointer(shared_info);
   SharedFunctionInfo::BodyDescriptor::IterateBody(map, shared_info, size, this);
 
-  if (!shared_info.ShouldFlushCode(code_flush_mode_)) {
+  if (code_flushing_budget_->is_enabled()) RecordFlushableCode(shared_info);
+
+  if (!shared_info.ShouldFlushCode(code_flush_mode_, code_flushing_age_)) {
     // If the SharedFunctionInfo doesn't have old bytecode visit the function
     // data strongly.
     VisitPointer(shared_info,
@@ -210,6 +213,28 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitSharedFunctionInfo(
   return size;
 }
 
+template <typename ConcreteVisitor, typename MarkingState>
+void MarkingVisitorBase<ConcreteVisitor, MarkingState>::RecordFlushableCode(
+    SharedFunctionInfo shared_info) {
+  if (!shared_info.ShouldFlushCode(code_flush_mode_,
+                                   BytecodeArray::kFirstBytecodeAge)) {
+    return;
+  }
+  size_t size = 0;
+  Object data = shared_info.function_data(kAcquireLoad);
+  if (data.IsCodeT()) {
+    CodeT baseline_codet = CodeT::cast(data);
+    // Safe to do a relaxed load here since the CodeT was acquire-loaded.
+    Code baseline_code = FromCodeT(baseline_codet, kRelaxedLoad);
+    size += baseline_code.Size();
+    data = baseline_codet.bytecode_or_interpreter_data();
+  }
+  // ShouldFlushCode only returns true for bytecode arrays.
+  BytecodeArray bytecode = BytecodeArray::cast(data);
+  size += bytecode.Size();
+  code_flushing_budget_->RecordFlushableCode(bytecode.bytecode_age(), size);
+}
+
 // ===========================================================================
 // Fixed arrays that need incremental processing and can be left-trimmed =====
 // ===========================================================================
@@ -6,6 +6,7 @@
 #define V8_HEAP_MARKING_VISITOR_H_
 
 #include "src/common/globals.h"
+#include "src/heap/code-flushing-budget.h"
 #include "src/heap/marking-worklist.h"
 #include "src/heap/marking.h"
 #include "src/heap/memory-chunk.h"
@@ -152,6 +153,8 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
         heap_(heap),
         mark_compact_epoch_(mark_compact_epoch),
         code_flush_mode_(code_flush_mode),
+        code_flushing_budget_(heap->code_flushing_budget()),
+        code_flushing_age_(code_flushing_budget_->flushing_age()),
         is_embedder_tracing_enabled_(is_embedder_tracing_enabled),
         should_keep_ages_unchanged_(should_keep_ages_unchanged),
         is_shared_heap_(heap->IsShared())
@@ -255,6 +258,10 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
   V8_INLINE void VisitDescriptors(DescriptorArray descriptors,
                                   int number_of_own_descriptors);
 
+  // Records the size of the bytecode and baseline code of |shared_info| with
+  // the code flushing budget if it could be flushed once old enough.
+  V8_INLINE void RecordFlushableCode(SharedFunctionInfo shared_info);
+
   V8_INLINE int VisitDescriptorsForMap(Map map);
 
   template <typename T>
@@ -295,6 +302,8 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
   Heap* const heap_;
   const unsigned mark_compact_epoch_;
   const base::EnumSet<CodeFlushMode> code_flush_mode_;
+  CodeFlushingBudget* const code_flushing_budget_;
+  const int code_flushing_age_;
   const bool is_embedder_tracing_enabled_;
   const bool should_keep_ages_unchanged_;
   const bool is_shared_heap_;
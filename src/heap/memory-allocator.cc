@@ -7,6 +7,7 @@
 #include <cinttypes>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -215,9 +216,17 @@ bool MemoryAllocator::CommitMemory(VirtualMemory* reservation) {
     return false;
   }
   UpdateAllocatedSpaceLimits(base, base + size);
+  BindToCurrentNumaNode(base, size);
   return true;
 }
 
+void MemoryAllocator::BindToCurrentNumaNode(Address base, size_t size) {
+  if (!FLAG_numa_local_heap_pages) return;
+  // This is advisory; pages stay usable if the OS refuses the binding.
+  USE(base::OS::BindMemoryToCurrentNumaNode(reinterpret_cast<void*>(base),
+                                            size));
+}
+
 bool MemoryAllocator::UncommitMemory(VirtualMemory* reservation) {
   size_t size = reservation->size();
   if (!reservation->SetPermissions(reservation->address(), size,
@@ -251,6 +260,7 @@ Address MemoryAllocator::AllocateAlignedMemory(
     if (reservation.SetPermissions(base, commit_size,
                                    PageAllocator::kReadWrite)) {
       UpdateAllocatedSpaceLimits(base, base + commit_size);
+      BindToCurrentNumaNode(base, commit_size);
     } else {
       base = kNullAddress;
     }
@@ -268,6 +268,10 @@ class MemoryAllocator {
   // it succeeded and false otherwise.
   bool CommitMemory(VirtualMemory* reservation);
 
+  // Binds freshly committed data pages to the NUMA node of the current thread
+  // when --numa-local-heap-pages is enabled.
+  void BindToCurrentNumaNode(Address base, size_t size);
+
   V8_WARN_UNUSED_RESULT bool CommitExecutableMemory(VirtualMemory* vm,
                                                     Address start,
                                                     size_t commit_size,
@@ -189,13 +189,120 @@ bool MemoryMeasurement::EnqueueRequest(
                      0u,
                      {}};
   request.timer.Start();
+  if (execution == v8::MeasureMemoryExecution::kCached) {
+    if (ReadFromCache(contexts, &request.sizes, &request.shared)) {
+      done_.push_back(std::move(request));
+      ScheduleReportingTask();
+      return true;
+    }
+    AddToCache(contexts);
+  }
   received_.push_back(std::move(request));
   ScheduleGCTask(execution);
   return true;
 }
 
+bool MemoryMeasurement::ReadFromCache(
+    const std::vector<Handle<NativeContext>>& contexts,
+    std::vector<size_t>* sizes, size_t* shared) {
+  if (cached_contexts_.is_null()) return false;
+  for (size_t i = 0; i < contexts.size(); i++) {
+    bool found = false;
+    for (int j = 0; j < cached_contexts_->length(); j++) {
+      HeapObject cached;
+      if (cached_contexts_->Get(j).GetHeapObject(&cached) &&
+          cached == *contexts[i]) {
+        if (!cached_valid_[j]) return false;
+        (*sizes)[i] = cached_sizes_[j];
+        found = true;
+        break;
+      }
+    }
+    if (!found) return false;
+  }
+  *shared = cached_shared_;
+  return true;
+}
+
+void MemoryMeasurement::AddToCache(
+    const std::vector<Handle<NativeContext>>& contexts) {
+  std::vector<Handle<NativeContext>> new_contexts;
+  for (const Handle<NativeContext>& context : contexts) {
+    bool found = false;
+    if (!cached_contexts_.is_null()) {
+      for (int j = 0; j < cached_contexts_->length(); j++) {
+        HeapObject cached;
+        if (cached_contexts_->Get(j).GetHeapObject(&cached) &&
+            cached == *context) {
+          found = true;
+          break;
+        }
+      }
+    }
+    if (!found) new_contexts.push_back(context);
+  }
+  if (new_contexts.empty()) return;
+
+  // Entries of dead contexts are dropped, unless a GC is currently measuring
+  // the cache by index.
+  bool compact = cached_processing_length_ < 0;
+  std::vector<Handle<HeapObject>> entries;
+  std::vector<size_t> sizes;
+  std::vector<bool> valid;
+  if (!cached_contexts_.is_null()) {
+    for (int j = 0; j < cached_contexts_->length(); j++) {
+      HeapObject cached;
+      bool alive = cached_contexts_->Get(j).GetHeapObject(&cached);
+      if (!alive && compact) continue;
+      entries.push_back(alive ? handle(cached, isolate_)
+                              : Handle<HeapObject>());
+      sizes.push_back(cached_sizes_[j]);
+      valid.push_back(alive && cached_valid_[j]);
+    }
+  }
+  for (const Handle<NativeContext>& context : new_contexts) {
+    entries.push_back(context);
+    sizes.push_back(0);
+    valid.push_back(false);
+  }
+
+  int length = static_cast<int>(entries.size());
+  Handle<WeakFixedArray> weak_contexts =
+      isolate_->factory()->NewWeakFixedArray(length);
+  for (int i = 0; i < length; i++) {
+    if (entries[i].is_null()) {
+      weak_contexts->Set(i, HeapObjectReference::ClearedValue(isolate_));
+    } else {
+      weak_contexts->Set(i, HeapObjectReference::Weak(*entries[i]));
+    }
+  }
+  if (!cached_contexts_.is_null()) {
+    GlobalHandles::Destroy(cached_contexts_.location());
+  }
+  cached_contexts_ = isolate_->global_handles()->Create(*weak_contexts);
+  cached_sizes_ = std::move(sizes);
+  cached_valid_ = std::move(valid);
+}
+
+void MemoryMeasurement::UpdateCache(const NativeContextStats& stats) {
+  if (cached_processing_length_ < 0) return;
+  DCHECK(!cached_contexts_.is_null());
+  DCHECK_LE(cached_processing_length_, cached_contexts_->length());
+  for (int i = 0; i < cached_processing_length_; i++) {
+    HeapObject context;
+    if (cached_contexts_->Get(i).GetHeapObject(&context)) {
+      cached_sizes_[i] = stats.Get(context.ptr());
+      cached_valid_[i] = true;
+    } else {
+      cached_valid_[i] = false;
+    }
+  }
+  cached_shared_ = stats.Get(MarkingWorklists::kSharedContext);
+  cached_processing_length_ = -1;
+}
+
 std::vector<Address> MemoryMeasurement::StartProcessing() {
-  if (received_.empty()) return {};
+  if (received_.empty() && cached_contexts_.is_null()) return {};
   std::unordered_set<Address> unique_contexts;
   DCHECK(processing_.empty());
   processing_ = std::move(received_);
@@ -208,10 +315,21 @@ std::vector<Address> MemoryMeasurement::StartProcessing() {
       }
     }
   }
+  if (!cached_contexts_.is_null()) {
+    // Keep measuring the cached contexts on every full GC.
+    cached_processing_length_ = cached_contexts_->length();
+    for (int i = 0; i < cached_processing_length_; i++) {
+      HeapObject context;
+      if (cached_contexts_->Get(i).GetHeapObject(&context)) {
+        unique_contexts.insert(context.ptr());
+      }
+    }
+  }
   return std::vector<Address>(unique_contexts.begin(), unique_contexts.end());
 }
 
 void MemoryMeasurement::FinishProcessing(const NativeContextStats& stats) {
+  UpdateCache(stats);
   if (processing_.empty()) return;
 
   while (!processing_.empty()) {
@@ -270,7 +388,10 @@ void MemoryMeasurement::SetGCTaskDone(v8::MeasureMemoryExecution execution) {
 }
 
 void MemoryMeasurement::ScheduleGCTask(v8::MeasureMemoryExecution execution) {
-  if (execution == v8::MeasureMemoryExecution::kLazy) return;
+  if (execution == v8::MeasureMemoryExecution::kLazy ||
+      execution == v8::MeasureMemoryExecution::kCached) {
+    return;
+  }
   if (IsGCTaskPending(execution)) return;
   SetGCTaskPending(execution);
   auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
@@ -45,6 +45,10 @@ class MemoryMeasurement {
     size_t shared;
     base::ElapsedTimer timer;
   };
+  bool ReadFromCache(const std::vector<Handle<NativeContext>>& contexts,
+                     std::vector<size_t>* sizes, size_t* shared);
+  void AddToCache(const std::vector<Handle<NativeContext>>& contexts);
+  void UpdateCache(const NativeContextStats& stats);
   void ScheduleReportingTask();
   void ReportResults();
   void ScheduleGCTask(v8::MeasureMemoryExecution execution);
@@ -60,6 +64,16 @@ class MemoryMeasurement {
   bool reporting_task_pending_ = false;
   bool delayed_gc_task_pending_ = false;
   bool eager_gc_task_pending_ = false;
+  // Contexts requested with MeasureMemoryExecution::kCached, together with
+  // their sizes as of the last full GC that measured them. A size is only
+  // valid once a GC has measured the context.
+  Handle<WeakFixedArray> cached_contexts_;
+  std::vector<size_t> cached_sizes_;
+  std::vector<bool> cached_valid_;
+  size_t cached_shared_ = 0;
+  // Number of cache entries the GC in progress measures, or -1 if no GC is
+  // measuring the cache. Entries may only be appended while it is measuring.
+  int cached_processing_length_ = -1;
   base::RandomNumberGenerator random_number_generator_;
 };
 
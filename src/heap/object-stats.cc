@@ -14,7 +14,8 @@
 #include "src/execution/isolate.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/heap-inl.h"
-#include "src/heap/mark-compact.h"
+#include "src/heap/mark-compact-inl.h"
+#include "src/heap/paged-spaces-inl.h"
 #include "src/logging/counters.h"
 #include "src/objects/compilation-cache-table-inl.h"
 #include "src/objects/heap-object.h"
@@ -161,6 +162,18 @@ FieldStatsCollector::GetInobjectFieldStats(Map map) {
   return stats;
 }
 
+void ObjectStats::ScaleObjectStats(size_t factor) {
+  for (int i = 0; i < OBJECT_STATS_COUNT; i++) {
+    object_counts_[i] *= factor;
+    object_sizes_[i] *= factor;
+    over_allocated_[i] *= factor;
+    for (int j = 0; j < kNumberOfBuckets; j++) {
+      size_histogram_[i][j] *= factor;
+      over_allocated_histogram_[i][j] *= factor;
+    }
+  }
+}
+
 void ObjectStats::ClearObjectStats(bool clear_last_time_stats) {
   memset(object_counts_, 0, sizeof(object_counts_));
   memset(object_sizes_, 0, sizeof(object_sizes_));
@@ -1133,5 +1146,24 @@ void ObjectStatsCollector::Collect() {
   }
 }
 
+void ObjectStatsCollector::CollectSampled(int sampling_interval) {
+  DCHECK_GT(sampling_interval, 0);
+  MarkCompactCollector::NonAtomicMarkingState* marking_state =
+      heap_->mark_compact_collector()->non_atomic_marking_state();
+  PtrComprCageBase cage_base(heap_->isolate());
+  OldGenerationMemoryChunkIterator it(heap_);
+  int index = 0;
+  for (MemoryChunk* chunk = it.next(); chunk != nullptr; chunk = it.next()) {
+    if (index++ % sampling_interval != 0) continue;
+    for (auto object_and_size : LiveObjectRange<kBlackObjects>(
+             chunk, marking_state->bitmap(chunk))) {
+      HeapObject object = object_and_size.first;
+      live_->RecordObjectStats(object.map(cage_base).instance_type(),
+                               object_and_size.second);
+    }
+  }
+  live_->ScaleObjectStats(static_cast<size_t>(sampling_interval));
+}
+
 }  // namespace internal
 }  // namespace v8
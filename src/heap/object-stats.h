@@ -118,6 +118,9 @@ class ObjectStats {
   void Dump(std::stringstream& stream);
 
   void CheckpointObjectStats();
+  // Multiplies the current counts and sizes by |factor|. Used to extrapolate
+  // statistics that were collected from a sample of the heap.
+  void ScaleObjectStats(size_t factor);
   void RecordObjectStats(InstanceType type, size_t size,
                          size_t over_allocated = kNoOverAllocation);
   void RecordVirtualObjectStats(VirtualInstanceType type, size_t size,
@@ -187,6 +190,13 @@ class ObjectStatsCollector {
   // be present.
   void Collect();
 
+  // Collects instance type counts and sizes of live objects on every
+  // |sampling_interval|-th old generation page and extrapolates them to the
+  // whole old generation. Much cheaper than Collect() as it neither visits
+  // dead objects nor computes virtual types or field statistics. Requires
+  // mark bits to be present.
+  void CollectSampled(int sampling_interval);
+
  private:
   Heap* const heap_;
   ObjectStats* const live_;
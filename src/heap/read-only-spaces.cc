@@ -9,6 +9,7 @@
 #include "include/v8-internal.h"
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
@@ -406,6 +407,17 @@ void ReadOnlySpace::Seal(SealMode ro_mode) {
   }
 
   SetPermissionsForPages(memory_allocator, PageAllocator::kRead);
+
+  if (FLAG_merge_read_only_pages) {
+    // The contents of sealed pages only depend on the snapshot, and with
+    // pointer compression not even on the address of the cage. Apart from the
+    // page headers, they are therefore identical in every process that
+    // deserialized the same snapshot and can be shared by the OS.
+    for (ReadOnlyPage* p : pages_) {
+      USE(base::OS::AdviseMergeable(reinterpret_cast<void*>(p->address()),
+                                    p->size()));
+    }
+  }
 }
 
 void ReadOnlySpace::Unseal() {
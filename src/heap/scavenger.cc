@@ -194,7 +194,7 @@ class ScavengeWeakObjectRetainer : public WeakObjectRetainer {
 ScavengerCollector::JobTask::JobTask(
     ScavengerCollector* outer,
     std::vector<std::unique_ptr<Scavenger>>* scavengers,
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks,
+    std::vector<std::pair<ParallelWorkItem, RememberedSetItem>> memory_chunks,
     Scavenger::CopiedList* copied_list,
     Scavenger::PromotionList* promotion_list)
     : outer_(outer),
@@ -255,7 +255,13 @@ void ScavengerCollector::JobTask::ConcurrentScavengePages(
     for (size_t i = *index; i < memory_chunks_.size(); ++i) {
       auto& work_item = memory_chunks_[i];
       if (!work_item.first.TryAcquire()) break;
-      scavenger->ScavengePage(work_item.second);
+      const RememberedSetItem& item = work_item.second;
+      if (item.is_range) {
+        scavenger->ScavengeLargePageRange(item.chunk, item.start_bucket,
+                                          item.end_bucket);
+      } else {
+        scavenger->ScavengePage(item.chunk);
+      }
       if (remaining_memory_chunks_.fetch_sub(1, std::memory_order_relaxed) <=
           1) {
         return;
@@ -291,6 +297,7 @@ void ScavengerCollector::CollectGarbage() {
   Scavenger::CopiedList copied_list;
   Scavenger::PromotionList promotion_list;
   EphemeronTableList ephemeron_table_list;
+  std::vector<MemoryChunk*> split_large_pages;
 
   {
     Sweeper* sweeper = heap_->mark_compact_collector()->sweeper();
@@ -324,10 +331,24 @@ void ScavengerCollector::CollectGarbage() {
                         &promotion_list, &ephemeron_table_list, i));
     }
 
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks;
+    std::vector<std::pair<ParallelWorkItem, RememberedSetItem>> memory_chunks;
     RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
-        heap_, [&memory_chunks](MemoryChunk* chunk) {
-          memory_chunks.emplace_back(ParallelWorkItem{}, chunk);
+        heap_, [&memory_chunks, &split_large_pages](MemoryChunk* chunk) {
+          const size_t buckets = chunk->buckets();
+          if (!chunk->IsLargePage() || buckets <= kBucketsPerLargePageItem) {
+            memory_chunks.emplace_back(
+                ParallelWorkItem{},
+                RememberedSetItem{chunk, 0, buckets, false});
+            return;
+          }
+          split_large_pages.push_back(chunk);
+          for (size_t start = 0; start < buckets;
+               start += kBucketsPerLargePageItem) {
+            const size_t end =
+                std::min(buckets, start + kBucketsPerLargePageItem);
+            memory_chunks.emplace_back(
+                ParallelWorkItem{}, RememberedSetItem{chunk, start, end, true});
+          }
         });
 
     RootScavengeVisitor root_scavenge_visitor(scavengers[kMainThreadId].get());
@@ -368,6 +389,14 @@ void ScavengerCollector::CollectGarbage() {
           ->Join();
       DCHECK(copied_list.IsEmpty());
       DCHECK(promotion_list.IsEmpty());
+
+      // The invalidated slots of split pages are only needed until all of
+      // their ranges have been processed.
+      for (MemoryChunk* chunk : split_large_pages) {
+        if (chunk->invalidated_slots<OLD_TO_NEW>() != nullptr) {
+          chunk->ReleaseInvalidatedSlots<OLD_TO_NEW>();
+        }
+      }
     }
 
     if (V8_UNLIKELY(FLAG_scavenge_separate_stack_scanning)) {
@@ -454,6 +483,11 @@ void ScavengerCollector::CollectGarbage() {
       }
     }
 
+    // Split pages did not track possibly empty buckets, so check all of them.
+    for (MemoryChunk* chunk : split_large_pages) {
+      RememberedSet<OLD_TO_NEW>::FreeEmptyBuckets(chunk);
+    }
+
 #ifdef DEBUG
     RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
         heap_, [](MemoryChunk* chunk) {
@@ -678,6 +712,36 @@ void Scavenger::ScavengePage(MemoryChunk* page) {
   AddPageToSweeperIfNecessary(page);
 }
 
+void Scavenger::ScavengeLargePageRange(MemoryChunk* page, size_t start_bucket,
+                                       size_t end_bucket) {
+  DCHECK(page->IsLargePage());
+  CodePageMemoryModificationScope memory_modification_scope(page);
+
+  SlotSet* slot_set = page->slot_set<OLD_TO_NEW, AccessMode::ATOMIC>();
+  if (slot_set != nullptr) {
+    InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(page);
+    slot_set->Iterate(
+        page->address(), start_bucket, end_bucket,
+        [this, &filter](MaybeObjectSlot slot) {
+          if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
+          return CheckAndScavengeObject(heap_, slot);
+        },
+        SlotSet::KEEP_EMPTY_BUCKETS);
+  }
+
+  // Large pages are never swept concurrently and typed slots are not split,
+  // so the first range takes care of them.
+  DCHECK_NULL(page->sweeping_slot_set<AccessMode::NON_ATOMIC>());
+  if (start_bucket != 0) return;
+  RememberedSet<OLD_TO_NEW>::IterateTyped(
+      page, [=](SlotType type, Address addr) {
+        return UpdateTypedSlotHelper::UpdateTypedSlot(
+            heap_, type, addr, [this](FullMaybeObjectSlot slot) {
+              return CheckAndScavengeObject(heap(), slot);
+            });
+      });
+}
+
 void Scavenger::Process(JobDelegate* delegate) {
   ScavengeVisitor scavenge_visitor(this);
 
@@ -97,6 +97,12 @@ class Scavenger {
   // objects see RootScavengingVisitor and ScavengeVisitor below.
   void ScavengePage(MemoryChunk* page);
 
+  // Scavenges the old-to-new slots in the buckets [start_bucket, end_bucket)
+  // of a large page whose remembered set is split across several tasks.
+  // Empty buckets are not tracked as the page is shared with other tasks.
+  void ScavengeLargePageRange(MemoryChunk* page, size_t start_bucket,
+                              size_t end_bucket);
+
   // Processes remaining work (=objects) after single objects have been
   // manually scavenged using ScavengeObject or CheckAndScavengeObject.
   void Process(JobDelegate* delegate = nullptr);
@@ -261,17 +267,32 @@ class ScavengerCollector {
   static const int kMaxScavengerTasks = 8;
   static const int kMainThreadId = 0;
 
+  // Large pages with more old-to-new buckets than this are split into several
+  // work items, so that huge arrays pointing into the young generation do not
+  // serialize the parallel phase on a single task.
+  static constexpr size_t kBucketsPerLargePageItem = 128;
+
   explicit ScavengerCollector(Heap* heap);
 
   void CollectGarbage();
 
  private:
+  // Remembered set work for the parallel phase. Either covers a whole chunk
+  // or, for large pages, a range of its buckets.
+  struct RememberedSetItem {
+    MemoryChunk* chunk;
+    size_t start_bucket;
+    size_t end_bucket;
+    bool is_range;
+  };
+
   class JobTask : public v8::JobTask {
    public:
     explicit JobTask(
         ScavengerCollector* outer,
         std::vector<std::unique_ptr<Scavenger>>* scavengers,
-        std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks,
+        std::vector<std::pair<ParallelWorkItem, RememberedSetItem>>
+            memory_chunks,
         Scavenger::CopiedList* copied_list,
         Scavenger::PromotionList* promotion_list);
 
@@ -285,7 +306,7 @@ class ScavengerCollector {
     ScavengerCollector* outer_;
 
     std::vector<std::unique_ptr<Scavenger>>* scavengers_;
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks_;
+    std::vector<std::pair<ParallelWorkItem, RememberedSetItem>> memory_chunks_;
     std::atomic<size_t> remaining_memory_chunks_{0};
     IndexGenerator generator_;
 
@@ -427,8 +427,15 @@ size_t Sweeper::ConcurrentSweepingPageCount() {
 
 bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
                                    JobDelegate* delegate) {
+  // Pages with the most free bytes are left to the main thread and to
+  // allocating background threads, which sweep on demand in
+  // ParallelSweepSpace. Concurrent tasks instead start with the pages that
+  // yield the least memory.
+  const SweepingOrder order = FLAG_allocation_aware_sweeping
+                                  ? SweepingOrder::kLeastFreeBytesFirst
+                                  : SweepingOrder::kMostFreeBytesFirst;
   while (!delegate->ShouldYield()) {
-    Page* page = GetSweepingPageSafe(identity);
+    Page* page = GetSweepingPageSafe(identity, order);
     if (page == nullptr) return true;
     // Typed slot sets are only recorded on code pages. Code pages
     // are not swept concurrently to the application to ensure W^X.
@@ -584,14 +591,21 @@ void Sweeper::PrepareToBeSweptPage(AllocationSpace space, Page* page) {
       marking_state_->live_bytes(page), page);
 }
 
-Page* Sweeper::GetSweepingPageSafe(AllocationSpace space) {
+Page* Sweeper::GetSweepingPageSafe(AllocationSpace space,
+                                   SweepingOrder order) {
   base::MutexGuard guard(&mutex_);
   DCHECK(IsValidSweepingSpace(space));
-  int space_index = GetSweepSpaceIndex(space);
+  SweepingList& sweeping_list = sweeping_list_[GetSweepSpaceIndex(space)];
   Page* page = nullptr;
-  if (!sweeping_list_[space_index].empty()) {
-    page = sweeping_list_[space_index].back();
-    sweeping_list_[space_index].pop_back();
+  if (!sweeping_list.empty()) {
+    if (order == SweepingOrder::kMostFreeBytesFirst) {
+      page = sweeping_list.back();
+      sweeping_list.pop_back();
+    } else {
+      DCHECK_EQ(SweepingOrder::kLeastFreeBytesFirst, order);
+      page = sweeping_list.front();
+      sweeping_list.pop_front();
+    }
   }
   return page;
 }
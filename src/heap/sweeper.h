@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_SWEEPER_H_
 #define V8_HEAP_SWEEPER_H_
 
+#include <deque>
 #include <map>
 #include <vector>
 
@@ -27,7 +28,8 @@ enum FreeSpaceTreatmentMode { IGNORE_FREE_SPACE, ZAP_FREE_SPACE };
 class Sweeper {
  public:
   using IterabilityList = std::vector<Page*>;
-  using SweepingList = std::vector<Page*>;
+  // Sorted in ascending order of free bytes after StartSweeping.
+  using SweepingList = std::deque<Page*>;
   using SweptList = std::vector<Page*>;
   using FreeRangesMap = std::map<uint32_t, uint32_t>;
 
@@ -76,6 +78,7 @@ class Sweeper {
   enum FreeListRebuildingMode { REBUILD_FREE_LIST, IGNORE_FREE_LIST };
   enum AddPageMode { REGULAR, READD_TEMPORARY_REMOVED_PAGE };
   enum class FreeSpaceMayContainInvalidatedSlots { kYes, kNo };
+  enum class SweepingOrder { kMostFreeBytesFirst, kLeastFreeBytesFirst };
 
   Sweeper(Heap* heap, MajorNonAtomicMarkingState* marking_state);
 
@@ -185,7 +188,12 @@ class Sweeper {
   // there are no more pages to sweep in the given space.
   bool IncrementalSweepSpace(AllocationSpace identity);
 
-  Page* GetSweepingPageSafe(AllocationSpace space);
+  // Takes the next page to sweep from the given space. Sweeping on behalf of
+  // the allocator should use kMostFreeBytesFirst, so that it gets the most
+  // memory for the least work; background tasks may work from the other end.
+  Page* GetSweepingPageSafe(
+      AllocationSpace space,
+      SweepingOrder order = SweepingOrder::kMostFreeBytesFirst);
   bool TryRemoveSweepingPageSafe(AllocationSpace space, Page* page);
 
   void PrepareToBeSweptPage(AllocationSpace space, Page* page);
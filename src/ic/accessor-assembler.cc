@@ -2708,8 +2708,9 @@ void AccessorAssembler::GenericPropertyLoad(
     TVARIABLE(IntPtrT, var_name_index);
     Label* notfound = use_stub_cache == kUseStubCache ? &try_stub_cache
                                                       : &lookup_prototype_chain;
-    DescriptorLookup(name, descriptors, bitfield3, &if_descriptor_found,
-                     &var_name_index, notfound);
+    DescriptorLookupWithCache(name, lookup_start_object_map, descriptors,
+                              bitfield3, &if_descriptor_found, &var_name_index,
+                              notfound);
 
     BIND(&if_descriptor_found);
     {
@@ -2863,7 +2864,8 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> raw_hash_field = LoadNameRawHashField(name);
@@ -2881,15 +2883,15 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kMapKeyShift))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  ExternalReference mask_reference = ExternalReference::Create(
+      stub_cache->mask_reference(StubCache::kPrimary));
+  TNode<Uint32T> mask = Load<Uint32T>(ExternalConstant(mask_reference));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
-TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
-                                                           TNode<Map> map) {
+TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
+    StubCache* stub_cache, TNode<Name> name, TNode<Map> map) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
@@ -2899,10 +2901,10 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryKeyShift);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  ExternalReference mask_reference = ExternalReference::Create(
+      stub_cache->mask_reference(StubCache::kSecondary));
+  TNode<Uint32T> mask = Load<Uint32T>(ExternalConstant(mask_reference));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
@@ -2959,7 +2961,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
 
   // Probe the primary table.
   TNode<IntPtrT> primary_offset =
-      StubCachePrimaryOffset(name, lookup_start_object_map);
+      StubCachePrimaryOffset(stub_cache, name, lookup_start_object_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          lookup_start_object_map, if_handler, var_handler,
                          &try_secondary);
@@ -2968,7 +2970,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   {
     // Probe the secondary table.
     TNode<IntPtrT> secondary_offset =
-        StubCacheSecondaryOffset(name, lookup_start_object_map);
+        StubCacheSecondaryOffset(stub_cache, name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            lookup_start_object_map, if_handler, var_handler,
                            &miss);
@@ -2981,6 +2983,77 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   }
 }
 
+void AccessorAssembler::StoreStubCacheTableEntry(
+    StubCache* stub_cache, StubCacheTable table_id,
+    TNode<IntPtrT> entry_offset, TNode<Name> name, TNode<Object> map,
+    TNode<MaybeObject> handler) {
+  StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  // The {entry_offset} holds the entry offset times four (due to masking
+  // and shifting optimizations).
+  const int kMultiplier =
+      sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
+  entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
+
+  TNode<ExternalReference> key_base = ExternalConstant(
+      ExternalReference::Create(stub_cache->key_reference(table)));
+
+  // The stub cache is cleared on every GC, so it does not participate in
+  // write barriers.
+  DCHECK_EQ(0, offsetof(StubCache::Entry, key));
+  UnsafeStoreNoWriteBarrier(MachineRepresentation::kTaggedPointer, key_base,
+                            entry_offset, name);
+  UnsafeStoreNoWriteBarrier(
+      MachineRepresentation::kTagged, key_base,
+      IntPtrAdd(entry_offset, IntPtrConstant(offsetof(StubCache::Entry, map))),
+      map);
+  UnsafeStoreNoWriteBarrier(
+      MachineRepresentation::kTagged, key_base,
+      IntPtrAdd(entry_offset,
+                IntPtrConstant(offsetof(StubCache::Entry, value))),
+      handler);
+}
+
+void AccessorAssembler::UpdateStubCache(StubCache* stub_cache,
+                                        TNode<Name> name, TNode<Map> map,
+                                        TNode<MaybeObject> handler) {
+  Comment("UpdateStubCache");
+  Label update_primary(this);
+  TNode<IntPtrT> primary_offset =
+      StubCachePrimaryOffset(stub_cache, name, map);
+  const int kMultiplier =
+      sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
+  TNode<IntPtrT> primary_entry_offset =
+      IntPtrMul(primary_offset, IntPtrConstant(kMultiplier));
+  TNode<ExternalReference> primary_base = ExternalConstant(
+      ExternalReference::Create(stub_cache->key_reference(StubCache::kPrimary)));
+
+  // If the primary entry has useful data in it, we retire it to the
+  // secondary cache before overwriting it. Cleared entries have a Smi map.
+  TNode<Object> old_map = Load<Object>(
+      primary_base,
+      IntPtrAdd(primary_entry_offset,
+                IntPtrConstant(offsetof(StubCache::Entry, map))));
+  GotoIf(TaggedIsSmi(old_map), &update_primary);
+  {
+    TNode<Name> old_name = CAST(
+        Load(MachineType::TaggedPointer(), primary_base, primary_entry_offset));
+    TNode<MaybeObject> old_handler = ReinterpretCast<MaybeObject>(
+        Load(MachineType::AnyTagged(), primary_base,
+             IntPtrAdd(primary_entry_offset,
+                       IntPtrConstant(offsetof(StubCache::Entry, value)))));
+    TNode<IntPtrT> secondary_offset =
+        StubCacheSecondaryOffset(stub_cache, old_name, CAST(old_map));
+    StoreStubCacheTableEntry(stub_cache, kSecondary, secondary_offset,
+                             old_name, old_map, old_handler);
+    Goto(&update_primary);
+  }
+
+  BIND(&update_primary);
+  StoreStubCacheTableEntry(stub_cache, kPrimary, primary_offset, name, map,
+                           handler);
+  IncrementCounter(isolate()->counters()->megamorphic_stub_cache_updates(), 1);
+}
+
 //////////////////// Entry points into private implementation (one per stub).
 
 void AccessorAssembler::LoadIC_BytecodeHandler(const LazyLoadICParameters* p,
@@ -78,13 +78,19 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                          Label* if_handler, TVariable<MaybeObject>* var_handler,
                          Label* if_miss);
 
-  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(TNode<Name> name,
+  // Implements StubCache::Set().
+  void UpdateStubCache(StubCache* stub_cache, TNode<Name> name, TNode<Map> map,
+                       TNode<MaybeObject> handler);
+
+  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(StubCache* stub_cache,
+                                                  TNode<Name> name,
                                                   TNode<Map> map) {
-    return StubCachePrimaryOffset(name, map);
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(StubCache* stub_cache,
+                                                    TNode<Name> name,
                                                     TNode<Map> map) {
-    return StubCacheSecondaryOffset(name, map);
+    return StubCacheSecondaryOffset(stub_cache, name, map);
   }
 
   struct LoadICParameters {
@@ -523,14 +529,20 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
-  TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name, TNode<Map> map);
+  TNode<IntPtrT> StubCachePrimaryOffset(StubCache* stub_cache, TNode<Name> name,
+                                        TNode<Map> map);
+  TNode<IntPtrT> StubCacheSecondaryOffset(StubCache* stub_cache,
+                                          TNode<Name> name, TNode<Map> map);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               TNode<IntPtrT> entry_offset, TNode<Object> name,
                               TNode<Map> map, Label* if_handler,
                               TVariable<MaybeObject>* var_handler,
                               Label* if_miss);
+  void StoreStubCacheTableEntry(StubCache* stub_cache,
+                                StubCacheTable table_id,
+                                TNode<IntPtrT> entry_offset, TNode<Name> name,
+                                TNode<Object> map, TNode<MaybeObject> handler);
 
   void BranchIfPrototypesHaveNoElements(TNode<Map> receiver_map,
                                         Label* definitely_no_elements,
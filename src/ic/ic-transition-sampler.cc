@@ -0,0 +1,173 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/ic/ic-transition-sampler.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "include/v8-script.h"
+#include "src/execution/frames-inl.h"
+#include "src/execution/isolate.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+ICTransitionSampler::ICTransitionSampler(Isolate* isolate, int sample_interval)
+    : isolate_(isolate),
+      sample_interval_(sample_interval),
+      countdown_(sample_interval) {
+  DCHECK_GT(sample_interval, 0);
+}
+
+void ICTransitionSampler::RecordTransition(const char* type, bool keyed,
+                                           FeedbackNexus* nexus,
+                                           InlineCacheState old_state,
+                                           InlineCacheState new_state) {
+  if (old_state == new_state) return;
+  if (--countdown_ > 0) return;
+  countdown_ = sample_interval_;
+
+  HandleScope scope(isolate_);
+  SharedFunctionInfo shared = nexus->vector().shared_function_info();
+  int script_id = shared.script().IsScript()
+                      ? Script::cast(shared.script()).id()
+                      : v8::UnboundScript::kNoScriptId;
+  SlotKey key(script_id, shared.StartPosition(), nexus->slot().ToInt());
+  auto it = records_.find(key);
+  if (it == records_.end()) {
+    if (records_.size() >= kMaxSlotRecords) {
+      dropped_count_++;
+      return;
+    }
+    SlotRecord record;
+    record.function_name = shared.DebugNameCStr().get();
+    record.ic_type = keyed ? "Keyed" : "";
+    record.ic_type += type;
+    record.script_id = script_id;
+    it = records_.emplace(key, std::move(record)).first;
+    RecordPosition(shared, &it->second);
+  }
+
+  SlotRecord& record = it->second;
+  record.state = new_state;
+  switch (new_state) {
+    case InlineCacheState::MONOMORPHIC:
+      record.monomorphic_count++;
+      break;
+    case InlineCacheState::POLYMORPHIC:
+      record.polymorphic_count++;
+      break;
+    case InlineCacheState::MEGAMORPHIC:
+      record.megamorphic_count++;
+      break;
+    default:
+      break;
+  }
+}
+
+void ICTransitionSampler::RecordPosition(SharedFunctionInfo shared,
+                                         SlotRecord* record) {
+  // The IC belongs to the innermost function of the top frame, unless it was
+  // reached through a builtin, in which case the position stays unknown.
+  JavaScriptFrameIterator it(isolate_);
+  if (it.done()) return;
+  FrameSummary summary = FrameSummary::GetTop(it.frame());
+  if (!summary.IsJavaScript()) return;
+  const FrameSummary::JavaScriptFrameSummary& js_summary =
+      summary.AsJavaScript();
+  if (js_summary.function()->shared() != shared) return;
+  if (js_summary.AreSourcePositionsAvailable()) {
+    record->position = js_summary.SourcePosition();
+  } else if (js_summary.abstract_code()->IsBytecodeArray()) {
+    // Collecting source positions means reparsing the function, so defer it
+    // until the records are queried.
+    record->bytecode_offset = js_summary.code_offset();
+    unresolved_count_++;
+  }
+}
+
+void ICTransitionSampler::ResolvePositions() {
+  if (unresolved_count_ == 0) return;
+  unresolved_count_ = 0;
+
+  auto is_unresolved = [](const SlotRecord& record) {
+    return record.position == kNoSourcePosition && record.bytecode_offset >= 0;
+  };
+
+  // Collect the functions first, since collecting source positions
+  // allocates.
+  std::vector<Handle<SharedFunctionInfo>> functions;
+  {
+    DisallowGarbageCollection no_gc;
+    Script::Iterator scripts(isolate_);
+    for (Script script = scripts.Next(); !script.is_null();
+         script = scripts.Next()) {
+      auto begin = records_.lower_bound(SlotKey(
+          script.id(), std::numeric_limits<int>::min(), 0));
+      if (begin == records_.end() || std::get<0>(begin->first) != script.id()) {
+        continue;
+      }
+      SharedFunctionInfo::ScriptIterator infos(isolate_, script);
+      for (SharedFunctionInfo info = infos.Next(); !info.is_null();
+           info = infos.Next()) {
+        auto record = records_.lower_bound(
+            SlotKey(script.id(), info.StartPosition(), 0));
+        if (record != records_.end() &&
+            std::get<0>(record->first) == script.id() &&
+            std::get<1>(record->first) == info.StartPosition()) {
+          functions.push_back(handle(info, isolate_));
+        }
+      }
+    }
+  }
+
+  for (Handle<SharedFunctionInfo> shared : functions) {
+    int script_id = Script::cast(shared->script()).id();
+    int start_position = shared->StartPosition();
+    auto begin = records_.lower_bound(SlotKey(script_id, start_position, 0));
+    auto end = records_.lower_bound(SlotKey(script_id, start_position + 1, 0));
+    if (std::none_of(begin, end, [&](const auto& entry) {
+          return is_unresolved(entry.second);
+        })) {
+      continue;
+    }
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate_, shared);
+    if (!shared->HasBytecodeArray()) continue;
+    AbstractCode code = AbstractCode::cast(shared->GetBytecodeArray(isolate_));
+    for (auto it = begin; it != end; ++it) {
+      if (!is_unresolved(it->second)) continue;
+      it->second.position = code.SourcePosition(it->second.bytecode_offset);
+    }
+  }
+
+  // Records of functions that have been collected or flushed before their
+  // positions were resolved get another chance on the next query.
+  for (const auto& entry : records_) {
+    if (is_unresolved(entry.second)) unresolved_count_++;
+  }
+}
+
+std::vector<const ICTransitionSampler::SlotRecord*>
+ICTransitionSampler::GetRecords() {
+  ResolvePositions();
+  std::vector<const SlotRecord*> records;
+  records.reserve(records_.size());
+  for (const auto& entry : records_) records.push_back(&entry.second);
+  std::stable_sort(records.begin(), records.end(),
+                   [](const SlotRecord* a, const SlotRecord* b) {
+                     if (a->megamorphic_count != b->megamorphic_count) {
+                       return a->megamorphic_count > b->megamorphic_count;
+                     }
+                     return a->polymorphic_count > b->polymorphic_count;
+                   });
+  return records;
+}
+
+}  // namespace internal
+}  // namespace v8
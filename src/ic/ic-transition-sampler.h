@@ -0,0 +1,83 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_IC_IC_TRANSITION_SAMPLER_H_
+#define V8_IC_IC_TRANSITION_SAMPLER_H_
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "src/common/globals.h"
+#include "src/objects/feedback-vector.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+// Aggregates inline cache state transitions per feedback slot in memory, so
+// that megamorphic sites can be found in production without the overhead of
+// --log-ic or the ic_stats trace category (see
+// v8::Isolate::SetICTransitionSampleInterval()).
+//
+// Every {sample_interval}th transition is recorded. Transitions only happen
+// on IC misses, so the per-transition cost is small compared to the miss
+// itself. The number of recorded slots is bounded; transitions of slots seen
+// after the table is full are dropped.
+class V8_EXPORT_PRIVATE ICTransitionSampler final {
+ public:
+  struct SlotRecord {
+    std::string function_name;
+    std::string ic_type;
+    int script_id = 0;
+    // Script offset of the access, or kNoSourcePosition if unknown.
+    int position = kNoSourcePosition;
+    // Bytecode offset of the access, used to compute {position} when it is
+    // queried if source positions were not available when it was recorded.
+    int bytecode_offset = -1;
+    InlineCacheState state = InlineCacheState::NO_FEEDBACK;
+    size_t monomorphic_count = 0;
+    size_t polymorphic_count = 0;
+    size_t megamorphic_count = 0;
+  };
+
+  static constexpr size_t kMaxSlotRecords = 16 * 1024;
+
+  ICTransitionSampler(Isolate* isolate, int sample_interval);
+  ICTransitionSampler(const ICTransitionSampler&) = delete;
+  ICTransitionSampler& operator=(const ICTransitionSampler&) = delete;
+
+  // Called by IC::TraceIC() for every IC miss that updated the feedback.
+  void RecordTransition(const char* type, bool keyed, FeedbackNexus* nexus,
+                        InlineCacheState old_state, InlineCacheState new_state);
+
+  // Returns the records sorted by the number of megamorphic, then
+  // polymorphic transitions. May allocate to collect source positions.
+  std::vector<const SlotRecord*> GetRecords();
+
+  int sample_interval() const { return sample_interval_; }
+  size_t dropped_count() const { return dropped_count_; }
+
+ private:
+  // Keyed by script id, function start position and feedback slot, which
+  // unlike the FeedbackVector do not move and survive bytecode flushing.
+  using SlotKey = std::tuple<int, int, int>;
+
+  void RecordPosition(SharedFunctionInfo shared, SlotRecord* record);
+  void ResolvePositions();
+
+  Isolate* const isolate_;
+  const int sample_interval_;
+  int countdown_;
+  size_t dropped_count_ = 0;
+  size_t unresolved_count_ = 0;
+  std::map<SlotKey, SlotRecord> records_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_IC_IC_TRANSITION_SAMPLER_H_
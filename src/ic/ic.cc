@@ -23,6 +23,7 @@
 #include "src/ic/handler-configuration-inl.h"
 #include "src/ic/ic-inl.h"
 #include "src/ic/ic-stats.h"
+#include "src/ic/ic-transition-sampler.h"
 #include "src/ic/stub-cache.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/api-callbacks.h"
@@ -109,7 +110,10 @@ const char* GetModifier(KeyedAccessStoreMode mode) {
 }  // namespace
 
 void IC::TraceIC(const char* type, Handle<Object> name) {
-  if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled())) return;
+  if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled() &&
+                isolate()->ic_transition_sampler() == nullptr)) {
+    return;
+  }
   State new_state =
       (state() == NO_FEEDBACK) ? NO_FEEDBACK : nexus()->ic_state();
   TraceIC(type, name, state(), new_state);
@@ -117,6 +121,13 @@ void IC::TraceIC(const char* type, Handle<Object> name) {
 
 void IC::TraceIC(const char* type, Handle<Object> name, State old_state,
                  State new_state) {
+  bool keyed_prefix = is_keyed() && !IsStoreInArrayLiteralIC();
+  if (V8_UNLIKELY(isolate()->ic_transition_sampler() != nullptr) &&
+      state() != NO_FEEDBACK) {
+    isolate()->ic_transition_sampler()->RecordTransition(
+        type, keyed_prefix, nexus(), old_state, new_state);
+  }
+
   if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled())) return;
 
   Handle<Map> map = lookup_start_object_map();  // Might be empty.
@@ -132,8 +143,6 @@ void IC::TraceIC(const char* type, Handle<Object> name, State old_state,
     modifier = GetModifier(mode);
   }
 
-  bool keyed_prefix = is_keyed() && !IsStoreInArrayLiteralIC();
-
   if (!(TracingFlags::ic_stats.load(std::memory_order_relaxed) &
         v8::tracing::TracingCategoryObserver::ENABLED_BY_TRACING)) {
     LOG(isolate(), ICEvent(type, keyed_prefix, map, name,
@@ -639,6 +648,23 @@ bool IC::UpdateMegaDOMIC(const MaybeObjectHandle& handler, Handle<Name> name) {
   call_optimization.LookupHolderOfExpectedType(isolate(), map, &holder_lookup);
   if (holder_lookup != CallOptimization::kHolderIsReceiver) return false;
 
+  // The MegaDOM handler calls the accessor for any receiver that passes its
+  // signature check, so make sure that the receivers seen so far do.
+  std::vector<Handle<Map>> existing_maps;
+  {
+    DisallowGarbageCollection no_gc;
+    for (FeedbackIterator it(nexus()); !it.done(); it.Advance()) {
+      if (it.handler()->IsCleared()) continue;
+      existing_maps.push_back(handle(it.map(), isolate()));
+    }
+  }
+  for (Handle<Map> existing_map : existing_maps) {
+    if (existing_map->is_deprecated()) continue;
+    call_optimization.LookupHolderOfExpectedType(isolate(), existing_map,
+                                                 &holder_lookup);
+    if (holder_lookup != CallOptimization::kHolderIsReceiver) return false;
+  }
+
   Handle<Context> accessor_context(call_optimization.GetAccessorContext(*map),
                                    isolate());
 
@@ -649,6 +675,16 @@ bool IC::UpdateMegaDOMIC(const MaybeObjectHandle& handler, Handle<Name> name) {
   return true;
 }
 
+bool IC::ShouldUpgradeToMegaDOMIC() {
+  if (FLAG_mega_dom_ic_map_threshold <= 0) return false;
+  DisallowGarbageCollection no_gc;
+  int number_of_maps = 1;
+  for (FeedbackIterator it(nexus()); !it.done(); it.Advance()) {
+    if (!it.handler()->IsCleared()) number_of_maps++;
+  }
+  return number_of_maps >= FLAG_mega_dom_ic_map_threshold;
+}
+
 bool IC::UpdatePolymorphicIC(Handle<Name> name,
                              const MaybeObjectHandle& handler) {
   DCHECK(IsHandler(*handler));
@@ -658,7 +694,7 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   Handle<Map> map = lookup_start_object_map();
 
   std::vector<MapAndHandler> maps_and_handlers;
-  maps_and_handlers.reserve(FLAG_max_valid_polymorphic_map_count);
+  maps_and_handlers.reserve(isolate()->max_valid_polymorphic_map_count());
   int deprecated_maps = 0;
   int handler_to_overwrite = -1;
 
@@ -705,8 +741,9 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   int number_of_valid_maps =
       number_of_maps - deprecated_maps - (handler_to_overwrite != -1);
 
-  if (number_of_valid_maps >= FLAG_max_valid_polymorphic_map_count)
+  if (number_of_valid_maps >= isolate()->max_valid_polymorphic_map_count()) {
     return false;
+  }
   if (number_of_maps == 0 && state() != MONOMORPHIC && state() != POLYMORPHIC) {
     return false;
   }
@@ -785,6 +822,9 @@ void IC::SetCache(Handle<Name> name, const MaybeObjectHandle& handler) {
       }
       V8_FALLTHROUGH;
     case POLYMORPHIC:
+      // Calling a shared API accessor directly beats searching a long list
+      // of receiver maps, so don't wait for the polymorphism limit.
+      if (ShouldUpgradeToMegaDOMIC() && UpdateMegaDOMIC(handler, name)) break;
       if (UpdatePolymorphicIC(name, handler)) break;
       if (UpdateMegaDOMIC(handler, name)) break;
       if (!is_keyed() || state() == RECOMPUTE_HANDLER) {
@@ -1296,7 +1336,7 @@ void KeyedLoadIC::UpdateLoadElement(Handle<HeapObject> receiver,
   // If the maximum number of receiver maps has been exceeded, use the generic
   // version of the IC.
   if (static_cast<int>(target_receiver_maps.size()) >
-      FLAG_max_valid_polymorphic_map_count) {
+      isolate()->max_valid_polymorphic_map_count()) {
     set_slow_stub_reason("max polymorph exceeded");
     return;
   }
@@ -2278,7 +2318,7 @@ void KeyedStoreIC::UpdateStoreElement(Handle<Map> receiver_map,
   // If the maximum number of receiver maps has been exceeded, use the
   // megamorphic version of the IC.
   if (static_cast<int>(target_maps_and_handlers.size()) >
-      FLAG_max_valid_polymorphic_map_count) {
+      isolate()->max_valid_polymorphic_map_count()) {
     return;
   }
 
@@ -103,6 +103,7 @@ class IC {
 
   void UpdateMonomorphicIC(const MaybeObjectHandle& handler, Handle<Name> name);
   bool UpdateMegaDOMIC(const MaybeObjectHandle& handler, Handle<Name> name);
+  bool ShouldUpgradeToMegaDOMIC();
   bool UpdatePolymorphicIC(Handle<Name> name, const MaybeObjectHandle& handler);
   void UpdateMegamorphicCache(Handle<Map> map, Handle<Name> name,
                               const MaybeObjectHandle& handler);
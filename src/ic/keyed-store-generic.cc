@@ -815,8 +815,9 @@ void KeyedStoreGenericAssembler::EmitGenericPropertyStore(
     TNode<DescriptorArray> descriptors = LoadMapDescriptors(receiver_map);
     Label descriptor_found(this), lookup_transition(this);
     TVARIABLE(IntPtrT, var_name_index);
-    DescriptorLookup(name, descriptors, bitfield3, &descriptor_found,
-                     &var_name_index, &lookup_transition);
+    DescriptorLookupWithCache(name, receiver_map, descriptors, bitfield3,
+                              &descriptor_found, &var_name_index,
+                              &lookup_transition);
 
     BIND(&descriptor_found);
     {
@@ -866,16 +867,47 @@ void KeyedStoreGenericAssembler::EmitGenericPropertyStore(
     {
       Comment("lookup transition");
       CheckForAssociatedProtector(name, slow);
-      TNode<Map> transition_map =
-          FindCandidateStoreICTransitionMapHandler(receiver_map, name, slow);
 
       // Validate the transition handler candidate and apply the transition.
       StoreTransitionMapFlags flags = kValidateTransitionHandler;
       if (ShouldCheckPrototypeValidity()) {
         flags = StoreTransitionMapFlags(flags | kCheckPrototypeValidity);
       }
-      HandleStoreICTransitionMapHandlerCase(p, transition_map, slow, flags);
-      exit_point->Return(p->value());
+
+      // Transition handlers found in the store stub cache are weak references
+      // to the transition map, see StoreHandler::StoreTransition(). Using
+      // them avoids searching the transition tree of maps that many objects
+      // are built from.
+      Label stub_cache_miss(this);
+      TVARIABLE(MaybeObject, var_handler);
+      Label found_handler(this, &var_handler);
+      TryProbeStubCache(isolate()->store_stub_cache(), receiver, name,
+                        &found_handler, &var_handler, &stub_cache_miss);
+      BIND(&found_handler);
+      {
+        TNode<MaybeObject> handler = var_handler.value();
+        GotoIfNot(IsWeakOrCleared(handler), &stub_cache_miss);
+        TNode<HeapObject> cached_transition =
+            GetHeapObjectAssumeWeak(handler, &stub_cache_miss);
+        GotoIfNot(IsMap(cached_transition), &stub_cache_miss);
+        HandleStoreICTransitionMapHandlerCase(p, CAST(cached_transition), slow,
+                                              flags);
+        exit_point->Return(p->value());
+      }
+
+      BIND(&stub_cache_miss);
+      {
+        TNode<Map> transition_map =
+            FindCandidateStoreICTransitionMapHandler(receiver_map, name, slow);
+        HandleStoreICTransitionMapHandlerCase(p, transition_map, slow, flags);
+        // Only transitions validated against the prototype chain are valid
+        // StoreIC handlers.
+        if (ShouldCheckPrototypeValidity()) {
+          UpdateStubCache(isolate()->store_stub_cache(), name, receiver_map,
+                          MakeWeak(transition_map));
+        }
+        exit_point->Return(p->value());
+      }
     }
   }
 
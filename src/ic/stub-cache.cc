@@ -4,8 +4,11 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
@@ -14,22 +17,43 @@
 namespace v8 {
 namespace internal {
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+namespace {
+
+int TableSize(int table_bits) {
+  return 1 << std::min(std::max(table_bits, StubCache::kMinTableBits),
+                       StubCache::kMaxTableBits);
+}
+
+}  // namespace
+
+StubCache::StubCache(Isolate* isolate)
+    : StubCache(isolate, FLAG_stub_cache_primary_table_bits,
+                FLAG_stub_cache_secondary_table_bits) {}
+
+StubCache::StubCache(Isolate* isolate, int primary_table_bits,
+                     int secondary_table_bits)
+    : primary_table_size_(TableSize(primary_table_bits)),
+      secondary_table_size_(TableSize(secondary_table_bits)),
+      primary_mask_((primary_table_size_ - 1) << kCacheIndexShift),
+      secondary_mask_((secondary_table_size_ - 1) << kCacheIndexShift),
+      primary_(new Entry[primary_table_size_]),
+      secondary_(new Entry[secondary_table_size_]),
+      isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
 }
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(primary_table_size_));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_table_size_));
   Clear();
 }
 
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::PrimaryOffset(Name name, Map map) {
+int StubCache::PrimaryOffset(Name name, Map map) const {
   // Compute the hash of the name (use entire hash field).
   DCHECK(name.HasHashCode());
   uint32_t field = name.raw_hash_field();
@@ -40,26 +64,26 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler. This hash should be sufficiently different from the primary one
 // in order to avoid collisions for minified code with short names.
 // Returns an index into the table that is scaled by 1 << kCacheIndexShift.
-int StubCache::SecondaryOffset(Name name, Map old_map) {
+int StubCache::SecondaryOffset(Name name, Map old_map) const {
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryKeyShift);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
-int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
+int StubCache::PrimaryOffsetForTesting(Name name, Map map) const {
   return PrimaryOffset(name, map);
 }
 
-int StubCache::SecondaryOffsetForTesting(Name name, Map map) {
+int StubCache::SecondaryOffsetForTesting(Name name, Map map) const {
   return SecondaryOffset(name, map);
 }
 
@@ -85,7 +109,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_.get(), primary_offset);
   MaybeObject old_handler(
       TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
@@ -98,7 +122,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
     Name old_name =
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
-    Entry* secondary = entry(secondary_, secondary_offset);
+    Entry* secondary = entry(secondary_.get(), secondary_offset);
     *secondary = *primary;
   }
 
@@ -112,12 +136,12 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 MaybeObject StubCache::Get(Name name, Map map) {
   DCHECK(CommonStubCacheChecks(this, name, map, MaybeObject()));
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_.get(), primary_offset);
   if (primary->key == name && primary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), primary->value);
   }
   int secondary_offset = SecondaryOffset(name, map);
-  Entry* secondary = entry(secondary_, secondary_offset);
+  Entry* secondary = entry(secondary_.get(), secondary_offset);
   if (secondary->key == name && secondary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), secondary->value);
   }
@@ -128,12 +152,12 @@ void StubCache::Clear() {
   MaybeObject empty =
       MaybeObject::FromObject(isolate_->builtins()->code(Builtin::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size_; j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
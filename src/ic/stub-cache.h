@@ -5,6 +5,8 @@
 #ifndef V8_IC_STUB_CACHE_H_
 #define V8_IC_STUB_CACHE_H_
 
+#include <memory>
+
 #include "src/objects/name.h"
 #include "src/objects/tagged-value.h"
 
@@ -15,6 +17,11 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// The table sizes are chosen per isolate when it is created (see
+// --stub-cache-primary-table-bits and --stub-cache-secondary-table-bits).
+// Generated code reads the index masks through external references, so the
+// builtins do not depend on the configured sizes.
 
 
 class SCTableReference {
@@ -66,16 +73,30 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The uint32_t mask that turns a hash into a (scaled) index into {table}.
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
-        return StubCache::primary_;
+        return primary_.get();
       case StubCache::kSecondary:
-        return StubCache::secondary_;
+        return secondary_.get();
     }
     UNREACHABLE();
   }
 
+  int primary_table_size() const { return primary_table_size_; }
+  int secondary_table_size() const { return secondary_table_size_; }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::HashBits::kShift is convenient because it
@@ -85,21 +106,26 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kDefaultPrimaryTableBits = 11;
+  static const int kDefaultSecondaryTableBits = 9;
+  static const int kMinTableBits = 4;
+  static const int kMaxTableBits = 16;
 
   // Used to introduce more entropy from the higher bits of the Map address.
-  // This should fill in the masked out kCacheIndexShift-bits.
-  static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
-  static const int kSecondaryKeyShift = kSecondaryTableBits + kCacheIndexShift;
+  // This should fill in the masked out kCacheIndexShift-bits. The shifts only
+  // depend on the default sizes, so that the hash functions are the same for
+  // all isolates.
+  static const int kMapKeyShift = kDefaultPrimaryTableBits + kCacheIndexShift;
+  static const int kSecondaryKeyShift =
+      kDefaultSecondaryTableBits + kCacheIndexShift;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, Map map);
+  int PrimaryOffsetForTesting(Name name, Map map) const;
+  int SecondaryOffsetForTesting(Name name, Map map) const;
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  StubCache(Isolate* isolate, int primary_table_bits,
+            int secondary_table_bits);
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -114,12 +140,12 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map) const;
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, Map map);
+  int SecondaryOffset(Name name, Map map) const;
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -136,8 +162,13 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  const int primary_table_size_;
+  const int secondary_table_size_;
+  // Read by generated code, see mask_reference().
+  const uint32_t primary_mask_;
+  const uint32_t secondary_mask_;
+  std::unique_ptr<Entry[]> primary_;
+  std::unique_ptr<Entry[]> secondary_;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -5829,9 +5829,9 @@ bool Genesis::InstallSpecialObjects(Isolate* isolate,
 
 #if V8_ENABLE_WEBASSEMBLY
   if (FLAG_expose_wasm) {
-    // Install the internal data structures into the isolate and expose on
-    // the global object.
-    WasmJs::Install(isolate, true);
+    // Expose on the global object through a lazy accessor. The internal data
+    // structures are installed into the isolate on first use.
+    WasmJs::InstallLazily(isolate);
   } else if (FLAG_validate_asm) {
     // Install the internal data structures only; these are needed for asm.js
     // translated to Wasm to work correctly.
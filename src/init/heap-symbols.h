@@ -374,6 +374,7 @@
   V(_, revoke_string, "revoke")                                       \
   V(_, roundingIncrement_string, "roundingIncrement")                 \
   V(_, RuntimeError_string, "RuntimeError")                           \
+  V(_, WebAssembly_string, "WebAssembly")                             \
   V(_, WebAssemblyException_string, "WebAssembly.Exception")          \
   V(_, Script_string, "Script")                                       \
   V(_, script_string, "script")                                       \
@@ -27,6 +27,15 @@ inline size_t GetIsolateRootBiasPageSize(
                  platform_page_allocator->AllocatePageSize());
 }
 
+// Heap pages allocated from the cage become eligible for transparent huge
+// pages once enough consecutive pages are committed with the same permissions.
+void MaybeAdviseHugePages(VirtualMemoryCage* cage) {
+  if (!FLAG_transparent_huge_pages) return;
+  // This is advisory; regular pages are used if the OS refuses.
+  USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(cage->base()),
+                                cage->size()));
+}
+
 }  // namespace
 
 struct PtrComprCageReservationParams
@@ -107,6 +116,7 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  MaybeAdviseHugePages(GetProcessWidePtrComprCage());
 #endif
 }
 
@@ -118,6 +128,7 @@ IsolateAllocator::IsolateAllocator() {
         nullptr,
         "Failed to reserve memory for Isolate V8 pointer compression cage");
   }
+  MaybeAdviseHugePages(&isolate_ptr_compr_cage_);
   page_allocator_ = isolate_ptr_compr_cage_.page_allocator();
   CommitPagesForIsolate();
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
@@ -0,0 +1,167 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/interpreter/bytecode-dispatch-sampler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "include/v8-script.h"
+#include "src/execution/frames-inl.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/objects/js-array-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+void BytecodeDispatchSampler::SampleTopFrame() {
+  JavaScriptFrameIterator it(isolate_);
+  if (it.done() || !it.frame()->is_unoptimized()) return;
+  UnoptimizedFrame* frame = UnoptimizedFrame::cast(it.frame());
+  HandleScope scope(isolate_);
+  Handle<SharedFunctionInfo> shared(frame->function().shared(), isolate_);
+  Handle<BytecodeArray> bytecode_array(frame->GetBytecodeArray(), isolate_);
+  Sample(shared, bytecode_array, frame->GetBytecodeOffset());
+}
+
+void BytecodeDispatchSampler::Sample(Handle<SharedFunctionInfo> shared,
+                                     Handle<BytecodeArray> bytecode_array,
+                                     int bytecode_offset) {
+  BytecodeArrayIterator iterator(bytecode_array, bytecode_offset);
+  bool is_loop = iterator.current_bytecode() == Bytecode::kJumpLoop;
+  int start_offset = is_loop ? iterator.GetJumpTargetOffset() : 0;
+
+  FunctionProfile& profile = ProfileFor(*shared);
+  profile.samples++;
+  sample_count_++;
+
+  Bytecode first = Bytecode::kIllegal;
+  Bytecode previous = Bytecode::kIllegal;
+  for (iterator.SetOffset(start_offset);
+       !iterator.done() && iterator.current_offset() <= bytecode_offset;
+       iterator.Advance()) {
+    Bytecode current = iterator.current_bytecode();
+    profile.bytecode_counts[Bytecodes::ToByte(current)]++;
+    if (previous != Bytecode::kIllegal) {
+      profile.dispatch_counts[DispatchKey(previous, current)]++;
+    } else {
+      first = current;
+    }
+    previous = current;
+  }
+  // Close the loop with the back edge.
+  if (is_loop && first != Bytecode::kIllegal) {
+    profile.dispatch_counts[DispatchKey(Bytecode::kJumpLoop, first)]++;
+  }
+}
+
+BytecodeDispatchSampler::FunctionProfile& BytecodeDispatchSampler::ProfileFor(
+    SharedFunctionInfo shared) {
+  int script_id = shared.script().IsScript()
+                      ? Script::cast(shared.script()).id()
+                      : v8::UnboundScript::kNoScriptId;
+  int start_position = shared.StartPosition();
+  auto result =
+      profiles_.emplace(std::make_pair(script_id, start_position),
+                        FunctionProfile());
+  FunctionProfile& profile = result.first->second;
+  if (result.second) {
+    profile.name = shared.DebugNameCStr().get();
+    profile.script_id = script_id;
+    profile.start_position = start_position;
+  }
+  return profile;
+}
+
+Handle<JSObject> BytecodeDispatchSampler::NewDispatchesObject(
+    const std::unordered_map<uint32_t, uint64_t>& dispatch_counts) {
+  Factory* factory = isolate_->factory();
+  Handle<JSObject> dispatches = factory->NewJSObjectWithNullProto();
+  // Emit rows in bytecode order, and only for bytecodes that dispatched.
+  for (int from_index = 0; from_index < Bytecodes::kBytecodeCount;
+       ++from_index) {
+    Bytecode from = Bytecodes::FromByte(from_index);
+    Handle<JSObject> row;
+    for (int to_index = 0; to_index < Bytecodes::kBytecodeCount; ++to_index) {
+      Bytecode to = Bytecodes::FromByte(to_index);
+      auto it = dispatch_counts.find(DispatchKey(from, to));
+      if (it == dispatch_counts.end()) continue;
+      if (row.is_null()) row = factory->NewJSObjectWithNullProto();
+      JSObject::AddProperty(isolate_, row, Bytecodes::ToString(to),
+                            factory->NewNumber(static_cast<double>(it->second)),
+                            NONE);
+    }
+    if (!row.is_null()) {
+      JSObject::AddProperty(isolate_, dispatches, Bytecodes::ToString(from),
+                            row, NONE);
+    }
+  }
+  return dispatches;
+}
+
+Handle<JSObject> BytecodeDispatchSampler::GetSamplesObject() {
+  Factory* factory = isolate_->factory();
+
+  std::vector<const FunctionProfile*> sorted_profiles;
+  std::unordered_map<uint32_t, uint64_t> total_dispatch_counts;
+  for (const auto& entry : profiles_) {
+    sorted_profiles.push_back(&entry.second);
+    for (const auto& dispatch : entry.second.dispatch_counts) {
+      total_dispatch_counts[dispatch.first] += dispatch.second;
+    }
+  }
+  std::stable_sort(sorted_profiles.begin(), sorted_profiles.end(),
+                   [](const FunctionProfile* a, const FunctionProfile* b) {
+                     return a->samples > b->samples;
+                   });
+
+  Handle<FixedArray> functions =
+      factory->NewFixedArray(static_cast<int>(sorted_profiles.size()));
+  for (size_t i = 0; i < sorted_profiles.size(); ++i) {
+    const FunctionProfile& profile = *sorted_profiles[i];
+    Handle<JSObject> function = factory->NewJSObjectWithNullProto();
+    Handle<String> name =
+        factory->NewStringFromUtf8(base::CStrVector(profile.name.c_str()))
+            .ToHandleChecked();
+    JSObject::AddProperty(isolate_, function, "name", name, NONE);
+    JSObject::AddProperty(isolate_, function, "scriptId",
+                          factory->NewNumberFromInt(profile.script_id), NONE);
+    JSObject::AddProperty(isolate_, function, "position",
+                          factory->NewNumberFromInt(profile.start_position),
+                          NONE);
+    JSObject::AddProperty(
+        isolate_, function, "samples",
+        factory->NewNumber(static_cast<double>(profile.samples)), NONE);
+
+    Handle<JSObject> bytecodes = factory->NewJSObjectWithNullProto();
+    for (int index = 0; index < Bytecodes::kBytecodeCount; ++index) {
+      uint64_t count = profile.bytecode_counts[index];
+      if (count == 0) continue;
+      JSObject::AddProperty(isolate_, bytecodes,
+                            Bytecodes::ToString(Bytecodes::FromByte(index)),
+                            factory->NewNumber(static_cast<double>(count)),
+                            NONE);
+    }
+    JSObject::AddProperty(isolate_, function, "bytecodes", bytecodes, NONE);
+    JSObject::AddProperty(isolate_, function, "dispatches",
+                          NewDispatchesObject(profile.dispatch_counts), NONE);
+    functions->set(static_cast<int>(i), *function);
+  }
+
+  Handle<JSObject> result = factory->NewJSObjectWithNullProto();
+  JSObject::AddProperty(isolate_, result, "dispatches",
+                        NewDispatchesObject(total_dispatch_counts), NONE);
+  JSObject::AddProperty(isolate_, result, "functions",
+                        factory->NewJSArrayWithElements(functions), NONE);
+  return result;
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,93 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INTERPRETER_BYTECODE_DISPATCH_SAMPLER_H_
+#define V8_INTERPRETER_BYTECODE_DISPATCH_SAMPLER_H_
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "src/handles/handles.h"
+#include "src/interpreter/bytecodes.h"
+
+namespace v8 {
+namespace internal {
+
+class BytecodeArray;
+class Isolate;
+class JSObject;
+class SharedFunctionInfo;
+
+namespace interpreter {
+
+// Approximates per-function bytecode histograms and dispatch transition counts
+// without instrumenting the bytecode handlers, so that it works in release
+// builds (see --sample-ignition-dispatches). Exact counts are only available
+// with v8_enable_ignition_dispatch_counting.
+//
+// A sample is taken on every bytecode budget interrupt. The budget is consumed
+// proportionally to the amount of bytecode executed, so the interrupts form a
+// cheap sampling clock. When the sample is taken at a JumpLoop the loop body
+// is attributed to the sample, otherwise the function up to the sampled
+// bytecode is. Bytecodes inside the attributed region are counted in linear
+// order, i.e. branches within the region are not followed.
+class V8_EXPORT_PRIVATE BytecodeDispatchSampler final {
+ public:
+  explicit BytecodeDispatchSampler(Isolate* isolate) : isolate_(isolate) {}
+  BytecodeDispatchSampler(const BytecodeDispatchSampler&) = delete;
+  BytecodeDispatchSampler& operator=(const BytecodeDispatchSampler&) = delete;
+
+  // Samples the unoptimized frame on top of the JavaScript stack, if any.
+  void SampleTopFrame();
+
+  // Attributes one sample taken at |bytecode_offset| in |bytecode_array| to
+  // |shared|.
+  void Sample(Handle<SharedFunctionInfo> shared,
+              Handle<BytecodeArray> bytecode_array, int bytecode_offset);
+
+  // Returns the samples as an object of the form
+  //   { dispatches: { <from>: { <to>: count } },
+  //     functions: [ { name, scriptId, position, samples,
+  //                    bytecodes: { <bytecode>: count },
+  //                    dispatches: { <from>: { <to>: count } } } ] }
+  // where the top-level dispatches table uses the format of
+  // Interpreter::GetDispatchCountersObject() and aggregates all functions.
+  Handle<JSObject> GetSamplesObject();
+
+  size_t sample_count() const { return sample_count_; }
+
+ private:
+  struct FunctionProfile {
+    std::string name;
+    int script_id = 0;
+    int start_position = 0;
+    uint64_t samples = 0;
+    uint64_t bytecode_counts[Bytecodes::kBytecodeCount] = {};
+    // Keyed by DispatchKey(from, to).
+    std::unordered_map<uint32_t, uint64_t> dispatch_counts;
+  };
+
+  static uint32_t DispatchKey(Bytecode from, Bytecode to) {
+    return Bytecodes::ToByte(from) * Bytecodes::kBytecodeCount +
+           Bytecodes::ToByte(to);
+  }
+
+  FunctionProfile& ProfileFor(SharedFunctionInfo shared);
+  Handle<JSObject> NewDispatchesObject(
+      const std::unordered_map<uint32_t, uint64_t>& dispatch_counts);
+
+  Isolate* isolate_;
+  size_t sample_count_ = 0;
+  // Keyed by script id and start position, which unlike the
+  // SharedFunctionInfo do not move and survive bytecode flushing.
+  std::map<std::pair<int, int>, FunctionProfile> profiles_;
+};
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INTERPRETER_BYTECODE_DISPATCH_SAMPLER_H_
@@ -2931,17 +2931,19 @@ void BytecodeGenerator::BuildInstanceMemberInitialization(Register constructor,
   FeedbackSlot slot = feedback_spec()->AddLoadICSlot();
   BytecodeLabel done;
 
+  builder()->LoadClassFieldsInitializer(constructor, feedback_index(slot));
+  // Class constructors only get here when the parser found instance members,
+  // in which case the class definition always installs the initializer. Only
+  // arrow functions and eval inside a derived constructor can reach this for
+  // a class without one, so only they need to check for undefined.
+  bool initializer_may_be_missing = !IsClassConstructor(function_kind());
+  if (initializer_may_be_missing) builder()->JumpIfUndefined(&done);
   builder()
-      ->LoadClassFieldsInitializer(constructor, feedback_index(slot))
-      // TODO(gsathya): This jump can be elided for the base
-      // constructor and derived constructor. This is only required
-      // when called from an arrow function.
-      .JumpIfUndefined(&done)
-      .StoreAccumulatorInRegister(initializer)
+      ->StoreAccumulatorInRegister(initializer)
       .MoveRegister(instance, args[0])
       .CallProperty(initializer, args,
-                    feedback_index(feedback_spec()->AddCallICSlot()))
-      .Bind(&done);
+                    feedback_index(feedback_spec()->AddCallICSlot()));
+  if (initializer_may_be_missing) builder()->Bind(&done);
 }
 
 void BytecodeGenerator::VisitNativeFunctionLiteral(
@@ -1219,19 +1219,73 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::TestJumpDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  // Only the single-byte operand forms are inlined; wide jumps start with a
+  // prefix bytecode and take the regular dispatch.
+  GotoIf(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue, TrueConstant());
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse, FalseConstant());
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode,
+                                               TNode<Oddball> condition) {
+  DCHECK(Bytecodes::IsTestJumpLookahead(bytecode_, operand_scale_));
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  // The test has already advanced to the jump, so from here on we generate
+  // exactly the code of the jump's own handler.
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  // All lookahead tests produce a boolean, which is what the JumpIfTrue and
+  // JumpIfFalse handlers require.
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  JumpIfTaggedEqual(accumulator, condition, 0);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
   TNode<IntPtrT> target_offset = Advance();
   TNode<WordT> target_bytecode = LoadBytecode(target_offset);
-  DispatchToBytecodeWithOptionalStarLookahead(target_bytecode);
+  DispatchToBytecodeWithOptionalLookahead(target_bytecode);
 }
 
-void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
+void InterpreterAssembler::DispatchToBytecodeWithOptionalLookahead(
     TNode<WordT> target_bytecode) {
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
   }
+  if (Bytecodes::IsTestJumpLookahead(bytecode_, operand_scale_)) {
+    TestJumpDispatchLookahead(target_bytecode);
+  }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
 
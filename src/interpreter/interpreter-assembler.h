@@ -250,9 +250,9 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
 
   // Dispatches to |target_bytecode| at BytecodeOffset(). Includes short-star
   // lookahead if the current bytecode_ is likely followed by a short-star
-  // instruction.
-  void DispatchToBytecodeWithOptionalStarLookahead(
-      TNode<WordT> target_bytecode);
+  // instruction, and conditional jump lookahead if it is a test that is likely
+  // followed by a JumpIfTrue or JumpIfFalse.
+  void DispatchToBytecodeWithOptionalLookahead(TNode<WordT> target_bytecode);
 
   // Abort with the given abort reason.
   void Abort(AbortReason abort_reason);
@@ -403,6 +403,16 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue or JumpIfFalse and inline it in a branch,
+  // including the dispatch to the jump target or the following instruction.
+  // Anything after this point can assume that the following instruction was
+  // neither of those jumps.
+  void TestJumpDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for the boolean conditional jump |jump_bytecode| at the next
+  // dispatch offset, which jumps if the accumulator is |condition|.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode, TNode<Oddball> condition);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -13,10 +13,13 @@
 #include "src/codegen/compiler.h"
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/globals.h"
+#include "src/compiler/bytecode-analysis.h"
 #include "src/execution/local-isolate.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/setup-isolate.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/interpreter/bytecode-dispatch-sampler.h"
 #include "src/interpreter/bytecode-generator.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -74,8 +77,13 @@ Interpreter::Interpreter(Isolate* isolate)
   if (V8_IGNITION_DISPATCH_COUNTING_BOOL) {
     InitDispatchCounters();
   }
+  if (FLAG_sample_ignition_dispatches) {
+    dispatch_sampler_ = std::make_unique<BytecodeDispatchSampler>(isolate);
+  }
 }
 
+Interpreter::~Interpreter() = default;
+
 void Interpreter::InitDispatchCounters() {
   static const int kBytecodeCount = static_cast<int>(Bytecode::kLast) + 1;
   bytecode_dispatch_counters_table_.reset(
@@ -209,6 +217,85 @@ InterpreterCompilationJob::Status InterpreterCompilationJob::ExecuteJobImpl() {
   return SUCCEEDED;
 }
 
+namespace {
+
+void WriteRegisterCountOperand(Address operand_start, OperandSize size,
+                               uint32_t value) {
+  switch (size) {
+    case OperandSize::kByte:
+      DCHECK_LE(value, kMaxUInt8);
+      base::WriteUnalignedValue<uint8_t>(operand_start,
+                                         static_cast<uint8_t>(value));
+      break;
+    case OperandSize::kShort:
+      DCHECK_LE(value, kMaxUInt16);
+      base::WriteUnalignedValue<uint16_t>(operand_start,
+                                          static_cast<uint16_t>(value));
+      break;
+    case OperandSize::kQuad:
+      base::WriteUnalignedValue<uint32_t>(operand_start, value);
+      break;
+    case OperandSize::kNone:
+      UNREACHABLE();
+  }
+}
+
+// The bytecode generator saves every allocated register at each suspend
+// point. Use liveness to shrink the register list of each SuspendGenerator /
+// ResumeGenerator pair to the registers that are live once the generator is
+// resumed. The register count is rewritten in place; a smaller value always
+// fits the operand width that was originally emitted.
+void TrimGeneratorRegisterLists(Handle<BytecodeArray> bytecodes,
+                                AccountingAllocator* allocator) {
+  Zone zone(allocator, ZONE_NAME);
+  compiler::BytecodeAnalysis analysis(bytecodes, &zone, BytecodeOffset::None(),
+                                      true);
+  Address bytecode_start = bytecodes->GetFirstBytecodeAddress();
+  int suspend_operand_offset = -1;
+  OperandSize suspend_operand_size = OperandSize::kNone;
+  for (BytecodeArrayIterator it(bytecodes); !it.done(); it.Advance()) {
+    Bytecode bytecode = it.current_bytecode();
+    int prefix_size =
+        it.current_operand_scale() == OperandScale::kSingle ? 0 : 1;
+    int operand_offset =
+        it.current_offset() + prefix_size +
+        Bytecodes::GetOperandOffset(bytecode, 2, it.current_operand_scale());
+    OperandSize operand_size =
+        Bytecodes::GetOperandSize(bytecode, 2, it.current_operand_scale());
+    if (bytecode == Bytecode::kSuspendGenerator) {
+      suspend_operand_offset = operand_offset;
+      suspend_operand_size = operand_size;
+      continue;
+    }
+    if (bytecode != Bytecode::kResumeGenerator) {
+      suspend_operand_offset = -1;
+      continue;
+    }
+    // Suspend and resume are always emitted back to back and share a
+    // register list starting at r0; anything else is left untouched.
+    if (suspend_operand_offset < 0) continue;
+    DCHECK_EQ(0, it.GetRegisterOperand(1).index());
+    int register_count = static_cast<int>(it.GetRegisterCountOperand(2));
+    const compiler::BytecodeLivenessState* liveness =
+        analysis.GetOutLivenessFor(it.current_offset());
+    int live_count = register_count;
+    while (live_count > 0 && !liveness->RegisterIsLive(live_count - 1)) {
+      live_count--;
+    }
+    if (live_count < register_count) {
+      // The suspend id may have widened the suspend's operand scale, so each
+      // operand is written with its own size.
+      WriteRegisterCountOperand(bytecode_start + suspend_operand_offset,
+                                suspend_operand_size, live_count);
+      WriteRegisterCountOperand(bytecode_start + operand_offset, operand_size,
+                                live_count);
+    }
+    suspend_operand_offset = -1;
+  }
+}
+
+}  // namespace
+
 #ifdef DEBUG
 template <typename IsolateT>
 void InterpreterCompilationJob::CheckAndPrintBytecodeMismatch(
@@ -275,6 +362,10 @@ InterpreterCompilationJob::Status InterpreterCompilationJob::DoFinalizeJobImpl(
     if (generator()->HasStackOverflow()) {
       return FAILED;
     }
+    if (FLAG_ignition_trim_generator_registers &&
+        IsResumableFunction(compilation_info()->literal()->kind())) {
+      TrimGeneratorRegisterLists(bytecodes, zone_.allocator());
+    }
     compilation_info()->SetBytecodeArray(bytecodes);
   }
 
@@ -297,8 +388,14 @@ InterpreterCompilationJob::Status InterpreterCompilationJob::DoFinalizeJobImpl(
   }
 
 #ifdef DEBUG
-  CheckAndPrintBytecodeMismatch(
-      isolate, handle(Script::cast(shared_info->script()), isolate), bytecodes);
+  // Trimmed register lists are patched into the final bytecode only, so they
+  // can't be compared against the generator's output.
+  if (!FLAG_ignition_trim_generator_registers ||
+      !IsResumableFunction(compilation_info()->literal()->kind())) {
+    CheckAndPrintBytecodeMismatch(
+        isolate, handle(Script::cast(shared_info->script()), isolate),
+        bytecodes);
+  }
 #endif
 
   return SUCCEEDED;
@@ -33,12 +33,13 @@ class ZoneVector;
 
 namespace interpreter {
 
+class BytecodeDispatchSampler;
 class InterpreterAssembler;
 
 class Interpreter {
  public:
   explicit Interpreter(Isolate* isolate);
-  virtual ~Interpreter() = default;
+  virtual ~Interpreter();
   Interpreter(const Interpreter&) = delete;
   Interpreter& operator=(const Interpreter&) = delete;
 
@@ -74,6 +75,11 @@ class Interpreter {
 
   V8_EXPORT_PRIVATE Handle<JSObject> GetDispatchCountersObject();
 
+  // Non-null if --sample-ignition-dispatches is enabled.
+  BytecodeDispatchSampler* dispatch_sampler() const {
+    return dispatch_sampler_.get();
+  }
+
   void ForEachBytecode(const std::function<void(Bytecode, OperandScale)>& f);
 
   void Initialize();
@@ -113,6 +119,7 @@ class Interpreter {
   Isolate* isolate_;
   Address dispatch_table_[kDispatchTableSize];
   std::unique_ptr<uintptr_t[]> bytecode_dispatch_counters_table_;
+  std::unique_ptr<BytecodeDispatchSampler> dispatch_sampler_;
   Address interpreter_entry_trampoline_instruction_start_;
 };
 
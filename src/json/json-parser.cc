@@ -4,6 +4,11 @@
 
 #include "src/json/json-parser.h"
 
+#include <algorithm>
+#include <memory>
+
+#include "include/v8-primitive.h"
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -1127,6 +1132,15 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if (sizeof(Char) == 1) {
+      // Skip over plain characters a word at a time. Two-byte input also has
+      // to track the characters outside of Latin-1, so it takes the slow path.
+      while (end_ - cursor_ >= static_cast<ptrdiff_t>(sizeof(uint64_t)) &&
+             !HasJsonSpecialCharacter(base::ReadUnalignedValue<uint64_t>(
+                 reinterpret_cast<Address>(cursor_)))) {
+        cursor_ += sizeof(uint64_t);
+      }
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -1209,5 +1223,56 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
 
+namespace {
+
+class JsonChunkedSourceResource final
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit JsonChunkedSourceResource(std::vector<char> chars)
+      : chars_(std::move(chars)) {}
+
+  const char* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<char> chars_;
+};
+
+}  // namespace
+
+void JsonChunkedSource::Append(const char* data, size_t length) {
+  // Check the chunk in pieces, String::IsAscii() takes an int length.
+  for (size_t checked = 0; is_ascii_ && checked < length;) {
+    int piece = static_cast<int>(std::min<size_t>(length - checked, kMaxInt));
+    is_ascii_ = String::IsAscii(data + checked, piece);
+    checked += piece;
+  }
+  chars_.insert(chars_.end(), data, data + length);
+}
+
+MaybeHandle<String> JsonChunkedSource::Finish(Isolate* isolate) {
+  std::vector<char> chars = std::move(chars_);
+  chars_.clear();
+  bool is_ascii = is_ascii_;
+  is_ascii_ = true;
+  if (chars.size() > static_cast<size_t>(String::kMaxLength)) {
+    THROW_NEW_ERROR(isolate, NewInvalidStringLengthError(), String);
+  }
+  if (!is_ascii || chars.size() < kMinExternalLength) {
+    return isolate->factory()->NewStringFromUtf8(
+        base::Vector<const char>(chars.data(), chars.size()));
+  }
+  auto resource =
+      std::make_unique<JsonChunkedSourceResource>(std::move(chars));
+  Handle<String> result;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, result,
+      isolate->factory()->NewExternalStringFromOneByte(resource.get()),
+      String);
+  // The string owns the resource now and disposes it when it dies.
+  resource.release();
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
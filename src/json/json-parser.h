@@ -5,6 +5,8 @@
 #ifndef V8_JSON_JSON_PARSER_H_
 #define V8_JSON_JSON_PARSER_H_
 
+#include <vector>
+
 #include "include/v8-callbacks.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
@@ -361,6 +363,30 @@ class JsonParser final {
 extern template class JsonParser<uint8_t>;
 extern template class JsonParser<uint16_t>;
 
+// Collects UTF-8 encoded JSON text that arrives in chunks, for
+// v8::JSON::StreamingParser. Appending does not touch the heap, so it can
+// happen on any thread while the input is still being received. Large input
+// that is all ASCII becomes an external string that takes over the buffer,
+// so it is held in memory only once while it is parsed.
+class V8_EXPORT_PRIVATE JsonChunkedSource final {
+ public:
+  // ASCII input shorter than this is copied into the heap instead.
+  static constexpr size_t kMinExternalLength = 64 * KB;
+
+  JsonChunkedSource() = default;
+  JsonChunkedSource(const JsonChunkedSource&) = delete;
+  JsonChunkedSource& operator=(const JsonChunkedSource&) = delete;
+
+  void Append(const char* data, size_t length);
+
+  // Returns the collected input as a string and leaves the source empty.
+  MaybeHandle<String> Finish(Isolate* isolate);
+
+ private:
+  std::vector<char> chars_;
+  bool is_ascii_ = true;
+};
+
 }  // namespace internal
 }  // namespace v8
 
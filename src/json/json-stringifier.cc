@@ -4,6 +4,7 @@
 
 #include "src/json/json-stringifier.h"
 
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
@@ -14,6 +15,7 @@
 #include "src/objects/oddball-inl.h"
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
+#include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-builder-inl.h"
 #include "src/utils/utils.h"
 
@@ -938,6 +940,20 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    if (sizeof(SrcChar) == 1) {
+      // Copy runs of characters that need no escaping a word at a time.
+      int run = i;
+      while (src.length() - run >= static_cast<int>(sizeof(uint64_t)) &&
+             !HasJsonSpecialCharacter(base::ReadUnalignedValue<uint64_t>(
+                 reinterpret_cast<Address>(src.begin() + run)))) {
+        run += sizeof(uint64_t);
+      }
+      if (run > i) {
+        dest->AppendChars(src.begin() + i, run - i);
+        i = run;
+        if (i == src.length()) break;
+      }
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
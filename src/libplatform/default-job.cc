@@ -14,6 +14,10 @@ namespace {
 // Capped to allow assigning task_ids from a bitfield.
 constexpr size_t kMaxWorkersPerJob = 32;
 
+// Number of workers that currently run jobs with a priority above
+// kBestEffort, across all jobs in the process.
+std::atomic<size_t> g_higher_priority_workers{0};
+
 }  // namespace
 
 DefaultJobState::JobDelegate::~JobDelegate() {
@@ -37,7 +41,7 @@ DefaultJobState::DefaultJobState(Platform* platform,
       priority_(priority),
       num_worker_threads_(std::min(num_worker_threads, kMaxWorkersPerJob)) {}
 
-DefaultJobState::~DefaultJobState() { DCHECK_EQ(0U, active_workers_); }
+DefaultJobState::~DefaultJobState() { DCHECK_EQ(0U, active_workers_.load()); }
 
 void DefaultJobState::NotifyConcurrencyIncrease() {
   if (is_canceled_.load(std::memory_order_relaxed)) return;
@@ -96,12 +100,12 @@ void DefaultJobState::Join() {
   bool can_run = false;
   {
     base::MutexGuard guard(&mutex_);
-    priority_ = TaskPriority::kUserBlocking;
+    SetPriorityLockRequired(TaskPriority::kUserBlocking);
     // Reserve a worker for the joining thread. GetMaxConcurrency() is ignored
     // here, but WaitForParticipationOpportunityLockRequired() waits for
     // workers to return if necessary so we don't exceed GetMaxConcurrency().
     num_worker_threads_ = platform_->NumberOfWorkerThreads() + 1;
-    ++active_workers_;
+    AddActiveWorkerLockRequired();
     can_run = WaitForParticipationOpportunityLockRequired();
   }
   DefaultJobState::JobDelegate delegate(this, true);
@@ -136,12 +140,9 @@ bool DefaultJobState::CanRunFirstTask() {
   base::MutexGuard guard(&mutex_);
   --pending_tasks_;
   if (is_canceled_.load(std::memory_order_relaxed)) return false;
-  if (active_workers_ >= std::min(job_task_->GetMaxConcurrency(active_workers_),
-                                  num_worker_threads_)) {
-    return false;
-  }
+  if (active_workers_ >= CappedMaxConcurrency(active_workers_)) return false;
   // Acquire current worker.
-  ++active_workers_;
+  AddActiveWorkerLockRequired();
   return true;
 }
 
@@ -154,7 +155,7 @@ bool DefaultJobState::DidRunTask() {
     if (is_canceled_.load(std::memory_order_relaxed) ||
         active_workers_ > max_concurrency) {
       // Release current worker and notify.
-      --active_workers_;
+      RemoveActiveWorkerLockRequired();
       worker_released_condition_.NotifyOne();
       return false;
     }
@@ -184,16 +185,64 @@ bool DefaultJobState::WaitForParticipationOpportunityLockRequired() {
     max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
   }
   if (active_workers_ <= max_concurrency) return true;
-  DCHECK_EQ(1U, active_workers_);
+  DCHECK_EQ(1U, active_workers_.load());
   DCHECK_EQ(0U, max_concurrency);
-  active_workers_ = 0;
+  RemoveActiveWorkerLockRequired();
   is_canceled_.store(true, std::memory_order_relaxed);
   return false;
 }
 
 size_t DefaultJobState::CappedMaxConcurrency(size_t worker_count) const {
-  return std::min(job_task_->GetMaxConcurrency(worker_count),
-                  num_worker_threads_);
+  size_t max_concurrency = std::min(job_task_->GetMaxConcurrency(worker_count),
+                                    num_worker_threads_);
+  if (priority_.load(std::memory_order_relaxed) == TaskPriority::kBestEffort) {
+    max_concurrency = std::min(max_concurrency, BestEffortWorkerBudget());
+  }
+  return max_concurrency;
+}
+
+size_t DefaultJobState::BestEffortWorkerBudget() const {
+  size_t num_threads = static_cast<size_t>(platform_->NumberOfWorkerThreads());
+  size_t busy = g_higher_priority_workers.load(std::memory_order_relaxed);
+  return busy < num_threads ? num_threads - busy : 1;
+}
+
+bool DefaultJobState::ShouldYield() const {
+  if (is_canceled_.load(std::memory_order_relaxed)) return true;
+  if (priority_.load(std::memory_order_relaxed) != TaskPriority::kBestEffort) {
+    return false;
+  }
+  // The workers above the budget return; DidRunTask() lets the others go on.
+  return active_workers_.load(std::memory_order_relaxed) >
+         BestEffortWorkerBudget();
+}
+
+void DefaultJobState::AddActiveWorkerLockRequired() {
+  ++active_workers_;
+  if (priority_ != TaskPriority::kBestEffort) {
+    g_higher_priority_workers.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void DefaultJobState::RemoveActiveWorkerLockRequired() {
+  DCHECK_LT(0U, active_workers_.load());
+  --active_workers_;
+  if (priority_ != TaskPriority::kBestEffort) {
+    g_higher_priority_workers.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+void DefaultJobState::SetPriorityLockRequired(TaskPriority priority) {
+  bool was_best_effort = priority_ == TaskPriority::kBestEffort;
+  bool is_best_effort = priority == TaskPriority::kBestEffort;
+  if (was_best_effort && !is_best_effort) {
+    g_higher_priority_workers.fetch_add(active_workers_,
+                                        std::memory_order_relaxed);
+  } else if (!was_best_effort && is_best_effort) {
+    g_higher_priority_workers.fetch_sub(active_workers_,
+                                        std::memory_order_relaxed);
+  }
+  priority_ = priority;
 }
 
 void DefaultJobState::CallOnWorkerThread(TaskPriority priority,
@@ -210,7 +259,7 @@ void DefaultJobState::CallOnWorkerThread(TaskPriority priority,
 
 void DefaultJobState::UpdatePriority(TaskPriority priority) {
   base::MutexGuard guard(&mutex_);
-  priority_ = priority;
+  SetPriorityLockRequired(priority);
 }
 
 DefaultJobHandle::DefaultJobHandle(std::shared_ptr<DefaultJobState> state)
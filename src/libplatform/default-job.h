@@ -30,7 +30,7 @@ class V8_PLATFORM_EXPORT DefaultJobState
     }
     bool ShouldYield() override {
       // Thread-safe but may return an outdated result.
-      return outer_->is_canceled_.load(std::memory_order_relaxed);
+      return outer_->ShouldYield();
     }
     uint8_t GetTaskId() override;
     bool IsJoiningThread() const override { return is_joining_thread_; }
@@ -67,6 +67,10 @@ class V8_PLATFORM_EXPORT DefaultJobState
 
   void UpdatePriority(TaskPriority);
 
+  // Returns true if the job is canceled, or if it is a best-effort job that
+  // runs on more workers than are left over by jobs of higher priority.
+  bool ShouldYield() const;
+
  private:
   // Called from the joining thread. Waits for the worker count to be below or
   // equal to max concurrency (will happen when a worker calls
@@ -76,19 +80,31 @@ class V8_PLATFORM_EXPORT DefaultJobState
   bool WaitForParticipationOpportunityLockRequired();
 
   // Returns GetMaxConcurrency() capped by the number of threads used by this
-  // job.
+  // job and, for best-effort jobs, by BestEffortWorkerBudget().
   size_t CappedMaxConcurrency(size_t worker_count) const;
 
+  // Returns the number of worker threads that are not busy with jobs of
+  // higher priority than kBestEffort, but at least 1 so that best-effort jobs
+  // still make progress.
+  size_t BestEffortWorkerBudget() const;
+
+  // Update |active_workers_| and |priority_| while keeping the process-wide
+  // count of workers running higher priority jobs in sync.
+  void AddActiveWorkerLockRequired();
+  void RemoveActiveWorkerLockRequired();
+  void SetPriorityLockRequired(TaskPriority priority);
+
   void CallOnWorkerThread(TaskPriority priority, std::unique_ptr<Task> task);
 
   Platform* const platform_;
   std::unique_ptr<JobTask> job_task_;
 
-  // All members below are protected by |mutex_|.
+  // All members below are protected by |mutex_|. |priority_| and
+  // |active_workers_| may additionally be read without it by ShouldYield().
   base::Mutex mutex_;
-  TaskPriority priority_;
+  std::atomic<TaskPriority> priority_;
   // Number of workers running this job.
-  size_t active_workers_ = 0;
+  std::atomic<size_t> active_workers_{0};
   // Number of posted tasks that aren't running this job yet.
   size_t pending_tasks_ = 0;
   // Indicates if the job is canceled.
@@ -46,13 +46,15 @@ int GetActualThreadPoolSize(int thread_pool_size) {
 std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     InProcessStackDumping in_process_stack_dumping,
-    std::unique_ptr<v8::TracingController> tracing_controller) {
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    PriorityMode priority_mode) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   thread_pool_size = GetActualThreadPoolSize(thread_pool_size);
   auto platform = std::make_unique<DefaultPlatform>(
-      thread_pool_size, idle_task_support, std::move(tracing_controller));
+      thread_pool_size, idle_task_support, std::move(tracing_controller),
+      priority_mode);
   return platform;
 }
 
@@ -93,9 +95,11 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
 
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
-    std::unique_ptr<v8::TracingController> tracing_controller)
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    PriorityMode priority_mode)
     : thread_pool_size_(thread_pool_size),
       idle_task_support_(idle_task_support),
+      priority_mode_(priority_mode),
       tracing_controller_(std::move(tracing_controller)),
       page_allocator_(std::make_unique<v8::base::PageAllocator>()) {
   if (!tracing_controller_) {
@@ -112,7 +116,16 @@ DefaultPlatform::DefaultPlatform(
 
 DefaultPlatform::~DefaultPlatform() {
   base::MutexGuard guard(&lock_);
-  if (worker_threads_task_runner_) worker_threads_task_runner_->Terminate();
+  if (worker_threads_task_runners_[0]) {
+    if (priority_mode_ == PriorityMode::kApply) {
+      for (const auto& runner : worker_threads_task_runners_) {
+        runner->Terminate();
+      }
+    } else {
+      // All priorities share one runner.
+      worker_threads_task_runners_[0]->Terminate();
+    }
+  }
   for (const auto& it : foreground_task_runner_map_) {
     it.second->Terminate();
   }
@@ -125,16 +138,53 @@ double DefaultTimeFunction() {
          static_cast<double>(base::Time::kMicrosecondsPerSecond);
 }
 
+base::Thread::Priority ThreadPriority(TaskPriority priority) {
+  switch (priority) {
+    case TaskPriority::kBestEffort:
+      return base::Thread::Priority::kBestEffort;
+    case TaskPriority::kUserVisible:
+      return base::Thread::Priority::kUserVisible;
+    case TaskPriority::kUserBlocking:
+      return base::Thread::Priority::kUserBlocking;
+  }
+  UNREACHABLE();
+}
+
 }  // namespace
 
 void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
-  DCHECK_NULL(worker_threads_task_runner_);
-  worker_threads_task_runner_ =
-      std::make_shared<DefaultWorkerThreadsTaskRunner>(
-          thread_pool_size_, time_function_for_testing_
-                                 ? time_function_for_testing_
-                                 : DefaultTimeFunction);
-  DCHECK_NOT_NULL(worker_threads_task_runner_);
+  DCHECK_NULL(worker_threads_task_runners_[0]);
+  TimeFunction time_function = time_function_for_testing_
+                                   ? time_function_for_testing_
+                                   : DefaultTimeFunction;
+  if (priority_mode_ == PriorityMode::kApply) {
+    for (int i = 0; i < kNumPriorities; ++i) {
+      worker_threads_task_runners_[i] =
+          std::make_shared<DefaultWorkerThreadsTaskRunner>(
+              thread_pool_size_, time_function,
+              ThreadPriority(static_cast<TaskPriority>(i)));
+    }
+  } else {
+    auto runner = std::make_shared<DefaultWorkerThreadsTaskRunner>(
+        thread_pool_size_, time_function);
+    for (int i = 0; i < kNumPriorities; ++i) {
+      worker_threads_task_runners_[i] = runner;
+    }
+  }
+  DCHECK_NOT_NULL(worker_threads_task_runners_[0]);
+}
+
+DefaultWorkerThreadsTaskRunner* DefaultPlatform::worker_threads_task_runner(
+    TaskPriority priority) const {
+  // If this DCHECK fires, then this means that either
+  // - V8 is running without the --single-threaded flag but
+  //   but the platform was created as a single-threaded platform.
+  // - or some component in V8 is ignoring --single-threaded
+  //   and posting a background task.
+  DefaultWorkerThreadsTaskRunner* runner =
+      worker_threads_task_runners_[static_cast<int>(priority)].get();
+  DCHECK_NOT_NULL(runner);
+  return runner;
 }
 
 void DefaultPlatform::SetTimeFunctionForTesting(
@@ -202,25 +252,26 @@ std::shared_ptr<TaskRunner> DefaultPlatform::GetForegroundTaskRunner(
 }
 
 void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
-  // If this DCHECK fires, then this means that either
-  // - V8 is running without the --single-threaded flag but
-  //   but the platform was created as a single-threaded platform.
-  // - or some component in V8 is ignoring --single-threaded
-  //   and posting a background task.
-  DCHECK_NOT_NULL(worker_threads_task_runner_);
-  worker_threads_task_runner_->PostTask(std::move(task));
+  worker_threads_task_runner(TaskPriority::kUserVisible)
+      ->PostTask(std::move(task));
+}
+
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  worker_threads_task_runner(TaskPriority::kUserBlocking)
+      ->PostTask(std::move(task));
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  worker_threads_task_runner(TaskPriority::kBestEffort)
+      ->PostTask(std::move(task));
 }
 
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                                 double delay_in_seconds) {
-  // If this DCHECK fires, then this means that either
-  // - V8 is running without the --single-threaded flag but
-  //   but the platform was created as a single-threaded platform.
-  // - or some component in V8 is ignoring --single-threaded
-  //   and posting a background task.
-  DCHECK_NOT_NULL(worker_threads_task_runner_);
-  worker_threads_task_runner_->PostDelayedTask(std::move(task),
-                                               delay_in_seconds);
+  worker_threads_task_runner(TaskPriority::kUserVisible)
+      ->PostDelayedTask(std::move(task), delay_in_seconds);
 }
 
 bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) {
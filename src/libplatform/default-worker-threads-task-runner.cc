@@ -10,10 +10,11 @@ namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
-    uint32_t thread_pool_size, TimeFunction time_function)
+    uint32_t thread_pool_size, TimeFunction time_function,
+    base::Thread::Priority priority)
     : queue_(time_function), time_function_(time_function) {
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, priority));
   }
 }
 
@@ -24,23 +25,19 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 }
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
-  base::MutexGuard guard(&lock_);
-  terminated_ = true;
   queue_.Terminate();
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
+  // The queue has its own lock and drops tasks posted after termination, so
+  // posting takes a single lock.
   queue_.Append(std::move(task));
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
   queue_.AppendDelayed(std::move(task), delay_in_seconds);
 }
 
@@ -60,8 +57,9 @@ std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
-    : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
+    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
+    : Thread(
+          Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread", priority)),
       runner_(runner) {
   CHECK(Start());
 }
@@ -22,8 +22,9 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  public:
   using TimeFunction = double (*)();
 
-  DefaultWorkerThreadsTaskRunner(uint32_t thread_pool_size,
-                                 TimeFunction time_function);
+  DefaultWorkerThreadsTaskRunner(
+      uint32_t thread_pool_size, TimeFunction time_function,
+      base::Thread::Priority priority = base::Thread::Priority::kDefault);
 
   ~DefaultWorkerThreadsTaskRunner() override;
 
@@ -44,7 +45,8 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  private:
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner,
+                 base::Thread::Priority priority);
     ~WorkerThread() override;
 
     WorkerThread(const WorkerThread&) = delete;
@@ -61,8 +63,6 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   // executed. Blocks if no task is available.
   std::unique_ptr<Task> GetNext();
 
-  bool terminated_ = false;
-  base::Mutex lock_;
   DelayedTaskQueue queue_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   TimeFunction time_function_;
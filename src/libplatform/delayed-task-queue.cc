@@ -4,6 +4,8 @@
 
 #include "src/libplatform/delayed-task-queue.h"
 
+#include <cmath>
+
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
 #include "src/base/platform/time.h"
@@ -11,8 +13,11 @@
 namespace v8 {
 namespace platform {
 
-DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function)
-    : time_function_(time_function) {}
+DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function,
+                                   double slack_in_seconds)
+    : time_function_(time_function), slack_in_seconds_(slack_in_seconds) {
+  DCHECK_GE(slack_in_seconds, 0.0);
+}
 
 DelayedTaskQueue::~DelayedTaskQueue() {
   base::MutexGuard guard(&lock_);
@@ -25,9 +30,13 @@ double DelayedTaskQueue::MonotonicallyIncreasingTime() {
 }
 
 void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+  {
+    base::MutexGuard guard(&lock_);
+    if (terminated_) return;
+    task_queue_.push(std::move(task));
+  }
+  // Notify after releasing the lock so that the woken thread does not
+  // immediately block on it again.
   queues_condition_var_.NotifyOne();
 }
 
@@ -37,21 +46,25 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
   {
     base::MutexGuard guard(&lock_);
-    DCHECK(!terminated_);
+    if (terminated_) return;
     delayed_task_queue_.emplace(deadline, std::move(task));
-    queues_condition_var_.NotifyOne();
   }
+  queues_condition_var_.NotifyOne();
 }
 
 std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   base::MutexGuard guard(&lock_);
   for (;;) {
-    // Move delayed tasks that have hit their deadline to the main queue.
-    double now = MonotonicallyIncreasingTime();
-    std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
-    while (task) {
-      task_queue_.push(std::move(task));
-      task = PopTaskFromDelayedQueue(now);
+    // Move delayed tasks that have hit their deadline to the main queue. Most
+    // tasks are not delayed, so avoid querying the clock when there are none.
+    double now = 0;
+    if (!delayed_task_queue_.empty()) {
+      now = MonotonicallyIncreasingTime();
+      std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
+      while (task) {
+        task_queue_.push(std::move(task));
+        task = PopTaskFromDelayedQueue(now);
+      }
     }
     if (!task_queue_.empty()) {
       std::unique_ptr<Task> result = std::move(task_queue_.front());
@@ -65,8 +78,14 @@ std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
     }
 
     if (task_queue_.empty() && !delayed_task_queue_.empty()) {
-      // Wait for the next delayed task or a newly posted task.
-      double wait_in_seconds = delayed_task_queue_.begin()->first - now;
+      // Wait for the next delayed task or a newly posted task. Round the
+      // deadline up to a multiple of the slack, so that delayed tasks with
+      // nearby deadlines are run after a single wakeup.
+      double deadline = delayed_task_queue_.begin()->first;
+      if (slack_in_seconds_ > 0) {
+        deadline = std::ceil(deadline / slack_in_seconds_) * slack_in_seconds_;
+      }
+      double wait_in_seconds = deadline - now;
       base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
           base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds);
 
@@ -27,7 +27,14 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
  public:
   using TimeFunction = double (*)();
 
-  explicit DelayedTaskQueue(TimeFunction time_function);
+  // Delayed tasks may run up to |slack_in_seconds| after their deadline, so
+  // that tasks with nearby deadlines can share a wakeup. They are never run
+  // before their deadline.
+  static constexpr double kDefaultSlackInSeconds = 0.001;
+
+  explicit DelayedTaskQueue(
+      TimeFunction time_function,
+      double slack_in_seconds = kDefaultSlackInSeconds);
   ~DelayedTaskQueue();
 
   DelayedTaskQueue(const DelayedTaskQueue&) = delete;
@@ -36,7 +43,8 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   double MonotonicallyIncreasingTime();
 
   // Appends an immediate task to the queue. The queue takes ownership of
-  // |task|. Tasks appended via this method will be run in order. Thread-safe.
+  // |task|. Tasks appended via this method will be run in order. Tasks
+  // appended after Terminate() are dropped. Thread-safe.
   void Append(std::unique_ptr<Task> task);
 
   // Appends a delayed task to the queue. There is no ordering guarantee
@@ -62,6 +70,7 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
   bool terminated_ = false;
   TimeFunction time_function_;
+  const double slack_in_seconds_;
 };
 
 }  // namespace platform
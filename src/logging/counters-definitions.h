@@ -200,6 +200,9 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_total_time,                                                  \
      V8.TurboFanOptimizeForOnStackReplacementTotalTime, 10000000, MICROSECOND) \
+  /* Sparkplug timers. */                                                      \
+  HT(sparkplug_time_to_baseline, V8.SparkplugTimeToBaseline, 10000000,         \
+     MICROSECOND)                                                              \
   /* Wasm timers. */                                                           \
   HT(wasm_compile_asm_module_time, V8.WasmCompileModuleMicroSeconds.asm,       \
      10000000, MICROSECOND)                                                    \
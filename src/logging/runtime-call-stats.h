@@ -200,6 +200,7 @@ class RuntimeCallTimer final {
   V(Object_Get)                                            \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
+  V(Object_GetOwnPropertyValues)                           \
   V(Object_GetPropertyAttributes)                          \
   V(Object_GetPropertyNames)                               \
   V(Object_GetRealNamedProperty)                           \
@@ -349,6 +350,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LateOptimization)                \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoadElimination)                 \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LocateSpillSlots)                \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopBoundsCheckElimination)      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopExitElimination)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopPeeling)                     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MachineOperatorOptimization)     \
@@ -9,7 +9,9 @@
 #include "src/handles/maybe-handles-inl.h"
 #include "src/ic/handler-configuration.h"
 #include "src/objects/feedback-vector.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/name-inl.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/objects/slots-inl.h"
 
 namespace v8 {
@@ -26,6 +28,79 @@ namespace maglev {
     this_field_will_be_unused_once_all_bytecodes_are_supported_ = true; \
   }
 
+namespace {
+
+// Returns true if {nexus} holds monomorphic feedback for an own data field
+// load, which can be lowered to a map check plus a field load.
+bool GetMonomorphicFieldLoad(const FeedbackNexus& nexus, Handle<Map>* map,
+                             int* handler) {
+  if (nexus.ic_state() != InlineCacheState::MONOMORPHIC) return false;
+  std::vector<MapAndHandler> maps_and_handlers;
+  nexus.ExtractMapsAndHandlers(&maps_and_handlers);
+  DCHECK_EQ(maps_and_handlers.size(), 1);
+  MapAndHandler& map_and_handler = maps_and_handlers[0];
+  if (!map_and_handler.second->IsSmi()) return false;
+  int smi_handler = map_and_handler.second->ToSmi().value();
+  if (LoadHandler::KindBits::decode(smi_handler) != LoadHandler::Kind::kField ||
+      LoadHandler::IsWasmStructBits::decode(smi_handler)) {
+    return false;
+  }
+  *map = map_and_handler.first;
+  *handler = smi_handler;
+  return true;
+}
+
+}  // namespace
+
+bool MaglevGraphBuilder::TryInlineFieldAccessor(ValueNode* function,
+                                                ValueNode* receiver,
+                                                FeedbackSlot slot) {
+  // TODO(leszeks): Use JSHeapBroker here.
+  FeedbackNexus nexus(feedback().object() /* TODO(v8:7700) */, slot);
+  if (nexus.ic_state() != InlineCacheState::MONOMORPHIC) return false;
+  HeapObject target_object;
+  if (!nexus.GetFeedback()->GetHeapObjectIfWeak(&target_object) ||
+      !target_object.IsJSFunction()) {
+    return false;
+  }
+  Handle<JSFunction> target(JSFunction::cast(target_object), isolate());
+  SharedFunctionInfo shared = target->shared();
+  if (!shared.HasBytecodeArray() || shared.HasBreakInfo() ||
+      IsClassConstructor(shared.kind()) || !target->has_feedback_vector()) {
+    return false;
+  }
+
+  // Only `return this.field` is inlined: its only effect is a load that the
+  // map check guards, so any deopt can resume at the call in the caller's
+  // frame and no frame state for the callee is needed.
+  interpreter::BytecodeArrayIterator callee_iterator(
+      handle(shared.GetBytecodeArray(isolate()), isolate()));
+  if (callee_iterator.current_bytecode() !=
+          interpreter::Bytecode::kLdaNamedProperty ||
+      callee_iterator.GetRegisterOperand(0).index() !=
+          interpreter::Register::FromParameterIndex(0).index()) {
+    return false;
+  }
+  FeedbackSlot load_slot = callee_iterator.GetSlotOperand(2);
+  callee_iterator.Advance();
+  if (callee_iterator.done() ||
+      callee_iterator.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return false;
+  }
+
+  FeedbackNexus load_nexus(handle(target->feedback_vector(), isolate()),
+                           load_slot);
+  Handle<Map> map;
+  int handler;
+  if (!GetMonomorphicFieldLoad(load_nexus, &map, &handler)) return false;
+
+  EnsureCheckpoint();
+  AddNewNode<CheckFunction>({function}, MakeRef(broker(), target));
+  AddNewNode<CheckMaps>({receiver}, MakeRef(broker(), map));
+  SetAccumulator(AddNewNode<LoadField>({receiver}, handler));
+  return true;
+}
+
 void MaglevGraphBuilder::VisitLdar() { SetAccumulator(LoadRegister(0)); }
 
 void MaglevGraphBuilder::VisitLdaZero() {
@@ -111,23 +186,13 @@ void MaglevGraphBuilder::VisitLdaNamedProperty() {
     AddNewNode<SoftDeopt>({});
   }
 
-  if (nexus.ic_state() == InlineCacheState::MONOMORPHIC) {
-    std::vector<MapAndHandler> maps_and_handlers;
-    nexus.ExtractMapsAndHandlers(&maps_and_handlers);
-    DCHECK_EQ(maps_and_handlers.size(), 1);
-    MapAndHandler& map_and_handler = maps_and_handlers[0];
-    if (map_and_handler.second->IsSmi()) {
-      int handler = map_and_handler.second->ToSmi().value();
-      LoadHandler::Kind kind = LoadHandler::KindBits::decode(handler);
-      if (kind == LoadHandler::Kind::kField &&
-          !LoadHandler::IsWasmStructBits::decode(handler)) {
-        EnsureCheckpoint();
-        AddNewNode<CheckMaps>({object},
-                              MakeRef(broker(), map_and_handler.first));
-        SetAccumulator(AddNewNode<LoadField>({object}, handler));
-        return;
-      }
-    }
+  Handle<Map> map;
+  int handler;
+  if (GetMonomorphicFieldLoad(nexus, &map, &handler)) {
+    EnsureCheckpoint();
+    AddNewNode<CheckMaps>({object}, MakeRef(broker(), map));
+    SetAccumulator(AddNewNode<LoadField>({object}, handler));
+    return;
   }
 
   ValueNode* context = GetContext();
@@ -176,6 +241,15 @@ void MaglevGraphBuilder::VisitInc() {
   FeedbackSlot slot_index = GetSlotOperand(0);
   ValueNode* value = GetAccumulator();
 
+  // TODO(leszeks): Use JSHeapBroker here.
+  FeedbackNexus nexus(feedback().object() /* TODO(v8:7700) */, slot_index);
+  if (nexus.GetBinaryOperationFeedback() ==
+      BinaryOperationHint::kSignedSmall) {
+    EnsureCheckpoint();
+    SetAccumulator(AddNewNode<CheckedSmiIncrement>({value}));
+    return;
+  }
+
   ValueNode* node = AddNewNode<Increment>(
       {value}, compiler::FeedbackSource{feedback(), slot_index});
   SetAccumulator(node);
@@ -214,6 +288,10 @@ void MaglevGraphBuilder::VisitCallProperty() {
 }
 void MaglevGraphBuilder::VisitCallProperty0() {
   ValueNode* function = LoadRegister(0);
+  if (FLAG_maglev_inline_accessors &&
+      TryInlineFieldAccessor(function, LoadRegister(1), GetSlotOperand(2))) {
+    return;
+  }
   ValueNode* context = GetContext();
 
   CallProperty* call_property =
@@ -259,7 +337,14 @@ void MaglevGraphBuilder::VisitTestLessThan() {
   FeedbackSlot slot_index = GetSlotOperand(1);
   ValueNode* right = GetAccumulator();
 
-  USE(slot_index);  // TODO(v8:7700): Use the feedback info.
+  // TODO(leszeks): Use JSHeapBroker here.
+  FeedbackNexus nexus(feedback().object() /* TODO(v8:7700) */, slot_index);
+  if (nexus.GetCompareOperationFeedback() ==
+      CompareOperationHint::kSignedSmall) {
+    EnsureCheckpoint();
+    SetAccumulator(AddNewNode<CheckedSmiLessThan>({left, right}));
+    return;
+  }
 
   ValueNode* node = AddNewNode<LessThan>(
       {left, right}, compiler::FeedbackSource{feedback(), slot_index});
@@ -206,6 +206,10 @@ class MaglevGraphBuilder {
   BYTECODE_LIST(BYTECODE_VISITOR)
 #undef BYTECODE_VISITOR
 
+  // Replaces a monomorphic call to a trivial getter with a guarded field load.
+  bool TryInlineFieldAccessor(ValueNode* function, ValueNode* receiver,
+                              FeedbackSlot slot);
+
   template <typename NodeT>
   NodeT* AddNode(NodeT* node) {
     current_block_->nodes().Add(node);
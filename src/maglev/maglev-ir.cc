@@ -554,6 +554,24 @@ void CheckMaps::PrintParams(std::ostream& os,
   os << "(" << *map().object() << ")";
 }
 
+void CheckFunction::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                 const ProcessingState& state) {
+  UseRegister(target_input());
+}
+void CheckFunction::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                 const ProcessingState& state) {
+  Register target = ToRegister(target_input());
+  __ Cmp(target, function().object());
+  Label is_ok;
+  __ j(equal, &is_ok);
+  EmitDeopt(code_gen_state, this, state);
+  __ bind(&is_ok);
+}
+void CheckFunction::PrintParams(std::ostream& os,
+                                MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << *function().object() << ")";
+}
+
 void LoadField::AllocateVreg(MaglevVregAllocationState* vreg_state,
                              const ProcessingState& state) {
   UseRegister(object_input());
@@ -629,6 +647,28 @@ void Increment::GenerateCode(MaglevCodeGenState* code_gen_state,
   __ CallBuiltin(Builtin::kIncrement_WithFeedback);
 }
 
+void CheckedSmiIncrement::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                       const ProcessingState& state) {
+  UseRegister(operand_input());
+  DefineAsRegister(vreg_state, this);
+}
+void CheckedSmiIncrement::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                       const ProcessingState& state) {
+  Register value = ToRegister(operand_input());
+  // Compute into the scratch register so that the input, which the deopt
+  // frame state may still refer to, is intact if we bail out.
+  Label deopt, done;
+  __ JumpIfNotSmi(value, &deopt);
+  __ movl(kScratchRegister, value);
+  __ addl(kScratchRegister, Immediate(Smi::FromInt(1).ptr()));
+  __ j(overflow, &deopt);
+  __ movl(ToRegister(result()), kScratchRegister);
+  __ jmp(&done);
+  __ bind(&deopt);
+  EmitDeopt(code_gen_state, this, state);
+  __ bind(&done);
+}
+
 void StoreToFrame::AllocateVreg(MaglevVregAllocationState* vreg_state,
                                 const ProcessingState& state) {}
 void StoreToFrame::GenerateCode(MaglevCodeGenState* code_gen_state,
@@ -698,6 +738,33 @@ void LessThan::GenerateCode(MaglevCodeGenState* code_gen_state,
   __ CallBuiltin(Builtin::kLessThan_WithFeedback);
 }
 
+void CheckedSmiLessThan::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                      const ProcessingState& state) {
+  UseRegister(left_input());
+  UseRegister(right_input());
+  DefineAsRegister(vreg_state, this);
+}
+void CheckedSmiLessThan::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                      const ProcessingState& state) {
+  Register left = ToRegister(left_input());
+  Register right = ToRegister(right_input());
+  Register result = ToRegister(this->result());
+  Label deopt, is_less, done;
+  __ JumpIfNotSmi(left, &deopt);
+  __ JumpIfNotSmi(right, &deopt);
+  // The result may alias an input, so only write it after the comparison.
+  __ cmpl(left, right);
+  __ j(less, &is_less);
+  __ LoadRoot(result, RootIndex::kFalseValue);
+  __ jmp(&done);
+  __ bind(&is_less);
+  __ LoadRoot(result, RootIndex::kTrueValue);
+  __ jmp(&done);
+  __ bind(&deopt);
+  EmitDeopt(code_gen_state, this, state);
+  __ bind(&done);
+}
+
 void Phi::AllocateVreg(MaglevVregAllocationState* vreg_state,
                        const ProcessingState& state) {
   // Phi inputs are processed in the post-process, once loop phis' inputs'
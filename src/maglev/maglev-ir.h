@@ -39,6 +39,8 @@ class MaglevVregAllocationState;
   V(Add)                   \
   V(CallProperty)          \
   V(CallUndefinedReceiver) \
+  V(CheckedSmiIncrement)   \
+  V(CheckedSmiLessThan)    \
   V(Constant)              \
   V(Increment)             \
   V(InitialValue)          \
@@ -54,6 +56,7 @@ class MaglevVregAllocationState;
 #define NODE_LIST(V) \
   V(Checkpoint)      \
   V(CheckMaps)       \
+  V(CheckFunction)   \
   V(SoftDeopt)       \
   V(StoreToFrame)    \
   V(GapMove)         \
@@ -867,6 +870,31 @@ class CheckMaps : public FixedInputNodeT<1, CheckMaps> {
   const compiler::MapRef map_;
 };
 
+// Deopts unless the input is the given closure. Used to guard inlined call
+// targets.
+class CheckFunction : public FixedInputNodeT<1, CheckFunction> {
+  using Base = FixedInputNodeT<1, CheckFunction>;
+
+ public:
+  explicit CheckFunction(size_t input_count,
+                         const compiler::JSFunctionRef& function)
+      : Base(input_count), function_(function) {}
+
+  static constexpr OpProperties kProperties = OpProperties::Deopt();
+
+  compiler::JSFunctionRef function() const { return function_; }
+
+  static constexpr int kTargetIndex = 0;
+  Input& target_input() { return input(kTargetIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::JSFunctionRef function_;
+};
+
 class LoadField : public FixedInputValueNodeT<1, LoadField> {
   using Base = FixedInputValueNodeT<1, LoadField>;
 
@@ -954,6 +982,26 @@ class Increment : public UnaryWithFeedbackNode<Increment> {
   void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
 };
 
+// Smi-specialized version of Increment, used when the feedback says the
+// operand is a small integer. Deopts if the input is not a Smi or the result
+// overflows.
+class CheckedSmiIncrement
+    : public FixedInputValueNodeT<1, CheckedSmiIncrement> {
+  using Base = FixedInputValueNodeT<1, CheckedSmiIncrement>;
+
+ public:
+  explicit CheckedSmiIncrement(size_t input_count) : Base(input_count) {}
+
+  static constexpr OpProperties kProperties = OpProperties::Deopt();
+
+  static constexpr int kOperandIndex = 0;
+  Input& operand_input() { return input(kOperandIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
 class StoreToFrame : public FixedInputNodeT<0, StoreToFrame> {
   using Base = FixedInputNodeT<0, StoreToFrame>;
 
@@ -1021,6 +1069,27 @@ class LessThan : public BinaryWithFeedbackNode<LessThan> {
   void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
 };
 
+// Smi-specialized version of LessThan, used when the feedback says both
+// operands are small integers. Produces a tagged boolean and deopts if either
+// input is not a Smi.
+class CheckedSmiLessThan : public FixedInputValueNodeT<2, CheckedSmiLessThan> {
+  using Base = FixedInputValueNodeT<2, CheckedSmiLessThan>;
+
+ public:
+  explicit CheckedSmiLessThan(size_t input_count) : Base(input_count) {}
+
+  static constexpr OpProperties kProperties = OpProperties::Deopt();
+
+  static constexpr int kLeftIndex = 0;
+  static constexpr int kRightIndex = 1;
+  Input& left_input() { return input(kLeftIndex); }
+  Input& right_input() { return input(kRightIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
 // TODO(verwaest): It may make more sense to buffer phis in merged_states until
 // we set up the interpreter frame state for code generation. At that point we
 // can generate correctly-sized phis.
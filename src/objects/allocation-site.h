@@ -35,7 +35,7 @@ class AllocationSite : public Struct {
     kLastPretenureDecisionValue = kZombie
   };
 
-  const char* PretenureDecisionName(PretenureDecision decision);
+  static const char* PretenureDecisionName(PretenureDecision decision);
 
   // Contains either a Smi-encoded bitfield or a boilerplate. If it's a Smi the
   // AllocationSite is for a constructed Array.
@@ -671,13 +671,31 @@ BackingStore::ResizeOrGrowResult BackingStore::ResizeInPlace(
   DCHECK(!is_shared());
 
   if (new_byte_length < byte_length_) {
-    // TOOO(v8:11111): Figure out a strategy for shrinking - when do we
-    // un-commit the memory?
+    // Decommit the pages that are no longer needed, so that the OS can reclaim
+    // them. Decommitted pages are zero-initialized when they are committed
+    // again, so only the tail of the last page that stays committed needs to
+    // be zeroed in case the buffer is grown later.
+    size_t page_size = AllocatePageSize();
+    DCHECK(IsAligned(new_committed_length, page_size));
+    size_t old_committed_length = RoundUp(byte_length_, page_size);
+    size_t zero_end = std::min(byte_length_, new_committed_length);
+    if (zero_end > new_byte_length) {
+      memset(reinterpret_cast<byte*>(buffer_start_) + new_byte_length, 0,
+             zero_end - new_byte_length);
+    }
+    if (old_committed_length > new_committed_length) {
+      void* decommit_start =
+          reinterpret_cast<byte*>(buffer_start_) + new_committed_length;
+      size_t decommit_length = old_committed_length - new_committed_length;
+      CHECK(GetPlatformPageAllocator()->DecommitPages(decommit_start,
+                                                      decommit_length));
+    }
 
-    // Zero the memory so that in case the buffer is grown later, we have
-    // zeroed the contents already.
-    memset(reinterpret_cast<byte*>(buffer_start_) + new_byte_length, 0,
-           byte_length_ - new_byte_length);
+    // Do per-isolate accounting for non-shared backing stores.
+    DCHECK(free_on_destruct_);
+    reinterpret_cast<v8::Isolate*>(isolate)
+        ->AdjustAmountOfExternalAllocatedMemory(
+            -static_cast<int64_t>(byte_length_ - new_byte_length));
 
     // Changing the byte length wouldn't strictly speaking be needed, since
     // the JSArrayBuffer already stores the updated length. This is to keep
@@ -515,6 +515,34 @@ int CallSiteInfo::GetSourcePosition(Handle<CallSiteInfo> info) {
   return source_position;
 }
 
+// static
+Handle<FixedArray> CallSiteInfo::EnsureCallSiteInfos(
+    Isolate* isolate, Handle<FixedArray> frames) {
+  if (frames->length() == 0 || !frames->get(kFrameRecordFlagsIndex).IsSmi()) {
+    return frames;
+  }
+  DCHECK_EQ(0, frames->length() % kFrameRecordSize);
+  int frame_count = frames->length() / kFrameRecordSize;
+  Handle<FixedArray> infos = isolate->factory()->NewFixedArray(frame_count);
+  for (int i = 0; i < frame_count; ++i) {
+    int record = i * kFrameRecordSize;
+    Handle<CallSiteInfo> info = isolate->factory()->NewCallSiteInfo(
+        handle(frames->get(record + kFrameRecordReceiverOrInstanceIndex),
+               isolate),
+        handle(frames->get(record + kFrameRecordFunctionIndex), isolate),
+        handle(HeapObject::cast(
+                   frames->get(record + kFrameRecordCodeObjectIndex)),
+               isolate),
+        Smi::ToInt(frames->get(record + kFrameRecordCodeOffsetIndex)),
+        Smi::ToInt(frames->get(record + kFrameRecordFlagsIndex)),
+        handle(FixedArray::cast(
+                   frames->get(record + kFrameRecordParametersIndex)),
+               isolate));
+    infos->set(i, *info);
+  }
+  return infos;
+}
+
 // static
 bool CallSiteInfo::ComputeLocation(Handle<CallSiteInfo> info,
                                    MessageLocation* location) {
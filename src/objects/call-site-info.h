@@ -92,6 +92,24 @@ class CallSiteInfo : public TorqueGeneratedCallSiteInfo<CallSiteInfo, Struct> {
   static bool ComputeLocation(Handle<CallSiteInfo> info,
                               MessageLocation* location);
 
+  // Simple stack traces are captured as a flat FixedArray holding one record
+  // of kFrameRecordSize slots per frame, so that capturing is cheap for the
+  // (common) errors whose stack is never looked at. Returns the CallSiteInfo
+  // instances for the {frames}, which are returned as is if they already
+  // are CallSiteInfo instances.
+  V8_EXPORT_PRIVATE static Handle<FixedArray> EnsureCallSiteInfos(
+      Isolate* isolate, Handle<FixedArray> frames);
+
+  // The flags come first, so that a Smi in the first slot identifies a
+  // FixedArray of frame records.
+  static constexpr int kFrameRecordFlagsIndex = 0;
+  static constexpr int kFrameRecordCodeOffsetIndex = 1;
+  static constexpr int kFrameRecordReceiverOrInstanceIndex = 2;
+  static constexpr int kFrameRecordFunctionIndex = 3;
+  static constexpr int kFrameRecordCodeObjectIndex = 4;
+  static constexpr int kFrameRecordParametersIndex = 5;
+  static constexpr int kFrameRecordSize = 6;
+
   using BodyDescriptor = StructBodyDescriptor;
 
  private:
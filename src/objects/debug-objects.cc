@@ -419,7 +419,9 @@ void ErrorStackData::EnsureStackFrameInfos(Isolate* isolate,
     return;
   }
   int limit = Smi::cast(error_stack->limit_or_stack_frame_infos()).value();
-  Handle<FixedArray> call_site_infos(error_stack->call_site_infos(), isolate);
+  Handle<FixedArray> call_site_infos = CallSiteInfo::EnsureCallSiteInfos(
+      isolate, handle(error_stack->call_site_infos(), isolate));
+  error_stack->set_call_site_infos(*call_site_infos);
   Handle<FixedArray> stack_frame_infos =
       isolate->factory()->NewFixedArray(call_site_infos->length());
   int index = 0;
@@ -4,6 +4,10 @@
 
 #include "src/objects/elements.h"
 
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include "src/base/atomicops.h"
 #include "src/base/safe_conversions.h"
 #include "src/common/message-template.h"
@@ -3617,11 +3621,82 @@ class TypedElementsAccessor
              type == kExternalUint8ClampedArray);
   }
 
+  // Whether FromScalar(double) is a plain cast for values that pass
+  // IsCastableDouble(), see CastDouble().
+  static constexpr bool kHasCastableDoubles =
+      std::is_same<ElementType, float>::value ||
+      (std::is_integral<ElementType>::value && sizeof(ElementType) <= 4 &&
+       Kind != UINT8_CLAMPED_ELEMENTS &&
+       Kind != RAB_GSAB_UINT8_CLAMPED_ELEMENTS);
+
+  static bool IsCastableDouble(double value) {
+    if (std::is_same<ElementType, float>::value) {
+      return !(std::abs(value) > std::numeric_limits<float>::max());
+    }
+    // Written without short-circuiting so that checking a range of values
+    // can be vectorized. NaN is not castable.
+    return (value > kMinInt - 1.0) & (value < kMaxInt + 1.0);
+  }
+
+  static ElementType CastDouble(double value) {
+    DCHECK(IsCastableDouble(value));
+    if (std::is_same<ElementType, float>::value) {
+      return static_cast<ElementType>(value);
+    }
+    return static_cast<ElementType>(static_cast<int32_t>(value));
+  }
+
+  // Converts a run of elements from a backing store that is not shared. The
+  // loops are plain loads, conversions and stores, which compilers vectorize
+  // where the conversion is a cast, e.g. from Uint8 to Float32 or Int16 to
+  // Int32. Conversions from floating point values are only casts for values
+  // in range, so those are checked a chunk at a time first.
+  template <typename SourceElementType>
+  static void CopyBetweenUnsharedBackingStores(
+      SourceElementType* source_data_ptr, ElementType* dest_data_ptr,
+      size_t length) {
+    // TODO(ishell, v8:8875): See GetImpl() for why the accesses are
+    // unaligned.
+    auto load = [=](size_t i) {
+      return base::ReadUnalignedValue<SourceElementType>(
+          reinterpret_cast<Address>(source_data_ptr + i));
+    };
+    auto store = [=](size_t i, ElementType value) {
+      base::WriteUnalignedValue(reinterpret_cast<Address>(dest_data_ptr + i),
+                                value);
+    };
+    size_t i = 0;
+    if (std::is_floating_point<SourceElementType>::value &&
+        kHasCastableDoubles) {
+      constexpr size_t kChunkLength = 64;
+      for (; i + kChunkLength <= length; i += kChunkLength) {
+        bool castable = true;
+        for (size_t j = i; j < i + kChunkLength; j++) {
+          castable &= IsCastableDouble(load(j));
+        }
+        if (castable) {
+          for (size_t j = i; j < i + kChunkLength; j++) {
+            store(j, CastDouble(load(j)));
+          }
+        } else {
+          for (size_t j = i; j < i + kChunkLength; j++) {
+            store(j, FromScalar(load(j)));
+          }
+        }
+      }
+    }
+    for (; i < length; i++) store(i, FromScalar(load(i)));
+  }
+
   template <ElementsKind SourceKind, typename SourceElementType>
   static void CopyBetweenBackingStores(SourceElementType* source_data_ptr,
                                        ElementType* dest_data_ptr,
                                        size_t length,
                                        IsSharedBuffer is_shared) {
+    if (!is_shared) {
+      CopyBetweenUnsharedBackingStores(source_data_ptr, dest_data_ptr, length);
+      return;
+    }
     for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
       // We use scalar accessors to avoid boxing/unboxing, so there are no
       // allocations.
@@ -3781,6 +3856,14 @@ class TypedElementsAccessor
     if (kind == PACKED_SMI_ELEMENTS) {
       FixedArray source_store = FixedArray::cast(source.elements());
 
+      if (!destination_shared) {
+        for (size_t i = 0; i < length; i++) {
+          Object elem = source_store.get(static_cast<int>(i));
+          base::WriteUnalignedValue(reinterpret_cast<Address>(dest_data + i),
+                                    FromScalar(Smi::ToInt(elem)));
+        }
+        return true;
+      }
       for (size_t i = 0; i < length; i++) {
         Object elem = source_store.get(static_cast<int>(i));
         SetImpl(dest_data + i, FromScalar(Smi::ToInt(elem)),
@@ -3804,6 +3887,14 @@ class TypedElementsAccessor
       // unboxing the double here by using get_scalar.
       FixedDoubleArray source_store = FixedDoubleArray::cast(source.elements());
 
+      if (!destination_shared) {
+        // A packed FixedDoubleArray holds no holes, so it can be converted
+        // like a Float64Array.
+        double* source_data = reinterpret_cast<double*>(
+            source_store.address() + FixedDoubleArray::OffsetOfElementAt(0));
+        CopyBetweenUnsharedBackingStores(source_data, dest_data, length);
+        return true;
+      }
       for (size_t i = 0; i < length; i++) {
         // Use the from_double conversion for this specific TypedArray type,
         // rather than relying on C++ to convert elem.
@@ -148,6 +148,10 @@ bool FeedbackVector::has_optimized_code() const {
   return !optimized_code().is_null();
 }
 
+int FeedbackVector::deopt_count() const {
+  return DeoptCountBits::decode(flags());
+}
+
 bool FeedbackVector::maybe_has_optimized_code() const {
   return MaybeHasOptimizedCodeBit::decode(flags());
 }
@@ -251,14 +251,10 @@ Handle<FeedbackVector> FeedbackVector::New(
   DCHECK(is_compiled_scope->is_compiled());
   Factory* factory = isolate->factory();
 
-  Handle<FeedbackMetadata> feedback_metadata(shared->feedback_metadata(),
-                                             isolate);
-  const int slot_count = feedback_metadata->slot_count();
-
   Handle<FeedbackVector> vector =
       factory->NewFeedbackVector(shared, closure_feedback_cell_array);
 
-  DCHECK_EQ(vector->length(), slot_count);
+  DCHECK_EQ(vector->length(), shared->feedback_metadata().slot_count());
 
   DCHECK_EQ(vector->shared_function_info(), *shared);
   DCHECK_EQ(vector->optimization_marker(), OptimizationMarker::kNone);
@@ -267,63 +263,6 @@ Handle<FeedbackVector> FeedbackVector::New(
   DCHECK_EQ(vector->profiler_ticks(), 0);
   DCHECK(vector->maybe_optimized_code()->IsCleared());
 
-  // Ensure we can skip the write barrier
-  Handle<Symbol> uninitialized_sentinel = UninitializedSentinel(isolate);
-  DCHECK_EQ(ReadOnlyRoots(isolate).uninitialized_symbol(),
-            *uninitialized_sentinel);
-  for (int i = 0; i < slot_count;) {
-    FeedbackSlot slot(i);
-    FeedbackSlotKind kind = feedback_metadata->GetKind(slot);
-    int entry_size = FeedbackMetadata::GetSlotSize(kind);
-
-    MaybeObject extra_value = MaybeObject::FromObject(*uninitialized_sentinel);
-    switch (kind) {
-      case FeedbackSlotKind::kLoadGlobalInsideTypeof:
-      case FeedbackSlotKind::kLoadGlobalNotInsideTypeof:
-      case FeedbackSlotKind::kStoreGlobalSloppy:
-      case FeedbackSlotKind::kStoreGlobalStrict:
-        vector->Set(slot, HeapObjectReference::ClearedValue(isolate),
-                    SKIP_WRITE_BARRIER);
-        break;
-      case FeedbackSlotKind::kForIn:
-      case FeedbackSlotKind::kCompareOp:
-      case FeedbackSlotKind::kBinaryOp:
-        vector->Set(slot, Smi::zero(), SKIP_WRITE_BARRIER);
-        break;
-      case FeedbackSlotKind::kLiteral:
-        vector->Set(slot, Smi::zero(), SKIP_WRITE_BARRIER);
-        break;
-      case FeedbackSlotKind::kCall:
-        vector->Set(slot, *uninitialized_sentinel, SKIP_WRITE_BARRIER);
-        extra_value = MaybeObject::FromObject(Smi::zero());
-        break;
-      case FeedbackSlotKind::kCloneObject:
-      case FeedbackSlotKind::kLoadProperty:
-      case FeedbackSlotKind::kLoadKeyed:
-      case FeedbackSlotKind::kHasKeyed:
-      case FeedbackSlotKind::kStoreNamedSloppy:
-      case FeedbackSlotKind::kStoreNamedStrict:
-      case FeedbackSlotKind::kStoreOwnNamed:
-      case FeedbackSlotKind::kDefineOwnKeyed:
-      case FeedbackSlotKind::kStoreKeyedSloppy:
-      case FeedbackSlotKind::kStoreKeyedStrict:
-      case FeedbackSlotKind::kStoreInArrayLiteral:
-      case FeedbackSlotKind::kStoreDataPropertyInLiteral:
-      case FeedbackSlotKind::kTypeProfile:
-      case FeedbackSlotKind::kInstanceOf:
-        vector->Set(slot, *uninitialized_sentinel, SKIP_WRITE_BARRIER);
-        break;
-
-      case FeedbackSlotKind::kInvalid:
-      case FeedbackSlotKind::kKindsNumber:
-        UNREACHABLE();
-    }
-    for (int j = 1; j < entry_size; j++) {
-      vector->Set(slot.WithOffset(j), extra_value, SKIP_WRITE_BARRIER);
-    }
-    i += entry_size;
-  }
-
   Handle<FeedbackVector> result = Handle<FeedbackVector>::cast(vector);
   if (!isolate->is_best_effort_code_coverage() ||
       isolate->is_collecting_type_profile()) {
@@ -386,6 +325,13 @@ void FeedbackVector::SaturatingIncrementProfilerTicks() {
   if (ticks < Smi::kMaxValue) set_profiler_ticks(ticks + 1);
 }
 
+void FeedbackVector::SaturatingIncrementDeoptCount() {
+  int count = deopt_count();
+  if (count < static_cast<int>(DeoptCountBits::kMax)) {
+    set_flags(DeoptCountBits::update(flags(), count + 1));
+  }
+}
+
 // static
 void FeedbackVector::SetOptimizedCode(Handle<FeedbackVector> vector,
                                       Handle<CodeT> code) {
@@ -430,6 +376,68 @@ void FeedbackVector::InitializeOptimizationState() {
             MaybeHasOptimizedCodeBit::encode(false));
 }
 
+void FeedbackVector::InitializeSlots(FeedbackMetadata metadata,
+                                     ReadOnlyRoots roots) {
+  // All initial values are Smis or read-only roots, so the write barrier can
+  // be skipped.
+  Symbol uninitialized_sentinel = roots.uninitialized_symbol();
+  PtrComprCageBase cage_base = GetPtrComprCageBase(*this);
+  const int slot_count = metadata.slot_count();
+  DCHECK_EQ(length(), slot_count);
+  for (int i = 0; i < slot_count;) {
+    FeedbackSlot slot(i);
+    FeedbackSlotKind kind = metadata.GetKind(slot);
+    int entry_size = FeedbackMetadata::GetSlotSize(kind);
+
+    MaybeObject extra_value = MaybeObject::FromObject(uninitialized_sentinel);
+    switch (kind) {
+      case FeedbackSlotKind::kLoadGlobalInsideTypeof:
+      case FeedbackSlotKind::kLoadGlobalNotInsideTypeof:
+      case FeedbackSlotKind::kStoreGlobalSloppy:
+      case FeedbackSlotKind::kStoreGlobalStrict:
+        Set(slot, HeapObjectReference::ClearedValue(cage_base),
+            SKIP_WRITE_BARRIER);
+        break;
+      case FeedbackSlotKind::kForIn:
+      case FeedbackSlotKind::kCompareOp:
+      case FeedbackSlotKind::kBinaryOp:
+        Set(slot, Smi::zero(), SKIP_WRITE_BARRIER);
+        break;
+      case FeedbackSlotKind::kLiteral:
+        Set(slot, Smi::zero(), SKIP_WRITE_BARRIER);
+        break;
+      case FeedbackSlotKind::kCall:
+        Set(slot, uninitialized_sentinel, SKIP_WRITE_BARRIER);
+        extra_value = MaybeObject::FromObject(Smi::zero());
+        break;
+      case FeedbackSlotKind::kCloneObject:
+      case FeedbackSlotKind::kLoadProperty:
+      case FeedbackSlotKind::kLoadKeyed:
+      case FeedbackSlotKind::kHasKeyed:
+      case FeedbackSlotKind::kStoreNamedSloppy:
+      case FeedbackSlotKind::kStoreNamedStrict:
+      case FeedbackSlotKind::kStoreOwnNamed:
+      case FeedbackSlotKind::kDefineOwnKeyed:
+      case FeedbackSlotKind::kStoreKeyedSloppy:
+      case FeedbackSlotKind::kStoreKeyedStrict:
+      case FeedbackSlotKind::kStoreInArrayLiteral:
+      case FeedbackSlotKind::kStoreDataPropertyInLiteral:
+      case FeedbackSlotKind::kTypeProfile:
+      case FeedbackSlotKind::kInstanceOf:
+        Set(slot, uninitialized_sentinel, SKIP_WRITE_BARRIER);
+        break;
+
+      case FeedbackSlotKind::kInvalid:
+      case FeedbackSlotKind::kKindsNumber:
+        UNREACHABLE();
+    }
+    for (int j = 1; j < entry_size; j++) {
+      Set(slot.WithOffset(j), extra_value, SKIP_WRITE_BARRIER);
+    }
+    i += entry_size;
+  }
+}
+
 void FeedbackVector::EvictOptimizedCodeMarkedForDeoptimization(
     SharedFunctionInfo shared, const char* reason) {
   MaybeObject slot = maybe_optimized_code(kAcquireLoad);
@@ -902,7 +910,7 @@ void FeedbackNexus::ConfigureCloneObject(Handle<Map> source_map,
       }
       break;
     case InlineCacheState::POLYMORPHIC: {
-      const int kMaxElements = FLAG_max_valid_polymorphic_map_count *
+      const int max_elements = isolate->max_valid_polymorphic_map_count() *
                                kCloneObjectPolymorphicEntrySize;
       Handle<WeakFixedArray> array = Handle<WeakFixedArray>::cast(feedback);
       int i = 0;
@@ -917,7 +925,8 @@ void FeedbackNexus::ConfigureCloneObject(Handle<Map> source_map,
       }
 
       if (i >= array->length()) {
-        if (i == kMaxElements) {
+        // The limit may have been lowered since the array was allocated.
+        if (i >= max_elements) {
           // Transition to MEGAMORPHIC.
           MaybeObject sentinel = MegamorphicSentinel();
           SetFeedback(sentinel, SKIP_WRITE_BARRIER,
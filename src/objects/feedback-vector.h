@@ -239,6 +239,11 @@ class FeedbackVector
   inline bool maybe_has_optimized_code() const;
   inline void set_maybe_has_optimized_code(bool value);
 
+  // The number of times optimized code for this function was invalidated by
+  // a deoptimization, saturating at DeoptCountBits::kMax.
+  inline int deopt_count() const;
+  void SaturatingIncrementDeoptCount();
+
   inline bool has_optimization_marker() const;
   inline OptimizationMarker optimization_marker() const;
   void EvictOptimizedCodeMarkedForDeoptimization(SharedFunctionInfo shared,
@@ -249,6 +254,11 @@ class FeedbackVector
   void SetOptimizationMarker(OptimizationMarker marker);
   void InitializeOptimizationState();
 
+  // Writes the initial (uninitialized) feedback for every slot described by
+  // {metadata}. Called once on a freshly allocated vector, before it becomes
+  // visible to the GC.
+  void InitializeSlots(FeedbackMetadata metadata, ReadOnlyRoots roots);
+
   // Clears the optimization marker in the feedback vector.
   void ClearOptimizationMarker();
 
@@ -9,6 +9,7 @@
 #include "src/objects/intl-objects.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -47,6 +48,7 @@
 #include "unicode/numfmt.h"
 #include "unicode/numsys.h"
 #include "unicode/timezone.h"
+#include "unicode/tztrans.h"
 #include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/uvernum.h"  // U_ICU_VERSION_MAJOR_NUM
@@ -346,16 +348,23 @@ MaybeHandle<String> Intl::ConvertToLower(Isolate* isolate, Handle<String> s) {
   // fits in the Latin1 range in the *root locale*. It does not hold
   // for ToUpperCase even in the root locale.
 
-  // Scan the string for uppercase and non-ASCII characters for strings
-  // shorter than a machine-word without any memory allocation overhead.
-  // TODO(jshin): Apply this to a longer input by breaking FastAsciiConvert()
-  // to two parts, one for scanning the prefix with no change and the other for
-  // handling ASCII-only characters.
-
-  bool is_short = length < static_cast<int>(sizeof(uintptr_t));
-  if (is_short) {
-    bool is_lower_ascii = FindFirstUpperOrNonAscii(*s, length) == length;
-    if (is_lower_ascii) return s;
+  // Scan the string for uppercase and non-ASCII characters without any
+  // memory allocation overhead, so that strings which are already lower case
+  // ASCII are returned as is.
+  {
+    DisallowGarbageCollection no_gc;
+    DCHECK(s->IsFlat());
+    String::FlatContent flat = s->GetFlatContent(no_gc);
+    if (flat.IsOneByte()) {
+      const char* src =
+          reinterpret_cast<const char*>(flat.ToOneByteVector().begin());
+      if (FastAsciiUnchangedPrefixLength<true>(src, length) == length) {
+        return s;
+      }
+    } else if (length < static_cast<int>(sizeof(uintptr_t))) {
+      bool is_lower_ascii = FindFirstUpperOrNonAscii(*s, length) == length;
+      if (is_lower_ascii) return s;
+    }
   }
 
   Handle<SeqOneByteString> result =
@@ -367,10 +376,23 @@ MaybeHandle<String> Intl::ConvertToLower(Isolate* isolate, Handle<String> s) {
 MaybeHandle<String> Intl::ConvertToUpper(Isolate* isolate, Handle<String> s) {
   int32_t length = s->length();
   if (s->IsOneByteRepresentation() && length > 0) {
+    DCHECK(s->IsFlat());
+    {
+      // Return strings that are already upper case ASCII without allocating.
+      DisallowGarbageCollection no_gc;
+      String::FlatContent flat = s->GetFlatContent(no_gc);
+      if (flat.IsOneByte()) {
+        const char* src =
+            reinterpret_cast<const char*>(flat.ToOneByteVector().begin());
+        if (FastAsciiUnchangedPrefixLength<false>(src, length) == length) {
+          return s;
+        }
+      }
+    }
+
     Handle<SeqOneByteString> result =
         isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
 
-    DCHECK(s->IsFlat());
     int sharp_s_count;
     bool is_result_single_byte;
     {
@@ -2555,6 +2577,8 @@ class ICUTimezoneCache : public base::TimezoneCache {
 
   double LocalTimeOffset(double time_ms, bool is_utc) override;
 
+  bool NextOffsetTransition(double time_ms, double* transition_ms) override;
+
   void Clear(TimeZoneDetection time_zone_detection) override;
 
  private:
@@ -2620,6 +2644,20 @@ double ICUTimezoneCache::LocalTimeOffset(double time_ms, bool is_utc) {
   return raw_offset + dst_offset;
 }
 
+bool ICUTimezoneCache::NextOffsetTransition(double time_ms,
+                                            double* transition_ms) {
+  icu::TimeZoneTransition transition;
+  // Note that casting TimeZone to BasicTimeZone is safe because we know that
+  // icu::TimeZone used here is a BasicTimeZone.
+  if (static_cast<const icu::BasicTimeZone*>(GetTimeZone())
+          ->getNextTransition(time_ms, false, transition)) {
+    *transition_ms = transition.getTime();
+  } else {
+    *transition_ms = std::numeric_limits<double>::infinity();
+  }
+  return true;
+}
+
 void ICUTimezoneCache::Clear(TimeZoneDetection time_zone_detection) {
   delete timezone_;
   timezone_ = nullptr;
@@ -232,7 +232,7 @@ bool JSFunction::is_compiled() const {
 }
 
 bool JSFunction::ShouldFlushBaselineCode(
-    base::EnumSet<CodeFlushMode> code_flush_mode) {
+    base::EnumSet<CodeFlushMode> code_flush_mode, int flushing_age) {
   if (!IsBaselineCodeFlushingEnabled(code_flush_mode)) return false;
   // Do a raw read for shared and code fields here since this function may be
   // called on a concurrent thread. JSFunction itself should be fully
@@ -250,7 +250,7 @@ bool JSFunction::ShouldFlushBaselineCode(
   if (code.kind() != CodeKind::BASELINE) return false;
 
   SharedFunctionInfo shared = SharedFunctionInfo::cast(maybe_shared);
-  return shared.ShouldFlushCode(code_flush_mode);
+  return shared.ShouldFlushCode(code_flush_mode, flushing_age);
 }
 
 bool JSFunction::NeedsResetDueToFlushedBytecode() {
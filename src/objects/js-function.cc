@@ -378,6 +378,7 @@ void JSFunction::CreateAndAttachFeedbackVector(
          isolate->heap()->many_closures_cell());
   function->raw_feedback_cell().set_value(*feedback_vector, kReleaseStore);
   function->SetInterruptBudget(isolate);
+  shared->set_has_feedback_vector_at_least_once(true);
 }
 
 // static
@@ -411,7 +412,10 @@ void JSFunction::InitializeFeedbackCell(
       // We also need a feedback vector for certain log events, collecting type
       // profile and more precise code coverage.
       FLAG_log_function_events || !isolate->is_best_effort_code_coverage() ||
-      isolate->is_collecting_type_profile();
+      isolate->is_collecting_type_profile() ||
+      // Skip the warm-up without feedback if the function was warm before.
+      (FLAG_feedback_vector_warm_start &&
+       function->shared().has_feedback_vector_at_least_once());
 
   if (needs_feedback_vector) {
     CreateAndAttachFeedbackVector(isolate, function, is_compiled_scope);
@@ -246,7 +246,7 @@ class JSFunction : public TorqueGeneratedJSFunction<
   // Returns if baseline code is a candidate for flushing. This method is called
   // from concurrent marking so we should be careful when accessing data fields.
   inline bool ShouldFlushBaselineCode(
-      base::EnumSet<CodeFlushMode> code_flush_mode);
+      base::EnumSet<CodeFlushMode> code_flush_mode, int flushing_age);
 
   DECL_GETTER(has_prototype_slot, bool)
 
@@ -407,6 +407,15 @@ Maybe<bool> JSReceiver::SetOrCopyDataProperties(
     }
   }
 
+  // For ordinary objects, the [[GetOwnProperty]] call in step 4a i is not
+  // observable, so a single own lookup can provide both the enumerability and
+  // the value. This is the common case for dictionary-mode sources.
+  const bool use_single_lookup =
+      from->IsJSObject() && !from->IsJSModuleNamespace() &&
+      !from->map().has_named_interceptor() &&
+      !from->map().has_indexed_interceptor() &&
+      !from->map().is_access_check_needed();
+
   // 4. Repeat for each element nextKey of keys in List order,
   for (int i = 0; i < keys->length(); ++i) {
     Handle<Object> next_key(keys->get(i), isolate);
@@ -415,35 +424,47 @@ Maybe<bool> JSReceiver::SetOrCopyDataProperties(
       continue;
     }
 
-    // 4a i. Let desc be ? from.[[GetOwnProperty]](nextKey).
-    PropertyDescriptor desc;
-    Maybe<bool> found =
-        JSReceiver::GetOwnPropertyDescriptor(isolate, from, next_key, &desc);
-    if (found.IsNothing()) return Nothing<bool>();
-    // 4a ii. If desc is not undefined and desc.[[Enumerable]] is true, then
-    if (found.FromJust() && desc.enumerable()) {
+    Handle<Object> prop_value;
+    if (use_single_lookup) {
+      PropertyKey key(isolate, next_key);
+      LookupIterator it(isolate, from, key, from,
+                        LookupIterator::OWN_SKIP_INTERCEPTOR);
+      if (it.state() != LookupIterator::DATA &&
+          it.state() != LookupIterator::ACCESSOR) {
+        continue;
+      }
+      if (!it.IsEnumerable()) continue;
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate, prop_value, Object::GetProperty(&it), Nothing<bool>());
+    } else {
+      // 4a i. Let desc be ? from.[[GetOwnProperty]](nextKey).
+      PropertyDescriptor desc;
+      Maybe<bool> found =
+          JSReceiver::GetOwnPropertyDescriptor(isolate, from, next_key, &desc);
+      if (found.IsNothing()) return Nothing<bool>();
+      // 4a ii. If desc is not undefined and desc.[[Enumerable]] is true, then
+      if (!found.FromJust() || !desc.enumerable()) continue;
       // 4a ii 1. Let propValue be ? Get(from, nextKey).
-      Handle<Object> prop_value;
       ASSIGN_RETURN_ON_EXCEPTION_VALUE(
           isolate, prop_value,
           Runtime::GetObjectProperty(isolate, from, next_key), Nothing<bool>());
+    }
 
-      if (use_set) {
-        // 4c ii 2. Let status be ? Set(to, nextKey, propValue, true).
-        Handle<Object> status;
-        ASSIGN_RETURN_ON_EXCEPTION_VALUE(
-            isolate, status,
-            Runtime::SetObjectProperty(isolate, target, next_key, prop_value,
-                                       StoreOrigin::kMaybeKeyed,
-                                       Just(ShouldThrow::kThrowOnError)),
-            Nothing<bool>());
-      } else {
-        // 4a ii 2. Perform ! CreateDataProperty(target, nextKey, propValue).
-        PropertyKey key(isolate, next_key);
-        LookupIterator it(isolate, target, key, LookupIterator::OWN);
-        CHECK(JSObject::CreateDataProperty(&it, prop_value, Just(kThrowOnError))
-                  .FromJust());
-      }
+    if (use_set) {
+      // 4c ii 2. Let status be ? Set(to, nextKey, propValue, true).
+      Handle<Object> status;
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate, status,
+          Runtime::SetObjectProperty(isolate, target, next_key, prop_value,
+                                     StoreOrigin::kMaybeKeyed,
+                                     Just(ShouldThrow::kThrowOnError)),
+          Nothing<bool>());
+    } else {
+      // 4a ii 2. Perform ! CreateDataProperty(target, nextKey, propValue).
+      PropertyKey key(isolate, next_key);
+      LookupIterator it(isolate, target, key, LookupIterator::OWN);
+      CHECK(JSObject::CreateDataProperty(&it, prop_value, Just(kThrowOnError))
+                .FromJust());
     }
   }
 
@@ -2028,7 +2049,14 @@ V8_WARN_UNUSED_RESULT Maybe<bool> FastGetOwnValuesOrEntries(
     descriptors.PatchValue(map->instance_descriptors(isolate));
   }
 
+  // A valid enum cache tells us how many enumerable string-keyed properties
+  // the map has, so while the shape stays stable we can stop walking the
+  // descriptors as soon as all of them have been collected.
+  int remaining_enumerable = map->EnumLength();
+  bool use_enum_length = remaining_enumerable != kInvalidEnumCacheSentinel;
+
   for (InternalIndex index : InternalIndex::Range(number_of_own_descriptors)) {
+    if (use_enum_length && stable && remaining_enumerable == 0) break;
     HandleScope inner_scope(isolate);
 
     Handle<Name> next_key(descriptors->GetKey(index), isolate);
@@ -2042,6 +2070,7 @@ V8_WARN_UNUSED_RESULT Maybe<bool> FastGetOwnValuesOrEntries(
 
       PropertyDetails details = descriptors->GetDetails(index);
       if (!details.IsEnumerable()) continue;
+      remaining_enumerable--;
       if (details.kind() == PropertyKind::kData) {
         if (details.location() == PropertyLocation::kDescriptor) {
           prop_value = handle(descriptors->GetStrongValue(index), isolate);
@@ -210,16 +210,23 @@ bool JSRegExp::MarkedForTierUp() {
 void JSRegExp::ResetLastTierUpTick() {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(type_tag(), JSRegExp::IRREGEXP);
-  int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) + 1;
+  int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
+  // A requested or pending tier-up task doesn't depend on the last tick.
+  if (tier_up_ticks < 0) return;
   FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
-                               Smi::FromInt(tier_up_ticks));
+                               Smi::FromInt(tier_up_ticks + 1));
 }
 
 void JSRegExp::TierUpTick() {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(type_tag(), JSRegExp::IRREGEXP);
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
-  if (tier_up_ticks == 0) {
+  if (tier_up_ticks <= 0) {
+    return;
+  }
+  if (tier_up_ticks == 1 && FLAG_regexp_async_tier_up) {
+    FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+                                 Smi::FromInt(kTierUpTaskRequestedValue));
     return;
   }
   FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
@@ -233,6 +240,24 @@ void JSRegExp::MarkTierUpForNextExec() {
                                Smi::zero());
 }
 
+bool JSRegExp::TierUpTaskRequested() {
+  if (!CanTierUp()) return false;
+  return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) ==
+         kTierUpTaskRequestedValue;
+}
+
+bool JSRegExp::TierUpTaskPending() {
+  if (!CanTierUp()) return false;
+  return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) ==
+         kTierUpTaskPendingValue;
+}
+
+void JSRegExp::MarkTierUpTaskPending() {
+  DCHECK(TierUpTaskRequested());
+  FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+                               Smi::FromInt(kTierUpTaskPendingValue));
+}
+
 // static
 MaybeHandle<JSRegExp> JSRegExp::Initialize(Handle<JSRegExp> regexp,
                                            Handle<String> source,
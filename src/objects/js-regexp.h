@@ -125,6 +125,12 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   void ResetLastTierUpTick();
   void TierUpTick();
   void MarkTierUpForNextExec();
+  // With --regexp-async-tier-up, running out of tier-up ticks requests a
+  // task that compiles the native code, while the interpreter keeps running
+  // until it has been installed.
+  bool TierUpTaskRequested();
+  bool TierUpTaskPending();
+  void MarkTierUpTaskPending();
 
   bool ShouldProduceBytecode();
   inline bool HasCompiledCode() const;
@@ -202,7 +208,16 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // above to save space.
   static constexpr int kIrregexpBacktrackLimit =
       kIrregexpTicksUntilTierUpIndex + 1;
-  static constexpr int kIrregexpDataSize = kIrregexpBacktrackLimit + 1;
+  // A String that every match contains, or kUninitializedValue (see
+  // RegExpPrefilter).
+  static constexpr int kIrregexpRequiredLiteralIndex =
+      kIrregexpBacktrackLimit + 1;
+  // A smi containing the maximal distance between the start of a match and
+  // the required literal, or -1 if it is unbounded.
+  static constexpr int kIrregexpRequiredLiteralMaxOffsetIndex =
+      kIrregexpRequiredLiteralIndex + 1;
+  static constexpr int kIrregexpDataSize =
+      kIrregexpRequiredLiteralMaxOffsetIndex + 1;
 
   // TODO(mbid,v8:10765): At the moment the EXPERIMENTAL data array conforms
   // to the format of an IRREGEXP data array, with most fields set to some
@@ -240,6 +255,11 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // tier-up to the compiler immediately, instead of using the interpreter.
   static constexpr int kTierUpForSubjectLengthValue = 1000;
 
+  // Values of the tier-up ticks with --regexp-async-tier-up once they have
+  // run out, before and after the tier-up task has been posted.
+  static constexpr int kTierUpTaskRequestedValue = -2;
+  static constexpr int kTierUpTaskPendingValue = -3;
+
   // Maximum number of captures allowed.
   static constexpr int kMaxCaptures = 1 << 16;
 
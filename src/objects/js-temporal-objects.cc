@@ -4,6 +4,8 @@
 
 #include "src/objects/js-temporal-objects.h"
 
+#include <cmath>
+#include <limits>
 #include <set>
 
 #include "src/common/globals.h"
@@ -928,30 +930,42 @@ Maybe<DateTimeRecordCommon> GetISOPartsFromEpoch(
     Isolate* isolate, Handle<BigInt> epoch_nanoseconds) {
   TEMPORAL_ENTER_FUNC();
   DateTimeRecordCommon result;
-  // 1. Let remainderNs be epochNanoseconds modulo 10^6.
-  Handle<BigInt> million = BigInt::FromInt64(isolate, 1000000);
-  Handle<BigInt> remainder_ns;
-  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
-      isolate, remainder_ns,
-      BigInt::Remainder(isolate, epoch_nanoseconds, million),
-      Nothing<DateTimeRecordCommon>());
-  // Need to do some remainder magic to negative remainder.
-  if (remainder_ns->IsNegative()) {
+  int64_t epoch_milliseconds;
+  int64_t remainder;
+  bool lossless;
+  int64_t epoch_nanoseconds_int64 = epoch_nanoseconds->AsInt64(&lossless);
+  if (lossless) {
+    // Instants within about 292 years of the epoch fit into an int64_t, so
+    // the steps below need no BigInt arithmetic.
+    remainder = modulo(epoch_nanoseconds_int64, 1000000);
+    epoch_milliseconds = (epoch_nanoseconds_int64 - remainder) / 1000000;
+  } else {
+    // 1. Let remainderNs be epochNanoseconds modulo 10^6.
+    Handle<BigInt> million = BigInt::FromInt64(isolate, 1000000);
+    Handle<BigInt> remainder_ns;
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
-        isolate, remainder_ns, BigInt::Add(isolate, remainder_ns, million),
+        isolate, remainder_ns,
+        BigInt::Remainder(isolate, epoch_nanoseconds, million),
         Nothing<DateTimeRecordCommon>());
-  }
+    // Need to do some remainder magic to negative remainder.
+    if (remainder_ns->IsNegative()) {
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate, remainder_ns, BigInt::Add(isolate, remainder_ns, million),
+          Nothing<DateTimeRecordCommon>());
+    }
 
-  // 2. Let epochMilliseconds be (epochNanoseconds − remainderNs) / 10^6.
-  Handle<BigInt> bigint;
-  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
-      isolate, bigint,
-      BigInt::Subtract(isolate, epoch_nanoseconds, remainder_ns),
-      Nothing<DateTimeRecordCommon>());
-  ASSIGN_RETURN_ON_EXCEPTION_VALUE(isolate, bigint,
-                                   BigInt::Divide(isolate, bigint, million),
-                                   Nothing<DateTimeRecordCommon>());
-  int64_t epoch_milliseconds = bigint->AsInt64();
+    // 2. Let epochMilliseconds be (epochNanoseconds − remainderNs) / 10^6.
+    Handle<BigInt> bigint;
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+        isolate, bigint,
+        BigInt::Subtract(isolate, epoch_nanoseconds, remainder_ns),
+        Nothing<DateTimeRecordCommon>());
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(isolate, bigint,
+                                     BigInt::Divide(isolate, bigint, million),
+                                     Nothing<DateTimeRecordCommon>());
+    epoch_milliseconds = bigint->AsInt64();
+    remainder = remainder_ns->AsInt64();
+  }
   int year = 0;
   int month = 0;
   int day = 0;
@@ -990,7 +1004,6 @@ Maybe<DateTimeRecordCommon> GetISOPartsFromEpoch(
   DCHECK_GE(result.millisecond, 0);
   DCHECK_LE(result.millisecond, 999);
   // 10. Let microsecond be floor(remainderNs / 1000) modulo 1000.
-  int64_t remainder = remainder_ns->AsInt64();
   result.microsecond = (remainder / 1000) % 1000;
   DCHECK_GE(result.microsecond, 0);
   DCHECK_LE(result.microsecond, 999);
@@ -2382,6 +2395,43 @@ Handle<String> UnitToString(Isolate* isolate, Unit unit) {
   }
 }
 
+// Returns the number of days from 1970-01-01 to the given date of the
+// proleptic Gregorian calendar, for any month in 1..12 and any day. Counts
+// whole 400-year eras, which all have the same length, so that any year is
+// handled in constant time (see Howard Hinnant, "chrono-Compatible Low-Level
+// Date Algorithms").
+int64_t ISODateToEpochDays(int64_t year, int64_t month, int64_t day) {
+  DCHECK_GE(month, 1);
+  DCHECK_LE(month, 12);
+  // Count years from March, so that the leap day is the last day of a year.
+  if (month <= 2) year--;
+  int64_t era = floor_divide(year, 400);
+  int64_t year_of_era = year - era * 400;
+  int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5;
+  int64_t day_of_era = year_of_era * 365 + year_of_era / 4 -
+                       year_of_era / 100 + day_of_year;
+  // 719468 is the number of days from 0000-03-01 to 1970-01-01.
+  return era * 146097 + day_of_era - 719468 + day - 1;
+}
+
+// The inverse of ISODateToEpochDays.
+void EpochDaysToISODate(int64_t days, int32_t* year, int32_t* month,
+                        int32_t* day) {
+  days += 719468;
+  int64_t era = floor_divide(days, 146097);
+  int64_t day_of_era = days - era * 146097;
+  int64_t year_of_era = (day_of_era - day_of_era / 1460 +
+                         day_of_era / 36524 - day_of_era / 146096) /
+                        365;
+  int64_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  int64_t shifted_month = (5 * day_of_year + 2) / 153;
+  *day = static_cast<int32_t>(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+  *month = static_cast<int32_t>(shifted_month < 10 ? shifted_month + 3
+                                                   : shifted_month - 9);
+  *year = static_cast<int32_t>(year_of_era + era * 400 + (*month <= 2 ? 1 : 0));
+}
+
 // #sec-temporal-balanceisodate
 void BalanceISODate(Isolate* isolate, int32_t* year, int32_t* month,
                     int32_t* day) {
@@ -2392,65 +2442,11 @@ void BalanceISODate(Isolate* isolate, int32_t* year, int32_t* month,
   // 3. Set month to balancedYearMonth.[[Month]].
   // 4. Set year to balancedYearMonth.[[Year]].
   BalanceISOYearMonth(isolate, year, month);
-  // 5. NOTE: To deal with negative numbers of days whose absolute value is
-  // greater than the number of days in a year, the following section subtracts
-  // years and adds days until the number of days is greater than −366 or −365.
-  // 6. If month > 2, then
-  // a. Let testYear be year.
-  // 7. Else,
-  // a. Let testYear be year − 1.
-  int32_t test_year = (*month > 2) ? *year : *year - 1;
-  // 8. Repeat, while day < −1 × ! ISODaysInYear(testYear),
-  int32_t iso_days_in_year;
-  while (*day < -(iso_days_in_year = ISODaysInYear(isolate, test_year))) {
-    // a. Set day to day + ! ISODaysInYear(testYear).
-    *day += iso_days_in_year;
-    // b. Set year to year − 1.
-    (*year)--;
-    // c. Set testYear to testYear − 1.
-    test_year--;
-  }
-  // 9. NOTE: To deal with numbers of days greater than the number of days in a
-  // year, the following section adds years and subtracts days until the number
-  // of days is less than 366 or 365.
-  // 10. Let testYear be year + 1.
-  test_year = (*year) + 1;
-  // 11. Repeat, while day > ! ISODaysInYear(testYear),
-  while (*day > (iso_days_in_year = ISODaysInYear(isolate, test_year))) {
-    // a. Set day to day − ! ISODaysInYear(testYear).
-    *day -= iso_days_in_year;
-    // b. Set year to year + 1.
-    (*year)++;
-    // c. Set testYear to testYear + 1.
-    test_year++;
-  }
-  // 12. NOTE: To deal with negative numbers of days whose absolute value is
-  // greater than the number of days in the current month, the following section
-  // subtracts months and adds days until the number of days is greater than 0.
-  // 13. Repeat, while day < 1,
-  while (*day < 1) {
-    // a. Set balancedYearMonth to ! BalanceISOYearMonth(year, month − 1).
-    // b. Set year to balancedYearMonth.[[Year]].
-    // c. Set month to balancedYearMonth.[[Month]].
-    *month -= 1;
-    BalanceISOYearMonth(isolate, year, month);
-    // d. Set day to day + ! ISODaysInMonth(year, month).
-    *day += ISODaysInMonth(isolate, *year, *month);
-  }
-  // 14. NOTE: To deal with numbers of days greater than the number of days in
-  // the current month, the following section adds months and subtracts days
-  // until the number of days is less than the number of days in the month.
-  // 15. Repeat, while day > ! ISODaysInMonth(year, month),
-  int32_t iso_days_in_month;
-  while (*day > (iso_days_in_month = ISODaysInMonth(isolate, *year, *month))) {
-    // a. Set day to day − ! ISODaysInMonth(year, month).
-    *day -= iso_days_in_month;
-    // b. Set balancedYearMonth to ! BalanceISOYearMonth(year, month + 1).
-    // c. Set year to balancedYearMonth.[[Year]].
-    // d. Set month to balancedYearMonth.[[Month]].
-    *month += 1;
-    BalanceISOYearMonth(isolate, year, month);
-  }
+  // 5-15. Subtract or add the lengths of years and months until day is within
+  // the month. This is the date day - 1 days after the first of the month, so
+  // count the days from the epoch instead of looping.
+  EpochDaysToISODate(ISODateToEpochDays(*year, *month, 1) + *day - 1, year,
+                     month, day);
   // 16. Return the new Record { [[Year]]: year, [[Month]]: month, [[Day]]: day
   // }.
   return;
@@ -3250,6 +3246,15 @@ MaybeHandle<BigInt> GetEpochFromISOParts(Isolate* isolate, int32_t year,
   double ms = MakeDate(date, time);
   // 7. Assert: ms is finite.
   // 8. Return ℝ(ms) × 10^6 + microsecond × 10^3 + nanosecond.
+  // Within about 292 years of the epoch the result fits into an int64_t and
+  // can be computed without intermediate BigInts.
+  constexpr double kMaxInt64Milliseconds =
+      static_cast<double>(std::numeric_limits<int64_t>::max() / 1000000 - 1);
+  if (std::abs(ms) <= kMaxInt64Milliseconds) {
+    return BigInt::FromInt64(
+        isolate, static_cast<int64_t>(ms) * 1000000 +
+                     static_cast<int64_t>(microsecond) * 1000 + nanosecond);
+  }
   Handle<BigInt> result;
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, result,
@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include "src/base/bits.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -32,6 +33,18 @@ class DescriptorLookupCache {
 
   static const int kAbsent = -2;
 
+  static const int kLength = 64;
+
+  // Layout of the cache, which is probed and updated directly by the generic
+  // property load and store builtins.
+  static const int kKeySize = 2 * kSystemPointerSize;
+  static const int kKeySourceOffset = 0;
+  static const int kKeyNameOffset = kSystemPointerSize;
+  static const int kResultSize = kInt32Size;
+
+  Address keys_address() { return reinterpret_cast<Address>(keys_); }
+  Address results_address() { return reinterpret_cast<Address>(results_); }
+
  private:
   DescriptorLookupCache() {
     for (int i = 0; i < kLength; ++i) {
@@ -43,11 +56,15 @@ class DescriptorLookupCache {
 
   static inline int Hash(Map source, Name name);
 
-  static const int kLength = 64;
   struct Key {
     Map source;
     Name name;
   };
+  STATIC_ASSERT(sizeof(Key) == kKeySize);
+  STATIC_ASSERT(offsetof(Key, source) == kKeySourceOffset);
+  STATIC_ASSERT(offsetof(Key, name) == kKeyNameOffset);
+  STATIC_ASSERT(sizeof(int) == kResultSize);
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(kLength));
 
   Key keys_[kLength];
   int results_[kLength];
@@ -193,7 +193,8 @@ bool Module::Instantiate(
   Zone zone(isolate->allocator(), ZONE_NAME);
   ZoneForwardList<Handle<SourceTextModule>> stack(&zone);
   unsigned dfs_index = 0;
-  if (!FinishInstantiate(isolate, module, &stack, &dfs_index, &zone)) {
+  if (!FinishInstantiate(isolate, module, &stack, &dfs_index, &zone,
+                         nullptr)) {
     ResetGraph(isolate, module);
     DCHECK_EQ(module->status(), kUnlinked);
     return false;
@@ -226,7 +227,8 @@ bool Module::PrepareInstantiate(
 
 bool Module::FinishInstantiate(Isolate* isolate, Handle<Module> module,
                                ZoneForwardList<Handle<SourceTextModule>>* stack,
-                               unsigned* dfs_index, Zone* zone) {
+                               unsigned* dfs_index, Zone* zone,
+                               ResolveSet* unresolvable) {
   DCHECK_NE(module->status(), kEvaluating);
   if (module->status() >= kLinking) return true;
   DCHECK_EQ(module->status(), kPreLinking);
@@ -235,7 +237,7 @@ bool Module::FinishInstantiate(Isolate* isolate, Handle<Module> module,
   if (module->IsSourceTextModule()) {
     return SourceTextModule::FinishInstantiate(
         isolate, Handle<SourceTextModule>::cast(module), stack, dfs_index,
-        zone);
+        zone, unresolvable);
   } else {
     return SyntheticModule::FinishInstantiate(
         isolate, Handle<SyntheticModule>::cast(module));
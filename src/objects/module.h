@@ -114,7 +114,7 @@ class Module : public TorqueGeneratedModule<Module, HeapObject> {
   static V8_WARN_UNUSED_RESULT bool FinishInstantiate(
       Isolate* isolate, Handle<Module> module,
       ZoneForwardList<Handle<SourceTextModule>>* stack, unsigned* dfs_index,
-      Zone* zone);
+      Zone* zone, ResolveSet* unresolvable);
 
   // Set module's status back to kUnlinked and reset other internal state.
   // This is used when instantiation fails.
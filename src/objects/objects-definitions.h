@@ -122,6 +122,8 @@ namespace internal {
   V(_, CALLBACK_TASK_TYPE, CallbackTask, callback_task)                        \
   V(_, PROMISE_RESOLVE_THENABLE_JOB_TASK_TYPE, PromiseResolveThenableJobTask,  \
     promise_resolve_thenable_job_task)                                         \
+  V(_, ASYNC_FUNCTION_RESUME_JOB_TASK_TYPE, AsyncFunctionResumeJobTask,        \
+    async_function_resume_job_task)                                            \
   V(_, FUNCTION_TEMPLATE_INFO_TYPE, FunctionTemplateInfo,                      \
     function_template_info)                                                    \
   V(_, OBJECT_TEMPLATE_INFO_TYPE, ObjectTemplateInfo, object_template_info)    \
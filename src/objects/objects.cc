@@ -123,6 +123,7 @@
 #include "src/strings/string-stream.h"
 #include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/ostreams.h"
 #include "src/utils/utils-inl.h"
 #include "src/zone/zone.h"
@@ -4645,15 +4646,17 @@ void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
 #endif
 
   const int separator_length = separator.length();
-  const bool use_one_byte_separator_fast_path =
-      separator_length == 1 && sizeof(sinkchar) == 1 &&
-      StringShape(separator).IsSequentialOneByte();
-  uint8_t separator_one_char;
-  if (use_one_byte_separator_fast_path) {
-    CHECK(StringShape(separator).IsSequentialOneByte());
-    CHECK_EQ(separator.length(), 1);
-    separator_one_char = SeqOneByteString::cast(separator).GetChars(no_gc)[0];
-  }
+  const bool use_single_char_separator_fast_path = separator_length == 1;
+  sinkchar separator_one_char = 0;
+  if (use_single_char_separator_fast_path) {
+    // A one-byte sink is only used if the separator is one-byte as well.
+    DCHECK_IMPLIES(sizeof(sinkchar) == 1, separator.IsOneByteRepresentation());
+    separator_one_char = static_cast<sinkchar>(separator.Get(0));
+  }
+  // Longer separators are only flattened into the sink once; later copies are
+  // made from that first copy, which avoids dispatching on the separator's
+  // representation for every element.
+  const sinkchar* separator_in_sink = nullptr;
 
   uint32_t num_separators = 0;
   for (int i = 0; i < length; i++) {
@@ -4676,16 +4679,21 @@ void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
     if (num_separators > 0 && separator_length > 0) {
       // TODO(pwong): Consider doubling strategy employed by runtime-strings.cc
       //              WriteRepeatToFlat().
-      // Fast path for single character, single byte separators.
-      if (use_one_byte_separator_fast_path) {
+      // Fast path for single character separators.
+      if (use_single_char_separator_fast_path) {
         DCHECK_LE(sink + num_separators, sink_end);
-        memset(sink, separator_one_char, num_separators);
+        std::fill_n(sink, num_separators, separator_one_char);
         DCHECK_EQ(separator_length, 1);
         sink += num_separators;
       } else {
         for (uint32_t j = 0; j < num_separators; j++) {
           DCHECK_LE(sink + separator_length, sink_end);
-          String::WriteToFlat(separator, sink, 0, separator_length);
+          if (separator_in_sink == nullptr) {
+            String::WriteToFlat(separator, sink, 0, separator_length);
+            separator_in_sink = sink;
+          } else {
+            CopyChars(sink, separator_in_sink, separator_length);
+          }
           sink += separator_length;
         }
       }
@@ -5295,6 +5303,7 @@ bool AllocationSite::ShouldTrack(ElementsKind from, ElementsKind to) {
   return IsMoreGeneralElementsKindTransition(from, to);
 }
 
+// static
 const char* AllocationSite::PretenureDecisionName(PretenureDecision decision) {
   switch (decision) {
     case kUndecided:
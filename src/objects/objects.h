@@ -190,6 +190,7 @@
 //           - PromiseFulfillReactionJobTask
 //           - PromiseRejectReactionJobTask
 //         - PromiseResolveThenableJobTask
+//         - AsyncFunctionResumeJobTask
 //       - Module
 //         - SourceTextModule
 //         - SyntheticModule
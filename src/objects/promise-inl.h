@@ -7,6 +7,7 @@
 
 #include "src/objects/promise.h"
 
+#include "src/objects/js-generator-inl.h"
 #include "src/objects/js-promise-inl.h"
 #include "src/objects/microtask-inl.h"
 
@@ -22,6 +23,7 @@ TQ_OBJECT_CONSTRUCTORS_IMPL(PromiseReactionJobTask)
 TQ_OBJECT_CONSTRUCTORS_IMPL(PromiseFulfillReactionJobTask)
 TQ_OBJECT_CONSTRUCTORS_IMPL(PromiseRejectReactionJobTask)
 TQ_OBJECT_CONSTRUCTORS_IMPL(PromiseResolveThenableJobTask)
+TQ_OBJECT_CONSTRUCTORS_IMPL(AsyncFunctionResumeJobTask)
 TQ_OBJECT_CONSTRUCTORS_IMPL(PromiseCapability)
 TQ_OBJECT_CONSTRUCTORS_IMPL(PromiseReaction)
 
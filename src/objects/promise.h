@@ -13,6 +13,7 @@
 namespace v8 {
 namespace internal {
 
+class JSAsyncFunctionObject;
 class JSPromise;
 class StructBodyDescriptor;
 
@@ -72,6 +73,18 @@ class PromiseResolveThenableJobTask
   TQ_OBJECT_CONSTRUCTORS(PromiseResolveThenableJobTask)
 };
 
+// A container struct to hold state required to resume an async function that
+// awaits an already settled native promise, without allocating the closures
+// and the PromiseReaction of the general case.
+class AsyncFunctionResumeJobTask
+    : public TorqueGeneratedAsyncFunctionResumeJobTask<
+          AsyncFunctionResumeJobTask, Microtask> {
+ public:
+  using BodyDescriptor = StructBodyDescriptor;
+
+  TQ_OBJECT_CONSTRUCTORS(AsyncFunctionResumeJobTask)
+};
+
 // Struct to hold the state of a PromiseCapability.
 class PromiseCapability
     : public TorqueGeneratedPromiseCapability<PromiseCapability, Struct> {
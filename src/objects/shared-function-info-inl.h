@@ -261,6 +261,22 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
                     has_static_private_methods_or_accessors,
                     SharedFunctionInfo::HasStaticPrivateMethodsOrAccessorsBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_optimized_at_least_once,
+                    SharedFunctionInfo::HasOptimizedAtLeastOnceBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compilation_failed,
+                    SharedFunctionInfo::MaglevCompilationFailedBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_maglev_code_at_least_once,
+                    SharedFunctionInfo::HasMaglevCodeAtLeastOnceBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_baseline_code_at_least_once,
+                    SharedFunctionInfo::HasBaselineCodeAtLeastOnceBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
+                    has_feedback_vector_at_least_once,
+                    SharedFunctionInfo::HasFeedbackVectorAtLeastOnceBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -607,7 +623,7 @@ void SharedFunctionInfo::set_bytecode_array(BytecodeArray bytecode) {
 }
 
 bool SharedFunctionInfo::ShouldFlushCode(
-    base::EnumSet<CodeFlushMode> code_flush_mode) {
+    base::EnumSet<CodeFlushMode> code_flush_mode, int flushing_age) {
   if (IsFlushingDisabled(code_flush_mode)) return false;
 
   // TODO(rmcilroy): Enable bytecode flushing for resumable functions.
@@ -637,7 +653,7 @@ bool SharedFunctionInfo::ShouldFlushCode(
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
-  return bytecode.IsOld();
+  return bytecode.bytecode_age() >= flushing_age;
 }
 
 CodeT SharedFunctionInfo::InterpreterTrampoline() const {
@@ -446,6 +446,33 @@ class SharedFunctionInfo
   DECL_BOOLEAN_ACCESSORS(class_scope_has_private_brand)
   DECL_BOOLEAN_ACCESSORS(has_static_private_methods_or_accessors)
 
+  // True once TurboFan code has been installed for this function. The bit is
+  // part of the serialized SharedFunctionInfo, so it survives the code cache
+  // and lets the TieringManager tier up previously hot functions early. It is
+  // also set by tiering hints (see v8::Isolate::SetTieringHints).
+  DECL_BOOLEAN_ACCESSORS(has_optimized_at_least_once)
+
+  // True if Maglev failed to compile this function, e.g. because it uses a
+  // bytecode Maglev does not support yet. Such functions skip the Maglev tier
+  // and tier up to TurboFan directly.
+  DECL_BOOLEAN_ACCESSORS(maglev_compilation_failed)
+
+  // Like has_optimized_at_least_once, but for Maglev code. Machine code is
+  // never part of the code cache, so this hint is what lets a warm-started
+  // process reach the Maglev tier quickly.
+  DECL_BOOLEAN_ACCESSORS(has_maglev_code_at_least_once)
+
+  // True if Sparkplug code was installed for this function at some point.
+  // Functions deserialized from the code cache with this bit set are compiled
+  // with Sparkplug right away instead of waiting for their interrupt budget.
+  DECL_BOOLEAN_ACCESSORS(has_baseline_code_at_least_once)
+
+  // True if a closure of this function got a feedback vector at some point.
+  // Closures of functions deserialized from the code cache with this bit set
+  // get their feedback vector right away instead of first running through
+  // the interpreter without collecting feedback.
+  DECL_BOOLEAN_ACCESSORS(has_feedback_vector_at_least_once)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -561,8 +588,10 @@ class SharedFunctionInfo
 
   // Returns true if the function has old bytecode that could be flushed. This
   // function shouldn't access any flags as it is used by concurrent marker.
-  // Hence it takes the mode as an argument.
-  inline bool ShouldFlushCode(base::EnumSet<CodeFlushMode> code_flush_mode);
+  // Hence it takes the mode and the bytecode age at which code is considered
+  // old as arguments.
+  inline bool ShouldFlushCode(base::EnumSet<CodeFlushMode> code_flush_mode,
+                              int flushing_age);
 
   enum Inlineability {
     // Different reasons for not being inlineable:
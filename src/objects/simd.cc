@@ -0,0 +1,169 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/simd.h"
+
+#include <cmath>
+#include <type_traits>
+
+#include "src/base/build_config.h"
+#include "src/base/memory.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/heap-number-inl.h"
+#include "src/objects/smi-inl.h"
+
+#if V8_HOST_ARCH_X64 || (V8_HOST_ARCH_IA32 && defined(__SSE2__))
+#define V8_ARRAY_SEARCH_SSE2 1
+#include <emmintrin.h>
+#elif V8_HOST_ARCH_ARM64
+#define V8_ARRAY_SEARCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The elements are only tagged-aligned, which with pointer compression is
+// less than the alignment of doubles, so all loads are unaligned.
+template <typename T>
+T LoadElement(Address start, uintptr_t index) {
+  return base::ReadUnalignedValue<T>(start + index * sizeof(T));
+}
+
+template <typename T>
+intptr_t SlowSearch(Address start, uintptr_t len, uintptr_t index,
+                    T search_element) {
+  for (; index < len; index++) {
+    if (LoadElement<T>(start, index) == search_element) {
+      return static_cast<intptr_t>(index);
+    }
+  }
+  return -1;
+}
+
+// Returns whether any of the elements in the 16 bytes at {block} is equal to
+// {search_element}.
+#if V8_ARRAY_SEARCH_SSE2
+template <typename T>
+bool BlockContains(Address block, T search_element);
+
+template <>
+bool BlockContains(Address block, uint32_t search_element) {
+  __m128i elements = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  __m128i search = _mm_set1_epi32(static_cast<int32_t>(search_element));
+  __m128i equal = _mm_cmpeq_epi32(elements, search);
+  return _mm_movemask_epi8(equal) != 0;
+}
+
+template <>
+bool BlockContains(Address block, uint64_t search_element) {
+  __m128i elements = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  __m128i search = _mm_set1_epi64x(static_cast<int64_t>(search_element));
+  // SSE2 has no 64-bit equality, combine the halves of each element.
+  __m128i equal = _mm_cmpeq_epi32(elements, search);
+  equal =
+      _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_movemask_epi8(equal) != 0;
+}
+
+template <>
+bool BlockContains(Address block, double search_element) {
+  __m128d elements = _mm_loadu_pd(reinterpret_cast<const double*>(block));
+  __m128d equal = _mm_cmpeq_pd(elements, _mm_set1_pd(search_element));
+  return _mm_movemask_pd(equal) != 0;
+}
+#elif V8_ARRAY_SEARCH_NEON
+template <typename T>
+bool BlockContains(Address block, T search_element);
+
+template <>
+bool BlockContains(Address block, uint32_t search_element) {
+  uint32x4_t elements = vld1q_u32(reinterpret_cast<const uint32_t*>(block));
+  return vmaxvq_u32(vceqq_u32(elements, vdupq_n_u32(search_element))) != 0;
+}
+
+template <>
+bool BlockContains(Address block, uint64_t search_element) {
+  uint64x2_t elements = vld1q_u64(reinterpret_cast<const uint64_t*>(block));
+  uint64x2_t equal = vceqq_u64(elements, vdupq_n_u64(search_element));
+  return vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0;
+}
+
+template <>
+bool BlockContains(Address block, double search_element) {
+  float64x2_t elements = vld1q_f64(reinterpret_cast<const double*>(block));
+  uint64x2_t equal = vceqq_f64(elements, vdupq_n_f64(search_element));
+  return vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0;
+}
+#else
+// Without vector instructions, the block equality is computed without
+// branches so that the compiler can at least overlap the comparisons.
+template <typename T>
+bool BlockContains(Address block, T search_element) {
+  constexpr uintptr_t kElements = 16 / sizeof(T);
+  bool found = false;
+  for (uintptr_t i = 0; i < kElements; i++) {
+    found |= LoadElement<T>(block, i) == search_element;
+  }
+  return found;
+}
+#endif
+
+// Compares 16 bytes of elements at a time with {search_element}. The elements
+// of the block that contains a match are compared again one by one to find
+// its index.
+template <typename T>
+intptr_t FastSearch(Address start, uintptr_t len, uintptr_t index,
+                    T search_element) {
+  constexpr uintptr_t kBlockElements = 16 / sizeof(T);
+  for (; index + kBlockElements <= len; index += kBlockElements) {
+    Address block = start + index * sizeof(T);
+    if (BlockContains<T>(block, search_element)) {
+      return SlowSearch<T>(start, index + kBlockElements, index,
+                           search_element);
+    }
+  }
+  return SlowSearch<T>(start, len, index, search_element);
+}
+
+}  // namespace
+
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address array, uintptr_t array_len,
+                                         uintptr_t from_index,
+                                         Address search_element) {
+  DisallowGarbageCollection no_gc;
+  FixedArray fixed_array = FixedArray::cast(Object(array));
+  DCHECK_LE(array_len, fixed_array.length());
+  Address start = fixed_array.data_start().address();
+  // Elements are compared by their tagged representation, which for
+  // compressed pointers is the lower half of the full pointer.
+  using TaggedValue =
+      std::conditional<kTaggedSize == 4, uint32_t, uint64_t>::type;
+  STATIC_ASSERT(sizeof(TaggedValue) == kTaggedSize);
+  return FastSearch<TaggedValue>(start, array_len, from_index,
+                                 static_cast<TaggedValue>(search_element));
+}
+
+intptr_t ArrayIndexOfIncludesDouble(Address array, uintptr_t array_len,
+                                    uintptr_t from_index,
+                                    Address search_element) {
+  DisallowGarbageCollection no_gc;
+  FixedDoubleArray fixed_array = FixedDoubleArray::cast(Object(array));
+  DCHECK_LE(array_len, fixed_array.length());
+  Address start =
+      fixed_array.address() + FixedDoubleArray::OffsetOfElementAt(0);
+  Object search = Object(search_element);
+  double search_num = search.IsSmi() ? Smi::ToInt(search)
+                                     : HeapNumber::cast(search).value();
+  DCHECK(!std::isnan(search_num));
+  return FastSearch<double>(start, array_len, from_index, search_num);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#undef V8_ARRAY_SEARCH_SSE2
+#undef V8_ARRAY_SEARCH_NEON
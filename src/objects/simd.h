@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_SIMD_H_
+#define V8_OBJECTS_SIMD_H_
+
+#include <cstdint>
+
+#include "include/v8-internal.h"
+
+namespace v8 {
+namespace internal {
+
+// Array.prototype.indexOf and Array.prototype.includes call these for large
+// arrays instead of looping in CSA. Both return the index of the first match
+// at or after {from_index}, or -1 if there is none.
+
+// Arrays with fewer elements left to search are not worth the C call.
+constexpr uintptr_t kArrayIndexOfIncludesMinSearchLength = 32;
+
+// Searches the FixedArray {array} for a tagged value identical to
+// {search_element}.
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address array, uintptr_t array_len,
+                                         uintptr_t from_index,
+                                         Address search_element);
+
+// Searches the FixedDoubleArray {array} for a value equal to the Smi or
+// HeapNumber {search_element}, which must not be NaN. Holes never match.
+intptr_t ArrayIndexOfIncludesDouble(Address array, uintptr_t array_len,
+                                    uintptr_t from_index,
+                                    Address search_element);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_SIMD_H_
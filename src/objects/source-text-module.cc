@@ -61,7 +61,7 @@ class Module::ResolveSet
           ModuleHandleEqual,
           ZoneAllocator<std::pair<const Handle<Module>, UnorderedStringSet*>>> {
  public:
-  explicit ResolveSet(Zone* zone)
+  explicit ResolveSet(Zone* zone, ResolveSet* unresolvable = nullptr)
       : std::unordered_map<Handle<Module>, UnorderedStringSet*,
                            ModuleHandleHash, ModuleHandleEqual,
                            ZoneAllocator<std::pair<const Handle<Module>,
@@ -69,12 +69,38 @@ class Module::ResolveSet
             2 /* bucket count */, ModuleHandleHash(), ModuleHandleEqual(),
             ZoneAllocator<std::pair<const Handle<Module>, UnorderedStringSet*>>(
                 zone)),
-        zone_(zone) {}
+        zone_(zone),
+        unresolvable_(unresolvable) {}
 
   Zone* zone() const { return zone_; }
 
+  bool Contains(Handle<Module> module, Handle<String> name) const {
+    auto it = find(module);
+    return it != end() && it->second->count(name) != 0;
+  }
+
+  void Add(Handle<Module> module, Handle<String> name) {
+    auto result = insert({module, nullptr});
+    if (result.second) {
+      result.first->second = zone_->New<UnorderedStringSet>(zone_);
+    }
+    result.first->second->insert(name);
+  }
+
+  // Names that some module is known not to provide through its star exports.
+  // This is shared by all resolutions of one instantiation, so that failing
+  // star export lookups are not repeated for every importer.
+  ResolveSet* unresolvable() const { return unresolvable_; }
+
+  // Number of times a resolution stopped at an entry that was already on the
+  // path. A failed lookup may only be cached if it did not depend on that.
+  int cycle_count() const { return cycle_count_; }
+  void RecordCycle() { cycle_count_++; }
+
  private:
   Zone* zone_;
+  ResolveSet* unresolvable_;
+  int cycle_count_ = 0;
 };
 
 struct SourceTextModule::AsyncEvaluatingOrdinalCompare {
@@ -199,6 +225,7 @@ MaybeHandle<Cell> SourceTextModule::ResolveExport(
       name_set = zone->New<UnorderedStringSet>(zone);
     } else if (name_set->count(export_name)) {
       // Cycle detected.
+      resolve_set->RecordCycle();
       if (must_resolve) {
         return isolate->ThrowAt<Cell>(
             isolate->factory()->NewSyntaxError(
@@ -267,9 +294,13 @@ MaybeHandle<Cell> SourceTextModule::ResolveExportUsingStarExports(
     Isolate* isolate, Handle<SourceTextModule> module,
     Handle<String> module_specifier, Handle<String> export_name,
     MessageLocation loc, bool must_resolve, Module::ResolveSet* resolve_set) {
-  if (!export_name->Equals(ReadOnlyRoots(isolate).default_string())) {
+  ResolveSet* unresolvable = resolve_set->unresolvable();
+  if (!export_name->Equals(ReadOnlyRoots(isolate).default_string()) &&
+      (unresolvable == nullptr ||
+       !unresolvable->Contains(module, export_name))) {
     // Go through all star exports looking for the given name.  If multiple star
     // exports provide the name, make sure they all map it to the same cell.
+    int cycle_count = resolve_set->cycle_count();
     Handle<Cell> unique_cell;
     Handle<FixedArray> special_exports(module->info().special_exports(),
                                        isolate);
@@ -307,6 +338,12 @@ MaybeHandle<Cell> SourceTextModule::ResolveExportUsingStarExports(
       module->set_exports(*exports);
       return unique_cell;
     }
+
+    // No star export provides the name. Unless a cycle cut the search short,
+    // this holds regardless of the path that led here.
+    if (unresolvable != nullptr && resolve_set->cycle_count() == cycle_count) {
+      unresolvable->Add(module, export_name);
+    }
   }
 
   // Unresolvable.
@@ -453,7 +490,11 @@ bool SourceTextModule::MaybeTransitionComponent(
 bool SourceTextModule::FinishInstantiate(
     Isolate* isolate, Handle<SourceTextModule> module,
     ZoneForwardList<Handle<SourceTextModule>>* stack, unsigned* dfs_index,
-    Zone* zone) {
+    Zone* zone, ResolveSet* unresolvable) {
+  // The root of the instantiation creates the cache of failed star export
+  // lookups that all modules of the graph share.
+  if (unresolvable == nullptr) unresolvable = zone->New<ResolveSet>(zone);
+
   // Instantiate SharedFunctionInfo and mark module as instantiating for
   // the recursion.
   Handle<SharedFunctionInfo> shared(SharedFunctionInfo::cast(module->code()),
@@ -474,7 +515,7 @@ bool SourceTextModule::FinishInstantiate(
     Handle<Module> requested_module(Module::cast(requested_modules->get(i)),
                                     isolate);
     if (!Module::FinishInstantiate(isolate, requested_module, stack, dfs_index,
-                                   zone)) {
+                                   zone, unresolvable)) {
       return false;
     }
 
@@ -506,7 +547,7 @@ bool SourceTextModule::FinishInstantiate(
         SourceTextModuleInfoEntry::cast(regular_imports->get(i)), isolate);
     Handle<String> name(String::cast(entry->import_name()), isolate);
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(zone);
+    ResolveSet resolve_set(zone, unresolvable);
     Handle<Cell> cell;
     if (!ResolveImport(isolate, module, name, entry->module_request(), loc,
                        true, &resolve_set)
@@ -524,7 +565,7 @@ bool SourceTextModule::FinishInstantiate(
     Handle<Object> name(entry->export_name(), isolate);
     if (name->IsUndefined(isolate)) continue;  // Star export.
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(zone);
+    ResolveSet resolve_set(zone, unresolvable);
     if (ResolveExport(isolate, module, Handle<String>(),
                       Handle<String>::cast(name), loc, true, &resolve_set)
             .is_null()) {
@@ -106,25 +106,46 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
-  void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements(), 1));
-
-    number_of_elements_++;
+  // Stores {entry} at {index} if the slot still holds {expected}, i.e. if no
+  // concurrent insert claimed it first.
+  bool TrySet(InternalIndex index, Object expected, String entry) {
+#ifdef V8_COMPRESS_POINTERS
+    Tagged_t expected_value = CompressTagged(expected.ptr());
+    Tagged_t entry_value = CompressTagged(entry.ptr());
+#else
+    Tagged_t expected_value = expected.ptr();
+    Tagged_t entry_value = entry.ptr();
+#endif
+    return AsAtomicTagged::Release_CompareAndSwap(
+               &elements_[index.as_uint32()], expected_value, entry_value) ==
+           expected_value;
+  }
+
+  // Inserts first reserve room for their element, so that concurrent inserts
+  // cannot overfill the table. Fails if the table has to grow first.
+  bool TryReserveElement() {
+    int nof = number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    if (StringTableHasSufficientCapacityToAdd(
+            capacity(), nof, number_of_deleted_elements(), 1)) {
+      return true;
+    }
+    CancelElementReservation();
+    return false;
+  }
+  void CancelElementReservation() {
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
-
-    number_of_elements_++;
-    number_of_deleted_elements_--;
+    DCHECK_LT(0, number_of_deleted_elements());
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  void ElementsAdded(int count) {
+    number_of_elements_.fetch_add(count, std::memory_order_relaxed);
   }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
-    number_of_deleted_elements_ += count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_add(count, std::memory_order_relaxed);
   }
 
   void* operator new(size_t size, int capacity);
@@ -132,8 +153,12 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
-  int number_of_deleted_elements() const { return number_of_deleted_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  int number_of_deleted_elements() const {
+    return number_of_deleted_elements_.load(std::memory_order_relaxed);
+  }
 
   template <typename IsolateT, typename StringTableKey>
   InternalIndex FindEntry(IsolateT* isolate, StringTableKey* key,
@@ -176,8 +201,8 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
-  int number_of_deleted_elements_;
+  std::atomic<int> number_of_elements_;
+  std::atomic<int> number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
 };
@@ -243,7 +268,8 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
         new_data->FindInsertionEntry(cage_base, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -336,7 +362,8 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    // Wait for concurrent inserts, whose reservations are counted already.
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
     return data_.load(std::memory_order_relaxed)->number_of_elements();
   }
 }
@@ -361,6 +388,12 @@ class InternalizedStringKey final : public StringTableKey {
     return string_->SlowEquals(string);
   }
 
+  // Migrating the string in place must only happen once it is certain that
+  // this string is inserted, see GetHandleForInsertion().
+  bool CanInsertConcurrently() const {
+    return maybe_internalized_map_.is_null();
+  }
+
   void PrepareForInsertion(Isolate* isolate) {
     StringTransitionStrategy strategy =
         isolate->factory()->ComputeInternalizationStrategyForString(
@@ -529,8 +562,46 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
+
+  // Inserts of keys without side effects on insertion (see
+  // StringTableKey::CanInsertConcurrently) can run concurrently with each
+  // other: they claim an empty or deleted slot with a compare-and-swap, and
+  // start over from a new lookup if another insert claimed it first. This
+  // works because the probe sequence of a key only changes when the table is
+  // resized or when the GC removes elements, and both exclude inserts.
+  if (key->CanInsertConcurrently()) {
+    while (true) {
+      {
+        base::SharedMutexGuard<base::kShared> table_insert_guard(&write_mutex_);
+        Data* data = data_.load(std::memory_order_relaxed);
+        if (data->TryReserveElement()) {
+          Handle<String> new_string = key->GetHandleForInsertion();
+          DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
+          while (true) {
+            entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+            Object element = data->Get(isolate, entry);
+            if (element != empty_element() && element != deleted_element()) {
+              // Another thread added the key after the check above.
+              data->CancelElementReservation();
+              return handle(String::cast(element), isolate);
+            }
+            if (data->TrySet(entry, element, *new_string)) {
+              if (element == deleted_element()) {
+                data->DeletedElementOverwritten();
+              }
+              return new_string;
+            }
+          }
+        }
+      }
+      // The table is full, grow it and try again.
+      base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
+      EnsureCapacity(isolate, 1);
+    }
+  }
+
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
 
     Data* data = EnsureCapacity(isolate, 1);
 
@@ -539,21 +610,16 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
     entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
 
     Object element = data->Get(isolate, entry);
-    if (element == empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      Handle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
-      data->Set(entry, *new_string);
-      data->ElementAdded();
-      return new_string;
-    } else if (element == deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
+    if (element == empty_element() || element == deleted_element()) {
+      // This entry is empty or was deleted, so write it and register that we
+      // added an element.
+      bool reserved = data->TryReserveElement();
+      DCHECK(reserved);
+      USE(reserved);
       Handle<String> new_string = key->GetHandleForInsertion();
       DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
       data->Set(entry, *new_string);
-      data->DeletedElementOverwritten();
+      if (element == deleted_element()) data->DeletedElementOverwritten();
       return new_string;
     } else {
       // Return the existing string as a handle.
@@ -562,6 +628,50 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   }
 }
 
+template <typename StringTableKey, typename IsolateT>
+MaybeHandle<String> StringTable::TryLookupKey(IsolateT* isolate,
+                                              StringTableKey* key) {
+  // See LookupKey for why reading without the lock is safe.
+  const Data* current_data = data_.load(std::memory_order_acquire);
+  InternalIndex entry = current_data->FindEntry(isolate, key, key->hash());
+  if (entry.is_not_found()) return {};
+  return handle(String::cast(current_data->Get(isolate, entry)), isolate);
+}
+
+template MaybeHandle<String> StringTable::TryLookupKey(Isolate* isolate,
+                                                       OneByteStringKey* key);
+template MaybeHandle<String> StringTable::TryLookupKey(Isolate* isolate,
+                                                       TwoByteStringKey* key);
+template MaybeHandle<String> StringTable::TryLookupKey(LocalIsolate* isolate,
+                                                       OneByteStringKey* key);
+template MaybeHandle<String> StringTable::TryLookupKey(LocalIsolate* isolate,
+                                                       TwoByteStringKey* key);
+
+void StringTable::ReserveForInsertions(PtrComprCageBase cage_base, int count) {
+  base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
+  EnsureCapacity(cage_base, count);
+}
+
+void StringTable::InsertForIsolateDeserialization(
+    Isolate* isolate, const std::vector<Handle<String>>& strings) {
+  DCHECK_EQ(NumberOfElements(), 0);
+  const int length = static_cast<int>(strings.size());
+
+  base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
+
+  Data* data = EnsureCapacity(isolate, length);
+
+  for (const Handle<String>& string : strings) {
+    DCHECK(string->IsInternalizedString());
+    InternalIndex entry =
+        data->FindInsertionEntry(isolate, string->EnsureHash());
+    // Since this is startup, there are no duplicate entries to overwrite.
+    DCHECK_EQ(empty_element(), data->Get(isolate, entry));
+    data->Set(entry, *string);
+  }
+  data->ElementsAdded(length);
+}
+
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
                                                OneByteStringKey* key);
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
@@ -583,8 +693,7 @@ template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
 
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the write mutex is held exclusively.
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
@@ -595,18 +704,19 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
   // enough space.
   int current_capacity = data->capacity();
   int current_nof = data->number_of_elements();
-  int capacity_after_shrinking =
-      ComputeStringTableCapacityWithShrink(current_capacity, current_nof + 1);
+  int capacity_after_shrinking = ComputeStringTableCapacityWithShrink(
+      current_capacity, current_nof + additional_elements);
 
   int new_capacity = -1;
   if (capacity_after_shrinking < current_capacity) {
-    DCHECK(StringTableHasSufficientCapacityToAdd(capacity_after_shrinking,
-                                                 current_nof, 0, 1));
+    DCHECK(StringTableHasSufficientCapacityToAdd(
+        capacity_after_shrinking, current_nof, 0, additional_elements));
     new_capacity = capacity_after_shrinking;
   } else if (!StringTableHasSufficientCapacityToAdd(
                  current_capacity, current_nof,
-                 data->number_of_deleted_elements(), 1)) {
-    new_capacity = ComputeStringTableCapacity(current_nof + 1);
+                 data->number_of_deleted_elements(), additional_elements)) {
+    new_capacity =
+        ComputeStringTableCapacity(current_nof + additional_elements);
   }
 
   if (new_capacity != -1) {
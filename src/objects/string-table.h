@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_STRING_TABLE_H_
 #define V8_OBJECTS_STRING_TABLE_H_
 
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
@@ -30,6 +32,10 @@ class StringTableKey {
   inline uint32_t hash() const;
   int length() const { return length_; }
 
+  // Whether GetHandleForInsertion() may be called by threads that then lose
+  // the race to insert the key, i.e. whether it does not change the heap.
+  bool CanInsertConcurrently() const { return true; }
+
  protected:
   inline void set_raw_hash_field(uint32_t raw_hash_field);
 
@@ -66,6 +72,22 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   Handle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // Find string in the string table, using the given key, without adding it.
+  // Does not take the write lock, so it may miss a concurrently added string.
+  template <typename StringTableKey, typename IsolateT>
+  MaybeHandle<String> TryLookupKey(IsolateT* isolate, StringTableKey* key);
+
+  // Grows the table so that {count} strings can be added without another
+  // resize. Callers about to insert a batch of strings use this so that the
+  // table is grown once instead of repeatedly during the batch.
+  void ReserveForInsertions(PtrComprCageBase cage_base, int count);
+
+  // Inserts the given internalized strings in bulk, growing the table at most
+  // once. None of them may be in the table yet, so no lookups are done. Used
+  // when deserializing the string table of a new Isolate.
+  void InsertForIsolateDeserialization(
+      Isolate* isolate, const std::vector<Handle<String>>& strings);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
@@ -90,9 +112,11 @@ class V8_EXPORT_PRIVATE StringTable {
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
+  // Inserts hold the write mutex shared and claim their slot with a
+  // compare-and-swap, while resizes and other writers hold it exclusively.
+  // It is mutable so that readers of concurrently mutated values (e.g.
   // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  mutable base::SharedMutex write_mutex_;
   Isolate* isolate_;
 };
 
@@ -52,6 +52,7 @@ namespace internal {
 //             unknown tags)
 // Version 14: flags for JSArrayBufferViews
 // Version 15: support for shared objects with an explicit tag
+// Version 16: packed arrays of Smis and doubles without per-element tags
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -60,7 +61,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 15;
+static const uint32_t kLatestVersion = 16;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -120,6 +121,14 @@ enum class SerializationTag : uint8_t {
   kBeginDenseJSArray = 'A',
   // End of a dense JS array. numProperties:uint32_t length:uint32_t
   kEndDenseJSArray = '$',
+  // Beginning of a dense JS array of Smis. length:uint32_t
+  // |length| ZigZag-encoded int32_t elements without a tag each, followed by
+  // properties and kEndDenseJSArray like a dense JS array.
+  kBeginDenseSmiJSArray = 'J',
+  // Beginning of a dense JS array of doubles. length:uint32_t
+  // |length| doubles without a tag each, followed by properties and
+  // kEndDenseJSArray like a dense JS array.
+  kBeginDenseDoubleJSArray = 'K',
   // Date. millisSinceEpoch:double
   kDate = 'D',
   // Boolean object. No data.
@@ -691,18 +700,25 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
 
   if (should_serialize_densely) {
     DCHECK_LE(length, static_cast<uint32_t>(FixedArray::kMaxLength));
-    WriteTag(SerializationTag::kBeginDenseJSArray);
+    ElementsKind kind = array->GetElementsKind(cage_base);
+    // Arrays of numbers are written without a tag per element.
+    WriteTag(kind == PACKED_SMI_ELEMENTS
+                 ? SerializationTag::kBeginDenseSmiJSArray
+                 : kind == PACKED_DOUBLE_ELEMENTS
+                       ? SerializationTag::kBeginDenseDoubleJSArray
+                       : SerializationTag::kBeginDenseJSArray);
     WriteVarint<uint32_t>(length);
     uint32_t i = 0;
 
     // Fast paths. Note that PACKED_ELEMENTS in particular can bail due to the
     // structure of the elements changing.
-    switch (array->GetElementsKind(cage_base)) {
+    switch (kind) {
       case PACKED_SMI_ELEMENTS: {
         DisallowGarbageCollection no_gc;
         FixedArray elements = FixedArray::cast(array->elements());
-        for (i = 0; i < length; i++)
-          WriteSmi(Smi::cast(elements.get(cage_base, i)));
+        for (i = 0; i < length; i++) {
+          WriteZigZag<int32_t>(Smi::cast(elements.get(cage_base, i)).value());
+        }
         break;
       }
       case PACKED_DOUBLE_ELEMENTS: {
@@ -711,10 +727,7 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
         if (length == 0) break;
         DisallowGarbageCollection no_gc;
         FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
-        for (i = 0; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements.get_scalar(i));
-        }
+        for (i = 0; i < length; i++) WriteDouble(elements.get_scalar(i));
         break;
       }
       case PACKED_ELEMENTS: {
@@ -1485,8 +1498,14 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
 #endif  // V8_ENABLE_WEBASSEMBLY
     case SerializationTag::kHostObject:
       return ReadHostObject();
+    case SerializationTag::kBeginDenseSmiJSArray:
+    case SerializationTag::kBeginDenseDoubleJSArray:
+      if (version_ >= 16) return ReadDenseNumberJSArray(tag);
+      // Treat the tags as unknown in older versions.
+      V8_FALLTHROUGH;
     case SerializationTag::kSharedObject:
-      if (version_ >= 15 && supports_shared_values_) {
+      if (tag == SerializationTag::kSharedObject && version_ >= 15 &&
+          supports_shared_values_) {
         return ReadSharedObject();
       }
       // If the delegate doesn't support shared values (e.g. older version, or
@@ -1731,6 +1750,66 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   return scope.CloseAndEscape(array);
 }
 
+MaybeHandle<JSArray> ValueDeserializer::ReadDenseNumberJSArray(
+    SerializationTag tag) {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSArray>());
+
+  // Each element takes at least one byte to encode, and doubles take eight,
+  // so if there are fewer bytes than that we can fail fast.
+  const bool is_double = tag == SerializationTag::kBeginDenseDoubleJSArray;
+  const size_t min_element_size = is_double ? sizeof(double) : 1;
+  uint32_t length;
+  if (!ReadVarint<uint32_t>().To(&length) ||
+      length > static_cast<uint32_t>(is_double ? FixedDoubleArray::kMaxLength
+                                               : FixedArray::kMaxLength) ||
+      length > static_cast<size_t>(end_ - position_) / min_element_size) {
+    return MaybeHandle<JSArray>();
+  }
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<JSArray> array = isolate_->factory()->NewJSArray(
+      is_double ? PACKED_DOUBLE_ELEMENTS : PACKED_SMI_ELEMENTS, length, length,
+      INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
+  AddObjectWithID(id, array);
+
+  if (length > 0) {
+    DisallowGarbageCollection no_gc;
+    if (is_double) {
+      FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
+      for (uint32_t i = 0; i < length; i++) {
+        double value;
+        if (!ReadDouble().To(&value)) return MaybeHandle<JSArray>();
+        elements.set(i, value);
+      }
+    } else {
+      FixedArray elements = FixedArray::cast(array->elements());
+      for (uint32_t i = 0; i < length; i++) {
+        int32_t value;
+        if (!ReadZigZag<int32_t>().To(&value) || !Smi::IsValid(value)) {
+          return MaybeHandle<JSArray>();
+        }
+        elements.set(i, Smi::FromInt(value));
+      }
+    }
+  }
+
+  uint32_t num_properties;
+  uint32_t expected_num_properties;
+  uint32_t expected_length;
+  if (!ReadJSObjectProperties(array, SerializationTag::kEndDenseJSArray, false)
+           .To(&num_properties) ||
+      !ReadVarint<uint32_t>().To(&expected_num_properties) ||
+      !ReadVarint<uint32_t>().To(&expected_length) ||
+      num_properties != expected_num_properties || length != expected_length) {
+    return MaybeHandle<JSArray>();
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(array);
+}
+
 MaybeHandle<JSDate> ValueDeserializer::ReadJSDate() {
   double value;
   if (!ReadDouble().To(&value)) return MaybeHandle<JSDate>();
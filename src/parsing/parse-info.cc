@@ -208,6 +208,8 @@ ParseInfo::ParseInfo(const UnoptimizedCompileFlags flags,
       state_(state),
       reusable_state_(reusable_state),
       extension_(nullptr),
+      compile_hint_callback_(nullptr),
+      compile_hint_callback_data_(nullptr),
       script_scope_(nullptr),
       stack_limit_(stack_limit),
       parameters_end_pos_(kNoSourcePosition),
@@ -2636,6 +2636,16 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
           ? FunctionLiteral::kShouldEagerCompile
           : default_eager_compile_hint();
 
+  // Let the embedder select functions for eager compilation, e.g. the ones it
+  // saw being called during a previous run. The position is the start
+  // position of the function, i.e. the position of the parameter list.
+  if (V8_UNLIKELY(info()->compile_hint_callback() != nullptr) &&
+      eager_compile_hint == FunctionLiteral::kShouldLazyCompile &&
+      info()->compile_hint_callback()(peek_position(),
+                                      info()->compile_hint_callback_data())) {
+    eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
+  }
+
   // Determine if the function can be parsed lazily. Lazy parsing is
   // different from lazy compilation; we need to parse more eagerly than we
   // compile.
@@ -35,6 +35,21 @@ void MaybeReportStatistics(ParseInfo* info, Handle<Script> script,
   }
 }
 
+// Eval and Function constructor sources are usually on-heap strings, whose
+// character streams can't be cloned, so none of their functions could be
+// compiled by the lazy compile dispatcher. For large sources it pays off to
+// copy the characters off the heap once, so that the parser can post parallel
+// compile tasks for them like it does for external script sources.
+bool UseOffHeapCopyForEval(ParseInfo* info, Handle<String> source) {
+  if (!info->flags().is_eval() || info->dispatcher() == nullptr) return false;
+  if (!info->flags().post_parallel_compile_tasks_for_eager_toplevel() &&
+      !info->flags().post_parallel_compile_tasks_for_lazy()) {
+    return false;
+  }
+  if (source->IsExternalString()) return false;
+  return source->length() >= FLAG_parallel_compile_eval_min_length;
+}
+
 }  // namespace
 
 bool ParseProgram(ParseInfo* info, Handle<Script> script,
@@ -49,7 +64,9 @@ bool ParseProgram(ParseInfo* info, Handle<Script> script,
   Handle<String> source(String::cast(script->source()), isolate);
   isolate->counters()->total_parse_size()->Increment(source->length());
   std::unique_ptr<Utf16CharacterStream> stream(
-      ScannerStream::For(isolate, source));
+      UseOffHeapCopyForEval(info, source)
+          ? ScannerStream::ForOffHeapCopy(isolate, source)
+          : ScannerStream::For(isolate, source));
   info->set_character_stream(std::move(stream));
 
   Parser parser(isolate->main_thread_local_isolate(), info, script);
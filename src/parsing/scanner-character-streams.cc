@@ -127,6 +127,34 @@ class ExternalStringStream {
   const size_t length_;
 };
 
+// A Char stream backed by an off-heap copy of a string's characters. The copy
+// is shared between clones, so unlike OnHeapStream it can be handed to
+// background compile tasks.
+template <typename Char>
+class CopiedStringStream {
+ public:
+  CopiedStringStream(std::shared_ptr<const std::vector<Char>> data,
+                     size_t length)
+      : data_(std::move(data)), length_(length) {
+    DCHECK_LE(length_, data_->size());
+  }
+
+  // The no_gc argument is only here because of the templated way this class
+  // is used along with other implementations that require V8 heap access.
+  Range<Char> GetDataAt(size_t pos, RuntimeCallStats* stats,
+                        DisallowGarbageCollection* no_gc = nullptr) {
+    const Char* data = data_->data();
+    return {&data[std::min(length_, pos)], &data[length_]};
+  }
+
+  static const bool kCanBeCloned = true;
+  static const bool kCanAccessHeap = false;
+
+ private:
+  std::shared_ptr<const std::vector<Char>> data_;
+  const size_t length_;
+};
+
 // A Char stream backed by a C array. Testing only.
 template <typename Char>
 class TestingStream {
@@ -619,6 +647,15 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    // Fast path for ascii sequences, which are one char per byte.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t remaining = end - cursor;
+      int max_length = static_cast<int>(std::min(remaining, position - chars));
+      int ascii_length = NonAsciiStart(cursor, max_length);
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -896,6 +933,27 @@ Utf16CharacterStream* ScannerStream::For(Isolate* isolate, Handle<String> data,
   }
 }
 
+Utf16CharacterStream* ScannerStream::ForOffHeapCopy(Isolate* isolate,
+                                                    Handle<String> data) {
+  data = String::Flatten(isolate, data);
+  size_t length = static_cast<size_t>(data->length());
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = data->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    auto copy =
+        std::make_shared<const std::vector<uint8_t>>(chars.begin(), chars.end());
+    return new BufferedCharacterStream<CopiedStringStream>(size_t{0},
+                                                           std::move(copy),
+                                                           length);
+  }
+  base::Vector<const base::uc16> chars = content.ToUC16Vector();
+  auto copy =
+      std::make_shared<const std::vector<uint16_t>>(chars.begin(), chars.end());
+  return new UnbufferedCharacterStream<CopiedStringStream>(
+      size_t{0}, std::move(copy), length);
+}
+
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     const char* data) {
   return ScannerStream::ForTesting(data, strlen(data));
@@ -27,6 +27,10 @@ class V8_EXPORT_PRIVATE ScannerStream {
   static Utf16CharacterStream* For(
       ScriptCompiler::ExternalSourceStream* source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding);
+  // Copies the characters of |data| off the heap, so that the stream can be
+  // cloned for parallel compile tasks.
+  static Utf16CharacterStream* ForOffHeapCopy(Isolate* isolate,
+                                              Handle<String> data);
 
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data);
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data,
@@ -211,7 +211,8 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntilWithAsciiFastPath<'\n', '\r'>(
+      [](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
 }
@@ -278,7 +279,7 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
+      AdvanceUntilWithAsciiFastPath<'\n', '\r', '*'>([](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           return unibrow::IsLineTerminator(c0);
         }
@@ -303,7 +304,8 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilWithAsciiFastPath<'*'>(
+        [](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -457,19 +459,25 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    AdvanceUntilWithAsciiFastPath<'\'', '"', '\n', '\r', '\\'>(
+        [this](base::uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+              return true;
+            }
+            AddLiteralChar(c0);
+            return false;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          if (MayTerminateString(char_flags)) return true;
+          AddLiteralChar(c0);
+          return false;
+        },
+        [this](const uint16_t* begin, const uint16_t* end) {
+          for (const uint16_t* it = begin; it != end; ++it) {
+            AddLiteralChar(static_cast<char>(*it));
+          }
+        });
 
     while (c0_ == '\\') {
       Advance();
@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "src/base/logging.h"
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -93,6 +94,55 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, for a {check} that can only be true for non-ASCII code
+  // units and the ASCII characters in {kAsciiStopChars}. Code units are read
+  // one word at a time, and words that consist only of other ASCII characters
+  // are skipped without calling {check}. Instead {skipped} is called with the
+  // skipped range [begin, end).
+  template <char... kAsciiStopChars, typename FunctionType,
+            typename SkippedFunctionType>
+  V8_INLINE base::uc32 AdvanceUntilWithAsciiFastPath(
+      FunctionType check, SkippedFunctionType skipped) {
+    while (true) {
+      const uint16_t* cursor = buffer_cursor_;
+      while (buffer_end_ - cursor >= kCodeUnitsPerWord &&
+             IsAsciiWordWithout<kAsciiStopChars...>(
+                 base::ReadUnalignedValue<uintptr_t>(
+                     reinterpret_cast<Address>(cursor)))) {
+        cursor += kCodeUnitsPerWord;
+      }
+      if (cursor != buffer_cursor_) {
+        skipped(buffer_cursor_, cursor);
+        buffer_cursor_ = cursor;
+      }
+
+      // Check the word that stopped the fast path one code unit at a time.
+      const uint16_t* limit =
+          std::min(buffer_end_, buffer_cursor_ + kCodeUnitsPerWord);
+      auto next_cursor_pos =
+          std::find_if(buffer_cursor_, limit, [&check](uint16_t raw_c0_) {
+            base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
+            return check(c0_);
+          });
+
+      if (next_cursor_pos != limit) {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<base::uc32>(*next_cursor_pos);
+      }
+      buffer_cursor_ = limit;
+      if (limit == buffer_end_ && !ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
+  template <char... kAsciiStopChars, typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntilWithAsciiFastPath(FunctionType check) {
+    return AdvanceUntilWithAsciiFastPath<kAsciiStopChars...>(
+        check, [](const uint16_t*, const uint16_t*) {});
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -150,6 +200,31 @@ class Utf16CharacterStream {
         buffer_pos_(buffer_pos) {}
   Utf16CharacterStream() : Utf16CharacterStream(nullptr, nullptr, nullptr, 0) {}
 
+  static constexpr int kCodeUnitsPerWord = kUIntptrSize / sizeof(uint16_t);
+
+  static constexpr uintptr_t RepeatCodeUnit(uint16_t code_unit) {
+    return kUintptrAllBitsSet / 0xFFFF * code_unit;
+  }
+
+  // Returns true if all code units in {word} are ASCII and none of them is one
+  // of {kAsciiStopChars}.
+  template <char... kAsciiStopChars>
+  static V8_INLINE bool IsAsciiWordWithout(uintptr_t word) {
+    if (word & RepeatCodeUnit(0xFF80)) return false;
+    constexpr char kStopChars[] = {kAsciiStopChars...};
+    for (char stop_char : kStopChars) {
+      // All code units are ASCII, so subtracting one only borrows across code
+      // units, and sets their top bit, when a code unit is zero, i.e. equal to
+      // {stop_char}.
+      uintptr_t zero_if_equal = word ^ RepeatCodeUnit(stop_char);
+      if ((zero_if_equal - RepeatCodeUnit(1)) & ~zero_if_equal &
+          RepeatCodeUnit(0x8000)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   bool ReadBlockChecked(size_t position) {
     // The callers of this method (Back/Back2/Seek) should handle the easy
     // case (seeking within the current buffer), and we should only get here
@@ -534,6 +609,19 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <char... kAsciiStopChars, typename FunctionType>
+  V8_INLINE void AdvanceUntilWithAsciiFastPath(FunctionType check) {
+    c0_ = source_->AdvanceUntilWithAsciiFastPath<kAsciiStopChars...>(check);
+  }
+
+  template <char... kAsciiStopChars, typename FunctionType,
+            typename SkippedFunctionType>
+  V8_INLINE void AdvanceUntilWithAsciiFastPath(FunctionType check,
+                                               SkippedFunctionType skipped) {
+    c0_ = source_->AdvanceUntilWithAsciiFastPath<kAsciiStopChars...>(check,
+                                                                     skipped);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -670,6 +670,17 @@ CpuProfile* CpuProfiler::StopProfiling(String title) {
   return StopProfiling(profiles_->GetName(title));
 }
 
+bool CpuProfiler::TakeSamples(const char* title,
+                              std::deque<CpuProfile::SampleInfo>* samples) {
+  if (!is_profiling_) return false;
+  return profiles_->TakeSamples(title, samples);
+}
+
+bool CpuProfiler::TakeSamples(String title,
+                              std::deque<CpuProfile::SampleInfo>* samples) {
+  return TakeSamples(profiles_->GetName(title), samples);
+}
+
 void CpuProfiler::StopProcessor() {
   is_profiling_ = false;
   processor_->StopSynchronously();
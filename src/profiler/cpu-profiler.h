@@ -12,6 +12,7 @@
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 #include "src/profiler/circular-queue.h"
+#include "src/profiler/profile-generator.h"
 #include "src/profiler/profiler-listener.h"
 #include "src/profiler/tick-sample.h"
 #include "src/utils/locked-queue.h"
@@ -354,6 +355,11 @@ class V8_EXPORT_PRIVATE CpuProfiler {
 
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String title);
+  // Moves the samples recorded so far by a running profile to {samples}. See
+  // v8::CpuProfiler::TakeSamples.
+  bool TakeSamples(const char* title,
+                   std::deque<CpuProfile::SampleInfo>* samples);
+  bool TakeSamples(String title, std::deque<CpuProfile::SampleInfo>* samples);
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
   void DeleteAllProfiles();
@@ -2738,12 +2738,16 @@ void HeapSnapshotJSONSerializer::SerializeImpl() {
 
 
 int HeapSnapshotJSONSerializer::GetStringId(const char* s) {
+  auto it = string_ids_by_address_.find(s);
+  if (it != string_ids_by_address_.end()) return it->second;
   base::HashMap::Entry* cache_entry =
       strings_.LookupOrInsert(const_cast<char*>(s), StringHash(s));
   if (cache_entry->value == nullptr) {
     cache_entry->value = reinterpret_cast<void*>(next_string_id_++);
   }
-  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+  int id = static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+  string_ids_by_address_.emplace(s, id);
+  return id;
 }
 
 
@@ -2812,8 +2816,8 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(to_node_index(edge->to()), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  writer_->AddSubstring(buffer.begin(), buffer_pos);
 }
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
@@ -2852,8 +2856,8 @@ void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->detachedness(), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  writer_->AddSubstring(buffer.begin(), buffer_pos);
 }
 
 void HeapSnapshotJSONSerializer::SerializeNodes() {
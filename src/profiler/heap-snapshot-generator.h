@@ -684,6 +684,9 @@ class HeapSnapshotJSONSerializer {
 
   HeapSnapshot* snapshot_;
   base::CustomMatcherHashMap strings_;
+  // Most names come from the snapshot's StringsStorage and are therefore
+  // shared by address; this lets GetStringId() skip hashing their contents.
+  std::unordered_map<const char*, int> string_ids_by_address_;
   int next_node_id_;
   int next_string_id_;
   OutputStreamWriter* writer_;
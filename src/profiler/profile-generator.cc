@@ -582,6 +582,7 @@ CpuProfile::CpuProfile(CpuProfiler* profiler, const char* title,
       top_down_(profiler->isolate(), profiler->code_entries()),
       profiler_(profiler),
       streaming_next_sample_(0),
+      last_streamed_timestamp_(start_time_),
       id_(++last_id_) {
   // The startTime timestamp is not converted to Perfetto's clock domain and
   // will get out of sync with other timestamps Perfetto knows about, including
@@ -723,14 +724,13 @@ void CpuProfile::StreamPendingTraceEvents() {
     // correct CLOCK_BOOTTIME time values (for instance, producing
     // CLOCK_BOOTTIME time values in the middle of the suspended period).
     value->BeginArray("timeDeltas");
-    base::TimeTicks lastTimestamp =
-        streaming_next_sample_ ? samples_[streaming_next_sample_ - 1].timestamp
-                               : start_time();
+    base::TimeTicks lastTimestamp = last_streamed_timestamp_;
     for (size_t i = streaming_next_sample_; i < samples_.size(); ++i) {
       value->AppendInteger(static_cast<int>(
           (samples_[i].timestamp - lastTimestamp).InMicroseconds()));
       lastTimestamp = samples_[i].timestamp;
     }
+    last_streamed_timestamp_ = lastTimestamp;
     value->EndArray();
     bool has_non_zero_lines =
         std::any_of(samples_.begin() + streaming_next_sample_, samples_.end(),
@@ -766,6 +766,19 @@ void CpuProfile::FinishProfile() {
                               "ProfileChunk", id_, "data", std::move(value));
 }
 
+void CpuProfile::TakeSamples(std::deque<SampleInfo>* samples) {
+  // Taken samples are gone from the profile, so stream them first.
+  StreamPendingTraceEvents();
+  DCHECK_EQ(streaming_next_sample_, samples_.size());
+  if (samples->empty()) {
+    samples->swap(samples_);
+  } else {
+    samples->insert(samples->end(), samples_.begin(), samples_.end());
+    samples_.clear();
+  }
+  streaming_next_sample_ = 0;
+}
+
 void CpuProfile::Print() const {
   base::OS::Print("[Top down]:\n");
   top_down_.Print();
@@ -940,6 +953,28 @@ CpuProfile* CpuProfilesCollection::StopProfiling(const char* title) {
   return profile;
 }
 
+bool CpuProfilesCollection::TakeSamples(
+    const char* title, std::deque<CpuProfile::SampleInfo>* samples) {
+  const bool empty_title = (title[0] == '\0');
+  bool found = false;
+  // Samples are added from the profile generator thread while holding the
+  // semaphore.
+  current_profiles_semaphore_.Wait();
+
+  auto it = std::find_if(current_profiles_.rbegin(), current_profiles_.rend(),
+                         [&](const std::unique_ptr<CpuProfile>& p) {
+                           return empty_title || strcmp(p->title(), title) == 0;
+                         });
+
+  if (it != current_profiles_.rend()) {
+    (*it)->TakeSamples(samples);
+    found = true;
+  }
+
+  current_profiles_semaphore_.Signal();
+  return found;
+}
+
 bool CpuProfilesCollection::IsLastProfile(const char* title) {
   // Called from VM thread, and only it can mutate the list,
   // so no locking is needed here.
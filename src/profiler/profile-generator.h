@@ -425,6 +425,9 @@ class CpuProfile {
                base::TimeDelta sampling_interval, StateTag state,
                EmbedderStateTag embedder_state);
   void FinishProfile();
+  // Moves the samples recorded so far to {samples}, after streaming them to
+  // tracing. The profile keeps recording.
+  void TakeSamples(std::deque<SampleInfo>* samples);
 
   const char* title() const { return title_; }
   const ProfileTree* top_down() const { return &top_down_; }
@@ -458,6 +461,9 @@ class CpuProfile {
   ProfileTree top_down_;
   CpuProfiler* const profiler_;
   size_t streaming_next_sample_;
+  // Timestamp of the last sample streamed to tracing, used as the base for the
+  // next time delta. Survives TakeSamples.
+  base::TimeTicks last_streamed_timestamp_;
   uint32_t id_;
   // Number of microseconds worth of profiler ticks that should elapse before
   // the next sample is recorded.
@@ -545,6 +551,10 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
       std::unique_ptr<DiscardedSamplesDelegate> delegate = nullptr);
 
   CpuProfile* StopProfiling(const char* title);
+  // Moves the samples of a running profile to {samples}. Returns false if no
+  // profile with the given title is running.
+  bool TakeSamples(const char* title,
+                   std::deque<CpuProfile::SampleInfo>* samples);
   std::vector<std::unique_ptr<CpuProfile>>* profiles() {
     return &finished_profiles_;
   }
@@ -190,13 +190,25 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
     SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
     int script_id = v8::UnboundScript::kNoScriptId;
     if (shared.script().IsScript()) {
       Script script = Script::cast(shared.script());
       script_id = script.id();
     }
-    node = FindOrAddChildNode(node, name, script_id, shared.StartPosition());
+    int start_position = shared.StartPosition();
+    if (script_id != v8::UnboundScript::kNoScriptId) {
+      // Nodes of script functions are keyed by their position only, so the
+      // name is only needed when a new node gets created. This keeps the
+      // common case of a known stack free of string copies.
+      AllocationNode* child = node->FindChildNode(
+          AllocationNode::function_id(script_id, start_position, nullptr));
+      if (child != nullptr) {
+        node = child;
+        continue;
+      }
+    }
+    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
+    node = FindOrAddChildNode(node, name, script_id, start_position);
   }
 
   if (found_arguments_marker_frames) {
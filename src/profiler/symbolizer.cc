@@ -92,7 +92,22 @@ Symbolizer::SymbolizedSample Symbolizer::SymbolizeTickSample(
           src_line = pc_entry->line_number();
         }
         src_line_not_found = false;
-        stack_trace.push_back({pc_entry, src_line});
+        // In optimized code the pc may be inside an inlined function. Expand
+        // the inline stack so that the tick and its source line are
+        // attributed to the most-inlined function rather than to the function
+        // that owns the code object, whose script the line does not belong to.
+        const std::vector<CodeEntryAndLineNumber>* inline_stack =
+            pc_entry->GetInlineStack(pc_offset);
+        if (inline_stack) {
+          DCHECK(!inline_stack->empty());
+          size_t index = stack_trace.size();
+          stack_trace.insert(stack_trace.end(), inline_stack->begin(),
+                             inline_stack->end());
+          // See the comment on the same fix-up for the stack frames below.
+          stack_trace[index].line_number = src_line;
+        } else {
+          stack_trace.push_back({pc_entry, src_line});
+        }
 
         if (pc_entry->builtin() == Builtin::kFunctionPrototypeApply ||
             pc_entry->builtin() == Builtin::kFunctionPrototypeCall) {
@@ -7,11 +7,13 @@
 #include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
+#include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone-list-inl.h"
 
 namespace v8 {
@@ -86,6 +88,256 @@ base::Vector<const base::uc16> ToCharacterVector<base::uc16>(
   return content.ToUC16Vector();
 }
 
+// Scans the input with a DFA to find out whether a bytecode program can
+// produce any match in a suffix of the input, and where the search for it
+// can start.  Whether some thread ACCEPTs does not depend on thread priorities
+// or capture registers, so the program can be simulated by a DFA whose states
+// are the sets of CONSUME_RANGE instructions that threads are blocked on.
+// States and transitions are built lazily when they are first needed, so
+// that, once the relevant part of the DFA exists, the simulation only costs a
+// table lookup per input character.  The cache of states is bounded; when it
+// is full, it is flushed and rebuilt, like in RE2.
+//
+// For programs starting with the /.*?/ preamble of unanchored regexps, the
+// preamble is left out of the states and threads for the rest of the program
+// are started at every position instead.  A state then consists of the
+// threads that started before the current position, and if it is empty,
+// no match can start before that position.
+//
+// Programs with ASSERTIONs are not supported, since whether an assertion holds
+// depends on the input around the current position.
+class DfaMatchFilter {
+ public:
+  // Special results of `InitialState` and `Step`.
+  static constexpr int kGaveUp = -1;
+  static constexpr int kAccept = -2;
+
+  DfaMatchFilter(base::Vector<const RegExpInstruction> bytecode, Zone* zone)
+      : cache_zone_(zone->allocator(), ZONE_NAME),
+        class_starts_(zone),
+        pc_visited_(bytecode.length(), 0, zone),
+        worklist_(zone),
+        start_pcs_(zone),
+        state_ids_(&cache_zone_),
+        state_pcs_(&cache_zone_),
+        transitions_(&cache_zone_) {
+    // Characters that are contained in the same CONSUME_RANGEs are
+    // indistinguishable for the DFA, so transitions are per character class.
+    class_starts_.push_back(0);
+    for (const RegExpInstruction& inst : bytecode) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (range.min > range.max) continue;
+      class_starts_.push_back(range.min);
+      if (range.max != 0xFFFF) class_starts_.push_back(range.max + 1);
+    }
+    std::sort(class_starts_.begin(), class_starts_.end());
+    class_starts_.erase(std::unique(class_starts_.begin(), class_starts_.end()),
+                        class_starts_.end());
+    for (int c = 0; c < kOneByteClassCount; ++c) {
+      one_byte_classes_[c] = ComputeClass(c);
+    }
+
+    // The threads started at every position of unanchored programs.
+    if (HasUnanchoredPreamble(bytecode)) {
+      ++visit_epoch_;
+      start_accepts_ = AddClosure(bytecode, kUnanchoredStartPc, &start_pcs_);
+      unanchored_ = true;
+    }
+  }
+
+  static bool CanHandle(base::Vector<const RegExpInstruction> bytecode) {
+    return std::none_of(bytecode.begin(), bytecode.end(),
+                        [](const RegExpInstruction& inst) {
+                          return inst.opcode == RegExpInstruction::ASSERTION;
+                        });
+  }
+
+  // Whether threads are started at every input position.
+  bool unanchored() const { return unanchored_; }
+
+  // Returns the state before any input was consumed.
+  int InitialState(base::Vector<const RegExpInstruction> bytecode) {
+    ZoneVector<int> pcs(&cache_zone_);
+    if (unanchored_) {
+      if (start_accepts_) return kAccept;
+    } else {
+      ++visit_epoch_;
+      if (AddClosure(bytecode, 0, &pcs)) return kAccept;
+    }
+    return InternState(std::move(pcs));
+  }
+
+  // Returns the state after consuming `c` in `state`, `kAccept` if some
+  // thread accepts after that, or `kGaveUp` if rebuilding the DFA would not
+  // be faster than running the NFA.
+  int Step(base::Vector<const RegExpInstruction> bytecode, int state,
+           base::uc16 c) {
+    const int char_class =
+        c < kOneByteClassCount ? one_byte_classes_[c] : ComputeClass(c);
+    const size_t transition_index = state * class_starts_.size() + char_class;
+    ++steps_since_flush_;
+    int next = transitions_[transition_index];
+    if (next != kNotComputed) return next;
+
+    const base::uc16 representative = class_starts_[char_class];
+    ZoneVector<int> pcs(&cache_zone_);
+    ++visit_epoch_;
+    auto consume = [&](int pc) {
+      RegExpInstruction::Uc16Range range = bytecode[pc].payload.consume_range;
+      return representative >= range.min && representative <= range.max &&
+             AddClosure(bytecode, pc + 1, &pcs);
+    };
+    const ZoneVector<int>& state_pcs = *state_pcs_[state];
+    const bool accepts =
+        std::any_of(state_pcs.begin(), state_pcs.end(), consume) ||
+        std::any_of(start_pcs_.begin(), start_pcs_.end(), consume);
+    if (accepts) {
+      next = kAccept;
+    } else {
+      const int flush_count = flush_count_;
+      next = InternState(std::move(pcs));
+      // The transition table is gone if the cache was flushed.
+      if (next == kGaveUp || flush_count_ != flush_count) return next;
+    }
+    transitions_[transition_index] = next;
+    return next;
+  }
+
+  // Returns whether no thread is left in `state`.  For unanchored programs,
+  // this means that no match can start before the current position,
+  // otherwise that nothing can match anymore.
+  bool IsEmpty(int state) const { return state_pcs_[state]->empty(); }
+
+ private:
+  static constexpr int kNotComputed = -3;
+  static constexpr int kOneByteClassCount = 256;
+  // Bounds the size of the transition table, and thus the memory used.
+  static constexpr size_t kMaxTransitions = 64 * 1024;
+  // The cache is only rebuilt if on average at least this many characters
+  // were consumed per state since the last flush, otherwise interpreting
+  // the NFA is cheaper.
+  static constexpr size_t kMinStepsPerState = 10;
+  // The pc after the /.*?/ preamble emitted by the compiler for unanchored
+  // regexps.
+  static constexpr int kUnanchoredStartPc = 4;
+
+  static bool HasUnanchoredPreamble(
+      base::Vector<const RegExpInstruction> bytecode) {
+    //   0: FORK 2
+    //   1: JMP 4
+    //   2: CONSUME_RANGE [0x0000, 0xFFFF]
+    //   3: FORK 2
+    //   4: ...
+    if (bytecode.length() <= kUnanchoredStartPc) return false;
+    const RegExpInstruction& any = bytecode[2];
+    return bytecode[0].opcode == RegExpInstruction::FORK &&
+           bytecode[0].payload.pc == 2 &&
+           bytecode[1].opcode == RegExpInstruction::JMP &&
+           bytecode[1].payload.pc == kUnanchoredStartPc &&
+           any.opcode == RegExpInstruction::CONSUME_RANGE &&
+           any.payload.consume_range.min == 0x0000 &&
+           any.payload.consume_range.max == 0xFFFF &&
+           bytecode[3].opcode == RegExpInstruction::FORK &&
+           bytecode[3].payload.pc == 2;
+  }
+
+  int ComputeClass(base::uc16 c) const {
+    auto it = std::upper_bound(class_starts_.begin(), class_starts_.end(), c);
+    return static_cast<int>(it - class_starts_.begin()) - 1;
+  }
+
+  // Adds the CONSUME_RANGE instructions that are reachable from `pc` without
+  // input to `pcs`, keeping it sorted.  Returns true if an ACCEPT is
+  // reachable.  Instructions visited since the last increment of
+  // `visit_epoch_` are skipped.
+  bool AddClosure(base::Vector<const RegExpInstruction> bytecode, int pc,
+                  ZoneVector<int>* pcs) {
+    worklist_.clear();
+    worklist_.push_back(pc);
+    while (!worklist_.empty()) {
+      int current = worklist_.back();
+      worklist_.pop_back();
+      if (pc_visited_[current] == visit_epoch_) continue;
+      pc_visited_[current] = visit_epoch_;
+      RegExpInstruction inst = bytecode[current];
+      switch (inst.opcode) {
+        case RegExpInstruction::ACCEPT:
+          return true;
+        case RegExpInstruction::CONSUME_RANGE:
+          pcs->insert(std::upper_bound(pcs->begin(), pcs->end(), current),
+                      current);
+          break;
+        case RegExpInstruction::FORK:
+          worklist_.push_back(inst.payload.pc);
+          worklist_.push_back(current + 1);
+          break;
+        case RegExpInstruction::JMP:
+          worklist_.push_back(inst.payload.pc);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          worklist_.push_back(current + 1);
+          break;
+        case RegExpInstruction::ASSERTION:
+          UNREACHABLE();
+      }
+    }
+    return false;
+  }
+
+  int InternState(ZoneVector<int> pcs) {
+    auto it = state_ids_.find(pcs);
+    if (it != state_ids_.end()) return it->second;
+    if (transitions_.size() + class_starts_.size() > kMaxTransitions) {
+      if (steps_since_flush_ < kMinStepsPerState * state_pcs_.size()) {
+        return kGaveUp;
+      }
+      // `pcs` lives in the zone that is about to be reset.
+      std::vector<int> saved_pcs(pcs.begin(), pcs.end());
+      FlushCache();
+      pcs = ZoneVector<int>(saved_pcs.begin(), saved_pcs.end(), &cache_zone_);
+    }
+    const int id = static_cast<int>(state_pcs_.size());
+    it = state_ids_.emplace(std::move(pcs), id).first;
+    state_pcs_.push_back(&it->first);
+    transitions_.resize(transitions_.size() + class_starts_.size(),
+                        kNotComputed);
+    return id;
+  }
+
+  void FlushCache() {
+    state_ids_.clear();
+    state_pcs_ = ZoneVector<const ZoneVector<int>*>(&cache_zone_);
+    transitions_ = ZoneVector<int>(&cache_zone_);
+    cache_zone_.Reset();
+    steps_since_flush_ = 0;
+    ++flush_count_;
+  }
+
+  // Holds the states and transitions, so that their memory can be released
+  // when the cache is flushed.
+  Zone cache_zone_;
+
+  // Sorted first characters of the character classes.
+  ZoneVector<int> class_starts_;
+  int one_byte_classes_[kOneByteClassCount];
+  ZoneVector<uint32_t> pc_visited_;
+  uint32_t visit_epoch_ = 0;
+  ZoneVector<int> worklist_;
+
+  bool unanchored_ = false;
+  bool start_accepts_ = false;
+  ZoneVector<int> start_pcs_;
+
+  ZoneMap<ZoneVector<int>, int> state_ids_;
+  ZoneVector<const ZoneVector<int>*> state_pcs_;
+  // Indexed by state * number of classes + class.
+  ZoneVector<int> transitions_;
+  size_t steps_since_flush_ = 0;
+  int flush_count_ = 0;
+};
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -159,6 +411,11 @@ class NfaInterpreter {
     DCHECK_LE(input_index_, input_.length());
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+
+    if (FLAG_experimental_regexp_engine_dfa_filter &&
+        DfaMatchFilter::CanHandle(bytecode_)) {
+      dfa_filter_.emplace(bytecode_, zone);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -283,6 +540,51 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  static constexpr int kTicksBetweenInterruptHandling = 64;
+
+  // Runs the `dfa_filter_` from the current `input_index_` and sets
+  // `may_match` to false if no match can be found from there.  Otherwise,
+  // sets `start_index` to a position at or before the start of the next
+  // match, from where the NFA needs to be run.  Returns
+  // RegExp::kInternalRegExpSuccess unless interrupted.
+  int RunDfaFilter(bool* may_match, int* start_index) {
+    *may_match = true;
+    *start_index = input_index_;
+    int state = dfa_filter_->InitialState(bytecode_);
+    int index = input_index_;
+    while (state != DfaMatchFilter::kAccept) {
+      if (state == DfaMatchFilter::kGaveUp) {
+        // The DFA is too large for this program, stop using it.
+        dfa_filter_.reset();
+        return RegExp::kInternalRegExpSuccess;
+      }
+      if (dfa_filter_->IsEmpty(state)) {
+        if (!dfa_filter_->unanchored()) {
+          *may_match = false;
+          return RegExp::kInternalRegExpSuccess;
+        }
+        // No thread started before `index` is left, so the next match
+        // can't start earlier.  Without assertions, threads started later
+        // behave the same whether or not the NFA has seen the input before.
+        *start_index = index;
+      }
+      if (index == input_.length()) {
+        *may_match = false;
+        return RegExp::kInternalRegExpSuccess;
+      }
+      base::uc16 input_char = input_[index];
+      ++index;
+
+      if (index % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+
+      state = dfa_filter_->Step(bytecode_, state, input_char);
+    }
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Change the current input index for future calls to `FindNextMatch`.
   void SetInputIndex(int new_input_index) {
     DCHECK_GE(input_index_, 0);
@@ -328,6 +630,17 @@ class NfaInterpreter {
       best_match_registers_ = base::nullopt;
     }
 
+    // Skip the search if the program can't match the rest of the input, and
+    // the part of the input that can't contain the start of the next match.
+    if (dfa_filter_.has_value()) {
+      bool may_match;
+      int start_index;
+      int err_code = RunDfaFilter(&may_match, &start_index);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      if (!may_match) return RegExp::kInternalRegExpSuccess;
+      input_index_ = start_index;
+    }
+
     // All threads start at bytecode 0.
     active_threads_.Add(
         InterpreterThread{0, NewRegisterArray(kUndefinedRegisterValue)}, zone_);
@@ -348,7 +661,6 @@ class NfaInterpreter {
       base::uc16 input_char = input_[input_index_];
       ++input_index_;
 
-      static constexpr int kTicksBetweenInterruptHandling = 64;
       if (input_index_ % kTicksBetweenInterruptHandling == 0) {
         int err_code = HandleInterrupts();
         if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
@@ -552,6 +864,10 @@ class NfaInterpreter {
   base::Optional<base::Vector<int>> best_match_registers_;
 
   Zone* zone_;
+
+  // Set if the program is supported by the DFA filter and the DFA didn't
+  // grow too large yet.
+  base::Optional<DfaMatchFilter> dfa_filter_;
 };
 
 }  // namespace
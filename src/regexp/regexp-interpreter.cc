@@ -1132,9 +1132,9 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromJs(
   String subject_string = String::cast(Object(subject));
   JSRegExp regexp_obj = JSRegExp::cast(Object(regexp));
 
-  if (regexp_obj.MarkedForTierUp()) {
+  if (regexp_obj.MarkedForTierUp() || regexp_obj.TierUpTaskRequested()) {
     // Returning RETRY will re-enter through runtime, where actual recompilation
-    // for tier-up takes place.
+    // for tier-up takes place, or the task doing it is posted.
     return IrregexpInterpreter::RETRY;
   }
 
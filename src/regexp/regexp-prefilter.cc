@@ -0,0 +1,244 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-prefilter.h"
+
+#include <algorithm>
+
+#include "src/flags/flags.h"
+#include "src/heap/factory.h"
+#include "src/objects/js-regexp-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/strings/string-search.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Stored in place of the maximal offset if it is unbounded.
+constexpr int kUnboundedOffset = -1;
+
+int AddOffsets(int a, int b) {
+  DCHECK_GE(a, 0);
+  DCHECK_GE(b, 0);
+  if (a > RegExpTree::kInfinity - b) return RegExpTree::kInfinity;
+  return a + b;
+}
+
+// A literal that every match of a subexpression contains.
+struct RequiredLiteral {
+  base::Vector<const base::uc16> chars;
+  // Upper bound of the distance between the start of the match of the
+  // subexpression and the start of the literal, or RegExpTree::kInfinity.
+  int max_offset = 0;
+  // Whether the subexpression matches exactly `chars`.
+  bool exact = false;
+
+  // Longer literals are less likely to occur and are searched faster;
+  // literals closer to the start of the match allow skipping more.
+  bool IsBetterThan(const RequiredLiteral& other) const {
+    if (chars.length() != other.chars.length()) {
+      return chars.length() > other.chars.length();
+    }
+    return max_offset < other.max_offset;
+  }
+};
+
+// Computes the best required literal of a concatenation, merging literals of
+// consecutive subexpressions that match exactly one literal.
+class ConcatenationBuilder {
+ public:
+  explicit ConcatenationBuilder(Zone* zone) : zone_(zone), run_(0, zone) {}
+
+  void Add(const RequiredLiteral& literal, int max_match) {
+    if (literal.exact) {
+      if (run_.is_empty()) run_offset_ = offset_;
+      run_.AddAll(literal.chars, zone_);
+    } else {
+      FinishRun();
+      all_exact_ = false;
+      Consider({literal.chars, AddOffsets(offset_, literal.max_offset)});
+    }
+    offset_ = AddOffsets(offset_, max_match);
+  }
+
+  RequiredLiteral Finish() {
+    FinishRun();
+    best_.exact = all_exact_;
+    return best_;
+  }
+
+ private:
+  void FinishRun() {
+    if (run_.is_empty()) return;
+    base::uc16* chars = zone_->NewArray<base::uc16>(run_.length());
+    std::copy(run_.begin(), run_.end(), chars);
+    Consider({base::Vector<const base::uc16>(chars, run_.length()),
+              run_offset_});
+    run_.Rewind(0);
+  }
+
+  void Consider(const RequiredLiteral& literal) {
+    if (literal.chars.empty()) return;
+    if (best_.chars.empty() || literal.IsBetterThan(best_)) best_ = literal;
+  }
+
+  Zone* const zone_;
+  ZoneList<base::uc16> run_;
+  int run_offset_ = 0;
+  int offset_ = 0;
+  bool all_exact_ = true;
+  RequiredLiteral best_;
+};
+
+RequiredLiteral FindRequiredLiteral(RegExpTree* tree, Zone* zone) {
+  if (tree->IsAtom()) {
+    return {tree->AsAtom()->data(), 0, true};
+  }
+  if (tree->IsEmpty()) {
+    return {base::Vector<const base::uc16>(), 0, true};
+  }
+  if (tree->IsText()) {
+    ConcatenationBuilder builder(zone);
+    for (const TextElement& element : *tree->AsText()->elements()) {
+      if (element.text_type() == TextElement::ATOM) {
+        builder.Add(FindRequiredLiteral(element.atom(), zone),
+                    element.length());
+      } else {
+        builder.Add(RequiredLiteral(), element.length());
+      }
+    }
+    return builder.Finish();
+  }
+  if (tree->IsAlternative()) {
+    ConcatenationBuilder builder(zone);
+    for (RegExpTree* node : *tree->AsAlternative()->nodes()) {
+      builder.Add(FindRequiredLiteral(node, zone), node->max_match());
+    }
+    return builder.Finish();
+  }
+  if (tree->IsCapture()) {
+    return FindRequiredLiteral(tree->AsCapture()->body(), zone);
+  }
+  if (tree->IsGroup()) {
+    return FindRequiredLiteral(tree->AsGroup()->body(), zone);
+  }
+  if (tree->IsQuantifier()) {
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() == 0) return RequiredLiteral();
+    // The first repetition contains the literal of the body.
+    RequiredLiteral literal = FindRequiredLiteral(quantifier->body(), zone);
+    literal.exact = false;
+    return literal;
+  }
+  // Lookarounds don't consume their input, and the other subexpressions don't
+  // match a fixed string.
+  return RequiredLiteral();
+}
+
+template <typename SubjectChar, typename LiteralChar>
+int FindSkip(Isolate* isolate, base::Vector<const SubjectChar> input,
+             base::Vector<const LiteralChar> literal, int max_offset,
+             bool sticky) {
+  int position = SearchString(isolate, input, literal, 0);
+  if (position < 0) return RegExpPrefilter::kNoMatch;
+  // The match contains the first occurrence of the literal or a later one,
+  // so it doesn't start before `position - max_offset`.
+  if (max_offset == kUnboundedOffset) return 0;
+  int skip = std::max(0, position - max_offset);
+  if (sticky && skip > 0) return RegExpPrefilter::kNoMatch;
+  return skip;
+}
+
+template <typename SubjectChar>
+int FindSkip(Isolate* isolate, FixedArray data,
+             base::Vector<const SubjectChar> input) {
+  DisallowGarbageCollection no_gc;
+  String literal =
+      String::cast(data.get(JSRegExp::kIrregexpRequiredLiteralIndex));
+  int max_offset =
+      Smi::ToInt(data.get(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex));
+  bool sticky = IsSticky(JSRegExp::AsRegExpFlags(
+      JSRegExp::Flags(Smi::ToInt(data.get(JSRegExp::kFlagsIndex)))));
+  String::FlatContent content = literal.GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  if (content.IsOneByte()) {
+    return FindSkip(isolate, input, content.ToOneByteVector(), max_offset,
+                    sticky);
+  }
+  return FindSkip(isolate, input, content.ToUC16Vector(), max_offset, sticky);
+}
+
+}  // namespace
+
+// static
+void RegExpPrefilter::Initialize(Isolate* isolate, Zone* zone,
+                                 RegExpTree* tree, RegExpFlags flags,
+                                 Handle<FixedArray> data) {
+  Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  data->set(JSRegExp::kIrregexpRequiredLiteralIndex, uninitialized);
+  data->set(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex, uninitialized);
+  // Case-insensitive literals would need a case-insensitive search.
+  if (!FLAG_regexp_prefilter || IsIgnoreCase(flags)) return;
+
+  RequiredLiteral literal = FindRequiredLiteral(tree, zone);
+  if (literal.chars.empty()) return;
+  // Literals are never longer than the pattern, so this can't fail.
+  Handle<String> chars =
+      isolate->factory()
+          ->NewStringFromTwoByte(literal.chars, AllocationType::kOld)
+          .ToHandleChecked();
+  int max_offset = literal.max_offset > String::kMaxLength
+                       ? kUnboundedOffset
+                       : literal.max_offset;
+  data->set(JSRegExp::kIrregexpRequiredLiteralIndex, *chars);
+  data->set(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex,
+            Smi::FromInt(max_offset));
+}
+
+// static
+int RegExpPrefilter::FindSearchStart(Isolate* isolate, FixedArray data,
+                                     String subject, int index) {
+  DisallowGarbageCollection no_gc;
+  if (data.get(JSRegExp::kIrregexpRequiredLiteralIndex).IsSmi()) return index;
+  if (subject.length() - index < kMinInputLength) return index;
+
+  String::FlatContent content = subject.GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  int skip;
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    skip = FindSkip(isolate, data, chars.SubVector(index, chars.length()));
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    skip = FindSkip(isolate, data, chars.SubVector(index, chars.length()));
+  }
+  return skip == kNoMatch ? kNoMatch : index + skip;
+}
+
+// static
+intptr_t RegExpPrefilter::SkipForCallFromJs(Isolate* isolate,
+                                            Address raw_data,
+                                            Address input_start,
+                                            Address input_end,
+                                            int is_one_byte) {
+  DisallowGarbageCollection no_gc;
+  FixedArray data = FixedArray::cast(Object(raw_data));
+  DCHECK(data.get(JSRegExp::kIrregexpRequiredLiteralIndex).IsString());
+  if (is_one_byte) {
+    const uint8_t* start = reinterpret_cast<const uint8_t*>(input_start);
+    const uint8_t* end = reinterpret_cast<const uint8_t*>(input_end);
+    return FindSkip(isolate, data,
+                    base::Vector<const uint8_t>(start, end - start));
+  }
+  const base::uc16* start = reinterpret_cast<const base::uc16*>(input_start);
+  const base::uc16* end = reinterpret_cast<const base::uc16*>(input_end);
+  return FindSkip(isolate, data,
+                  base::Vector<const base::uc16>(start, end - start));
+}
+
+}  // namespace internal
+}  // namespace v8
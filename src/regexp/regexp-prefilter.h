@@ -0,0 +1,54 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_PREFILTER_H_
+#define V8_REGEXP_REGEXP_PREFILTER_H_
+
+#include "src/common/globals.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+class FixedArray;
+class RegExpTree;
+class String;
+class Zone;
+
+// Most regexps contain a literal that every match contains, e.g. "foo" in
+// /(\w+)foo\d*/.  Looking for that literal with the string search algorithms
+// before entering the irregexp code is much faster than letting the
+// backtracking engine try every start position: subjects without it are
+// rejected right away, and if the distance between the start of a match and
+// the literal is bounded, the part of the subject that is too far ahead of
+// the first occurrence of the literal is skipped.
+class RegExpPrefilter final : public AllStatic {
+ public:
+  static constexpr int kNoMatch = -1;
+  // Shorter inputs are searched by the irregexp code right away.
+  static constexpr int kMinInputLength = 64;
+
+  // Looks for a literal that every match of `tree` contains and stores it in
+  // the irregexp `data`.
+  static void Initialize(Isolate* isolate, Zone* zone, RegExpTree* tree,
+                         RegExpFlags flags, Handle<FixedArray> data);
+
+  // Returns the index from which the irregexp code for `data` has to search
+  // `subject` for a match starting at or after `index`, or kNoMatch if there
+  // is none.  `subject` has to be flat.
+  static int FindSearchStart(Isolate* isolate, FixedArray data, String subject,
+                             int index);
+
+  // Called from RegExpExecInternal with the part of the subject from the
+  // current index to its end.  Returns the number of characters that can be
+  // skipped, or kNoMatch.
+  static intptr_t SkipForCallFromJs(Isolate* isolate, Address raw_data,
+                                    Address input_start, Address input_end,
+                                    int is_one_byte);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_PREFILTER_H_
@@ -8,7 +8,9 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/interrupts-scope.h"
+#include "src/handles/global-handles.h"
 #include "src/heap/heap-inl.h"
+#include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-bytecode-generator.h"
@@ -19,8 +21,10 @@
 #include "src/regexp/regexp-macro-assembler-arch.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-parser.h"
+#include "src/regexp/regexp-prefilter.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/strings/string-search.h"
+#include "src/tasks/cancelable-task.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -87,6 +91,10 @@ class RegExpImpl final : public AllStatic {
                                             Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
                                             bool is_one_byte);
+  // Posts a task that compiles native code for the encodings `re` has been
+  // interpreted for.
+  static void ScheduleTierUpTask(Isolate* isolate, Handle<JSRegExp> re,
+                                 Handle<String> sample_subject);
 
   // Returns true on success, false on failure.
   static bool Compile(Isolate* isolate, Zone* zone, RegExpCompileData* input,
@@ -419,6 +427,71 @@ Handle<Object> RegExpImpl::AtomExec(Isolate* isolate, Handle<JSRegExp> re,
 
 // Irregexp implementation.
 
+namespace {
+
+class RegExpTierUpTask final : public CancelableTask {
+ public:
+  RegExpTierUpTask(Isolate* isolate, Handle<JSRegExp> regexp,
+                   Handle<String> sample_subject)
+      : CancelableTask(isolate),
+        isolate_(isolate),
+        regexp_(Handle<JSRegExp>::cast(
+            isolate->global_handles()->Create(*regexp))),
+        sample_subject_(Handle<String>::cast(
+            isolate->global_handles()->Create(*sample_subject))) {}
+  RegExpTierUpTask(const RegExpTierUpTask&) = delete;
+  RegExpTierUpTask& operator=(const RegExpTierUpTask&) = delete;
+
+  ~RegExpTierUpTask() override {
+    GlobalHandles::Destroy(regexp_.location());
+    GlobalHandles::Destroy(sample_subject_.location());
+  }
+
+ private:
+  void RunInternal() override {
+    HandleScope scope(isolate_);
+    // The regexp may have been recompiled, or tiered up synchronously in the
+    // meantime.
+    if (!regexp_->TierUpTaskPending()) return;
+    if (FLAG_trace_regexp_tier_up) {
+      PrintF("JSRegExp object %p tier-up task running\n",
+             reinterpret_cast<void*>(regexp_->ptr()));
+    }
+    regexp_->MarkTierUpForNextExec();
+    for (bool is_one_byte : {true, false}) {
+      if (!regexp_->bytecode(is_one_byte).IsByteArray()) continue;
+      if (!RegExpImpl::CompileIrregexp(isolate_, regexp_, sample_subject_,
+                                       is_one_byte)) {
+        // The regexp stays marked for tier-up, so that the next execution
+        // compiles it again and throws the exception.
+        isolate_->clear_pending_exception();
+        return;
+      }
+    }
+  }
+
+  Isolate* const isolate_;
+  const Handle<JSRegExp> regexp_;
+  const Handle<String> sample_subject_;
+};
+
+}  // namespace
+
+// static
+void RegExpImpl::ScheduleTierUpTask(Isolate* isolate, Handle<JSRegExp> re,
+                                    Handle<String> sample_subject) {
+  DCHECK(FLAG_regexp_async_tier_up);
+  if (FLAG_trace_regexp_tier_up) {
+    PrintF("JSRegExp object %p posts tier-up task\n",
+           reinterpret_cast<void*>(re->ptr()));
+  }
+  re->MarkTierUpTaskPending();
+  auto task_runner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+      reinterpret_cast<v8::Isolate*>(isolate));
+  task_runner->PostTask(
+      std::make_unique<RegExpTierUpTask>(isolate, re, sample_subject));
+}
+
 // Ensures that the regexp object contains a compiled version of the
 // source for either one-byte or two-byte subject strings.
 // If the compiled version doesn't already exist, it is compiled
@@ -428,6 +501,11 @@ Handle<Object> RegExpImpl::AtomExec(Isolate* isolate, Handle<JSRegExp> re,
 bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                         Handle<String> sample_subject,
                                         bool is_one_byte) {
+  // The interpreter keeps running until the task has installed the code.
+  if (re->TierUpTaskRequested()) {
+    ScheduleTierUpTask(isolate, re, sample_subject);
+  }
+
   Object compiled_code = re->code(is_one_byte);
   Object bytecode = re->bytecode(is_one_byte);
   bool needs_initial_compilation =
@@ -594,6 +672,7 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     SetIrregexpMaxRegisterCount(*data, compile_data.register_count);
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+  RegExpPrefilter::Initialize(isolate, &zone, compile_data.tree, flags, data);
 
   if (FLAG_trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
@@ -663,6 +742,11 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp->capture_count()));
 
+  // Skip the part of the subject that can't contain a match.
+  index = RegExpPrefilter::FindSearchStart(
+      isolate, FixedArray::cast(regexp->data()), *subject, index);
+  if (index == RegExpPrefilter::kNoMatch) return RegExp::RE_FAILURE;
+
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
   if (!regexp->ShouldProduceBytecode()) {
@@ -1048,7 +1132,8 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
       regexp_(regexp),
       subject_(subject),
       isolate_(isolate) {
-  DCHECK(IsGlobal(JSRegExp::AsRegExpFlags(regexp->flags())));
+  // Only code for global regexps finds several matches in one call.
+  const bool is_global = IsGlobal(JSRegExp::AsRegExpFlags(regexp->flags()));
 
   switch (regexp_->type_tag()) {
     case JSRegExp::NOT_COMPILED:
@@ -1068,7 +1153,7 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
         num_matches_ = -1;  // Signal exception.
         return;
       }
-      if (regexp->ShouldProduceBytecode()) {
+      if (regexp->ShouldProduceBytecode() || !is_global) {
         // Global loop in interpreted regexp is not implemented.  We choose the
         // size of the offsets vector so that it can only store one match.
         register_array_size_ = registers_per_match_;
@@ -1088,8 +1173,10 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
       }
       registers_per_match_ =
           JSRegExp::RegistersForCaptureCount(regexp->capture_count());
-      register_array_size_ = std::max(
-          {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+      register_array_size_ =
+          is_global ? std::max({registers_per_match_,
+                                Isolate::kJSRegexpStaticOffsetsVectorSize})
+                    : registers_per_match_;
       break;
     }
   }
@@ -1147,6 +1234,14 @@ int32_t* RegExpGlobalCache::FetchNext() {
     int32_t* last_match =
         &register_array_[(current_match_index_ - 1) * registers_per_match_];
     int last_end_index = last_match[1];
+    if (last_match[0] == last_end_index) {
+      // Zero-length match. Advance by one code point.
+      last_end_index = AdvanceZeroLength(last_end_index);
+    }
+    if (last_end_index > subject_->length()) {
+      num_matches_ = 0;  // Signal failed match.
+      return nullptr;
+    }
 
     switch (regexp_->type_tag()) {
       case JSRegExp::NOT_COMPILED:
@@ -1165,15 +1260,6 @@ int32_t* RegExpGlobalCache::FetchNext() {
         break;
       }
       case JSRegExp::IRREGEXP: {
-        int last_start_index = last_match[0];
-        if (last_start_index == last_end_index) {
-          // Zero-length match. Advance by one code point.
-          last_end_index = AdvanceZeroLength(last_end_index);
-        }
-        if (last_end_index > subject_->length()) {
-          num_matches_ = 0;  // Signal failed match.
-          return nullptr;
-        }
         num_matches_ = RegExpImpl::IrregexpExecRaw(
             isolate_, regexp_, subject_, last_end_index, register_array_,
             register_array_size_);
@@ -169,6 +169,8 @@ class RegExp final : public AllStatic {
 // Uses a special global mode of irregexp-generated code to perform a global
 // search and return multiple results at once. As such, this is essentially an
 // iterator over multiple results (retrieved batch-wise in advance).
+// Non-global regexps are supported too, but their code only finds one match
+// per call.
 class RegExpGlobalCache final {
  public:
   RegExpGlobalCache(Handle<JSRegExp> regexp, Handle<String> subject,
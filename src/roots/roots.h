@@ -298,6 +298,7 @@ class Symbol;
 #define STRONG_MUTABLE_MOVABLE_ROOT_LIST(V)                                 \
   /* Caches */                                                              \
   V(FixedArray, number_string_cache, NumberStringCache)                     \
+  V(FixedArray, unoptimized_metadata_cache, UnoptimizedMetadataCache)       \
   /* Lists and dictionaries */                                              \
   V(RegisteredSymbolTable, public_symbol_table, PublicSymbolTable)          \
   V(RegisteredSymbolTable, api_symbol_table, ApiSymbolTable)                \
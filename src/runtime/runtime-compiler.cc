@@ -13,6 +13,7 @@
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/compiler/pipeline.h"
 #include "src/deoptimizer/deoptimizer.h"
+#include "src/diagnostics/code-tracer.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -173,6 +174,30 @@ RUNTIME_FUNCTION(Runtime_InstantiateAsmJs) {
   return Smi::zero();
 }
 
+namespace {
+
+void RecordDeoptForReoptimizationBackoff(Isolate* isolate,
+                                         Handle<JSFunction> function) {
+  if (!function->has_feedback_vector()) return;
+  FeedbackVector vector = function->feedback_vector();
+  vector.SaturatingIncrementDeoptCount();
+  const int deopt_count = vector.deopt_count();
+  if (FLAG_trace_deopt_loops) {
+    CodeTracer::Scope scope(isolate->GetCodeTracer());
+    PrintF(scope.file(), "[deopt loop: ");
+    function->ShortPrint(scope.file());
+    PrintF(scope.file(), " deoptimized %d time(s)]\n", deopt_count);
+  }
+  if (FLAG_max_deopts_before_disabling_optimization > 0 &&
+      deopt_count >= FLAG_max_deopts_before_disabling_optimization &&
+      !function->shared().optimization_disabled()) {
+    function->shared().DisableOptimization(
+        BailoutReason::kDeoptimizedTooManyTimes);
+  }
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   HandleScope scope(isolate);
   DCHECK_EQ(0, args.length());
@@ -206,6 +231,7 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   // Invalidate the underlying optimized code on eager and soft deopts.
   if (type == DeoptimizeKind::kEager || type == DeoptimizeKind::kSoft) {
     Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
+    RecordDeoptForReoptimizationBackoff(isolate, function);
   }
 
   return ReadOnlyRoots(isolate).undefined_value();
@@ -302,15 +328,35 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
 
   MaybeHandle<CodeT> maybe_result;
   Handle<JSFunction> function(frame->function(), isolate);
+  const bool concurrent_osr =
+      FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled();
+  if (concurrent_osr && function->IsInOptimizationQueue()) {
+    // A background job for this function is already in flight. Keep running
+    // the unoptimized code; finalizing an OSR job re-arms the back edges.
+    return Object();
+  }
   if (IsSuitableForOnStackReplacement(isolate, function)) {
     if (FLAG_trace_osr) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
-      PrintF(scope.file(), "[OSR - Compiling: ");
+      PrintF(scope.file(), "[OSR - Compiling%s: ",
+             concurrent_osr ? " concurrently" : "");
       function->PrintName(scope.file());
       PrintF(scope.file(), " at OSR bytecode offset %d]\n", osr_offset.ToInt());
     }
-    maybe_result =
-        Compiler::GetOptimizedCodeForOSR(isolate, function, osr_offset, frame);
+    if (concurrent_osr) {
+      // Either returns cached OSR code, or queues a job and returns the code
+      // to continue in, which is rejected as an OSR target below.
+      maybe_result = Compiler::GetOptimizedCodeForOSR(
+          isolate, function, osr_offset, nullptr, ConcurrencyMode::kConcurrent);
+      if (!maybe_result.is_null() &&
+          !CodeKindIsOptimizedJSFunction(
+              maybe_result.ToHandleChecked()->kind())) {
+        return Object();
+      }
+    } else {
+      maybe_result = Compiler::GetOptimizedCodeForOSR(isolate, function,
+                                                      osr_offset, frame);
+    }
   }
 
   // Check whether we ended up with usable optimized code.
@@ -351,17 +397,20 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
       // the optimization occurs concurrently off main thread.
       if (!function->HasAvailableOptimizedCode() &&
           function->feedback_vector().invocation_count() > 1) {
-        // If we're not already optimized, set to optimize non-concurrently on
-        // the next call, otherwise we'd run unoptimized once more and
-        // potentially compile for OSR again.
+        // If we're not already optimized, set to optimize on the next call,
+        // otherwise we'd run unoptimized once more and potentially compile
+        // for OSR again. With concurrent OSR the regular compile is
+        // concurrent as well, since the OSR code covers the hot loop.
         if (FLAG_trace_osr) {
           CodeTracer::Scope scope(isolate->GetCodeTracer());
           PrintF(scope.file(), "[OSR - Re-marking ");
           function->PrintName(scope.file());
-          PrintF(scope.file(), " for non-concurrent optimization]\n");
+          PrintF(scope.file(), " for %s optimization]\n",
+                 concurrent_osr ? "concurrent" : "non-concurrent");
         }
         function->SetOptimizationMarker(
-            OptimizationMarker::kCompileTurbofan_NotConcurrent);
+            concurrent_osr ? OptimizationMarker::kCompileTurbofan_Concurrent
+                           : OptimizationMarker::kCompileTurbofan_NotConcurrent);
       }
       return *result;
     }
@@ -17,6 +17,8 @@
 #include "src/execution/tiering-manager.h"
 #include "src/handles/maybe-handles.h"
 #include "src/init/bootstrapper.h"
+#include "src/interpreter/bytecode-dispatch-sampler.h"
+#include "src/interpreter/interpreter.h"
 #include "src/logging/counters.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/feedback-vector-inl.h"
@@ -345,6 +347,16 @@ RUNTIME_FUNCTION(Runtime_StackGuardWithGap) {
   return isolate->stack_guard()->HandleInterrupts();
 }
 
+namespace {
+
+void SampleBytecodeDispatches(Isolate* isolate) {
+  interpreter::BytecodeDispatchSampler* sampler =
+      isolate->interpreter()->dispatch_sampler();
+  if (V8_UNLIKELY(sampler != nullptr)) sampler->SampleTopFrame();
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_BytecodeBudgetInterruptWithStackCheck) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -367,6 +379,7 @@ RUNTIME_FUNCTION(Runtime_BytecodeBudgetInterruptWithStackCheck) {
     }
   }
 
+  SampleBytecodeDispatches(isolate);
   isolate->tiering_manager()->OnInterruptTick(function);
   return ReadOnlyRoots(isolate).undefined_value();
 }
@@ -377,6 +390,7 @@ RUNTIME_FUNCTION(Runtime_BytecodeBudgetInterrupt) {
   CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
   TRACE_EVENT0("v8.execute", "V8.BytecodeBudgetInterrupt");
 
+  SampleBytecodeDispatches(isolate);
   isolate->tiering_manager()->OnInterruptTick(function);
   return ReadOnlyRoots(isolate).undefined_value();
 }
@@ -1786,6 +1786,101 @@ RUNTIME_FUNCTION(Runtime_RegExpSplit) {
   return *NewJSArrayWithElements(isolate, elems, num_elems);
 }
 
+// Fast path for:
+// ES#sec-regexp.prototype-@@split
+// RegExp.prototype [ @@split ] ( string, limit )
+// Only called for unmodified, non-sticky regexps from RegExpSplit, which
+// handles the empty subject. Matches are fetched in batches if the regexp is
+// global, and the last match info is only updated once at the end.
+RUNTIME_FUNCTION(Runtime_RegExpSplitBatched) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(4, args.length());
+
+  CONVERT_ARG_HANDLE_CHECKED(JSRegExp, regexp, 0);
+  CONVERT_ARG_HANDLE_CHECKED(String, subject, 1);
+  CONVERT_NUMBER_CHECKED(uint32_t, limit, Uint32, args[2]);
+  CONVERT_ARG_HANDLE_CHECKED(RegExpMatchInfo, last_match_info, 3);
+
+  DCHECK(RegExpUtils::IsUnmodifiedRegExp(isolate, regexp));
+  DCHECK(!IsSticky(JSRegExp::AsRegExpFlags(regexp->flags())));
+
+  Factory* factory = isolate->factory();
+  if (limit == 0) return *factory->NewJSArray(0);
+
+  subject = String::Flatten(isolate, subject);
+  const int subject_length = subject->length();
+  DCHECK_LT(0, subject_length);
+  const int capture_count = regexp->capture_count();
+
+  // Like RegExpImpl::IrregexpExec, don't interpret very long subjects.
+  if (FLAG_regexp_tier_up && regexp->type_tag() == JSRegExp::IRREGEXP &&
+      subject_length >= JSRegExp::kTierUpForSubjectLengthValue) {
+    regexp->MarkTierUpForNextExec();
+  }
+
+  RegExpGlobalCache global_cache(regexp, subject, isolate);
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+
+  static const int kInitialArraySize = 8;
+  Handle<FixedArray> elems = factory->NewFixedArrayWithHoles(kInitialArraySize);
+  uint32_t num_elems = 0;
+
+  // Fetching the next batch overwrites the registers of the previous match,
+  // so the ones for the last match info are copied.
+  base::ScopedVector<int32_t> last_match(
+      JSRegExp::RegistersForCaptureCount(capture_count));
+  bool has_last_match = false;
+
+  int last_matched_until = 0;
+  while (num_elems < limit) {
+    int32_t* current_match = global_cache.FetchNext();
+    if (current_match == nullptr) break;
+    const int match_from = current_match[0];
+    const int match_to = current_match[1];
+
+    // A match at the end of the subject is treated as a failure.
+    if (match_from == subject_length) break;
+    std::copy(current_match, current_match + last_match.length(),
+              last_match.begin());
+    has_last_match = true;
+
+    // An empty match where the previous one ended doesn't split anything.
+    if (match_to == last_matched_until) continue;
+
+    Handle<String> substr =
+        factory->NewSubString(subject, last_matched_until, match_from);
+    elems = FixedArray::SetAndGrow(isolate, elems, num_elems++, substr);
+
+    for (int i = 1; i <= capture_count && num_elems < limit; i++) {
+      const int capture_from = current_match[i * 2];
+      const int capture_to = current_match[i * 2 + 1];
+      Handle<Object> capture =
+          capture_to == -1
+              ? factory->undefined_value()
+              : Handle<Object>::cast(
+                    factory->NewSubString(subject, capture_from, capture_to));
+      elems = FixedArray::SetAndGrow(isolate, elems, num_elems++, capture);
+    }
+
+    last_matched_until = match_to;
+  }
+
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+
+  if (has_last_match) {
+    RegExp::SetLastMatchInfo(isolate, last_match_info, subject, capture_count,
+                             last_match.begin());
+  }
+
+  if (num_elems < limit) {
+    Handle<String> substr =
+        factory->NewSubString(subject, last_matched_until, subject_length);
+    elems = FixedArray::SetAndGrow(isolate, elems, num_elems++, substr);
+  }
+
+  return *NewJSArrayWithElements(isolate, elems, num_elems);
+}
+
 // Slow path for:
 // ES#sec-regexp.prototype-@@replace
 // RegExp.prototype [ @@replace ] ( string, replaceValue )
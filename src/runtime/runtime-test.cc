@@ -586,6 +586,8 @@ RUNTIME_FUNCTION(Runtime_OptimizeOsr) {
     isolate->tiering_manager()->AttemptOnStackReplacement(
         UnoptimizedFrame::cast(it.frame()),
         AbstractCode::kMaxLoopNestingMarker);
+    // Sparkplug code only checks the arming on budget interrupts.
+    function->raw_feedback_cell().set_interrupt_budget(0);
   }
 
   return ReadOnlyRoots(isolate).undefined_value();
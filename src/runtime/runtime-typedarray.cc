@@ -2,7 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include "src/base/atomicops.h"
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
@@ -84,6 +91,74 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Large arrays are sorted with an LSD radix sort on the bytes of a key that
+// orders like CompareNum, using a temporary buffer of the array's size.
+constexpr size_t kMinLengthForRadixSort = 4 * KB;
+constexpr size_t kMaxBytesForRadixSort = 256 * MB;
+
+template <typename T,
+          typename = typename std::enable_if<std::is_integral<T>::value>::type>
+typename std::make_unsigned<T>::type RadixSortKey(T value) {
+  using Key = typename std::make_unsigned<T>::type;
+  Key key = static_cast<Key>(value);
+  if (std::is_signed<T>::value) {
+    key ^= static_cast<Key>(Key{1} << (8 * sizeof(T) - 1));
+  }
+  return key;
+}
+
+// Negative numbers, including -0, have their bits inverted and positive ones
+// their sign bit set, so that the keys order like the numbers. NaNs of
+// either sign go last.
+template <typename Float, typename Key>
+Key FloatRadixSortKey(Float value) {
+  if (std::isnan(value)) return std::numeric_limits<Key>::max();
+  Key bits = bit_cast<Key>(value);
+  constexpr Key kSignBit = Key{1} << (8 * sizeof(Key) - 1);
+  return (bits & kSignBit) ? ~bits : bits | kSignBit;
+}
+
+uint32_t RadixSortKey(float value) {
+  return FloatRadixSortKey<float, uint32_t>(value);
+}
+
+uint64_t RadixSortKey(double value) {
+  return FloatRadixSortKey<double, uint64_t>(value);
+}
+
+template <typename T>
+void RadixSort(T* data, size_t length) {
+  // {data} may be unaligned, see UnalignedSlot<T>.
+  auto load = [](T* array, size_t i) {
+    return base::ReadUnalignedValue<T>(reinterpret_cast<Address>(array + i));
+  };
+  auto store = [](T* array, size_t i, T value) {
+    base::WriteUnalignedValue<T>(reinterpret_cast<Address>(array + i), value);
+  };
+  std::vector<T> buffer(length);
+  T* from = data;
+  T* to = buffer.data();
+  for (size_t shift = 0; shift < 8 * sizeof(T); shift += 8) {
+    size_t offsets[257] = {0};
+    for (size_t i = 0; i < length; i++) {
+      offsets[((RadixSortKey(load(from, i)) >> shift) & 0xFF) + 1]++;
+    }
+    // Skip the pass if all keys have the same byte.
+    if (std::find(offsets + 1, offsets + 257, length) != offsets + 257) {
+      continue;
+    }
+    for (int byte = 1; byte < 257; byte++) offsets[byte] += offsets[byte - 1];
+    for (size_t i = 0; i < length; i++) {
+      T value = load(from, i);
+      store(to, offsets[(RadixSortKey(value) >> shift) & 0xFF]++, value);
+    }
+    std::swap(from, to);
+  }
+  if (from != data) {
+    for (size_t i = 0; i < length; i++) store(data, i, load(from, i));
+  }
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -137,8 +212,11 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array) {                 \
+    if (length >= kMinLengthForRadixSort &&                                \
+        length <= kMaxBytesForRadixSort / sizeof(ctype)) {                 \
+      RadixSort(data, length);                                             \
+    } else if (kExternal##Type##Array == kExternalFloat64Array ||          \
+               kExternal##Type##Array == kExternalFloat32Array) {          \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
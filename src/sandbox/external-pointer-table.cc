@@ -28,13 +28,31 @@ uint32_t ExternalPointerTable::Sweep(Isolate* isolate) {
   // which helps defragment the table. This method must run either on the
   // mutator thread or while the mutator is stopped. Also clear marking bits on
   // live entries.
-  // TODO(v8:10391, saelo) could also shrink the table using DecommitPages() if
-  // elements at the end are free. This might require some form of compaction.
+  // TODO(v8:10391, saelo) entries could also be compacted towards the start
+  // of the table, which would allow shrinking it further.
+  DCHECK_GE(capacity_, 1);
+
+  // Blocks at the end of the table that no longer contain any live entries
+  // are decommitted so that the memory can be reclaimed by the OS. One
+  // completely free block is kept around to avoid repeatedly growing and
+  // shrinking the table when the number of entries hovers around a block
+  // boundary.
+  uint32_t last_live_entry = 0;
+  for (uint32_t i = capacity_ - 1; i > 0; i--) {
+    if (is_marked(load(i))) {
+      last_live_entry = i;
+      break;
+    }
+  }
+  uint32_t new_capacity =
+      RoundUp(last_live_entry + 1, static_cast<uint32_t>(kEntriesPerBlock)) +
+      static_cast<uint32_t>(kEntriesPerBlock);
+  if (new_capacity < capacity_) Shrink(new_capacity);
+
   uint32_t freelist_size = 0;
   uint32_t current_freelist_head = 0;
 
   // Skip the special null entry.
-  DCHECK_GE(capacity_, 1);
   for (uint32_t i = capacity_ - 1; i > 0; i--) {
     // No other threads are active during sweep, so there is no need to use
     // atomic operations here.
@@ -91,6 +109,21 @@ uint32_t ExternalPointerTable::Grow() {
   return start;
 }
 
+void ExternalPointerTable::Shrink(uint32_t new_capacity) {
+  DCHECK(IsAligned(new_capacity, kEntriesPerBlock));
+  DCHECK_GE(new_capacity, kEntriesPerBlock);
+  DCHECK_LT(new_capacity, capacity_);
+
+  // The decommitted pages are inaccessible afterwards and will be made
+  // accessible again (and zero-initialized) by Grow() if needed.
+  VirtualAddressSpace* root_space = GetPlatformVirtualAddressSpace();
+  Address start = buffer_ + new_capacity * sizeof(Address);
+  size_t size = (capacity_ - new_capacity) * sizeof(Address);
+  DCHECK(IsAligned(size, root_space->page_size()));
+  CHECK(root_space->DecommitPages(start, size));
+  capacity_ = new_capacity;
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -51,7 +51,8 @@ class Isolate;
  *    marking bit using an atomic CAS operation.
  *  - When marking is finished, Sweep() iterates of the table once while the
  *    mutator is stopped and builds a freelist from all dead entries while also
- *    removing the marking bit from any live entry.
+ *    removing the marking bit from any live entry. Blocks at the end of the
+ *    table that only contain dead entries are decommitted.
  *
  * The freelist is a singly-linked list, using the lower 32 bits of each entry
  * to store the index of the next free entry. When the freelist is empty and a
@@ -112,6 +113,9 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // Returns the number of live entries after sweeping.
   uint32_t Sweep(Isolate* isolate);
 
+  // Returns the number of usable entries, including free ones.
+  uint32_t capacity() const { return capacity_; }
+
  private:
   // Required for Isolate::CheckIsolateLayout().
   friend class Isolate;
@@ -132,6 +136,11 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // TODO(saelo) this can fail, deal with that appropriately.
   uint32_t Grow();
 
+  // Decommits the blocks at the end of the table so that only the first
+  // new_capacity entries remain usable. None of the removed entries may be
+  // live. Must only be called during Sweep().
+  void Shrink(uint32_t new_capacity);
+
   // Computes the address of the specified entry.
   inline Address entry_address(uint32_t index) const {
     return buffer_ + index * sizeof(Address);
@@ -5,10 +5,13 @@
 #include "src/snapshot/code-serializer.h"
 
 #include <memory>
+#include <vector>
 
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/platform.h"
+#include "src/baseline/baseline-batch-compiler.h"
+#include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
@@ -325,6 +328,50 @@ class StressOffThreadDeserializeThread final : public base::Thread {
   CodeSerializer::OffThreadDeserializeData off_thread_data_;
 };
 
+// Baseline code is not part of the code cache since it is cheap to regenerate
+// from the bytecode. Functions that had baseline code when the cache was
+// created are recompiled eagerly, so that short-running processes don't have
+// to wait for the interrupt budget before leaving the interpreter.
+void CompileDeserializedCodeWithBaseline(Isolate* isolate,
+                                         Handle<SharedFunctionInfo> result) {
+  Handle<Script> script(Script::cast(result->script()), isolate);
+  if (FLAG_concurrent_sparkplug &&
+      isolate->baseline_batch_compiler()->is_enabled()) {
+    // Compile in the background so that warming up does not add to the time
+    // the main thread spends on deserialization. The functions run in the
+    // interpreter until their code is installed at the next interrupt check.
+    std::vector<Handle<SharedFunctionInfo>> candidates;
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (!info.has_baseline_code_at_least_once()) continue;
+      if (!info.is_compiled() || info.HasBaselineCode()) continue;
+      candidates.push_back(handle(info, isolate));
+    }
+    if (candidates.empty()) return;
+    int batch_size = static_cast<int>(candidates.size());
+    Handle<WeakFixedArray> batch =
+        isolate->factory()->NewWeakFixedArray(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+      batch->Set(i, HeapObjectReference::Weak(*candidates[i]));
+    }
+    isolate->baseline_batch_compiler()->CompileBatchConcurrently(batch,
+                                                                 batch_size);
+    return;
+  }
+  CodePageCollectionMemoryModificationScope code_allocation(isolate->heap());
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (!info.has_baseline_code_at_least_once()) continue;
+    if (!info.is_compiled() || info.HasBaselineCode()) continue;
+    Handle<SharedFunctionInfo> shared_info(info, isolate);
+    IsCompiledScope is_compiled_scope(*shared_info, isolate);
+    Compiler::CompileSharedWithBaseline(
+        isolate, shared_info, Compiler::CLEAR_EXCEPTION, &is_compiled_scope);
+  }
+}
+
 void FinalizeDeserialization(Isolate* isolate,
                              Handle<SharedFunctionInfo> result,
                              const base::ElapsedTimer& timer) {
@@ -387,6 +434,10 @@ void FinalizeDeserialization(Isolate* isolate,
     Handle<Script> script(Script::cast(result->script()), isolate);
     Script::InitLineEnds(isolate, script);
   }
+
+  if (FLAG_sparkplug && FLAG_sparkplug_code_cache_warm_start) {
+    CompileDeserializedCodeWithBaseline(isolate, result);
+  }
 }
 
 }  // namespace
@@ -19,7 +19,7 @@ namespace {
 Builtin TryLookupCode(const EmbeddedData& d, Address address) {
   if (!d.IsInCodeRange(address)) return Builtin::kNoBuiltinId;
 
-  if (address < d.InstructionStartOfBuiltin(static_cast<Builtin>(0))) {
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinInLayoutOrder(0))) {
     return Builtin::kNoBuiltinId;
   }
 
@@ -30,7 +30,7 @@ Builtin TryLookupCode(const EmbeddedData& d, Address address) {
   int l = 0, r = Builtins::kBuiltinCount;
   while (l < r) {
     const int mid = (l + r) / 2;
-    const Builtin builtin = Builtins::FromInt(mid);
+    const Builtin builtin = d.BuiltinInLayoutOrder(mid);
     Address start = d.InstructionStartOfBuiltin(builtin);
     Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
@@ -266,6 +266,27 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
 EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   Builtins* builtins = isolate->builtins();
 
+  // Determine the order of builtins in the code section.
+  std::vector<uint32_t> builtin_order;
+  builtin_order.reserve(kTableSize);
+  if (builtins->embedded_blob_order().empty()) {
+    for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+         ++builtin) {
+      builtin_order.push_back(static_cast<uint32_t>(builtin));
+    }
+  } else {
+    CHECK_EQ(kTableSize, builtins->embedded_blob_order().size());
+    for (Builtin builtin : builtins->embedded_blob_order()) {
+      builtin_order.push_back(static_cast<uint32_t>(builtin));
+    }
+    // Bytecode handlers must stay in place, see
+    // InstructionStartOfBytecodeHandlers.
+    for (int i = static_cast<int>(Builtin::kFirstBytecodeHandler);
+         i < Builtins::kBuiltinCount; i++) {
+      CHECK_EQ(static_cast<uint32_t>(i), builtin_order[i]);
+    }
+  }
+
   // Store instruction stream lengths and offsets.
   std::vector<struct LayoutDescription> layout_descriptions(kTableSize);
 
@@ -273,8 +294,8 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   uint32_t raw_code_size = 0;
   uint32_t raw_data_size = 0;
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
+  for (uint32_t builtin_id : builtin_order) {
+    Builtin builtin = Builtins::FromInt(static_cast<int>(builtin_id));
     Code code = FromCodeT(builtins->code(builtin));
 
     // Sanity-check that the given builtin is isolate-independent and does not
@@ -296,6 +317,7 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
 
     DCHECK_EQ(0, raw_code_size % kCodeAlignment);
     const int builtin_index = static_cast<int>(builtin);
+    DCHECK_EQ(0, layout_descriptions[builtin_index].instruction_length);
     layout_descriptions[builtin_index].instruction_offset = raw_code_size;
     layout_descriptions[builtin_index].instruction_length = instruction_size;
     layout_descriptions[builtin_index].metadata_offset = raw_data_size;
@@ -338,6 +360,12 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   std::memcpy(blob_data + LayoutDescriptionTableOffset(),
               layout_descriptions.data(), LayoutDescriptionTableSize());
 
+  // Write the builtin order table.
+  DCHECK_EQ(BuiltinOrderTableSize(),
+            sizeof(builtin_order[0]) * builtin_order.size());
+  std::memcpy(blob_data + BuiltinOrderTableOffset(), builtin_order.data(),
+              BuiltinOrderTableSize());
+
   // .. and the variable-size data section.
   uint8_t* const raw_metadata_start = blob_data + RawMetadataOffset();
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
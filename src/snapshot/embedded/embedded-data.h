@@ -136,6 +136,14 @@ class EmbeddedData final {
   Address MetadataStartOfBuiltin(Builtin builtin) const;
   uint32_t MetadataSizeOfBuiltin(Builtin builtin) const;
 
+  // Returns the builtin at the given position in the code section, i.e.
+  // builtins sorted by their instruction start.
+  Builtin BuiltinInLayoutOrder(int index) const {
+    DCHECK_LE(0, index);
+    DCHECK_LT(index, Builtins::kBuiltinCount);
+    return Builtins::FromInt(static_cast<int>(BuiltinOrderTable()[index]));
+  }
+
   uint32_t AddressForHashing(Address addr) {
     DCHECK(IsInCodeRange(addr));
     Address start = reinterpret_cast<Address>(code_);
@@ -195,12 +203,18 @@ class EmbeddedData final {
   // [2] hash of embedded-blob-relevant heap objects
   // [3] layout description of instruction stream 0
   // ... layout descriptions
+  // [y] id of the builtin at the start of the code section
+  // ... builtin ids in code section order
   // [x] metadata section of builtin 0
   // ... metadata sections
   //
   // code:
-  // [0] instruction section of builtin 0
+  // [0] instruction section of the first builtin in layout order
   // ... instruction sections
+  //
+  // Builtins are laid out in definition order unless mksnapshot reorders them
+  // (see --reorder-builtins). Bytecode handlers always form a contiguous range
+  // at the end of the code section.
 
   static constexpr uint32_t kTableSize = Builtins::kBuiltinCount;
   static constexpr uint32_t EmbeddedBlobDataHashOffset() { return 0; }
@@ -219,9 +233,15 @@ class EmbeddedData final {
   static constexpr uint32_t LayoutDescriptionTableSize() {
     return sizeof(struct LayoutDescription) * kTableSize;
   }
-  static constexpr uint32_t FixedDataSize() {
+  static constexpr uint32_t BuiltinOrderTableOffset() {
     return LayoutDescriptionTableOffset() + LayoutDescriptionTableSize();
   }
+  static constexpr uint32_t BuiltinOrderTableSize() {
+    return kUInt32Size * kTableSize;
+  }
+  static constexpr uint32_t FixedDataSize() {
+    return BuiltinOrderTableOffset() + BuiltinOrderTableSize();
+  }
   // The variable-size data section starts here.
   static constexpr uint32_t RawMetadataOffset() { return FixedDataSize(); }
 
@@ -244,6 +264,9 @@ class EmbeddedData final {
     return reinterpret_cast<const struct LayoutDescription*>(
         data_ + LayoutDescriptionTableOffset());
   }
+  const uint32_t* BuiltinOrderTable() const {
+    return reinterpret_cast<const uint32_t*>(data_ + BuiltinOrderTableOffset());
+  }
   const uint8_t* RawMetadata() const { return data_ + RawMetadataOffset(); }
 
   static constexpr int PadAndAlignCode(int size) {
@@ -158,10 +158,10 @@ void EmbeddedFileWriter::WriteCodeSection(PlatformEmbeddedFileWriterBase* w,
   w->AlignToCodeAlignment();
   w->DeclareLabel(EmbeddedBlobCodeDataSymbol().c_str());
 
+  // Builtins must be emitted in the order they are laid out in the blob.
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
-    WriteBuiltin(w, blob, builtin);
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    WriteBuiltin(w, blob, blob->BuiltinInLayoutOrder(i));
   }
   w->Newline();
 }
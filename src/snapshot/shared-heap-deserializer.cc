@@ -37,22 +37,15 @@ void SharedHeapDeserializer::DeserializeStringTable() {
   // Get the string table size.
   int string_table_size = source()->GetInt();
 
-  // Add each string to the Isolate's string table.
-  // TODO(leszeks): Consider pre-sizing the string table.
+  // Add all strings to the Isolate's string table at once, so that the table
+  // is sized up front instead of growing while inserting.
+  std::vector<Handle<String>> strings;
+  strings.reserve(string_table_size);
   for (int i = 0; i < string_table_size; ++i) {
-    Handle<String> string = Handle<String>::cast(ReadObject());
-    StringTableInsertionKey key(
-        isolate(), string,
-        DeserializingUserCodeOption::kNotDeserializingUserCode);
-    Handle<String> result =
-        isolate()->string_table()->LookupKey(isolate(), &key);
-
-    // Since this is startup, there should be no duplicate entries in the
-    // string table, and the lookup should unconditionally add the given
-    // string.
-    DCHECK_EQ(*result, *string);
-    USE(result);
+    strings.push_back(Handle<String>::cast(ReadObject()));
   }
+  isolate()->string_table()->InsertForIsolateDeserialization(isolate(),
+                                                             strings);
 
   DCHECK_EQ(string_table_size, isolate()->string_table()->NumberOfElements());
 }
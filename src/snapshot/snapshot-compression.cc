@@ -4,7 +4,14 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +19,75 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+// The compressed data starts with a header of uint32 values, followed by the
+// compressed chunks:
+//   uncompressed size
+//   number of chunks
+//   compressed size of each chunk
+// Every chunk but the last one holds kChunkSize bytes of uncompressed data.
+// The chunks are compressed independently, so that they can be decompressed in
+// parallel.
+namespace {
+
+constexpr uint32_t kChunkSize = 256 * KB;
+
+uint32_t ReadUint32(const byte* data, uint32_t index) {
+  uint32_t value;
+  MemCopy(&value, data + index * sizeof(value), sizeof(value));
+  return value;
+}
+
+void WriteUint32(byte* data, uint32_t index, uint32_t value) {
+  MemCopy(data + index * sizeof(value), &value, sizeof(value));
+}
+
+uint32_t HeaderSize(uint32_t num_chunks) {
+  return (2 + num_chunks) * sizeof(uint32_t);
+}
+
+struct Chunk {
+  const byte* compressed;
+  uint32_t compressed_size;
+  byte* uncompressed;
+  uint32_t uncompressed_size;
+};
+
+void DecompressChunk(const Chunk& chunk) {
+  uLongf uncompressed_size = chunk.uncompressed_size;
+  CHECK_EQ(zlib_internal::UncompressHelper(
+               zlib_internal::ZRAW, bit_cast<Bytef*>(chunk.uncompressed),
+               &uncompressed_size, bit_cast<const Bytef*>(chunk.compressed),
+               static_cast<uLong>(chunk.compressed_size)),
+           Z_OK);
+  CHECK_EQ(chunk.uncompressed_size, uncompressed_size);
 }
 
+class DecompressChunksJob final : public JobTask {
+ public:
+  explicit DecompressChunksJob(const std::vector<Chunk>* chunks)
+      : chunks_(chunks) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (true) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->size()) return;
+      DecompressChunk((*chunks_)[index]);
+      if (delegate && delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return next_chunk < chunks_->size() ? chunks_->size() - next_chunk : 0;
+  }
+
+ private:
+  const std::vector<Chunk>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,34 +95,43 @@ SnapshotData SnapshotCompression::Compress(
   if (FLAG_profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
+  const byte* input = uncompressed_data->RawData().begin();
   uint32_t payload_length =
       static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  uint32_t num_chunks = (payload_length + kChunkSize - 1) / kChunkSize;
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+  uint32_t max_size = HeaderSize(num_chunks);
+  for (uint32_t offset = 0; offset < payload_length; offset += kChunkSize) {
+    max_size += static_cast<uint32_t>(
+        compressBound(std::min(kChunkSize, payload_length - offset)));
+  }
+  snapshot_data.AllocateData(max_size);
 
   byte* compressed_data = const_cast<byte*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
   // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(zlib_internal::CompressHelper(
-               zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-               &compressed_data_size,
-               bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-               input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-           Z_OK);
+  WriteUint32(compressed_data, 0, payload_length);
+  WriteUint32(compressed_data, 1, num_chunks);
+
+  uint32_t compressed_offset = HeaderSize(num_chunks);
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    uint32_t offset = i * kChunkSize;
+    uint32_t chunk_size = std::min(kChunkSize, payload_length - offset);
+    uLongf compressed_chunk_size = max_size - compressed_offset;
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + compressed_offset,
+                 &compressed_chunk_size, bit_cast<const Bytef*>(input + offset),
+                 chunk_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    WriteUint32(compressed_data, 2 + i,
+                static_cast<uint32_t>(compressed_chunk_size));
+    compressed_offset += static_cast<uint32_t>(compressed_chunk_size);
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(compressed_offset);
+  DCHECK_EQ(payload_length, ReadUint32(snapshot_data.RawData().begin(), 0));
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -67,28 +146,43 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef = bit_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  const byte* input = compressed_data.begin();
+  uint32_t uncompressed_payload_length = ReadUint32(input, 0);
+  uint32_t num_chunks = ReadUint32(input, 1);
+  CHECK_LE(HeaderSize(num_chunks), compressed_data.size());
 
   snapshot_data.AllocateData(uncompressed_payload_length);
-
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               bit_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  byte* output = const_cast<byte*>(snapshot_data.RawData().begin());
+
+  std::vector<Chunk> chunks;
+  chunks.reserve(num_chunks);
+  uint32_t compressed_offset = HeaderSize(num_chunks);
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    uint32_t offset = i * kChunkSize;
+    CHECK_LT(offset, uncompressed_payload_length);
+    uint32_t compressed_size = ReadUint32(input, 2 + i);
+    CHECK_LE(compressed_size, compressed_data.size() - compressed_offset);
+    chunks.push_back(
+        {input + compressed_offset, compressed_size, output + offset,
+         std::min(kChunkSize, uncompressed_payload_length - offset)});
+    compressed_offset += compressed_size;
+  }
+  CHECK_EQ(compressed_offset, compressed_data.size());
+
+  if (FLAG_parallel_snapshot_decompression && num_chunks > 1) {
+    // Wait for completion, while contributing to the work.
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                  std::make_unique<DecompressChunksJob>(&chunks))
+        ->Join();
+  } else {
+    for (const Chunk& chunk : chunks) DecompressChunk(chunk);
+  }
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_payload_length, num_chunks, ms);
   }
   return snapshot_data;
 }
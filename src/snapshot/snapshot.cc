@@ -9,6 +9,7 @@
 #include "src/base/platform/platform.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate-inl.h"
+#include "src/heap/heap-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -262,6 +263,10 @@ void Snapshot::ClearReconstructableDataForSerialization(
     }
   }
 
+  // The metadata cache is repopulated on demand.
+  isolate->heap()->SetRootUnoptimizedMetadataCache(
+      ReadOnlyRoots(isolate).empty_fixed_array());
+
   // Clear JSFunctions.
 
   i::HeapObjectIterator it(isolate->heap());
@@ -613,6 +618,10 @@ bool Snapshot::VerifyChecksum(const v8::StartupData* data) {
   return result == expected;
 }
 
+uint32_t Snapshot::GetExpectedChecksum(const v8::StartupData* data) {
+  return SnapshotImpl::GetHeaderValue(data, SnapshotImpl::kChecksumOffset);
+}
+
 uint32_t SnapshotImpl::ExtractContextOffset(const v8::StartupData* data,
                                             uint32_t index) {
   // Extract the offset of the context at a given index from the StartupData,
@@ -106,6 +106,9 @@ class Snapshot : public AllStatic {
   static bool HasContextSnapshot(Isolate* isolate, size_t index);
   static bool EmbedsScript(Isolate* isolate);
   V8_EXPORT_PRIVATE static bool VerifyChecksum(const v8::StartupData* data);
+  // Returns the checksum recorded in the header of {data}, without verifying
+  // it.
+  static uint32_t GetExpectedChecksum(const v8::StartupData* data);
   static bool ExtractRehashability(const v8::StartupData* data);
   static bool VersionIsValid(const v8::StartupData* data);
 
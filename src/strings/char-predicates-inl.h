@@ -168,6 +168,17 @@ bool IsLineTerminatorSequence(base::uc32 c, base::uc32 next) {
   return false;
 }
 
+constexpr bool HasJsonSpecialCharacter(uint64_t word) {
+  // Each test is exact for the word as a whole, not for individual bytes.
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  uint64_t quote = word ^ (kOnes * '"');
+  uint64_t backslash = word ^ (kOnes * '\\');
+  return (((quote - kOnes) & ~quote) | ((backslash - kOnes) & ~backslash) |
+          ((word - kOnes * 0x20) & ~word)) &
+         kHighBits;
+}
+
 }  // namespace internal
 
 }  // namespace v8
@@ -87,6 +87,11 @@ inline bool IsWhiteSpaceOrLineTerminatorSlow(base::uc32 c) {
 
 inline bool IsLineTerminatorSequence(base::uc32 c, base::uc32 next);
 
+// Returns whether any of the eight one-byte characters packed into {word} is
+// a '"', a '\\' or a control character, i.e. may terminate a JSON string or
+// needs to be escaped in one.
+inline constexpr bool HasJsonSpecialCharacter(uint64_t word);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -127,10 +127,42 @@ int FastAsciiConvert(char* dst, const char* src, int length,
   return length;
 }
 
+template <bool is_lower>
+int FastAsciiUnchangedPrefixLength(const char* src, int length) {
+  const char* saved_src = src;
+  static const char lo = is_lower ? 'A' - 1 : 'a' - 1;
+  static const char hi = is_lower ? 'Z' + 1 : 'z' + 1;
+  const char* const limit = src + length;
+
+  // Process the unaligned start one byte at a time, then whole words.
+  while (src < limit &&
+         !IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
+    char c = *src;
+    if ((c & kAsciiMask) != 0 || (lo < c && c < hi)) {
+      return static_cast<int>(src - saved_src);
+    }
+    ++src;
+  }
+  while (src <= limit - sizeof(word_t)) {
+    const word_t w = *reinterpret_cast<const word_t*>(src);
+    if ((w & kAsciiMask) != 0 || AsciiRangeMask(w, lo, hi) != 0) break;
+    src += sizeof(word_t);
+  }
+  while (src < limit) {
+    char c = *src;
+    if ((c & kAsciiMask) != 0 || (lo < c && c < hi)) break;
+    ++src;
+  }
+  return static_cast<int>(src - saved_src);
+}
+
 template int FastAsciiConvert<false>(char* dst, const char* src, int length,
                                      bool* changed_out);
 template int FastAsciiConvert<true>(char* dst, const char* src, int length,
                                     bool* changed_out);
+template int FastAsciiUnchangedPrefixLength<false>(const char* src,
+                                                   int length);
+template int FastAsciiUnchangedPrefixLength<true>(const char* src, int length);
 
 }  // namespace internal
 }  // namespace v8
@@ -11,6 +11,12 @@ namespace internal {
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length, bool* changed_out);
 
+// Returns the length of the prefix of {src} that FastAsciiConvert<is_lower>
+// would copy unchanged, i.e. the index of the first character that is either
+// non-ASCII or needs conversion. Does not write anything.
+template <bool is_lower>
+int FastAsciiUnchangedPrefixLength(const char* src, int length);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -5,6 +5,7 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
@@ -263,6 +264,54 @@ inline bool CharCompare(const PatternChar* pattern, const SubjectChar* subject,
   return true;
 }
 
+// Linear search for short patterns in one-byte subjects. Eight positions at
+// a time are checked for both the first and the last character of the
+// pattern, which filters out most candidates that a search for the first
+// character alone would have to compare.
+inline int FindOneByteFirstAndLastCharacters(
+    base::Vector<const uint8_t> pattern, base::Vector<const uint8_t> subject,
+    int index) {
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  const int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+  const uint8_t first_char = pattern[0];
+  const uint8_t last_char = pattern[pattern_length - 1];
+  const uint64_t first_word = kOnes * first_char;
+  const uint64_t last_word = kOnes * last_char;
+  const uint8_t* chars = subject.begin();
+  const int n = subject.length() - pattern_length;
+
+  auto matches_at = [&](int i) {
+    return chars[i] == first_char &&
+           chars[i + pattern_length - 1] == last_char &&
+           (pattern_length == 2 || CharCompare(pattern.begin() + 1,
+                                               chars + i + 1,
+                                               pattern_length - 2));
+  };
+
+  int i = index;
+  for (; i <= n - 7; i += 8) {
+    uint64_t mismatches =
+        (base::ReadUnalignedValue<uint64_t>(
+             reinterpret_cast<Address>(chars + i)) ^
+         first_word) |
+        (base::ReadUnalignedValue<uint64_t>(
+             reinterpret_cast<Address>(chars + i + pattern_length - 1)) ^
+         last_word);
+    // Checks for a zero byte, i.e. a position where both characters match.
+    // It may report false positives but no false negatives.
+    if ((((mismatches - kOnes) & ~mismatches) & kHighBits) == 0) continue;
+    for (int j = i; j < i + 8; j++) {
+      if (matches_at(j)) return j;
+    }
+  }
+  for (; i <= n; i++) {
+    if (matches_at(i)) return i;
+  }
+  return -1;
+}
+
 // Simple linear search for short patterns. Never bails out.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
@@ -270,6 +319,11 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     base::Vector<const SubjectChar> subject, int index) {
   base::Vector<const PatternChar> pattern = search->pattern_;
   DCHECK_GT(pattern.length(), 1);
+  if (sizeof(PatternChar) == 1 && sizeof(SubjectChar) == 1) {
+    return FindOneByteFirstAndLastCharacters(
+        base::Vector<const uint8_t>::cast(pattern),
+        base::Vector<const uint8_t>::cast(subject), index);
+  }
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
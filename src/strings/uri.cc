@@ -276,6 +276,56 @@ void EncodePair(base::uc16 cc1, base::uc16 cc2, std::vector<uint8_t>* buffer) {
   }
 }
 
+bool IsUnescapedInUri(base::uc16 c, bool is_uri) {
+  return IsUnescapePredicateInUriComponent(c) || (is_uri && IsUriSeparator(c));
+}
+
+// Appends the encoding of {chars} to {buffer}. Runs of characters that don't
+// need escaping are copied in bulk. Returns false if {chars} contains a lone
+// surrogate.
+template <typename Char>
+bool EncodeChars(base::Vector<const Char> chars, bool is_uri,
+                 std::vector<uint8_t>* buffer) {
+  const int length = chars.length();
+  int k = 0;
+  while (k < length) {
+    int run_start = k;
+    while (k < length && IsUnescapedInUri(chars[k], is_uri)) k++;
+    if (k > run_start) {
+      // All unescaped characters are ASCII.
+      size_t old_size = buffer->size();
+      buffer->resize(old_size + (k - run_start));
+      CopyChars(buffer->data() + old_size, chars.begin() + run_start,
+                k - run_start);
+      if (k == length) break;
+    }
+
+    base::uc16 cc1 = chars[k++];
+    if (sizeof(Char) == 1) {
+      // One-byte strings cannot contain surrogates.
+      EncodeSingle(cc1, buffer);
+    } else if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
+      if (k == length) return false;
+      base::uc16 cc2 = chars[k++];
+      if (!unibrow::Utf16::IsTrailSurrogate(cc2)) return false;
+      EncodePair(cc1, cc2, buffer);
+    } else if (unibrow::Utf16::IsTrailSurrogate(cc1)) {
+      return false;
+    } else {
+      EncodeSingle(cc1, buffer);
+    }
+  }
+  return true;
+}
+
+// Returns the length of the prefix of {chars} that needs no escaping.
+template <typename Char>
+int UnescapedPrefixLength(base::Vector<const Char> chars, bool is_uri) {
+  int k = 0;
+  while (k < chars.length() && IsUnescapedInUri(chars[k], is_uri)) k++;
+  return k;
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
@@ -283,39 +333,24 @@ MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
   uri = String::Flatten(isolate, uri);
   int uri_length = uri->length();
   std::vector<uint8_t> buffer;
-  buffer.reserve(uri_length);
 
   bool throw_error = false;
   {
     DisallowGarbageCollection no_gc;
     String::FlatContent uri_content = uri->GetFlatContent(no_gc);
 
-    for (int k = 0; k < uri_length; k++) {
-      base::uc16 cc1 = uri_content.Get(k);
-      if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
-        k++;
-        if (k < uri_length) {
-          base::uc16 cc2 = uri->Get(k);
-          if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
-            EncodePair(cc1, cc2, &buffer);
-            continue;
-          }
-        }
-      } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
-        if (IsUnescapePredicateInUriComponent(cc1) ||
-            (is_uri && IsUriSeparator(cc1))) {
-          buffer.push_back(cc1);
-        } else {
-          EncodeSingle(cc1, &buffer);
-        }
-        continue;
-      }
-
+    if (uri_content.IsOneByte()) {
+      base::Vector<const uint8_t> chars = uri_content.ToOneByteVector();
+      // Encoding a string that contains nothing to escape is the identity.
+      if (UnescapedPrefixLength(chars, is_uri) == uri_length) return uri;
+      buffer.reserve(uri_length);
+      EncodeChars(chars, is_uri, &buffer);
+    } else {
+      buffer.reserve(uri_length);
       // String::FlatContent DCHECKs its contents did not change during its
       // lifetime. Throwing the error inside the loop may cause GC and move the
       // string contents.
-      throw_error = true;
-      break;
+      throw_error = !EncodeChars(uri_content.ToUC16Vector(), is_uri, &buffer);
     }
   }
 
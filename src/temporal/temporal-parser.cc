@@ -965,6 +965,56 @@ bool SatisfyTemporalCalendarString(base::Vector<Char> str,
   return false;
 }
 
+// Fast path for the canonical forms produced by the toString() methods and
+// Date.prototype.toISOString():
+//   DateFourDigitYear - DateMonth - DateDay
+//   DateFourDigitYear - DateMonth - DateDay T TimeHour : TimeMinute
+//     [: TimeSecond [. FractionalPart]]
+// each optionally followed by the UTCDesignator Z. Every such string is a
+// CalendarDateTime, and also a TemporalInstantString if it ends in Z, and the
+// fixed layout lets it be checked without trying the alternatives of the
+// general grammar. Returns false for anything else, in which case the caller
+// falls back to the general parser.
+template <typename Char>
+bool SatisfyCanonicalDateTime(base::Vector<Char> str,
+                              bool utc_designator_required,
+                              ParsedISO8601Result* r) {
+  int32_t length = str.length();
+  if (length < 10 || str[4] != '-' || str[7] != '-') return false;
+  ParsedISO8601Result ret;
+  if (ScanDateFourDigitYear(str, 0, &ret.date_year) == 0 ||
+      ScanDateMonth(str, 5, &ret.date_month) == 0 ||
+      ScanDateDay(str, 8, &ret.date_day) == 0) {
+    return false;
+  }
+  int32_t cur = 10;
+  if (length >= cur + 6 && str[cur] == 'T') {
+    if (str[cur + 3] != ':' ||
+        ScanTimeHour(str, cur + 1, &ret.time_hour) == 0 ||
+        ScanTimeMinute(str, cur + 4, &ret.time_minute) == 0) {
+      return false;
+    }
+    cur += 6;
+    if (length >= cur + 3 && str[cur] == ':') {
+      if (ScanTimeSecond(str, cur + 1, &ret.time_second) == 0) return false;
+      cur += 3;
+      if (length >= cur + 2 && str[cur] == '.') {
+        int32_t len = ScanFractionalPart(str, cur + 1, &ret.time_nanosecond);
+        if (len == 0) return false;
+        cur += len + 1;
+      }
+    }
+  }
+  if (cur + 1 == length && str[cur] == 'Z') {
+    ret.utc_designator = true;
+    cur++;
+  }
+  if (cur != length) return false;
+  if (utc_designator_required && !ret.utc_designator) return false;
+  *r = ret;
+  return true;
+}
+
 // Duration
 
 SCAN_FORWARD(TimeFractionalPart, FractionalPart, int64_t)
@@ -1205,15 +1255,46 @@ SATISIFY(TemporalDurationString, ParsedISO8601Duration)
     return Nothing<R>();                                                   \
   }
 
-IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalDateTimeString)
-IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalDateString)
-IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalYearMonthString)
-IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalMonthDayString)
+// Same as above, but tries SatisfyCanonicalDateTime first for productions
+// that accept all of the canonical forms with the same result.
+#define IMPL_PARSE_METHOD_WITH_CANONICAL_FAST_PATH(NAME,                   \
+                                                   utc_designator_required) \
+  Maybe<ParsedISO8601Result> TemporalParser::Parse##NAME(                  \
+      Isolate* isolate, Handle<String> iso_string) {                       \
+    bool valid;                                                            \
+    ParsedISO8601Result parsed;                                            \
+    iso_string = String::Flatten(isolate, iso_string);                     \
+    {                                                                      \
+      DisallowGarbageCollection no_gc;                                     \
+      String::FlatContent str_content = iso_string->GetFlatContent(no_gc); \
+      if (str_content.IsOneByte()) {                                       \
+        base::Vector<const uint8_t> str = str_content.ToOneByteVector();   \
+        valid = SatisfyCanonicalDateTime(str, utc_designator_required,     \
+                                         &parsed) ||                       \
+                Satisfy##NAME(str, &parsed);                               \
+      } else {                                                             \
+        base::Vector<const base::uc16> str = str_content.ToUC16Vector();   \
+        valid = SatisfyCanonicalDateTime(str, utc_designator_required,     \
+                                         &parsed) ||                       \
+                Satisfy##NAME(str, &parsed);                               \
+      }                                                                    \
+    }                                                                      \
+    if (valid) return Just(parsed);                                        \
+    return Nothing<ParsedISO8601Result>();                                 \
+  }
+
+// A canonical date string is too long to be a DateSpecYearMonth or a
+// DateSpecMonthDay, so for those productions it can only be a
+// CalendarDateTime, too.
+IMPL_PARSE_METHOD_WITH_CANONICAL_FAST_PATH(TemporalDateTimeString, false)
+IMPL_PARSE_METHOD_WITH_CANONICAL_FAST_PATH(TemporalDateString, false)
+IMPL_PARSE_METHOD_WITH_CANONICAL_FAST_PATH(TemporalYearMonthString, false)
+IMPL_PARSE_METHOD_WITH_CANONICAL_FAST_PATH(TemporalMonthDayString, false)
 IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalTimeString)
-IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalInstantString)
+IMPL_PARSE_METHOD_WITH_CANONICAL_FAST_PATH(TemporalInstantString, true)
 IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalZonedDateTimeString)
 IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalTimeZoneString)
-IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalRelativeToString)
+IMPL_PARSE_METHOD_WITH_CANONICAL_FAST_PATH(TemporalRelativeToString, false)
 IMPL_PARSE_METHOD(ParsedISO8601Result, TemporalCalendarString)
 IMPL_PARSE_METHOD(ParsedISO8601Result, TimeZoneNumericUTCOffset)
 IMPL_PARSE_METHOD(ParsedISO8601Duration, TemporalDurationString)
@@ -16,6 +16,7 @@ class TracingCategoryObserver : public TracingController::TraceStateObserver {
     ENABLED_BY_NATIVE = 1 << 0,
     ENABLED_BY_TRACING = 1 << 1,
     ENABLED_BY_SAMPLING = 1 << 2,
+    ENABLED_BY_API = 1 << 3,
   };
 
   static void SetUp();
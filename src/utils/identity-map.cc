@@ -6,7 +6,7 @@
 
 #include "src/base/functional.h"
 #include "src/base/logging.h"
-#include "src/heap/heap.h"
+#include "src/heap/heap-inl.h"
 #include "src/roots/roots-inl.h"
 
 namespace v8 {
@@ -15,6 +15,14 @@ namespace internal {
 static const int kInitialIdentityMapSize = 4;
 static const int kResizeFactor = 2;
 
+namespace {
+
+bool InYoungGeneration(Address key) {
+  return Heap::InYoungGeneration(Object(key));
+}
+
+}  // namespace
+
 IdentityMapBase::~IdentityMapBase() {
   // Clear must be called by the subclass to avoid calling the virtual
   // DeleteArray function from the destructor.
@@ -31,6 +39,7 @@ void IdentityMapBase::Clear() {
     keys_ = nullptr;
     strong_roots_entry_ = nullptr;
     values_ = nullptr;
+    young_keys_ = 0;
     size_ = 0;
     capacity_ = 0;
     mask_ = 0;
@@ -63,7 +72,7 @@ int IdentityMapBase::ScanKeysFor(Address address, uint32_t hash) const {
 
 std::pair<int, bool> IdentityMapBase::InsertKey(Address address,
                                                 uint32_t hash) {
-  DCHECK_EQ(gc_counter_, heap_->gc_count());
+  DCHECK(!NeedsRehash());
 
   // Grow the map if we reached >= 80% occupancy.
   if (size_ + size_ / 4 >= capacity_) {
@@ -82,6 +91,7 @@ std::pair<int, bool> IdentityMapBase::InsertKey(Address address,
       size_++;
       DCHECK_LE(size_, capacity_);
       keys_[index] = address;
+      if (InYoungGeneration(address)) young_keys_++;
       return {index, false};
     }
     index = (index + 1) & mask_;
@@ -94,6 +104,7 @@ bool IdentityMapBase::DeleteIndex(int index, uintptr_t* deleted_value) {
   if (deleted_value != nullptr) *deleted_value = values_[index];
   Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
   DCHECK_NE(keys_[index], not_mapped);
+  if (young_keys_ > 0 && InYoungGeneration(keys_[index])) young_keys_--;
   keys_[index] = not_mapped;
   values_[index] = 0;
   size_--;
@@ -133,7 +144,7 @@ bool IdentityMapBase::DeleteIndex(int index, uintptr_t* deleted_value) {
 int IdentityMapBase::Lookup(Address key) const {
   uint32_t hash = Hash(key);
   int index = ScanKeysFor(key, hash);
-  if (index < 0 && gc_counter_ != heap_->gc_count()) {
+  if (index < 0 && NeedsRehash()) {
     // Miss; rehash if there was a GC, then lookup again.
     const_cast<IdentityMapBase*>(this)->Rehash();
     index = ScanKeysFor(key, hash);
@@ -148,7 +159,7 @@ std::pair<int, bool> IdentityMapBase::LookupOrInsert(Address key) {
   bool already_exists;
   if (index < 0) {
     // Miss; rehash if there was a GC, then insert.
-    if (gc_counter_ != heap_->gc_count()) Rehash();
+    if (NeedsRehash()) Rehash();
     std::tie(index, already_exists) = InsertKey(key, hash);
   } else {
     already_exists = true;
@@ -157,6 +168,14 @@ std::pair<int, bool> IdentityMapBase::LookupOrInsert(Address key) {
   return {index, already_exists};
 }
 
+// Keys are hashed by address, so the map has to be rehashed after a GC moved
+// any of them. Only full GCs move old generation objects.
+bool IdentityMapBase::NeedsRehash() const {
+  if (gc_counter_ == heap_->gc_count()) return false;
+  return V8_ENABLE_THIRD_PARTY_HEAP_BOOL || young_keys_ > 0 ||
+         ms_counter_ != heap_->ms_count();
+}
+
 uint32_t IdentityMapBase::Hash(Address address) const {
   CHECK_NE(address, ReadOnlyRoots(heap_).not_mapped_symbol().ptr());
   return static_cast<uint32_t>(hasher_(address));
@@ -198,6 +217,7 @@ IdentityMapBase::RawEntry IdentityMapBase::InsertEntry(Address key) {
     capacity_ = kInitialIdentityMapSize;
     mask_ = kInitialIdentityMapSize - 1;
     gc_counter_ = heap_->gc_count();
+    ms_counter_ = heap_->ms_count();
 
     keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_));
     Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
@@ -210,7 +230,7 @@ IdentityMapBase::RawEntry IdentityMapBase::InsertEntry(Address key) {
                                    FullObjectSlot(keys_ + capacity_));
   } else {
     // Rehash if there was a GC, then insert.
-    if (gc_counter_ != heap_->gc_count()) Rehash();
+    if (NeedsRehash()) Rehash();
   }
 
   int index;
@@ -262,8 +282,11 @@ int IdentityMapBase::NextIndex(int index) const {
 
 void IdentityMapBase::Rehash() {
   CHECK(!is_iterable());  // Can't rehash while iterating.
-  // Record the current GC counter.
+  // Record the current GC counters.
   gc_counter_ = heap_->gc_count();
+  ms_counter_ = heap_->ms_count();
+  // Recount young keys; promoted keys are no longer young.
+  young_keys_ = 0;
   // Assume that most objects won't be moved.
   std::vector<std::pair<Address, uintptr_t>> reinsert;
   // Search the table looking for keys that wouldn't be found with their
@@ -282,6 +305,8 @@ void IdentityMapBase::Rehash() {
         values_[i] = 0;
         last_empty = i;
         size_--;
+      } else if (InYoungGeneration(keys_[i])) {
+        young_keys_++;
       }
     }
   }
@@ -304,6 +329,8 @@ void IdentityMapBase::Resize(int new_capacity) {
   capacity_ = new_capacity;
   mask_ = capacity_ - 1;
   gc_counter_ = heap_->gc_count();
+  ms_counter_ = heap_->ms_count();
+  young_keys_ = 0;
   size_ = 0;
 
   keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_));
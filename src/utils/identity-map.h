@@ -45,6 +45,8 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
   explicit IdentityMapBase(Heap* heap)
       : heap_(heap),
         gc_counter_(-1),
+        ms_counter_(-1),
+        young_keys_(0),
         size_(0),
         capacity_(0),
         mask_(0),
@@ -76,6 +78,7 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
   int ScanKeysFor(Address address, uint32_t hash) const;
   std::pair<int, bool> InsertKey(Address address, uint32_t hash);
   int Lookup(Address key) const;
+  bool NeedsRehash() const;
   std::pair<int, bool> LookupOrInsert(Address key);
   bool DeleteIndex(int index, uintptr_t* deleted_value);
   void Rehash();
@@ -85,6 +88,11 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
   base::hash<uintptr_t> hasher_;
   Heap* heap_;
   int gc_counter_;
+  int ms_counter_;
+  // Upper bound on the number of keys in the young generation. Scavenges only
+  // move young objects, so a map without young keys only needs rehashing
+  // after a full GC.
+  int young_keys_;
   int size_;
   int capacity_;
   int mask_;
@@ -320,6 +320,28 @@ class SetOncePointer {
   T* pointer_ = nullptr;
 };
 
+// Returns the length of a prefix of {lhs} and {rhs} that is known to be
+// equal, a multiple of kCompareCharsBlockSize. The characters are compared
+// in blocks without a branch per character, so that the compiler can
+// vectorize the loop also when the character widths differ.
+constexpr size_t kCompareCharsBlockSize = 16;
+template <typename lchar, typename rchar>
+inline size_t CompareCharsEqualBlocks(const lchar* lhs, const rchar* rhs,
+                                      size_t chars) {
+  STATIC_ASSERT(std::is_unsigned<lchar>::value);
+  STATIC_ASSERT(std::is_unsigned<rchar>::value);
+  size_t i = 0;
+  for (; i + kCompareCharsBlockSize <= chars; i += kCompareCharsBlockSize) {
+    uint32_t difference = 0;
+    for (size_t j = 0; j < kCompareCharsBlockSize; j++) {
+      difference |=
+          static_cast<uint32_t>(lhs[i + j]) ^ static_cast<uint32_t>(rhs[i + j]);
+    }
+    if (difference != 0) break;
+  }
+  return i;
+}
+
 // Compare 8bit/16bit chars to 8bit/16bit chars.
 template <typename lchar, typename rchar>
 inline bool CompareCharsEqualUnsigned(const lchar* lhs, const rchar* rhs,
@@ -331,8 +353,9 @@ inline bool CompareCharsEqualUnsigned(const lchar* lhs, const rchar* rhs,
     // two-byte char comparison is little- or big-endian.
     return memcmp(lhs, rhs, chars * sizeof(*lhs)) == 0;
   }
-  for (const lchar* limit = lhs + chars; lhs < limit; ++lhs, ++rhs) {
-    if (*lhs != *rhs) return false;
+  size_t i = CompareCharsEqualBlocks(lhs, rhs, chars);
+  for (; i < chars; ++i) {
+    if (lhs[i] != rhs[i]) return false;
   }
   return true;
 }
@@ -357,8 +380,9 @@ inline int CompareCharsUnsigned(const lchar* lhs, const rchar* rhs,
     // strings on little-endian systems.
     return memcmp(lhs, rhs, chars);
   }
-  for (const lchar* limit = lhs + chars; lhs < limit; ++lhs, ++rhs) {
-    int r = static_cast<int>(*lhs) - static_cast<int>(*rhs);
+  // Skip the equal prefix, then find the first difference.
+  for (size_t i = CompareCharsEqualBlocks(lhs, rhs, chars); i < chars; ++i) {
+    int r = static_cast<int>(lhs[i]) - static_cast<int>(rhs[i]);
     if (r != 0) return r;
   }
   return 0;
@@ -1884,6 +1884,44 @@ void LiftoffAssembler::emit_f64x2_pmax(LiftoffRegister dst, LiftoffRegister lhs,
   }
 }
 
+void LiftoffAssembler::emit_f64x2_qfma(LiftoffRegister dst,
+                                       LiftoffRegister src1,
+                                       LiftoffRegister src2,
+                                       LiftoffRegister src3) {
+  UseScratchRegisterScope temps(this);
+
+  VRegister tmp = dst.fp();
+  if (dst == src2 || dst == src3) {
+    tmp = temps.AcquireV(kFormat2D);
+  }
+
+  Mov(tmp.V2D(), src1.fp().V2D());
+  Fmla(tmp.V2D(), src2.fp().V2D(), src3.fp().V2D());
+
+  if (dst == src2 || dst == src3) {
+    Mov(dst.fp().V2D(), tmp.V2D());
+  }
+}
+
+void LiftoffAssembler::emit_f64x2_qfms(LiftoffRegister dst,
+                                       LiftoffRegister src1,
+                                       LiftoffRegister src2,
+                                       LiftoffRegister src3) {
+  UseScratchRegisterScope temps(this);
+
+  VRegister tmp = dst.fp();
+  if (dst == src2 || dst == src3) {
+    tmp = temps.AcquireV(kFormat2D);
+  }
+
+  Mov(tmp.V2D(), src1.fp().V2D());
+  Fmls(tmp.V2D(), src2.fp().V2D(), src3.fp().V2D());
+
+  if (dst == src2 || dst == src3) {
+    Mov(dst.fp().V2D(), tmp.V2D());
+  }
+}
+
 void LiftoffAssembler::emit_f64x2_convert_low_i32x4_s(LiftoffRegister dst,
                                                       LiftoffRegister src) {
   Sxtl(dst.fp().V2D(), src.fp().V2S());
@@ -2025,6 +2063,44 @@ void LiftoffAssembler::emit_f32x4_pmax(LiftoffRegister dst, LiftoffRegister lhs,
   }
 }
 
+void LiftoffAssembler::emit_f32x4_qfma(LiftoffRegister dst,
+                                       LiftoffRegister src1,
+                                       LiftoffRegister src2,
+                                       LiftoffRegister src3) {
+  UseScratchRegisterScope temps(this);
+
+  VRegister tmp = dst.fp();
+  if (dst == src2 || dst == src3) {
+    tmp = temps.AcquireV(kFormat4S);
+  }
+
+  Mov(tmp.V4S(), src1.fp().V4S());
+  Fmla(tmp.V4S(), src2.fp().V4S(), src3.fp().V4S());
+
+  if (dst == src2 || dst == src3) {
+    Mov(dst.fp().V4S(), tmp.V4S());
+  }
+}
+
+void LiftoffAssembler::emit_f32x4_qfms(LiftoffRegister dst,
+                                       LiftoffRegister src1,
+                                       LiftoffRegister src2,
+                                       LiftoffRegister src3) {
+  UseScratchRegisterScope temps(this);
+
+  VRegister tmp = dst.fp();
+  if (dst == src2 || dst == src3) {
+    tmp = temps.AcquireV(kFormat4S);
+  }
+
+  Mov(tmp.V4S(), src1.fp().V4S());
+  Fmls(tmp.V4S(), src2.fp().V4S(), src3.fp().V4S());
+
+  if (dst == src2 || dst == src3) {
+    Mov(dst.fp().V4S(), tmp.V4S());
+  }
+}
+
 void LiftoffAssembler::emit_i64x2_splat(LiftoffRegister dst,
                                         LiftoffRegister src) {
   Dup(dst.fp().V2D(), src.gp().X());
@@ -6,6 +6,7 @@
 
 #include "src/base/enum-set.h"
 #include "src/base/optional.h"
+#include "src/base/overflowing-math.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler-inl.h"
 // TODO(clemensb): Remove dependences on compiler stuff.
@@ -1859,8 +1860,60 @@ class LiftoffCompiler {
                                            GetCompareCondition(opcode)));
   }
 
+  // Constant-fold i32 operations on two constants. Constants are tracked
+  // through locals, so this mostly simplifies address computations, which can
+  // then skip their bounds checks.
+  bool TryFoldI32BinOp(WasmOpcode opcode) {
+    auto& stack_state = __ cache_state()->stack_state;
+    const LiftoffAssembler::VarState& lhs_slot = stack_state.end()[-2];
+    const LiftoffAssembler::VarState& rhs_slot = stack_state.end()[-1];
+    if (!lhs_slot.is_const() || !rhs_slot.is_const() ||
+        lhs_slot.kind() != kI32 || rhs_slot.kind() != kI32) {
+      return false;
+    }
+    int32_t lhs = lhs_slot.i32_const();
+    int32_t rhs = rhs_slot.i32_const();
+    int32_t result;
+    switch (opcode) {
+      case kExprI32Add:
+        result = base::AddWithWraparound(lhs, rhs);
+        break;
+      case kExprI32Sub:
+        result = base::SubWithWraparound(lhs, rhs);
+        break;
+      case kExprI32Mul:
+        result = base::MulWithWraparound(lhs, rhs);
+        break;
+      case kExprI32And:
+        result = lhs & rhs;
+        break;
+      case kExprI32Ior:
+        result = lhs | rhs;
+        break;
+      case kExprI32Xor:
+        result = lhs ^ rhs;
+        break;
+      case kExprI32Shl:
+        result = base::ShlWithWraparound(lhs, rhs);
+        break;
+      case kExprI32ShrS:
+        result = lhs >> (rhs & 31);
+        break;
+      case kExprI32ShrU:
+        result = static_cast<int32_t>(static_cast<uint32_t>(lhs) >> (rhs & 31));
+        break;
+      default:
+        return false;
+    }
+    stack_state.pop_back();
+    stack_state.pop_back();
+    __ PushConstant(kI32, result);
+    return true;
+  }
+
   void BinOp(FullDecoder* decoder, WasmOpcode opcode, const Value& lhs,
              const Value& rhs, Value* result) {
+    if (TryFoldI32BinOp(opcode)) return;
 #define CASE_I64_SHIFTOP(opcode, fn)                                         \
   case kExpr##opcode:                                                        \
     return EmitBinOpImm<kI64, kI64>(                                         \
@@ -3998,6 +4051,51 @@ class LiftoffCompiler {
       case wasm::kExprI32x4TruncSatF64x2UZero:
         return EmitUnOp<kS128, kS128>(
             &LiftoffAssembler::emit_i32x4_trunc_sat_f64x2_u_zero);
+      case wasm::kExprF32x4Qfma:
+        return EmitTerOp<kS128, kS128, kF32>(
+            &LiftoffAssembler::emit_f32x4_qfma);
+      case wasm::kExprF32x4Qfms:
+        return EmitTerOp<kS128, kS128, kF32>(
+            &LiftoffAssembler::emit_f32x4_qfms);
+      case wasm::kExprF64x2Qfma:
+        return EmitTerOp<kS128, kS128, kF64>(
+            &LiftoffAssembler::emit_f64x2_qfma);
+      case wasm::kExprF64x2Qfms:
+        return EmitTerOp<kS128, kS128, kF64>(
+            &LiftoffAssembler::emit_f64x2_qfms);
+      // The remaining relaxed operations allow the results of the
+      // corresponding deterministic operations.
+      case wasm::kExprI8x16RelaxedSwizzle:
+        return EmitBinOp<kS128, kS128>(&LiftoffAssembler::emit_i8x16_swizzle);
+      case wasm::kExprI8x16RelaxedLaneSelect:
+      case wasm::kExprI16x8RelaxedLaneSelect:
+      case wasm::kExprI32x4RelaxedLaneSelect:
+      case wasm::kExprI64x2RelaxedLaneSelect:
+        return EmitTerOp<kS128, kS128>(&LiftoffAssembler::emit_s128_select);
+      case wasm::kExprF32x4RelaxedMin:
+        return EmitBinOp<kS128, kS128, false, kF32>(
+            &LiftoffAssembler::emit_f32x4_min);
+      case wasm::kExprF32x4RelaxedMax:
+        return EmitBinOp<kS128, kS128, false, kF32>(
+            &LiftoffAssembler::emit_f32x4_max);
+      case wasm::kExprF64x2RelaxedMin:
+        return EmitBinOp<kS128, kS128, false, kF64>(
+            &LiftoffAssembler::emit_f64x2_min);
+      case wasm::kExprF64x2RelaxedMax:
+        return EmitBinOp<kS128, kS128, false, kF64>(
+            &LiftoffAssembler::emit_f64x2_max);
+      case wasm::kExprI32x4RelaxedTruncF32x4S:
+        return EmitUnOp<kS128, kS128>(
+            &LiftoffAssembler::emit_i32x4_sconvert_f32x4);
+      case wasm::kExprI32x4RelaxedTruncF32x4U:
+        return EmitUnOp<kS128, kS128>(
+            &LiftoffAssembler::emit_i32x4_uconvert_f32x4);
+      case wasm::kExprI32x4RelaxedTruncF64x2SZero:
+        return EmitUnOp<kS128, kS128>(
+            &LiftoffAssembler::emit_i32x4_trunc_sat_f64x2_s_zero);
+      case wasm::kExprI32x4RelaxedTruncF64x2UZero:
+        return EmitUnOp<kS128, kS128>(
+            &LiftoffAssembler::emit_i32x4_trunc_sat_f64x2_u_zero);
       default:
         unsupported(decoder, kSimd, "simd");
     }
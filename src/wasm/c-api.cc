@@ -1722,8 +1722,17 @@ i::Address FuncData::v8_callback(i::Address host_data_foreign,
   int num_param_types = static_cast<int>(param_types.size());
   int num_result_types = static_cast<int>(result_types.size());
 
-  std::unique_ptr<Val[]> params(new Val[num_param_types]);
-  std::unique_ptr<Val[]> results(new Val[num_result_types]);
+  // Most host functions have few parameters and results; avoid allocating
+  // them on the heap for every call.
+  static constexpr int kMaxOnStackVals = 8;
+  Val on_stack_vals[kMaxOnStackVals];
+  std::unique_ptr<Val[]> heap_vals;
+  Val* params = on_stack_vals;
+  if (num_param_types + num_result_types > kMaxOnStackVals) {
+    heap_vals.reset(new Val[num_param_types + num_result_types]);
+    params = heap_vals.get();
+  }
+  Val* results = params + num_param_types;
   i::Address p = argv;
   for (int i = 0; i < num_param_types; ++i) {
     switch (param_types[i]->kind()) {
@@ -1756,9 +1765,9 @@ i::Address FuncData::v8_callback(i::Address host_data_foreign,
 
   own<Trap> trap;
   if (self->kind == kCallbackWithEnv) {
-    trap = self->callback_with_env(self->env, params.get(), results.get());
+    trap = self->callback_with_env(self->env, params, results);
   } else {
-    trap = self->callback(params.get(), results.get());
+    trap = self->callback(params, results);
   }
 
   if (trap) {
@@ -84,6 +84,22 @@ unsigned OpcodeLength(const byte* pc, const byte* end) {
   return WasmDecoder<Decoder::kNoValidation>::OpcodeLength(&decoder, pc);
 }
 
+std::vector<uint32_t> GetDirectCallees(const byte* start, const byte* end) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  BodyLocalDecls decls(&zone);
+  std::vector<uint32_t> callees;
+  for (BytecodeIterator iterator(start, end, &decls); iterator.has_next();
+       iterator.next()) {
+    WasmOpcode opcode = iterator.current();
+    if (opcode != kExprCallFunction && opcode != kExprReturnCall) continue;
+    CallFunctionImmediate<Decoder::kNoValidation> imm(&iterator,
+                                                      iterator.pc() + 1);
+    callees.push_back(imm.index);
+  }
+  return callees;
+}
+
 bool CheckHardwareSupportsSimd() { return CpuFeatures::SupportsWasmSimd128(); }
 
 std::pair<uint32_t, uint32_t> StackEffect(const WasmModule* module,
@@ -80,6 +80,12 @@ V8_EXPORT_PRIVATE BitVector* AnalyzeLoopAssignmentForTesting(
 // Computes the length of the opcode at the given address.
 V8_EXPORT_PRIVATE unsigned OpcodeLength(const byte* pc, const byte* end);
 
+// Returns the indices of the functions that the given function body calls
+// directly (via {call} or {return_call}), in order of appearance. The body
+// must have been validated.
+V8_EXPORT_PRIVATE std::vector<uint32_t> GetDirectCallees(const byte* start,
+                                                         const byte* end);
+
 // Computes the stack effect of the opcode at the given address.
 // Returns <pop count, push count>.
 // Be cautious with control opcodes: This function only covers their immediate,
@@ -26,7 +26,9 @@
 #include "src/trap-handler/trap-handler.h"
 #include "src/utils/identity-map.h"
 #include "src/wasm/code-space-access.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
@@ -954,6 +956,15 @@ ExecutionTierPair GetRequestedExecutionTiers(
   bool dynamic_tiering =
       Impl(native_module->compilation_state())->dynamic_tiering() ==
       DynamicTiering::kEnabled;
+  // With dynamic tiering, functions that were hot in the imported tiering
+  // profile don't wait for their tiering budget to run out.
+  if (dynamic_tiering && FLAG_wasm_tiering_profile_from_file &&
+      module->origin == kWasmOrigin &&
+      result.baseline_tier == ExecutionTier::kLiftoff &&
+      IsHotInTieringProfile(module, func_index)) {
+    result.top_tier = ExecutionTier::kTurbofan;
+    return result;
+  }
   bool tier_up_enabled = !dynamic_tiering && FLAG_wasm_tier_up;
   if (module->origin != kWasmOrigin || !tier_up_enabled ||
       V8_UNLIKELY(FLAG_wasm_tier_up_filter >= 0 &&
@@ -1054,6 +1065,8 @@ class CompilationUnitBuilder {
     js_to_wasm_wrapper_units_.clear();
   }
 
+  size_t num_baseline_units() const { return baseline_units_.size(); }
+
   const WasmModule* module() { return native_module_->module(); }
 
  private:
@@ -1138,6 +1151,52 @@ bool IsLazyModule(const WasmModule* module) {
          (FLAG_asm_wasm_lazy_compilation && is_asmjs_module(module));
 }
 
+// Functions that are compiled lazily and were not validated up front. Their
+// compilation in the background is speculative, and errors are only reported
+// once they get called.
+bool IsLazilyValidated(const WasmModule* module,
+                       const WasmFeatures& enabled_features,
+                       uint32_t func_index) {
+  return FLAG_wasm_lazy_validation && module->origin == kWasmOrigin &&
+         GetCompileStrategy(module, enabled_features, func_index,
+                            IsLazyModule(module)) == CompileStrategy::kLazy;
+}
+
+// The direct callees of a function are likely to be called soon after it, so
+// compile the ones that are still lazy in the background, the same way as a
+// call would compile them.
+void CompileDirectCalleesInBackground(NativeModule* native_module,
+                                      int func_index) {
+  const WasmModule* module = native_module->module();
+  auto enabled_features = native_module->enabled_features();
+  CompilationStateImpl* compilation_state =
+      Impl(native_module->compilation_state());
+  base::Vector<const uint8_t> code =
+      compilation_state->GetWireBytesStorage()->GetCode(
+          module->functions[func_index].code);
+  std::vector<uint32_t> callees = GetDirectCallees(code.begin(), code.end());
+  std::sort(callees.begin(), callees.end());
+  callees.erase(std::unique(callees.begin(), callees.end()), callees.end());
+
+  const bool lazy_module = IsLazyModule(module);
+  CompilationUnitBuilder builder(native_module);
+  for (uint32_t callee : callees) {
+    if (callee < module->num_imported_functions) continue;
+    if (native_module->HasCode(callee)) continue;
+    if (GetCompileStrategy(module, enabled_features, callee, lazy_module) !=
+        CompileStrategy::kLazy) {
+      continue;
+    }
+    ExecutionTierPair tiers =
+        GetRequestedExecutionTiers(native_module, enabled_features, callee);
+    builder.AddBaselineUnit(callee, tiers.baseline_tier);
+    if (tiers.baseline_tier < tiers.top_tier) {
+      builder.AddTopTierUnit(callee, tiers.top_tier);
+    }
+  }
+  builder.Commit();
+}
+
 }  // namespace
 
 bool CompileLazy(Isolate* isolate, Handle<WasmInstanceObject> instance,
@@ -1241,6 +1300,10 @@ bool CompileLazy(Isolate* isolate, Handle<WasmInstanceObject> instance,
     compilation_state->CommitTopTierCompilationUnit(tiering_unit);
   }
 
+  if (FLAG_wasm_lazy_compile_callees) {
+    CompileDirectCalleesInBackground(native_module, func_index);
+  }
+
   return true;
 }
 
@@ -1508,11 +1571,16 @@ CompilationExecutionResult ExecuteCompilationUnits(
       if (compile_scope.cancelled()) return kYield;
 
       if (!results_to_publish.back().succeeded()) {
-        compile_scope.compilation_state()->SetError();
-        return kNoMoreUnits;
-      }
-
-      if (!unit->for_debugging() && result.result_tier != current_tier) {
+        const NativeModule* module = compile_scope.native_module();
+        if (!IsLazilyValidated(module->module(), module->enabled_features(),
+                               unit->func_index())) {
+          compile_scope.compilation_state()->SetError();
+          return kNoMoreUnits;
+        }
+        // Leave the function to {CompileLazy}, which reports the error.
+        results_to_publish.pop_back();
+      } else if (!unit->for_debugging() &&
+                 result.result_tier != current_tier) {
         compile_scope.native_module()->AddLiftoffBailout();
       }
 
@@ -1637,6 +1705,13 @@ void InitializeLazyCompilation(NativeModule* native_module) {
 
 std::unique_ptr<CompilationUnitBuilder> InitializeCompilation(
     Isolate* isolate, NativeModule* native_module) {
+  // Streaming compilation starts before all wire bytes are known, so it can't
+  // look up the profile.
+  if (FLAG_wasm_tiering_profile_from_file &&
+      !native_module->wire_bytes().empty()) {
+    LoadTieringProfileFromFile(native_module->module(),
+                               native_module->wire_bytes());
+  }
   InitializeLazyCompilation(native_module);
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
@@ -2034,9 +2109,15 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 
   void CommitCompilationUnits();
 
+  // Commits the units of the current chunk before the end of the chunk if the
+  // workers are running out of work.
+  void MaybeCommitCompilationUnitsEarly();
+
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
+  // The number of units that keeps all compilation workers busy.
+  size_t num_units_for_workers_ = 1;
   int num_functions_ = 0;
   bool prefix_cache_hit_ = false;
   bool before_code_section_ = true;
@@ -2810,6 +2891,9 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
   job_->outstanding_finishers_.store(2);
   compilation_unit_builder_ =
       InitializeCompilation(job_->isolate(), job_->native_module_.get());
+  num_units_for_workers_ = static_cast<size_t>(
+      std::max(1, std::min(FLAG_wasm_num_compilation_tasks,
+                           V8::GetCurrentPlatform()->NumberOfWorkerThreads())));
   return true;
 }
 
@@ -2856,6 +2940,7 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
   compilation_state->AddCompilationUnit(compilation_unit_builder_.get(),
                                         func_index);
   ++num_functions_;
+  MaybeCommitCompilationUnitsEarly();
 
   return true;
 }
@@ -2865,6 +2950,24 @@ void AsyncStreamingProcessor::CommitCompilationUnits() {
   compilation_unit_builder_->Commit();
 }
 
+void AsyncStreamingProcessor::MaybeCommitCompilationUnitsEarly() {
+  // Large chunks contain many functions. Instead of waiting for the end of the
+  // chunk, hand out one function per worker as soon as the workers have less
+  // than that left to do. As long as they are busy, keep collecting units, so
+  // that committing (and notifying the compile job) doesn't happen for every
+  // function.
+  if (compilation_unit_builder_->num_baseline_units() <
+      num_units_for_workers_) {
+    return;
+  }
+  auto* compilation_state = Impl(job_->native_module_->compilation_state());
+  if (compilation_state->NumOutstandingCompilations() >=
+      num_units_for_workers_) {
+    return;
+  }
+  CommitCompilationUnits();
+}
+
 void AsyncStreamingProcessor::OnFinishedChunk() {
   TRACE_STREAMING("FinishChunk...\n");
   if (compilation_unit_builder_) CommitCompilationUnits();
@@ -43,6 +43,30 @@ byte* raw_buffer_ptr(MaybeHandle<JSArrayBuffer> buffer, int offset) {
   return static_cast<byte*>(buffer.ToHandleChecked()->backing_store()) + offset;
 }
 
+bool IsAllZero(const byte* data, size_t size) {
+  DCHECK_LT(0, size);
+  return data[0] == 0 && std::memcmp(data, data + 1, size - 1) == 0;
+}
+
+// Copies a data segment into a range of memory that is still zero-initialized
+// and has not been written yet. Whole system pages that would only receive
+// zeros are skipped, so that they are never touched and committed.
+void CopyToFreshMemory(byte* dest, const byte* src, size_t size) {
+  const size_t page_size = CommitPageSize();
+  size_t offset = 0;
+  while (offset < size) {
+    // Copy up to the next page boundary of the destination.
+    Address chunk_start = reinterpret_cast<Address>(dest + offset);
+    size_t chunk_size =
+        std::min(size - offset, RoundUp(chunk_start + 1, page_size) -
+                                    chunk_start);
+    if (chunk_size < page_size || !IsAllZero(src + offset, chunk_size)) {
+      std::memcpy(dest + offset, src + offset, chunk_size);
+    }
+    offset += chunk_size;
+  }
+}
+
 using ImportWrapperQueue = WrapperQueue<WasmImportWrapperCache::CacheKey,
                                         WasmImportWrapperCache::CacheKeyHash>;
 
@@ -277,6 +301,9 @@ class InstanceBuilder {
   MaybeHandle<JSReceiver> ffi_;
   MaybeHandle<JSArrayBuffer> memory_buffer_;
   Handle<WasmMemoryObject> memory_object_;
+  // Whether the memory was allocated by this instantiation, i.e. it is still
+  // all zeros before data segments are loaded.
+  bool memory_is_fresh_ = false;
   Handle<JSArrayBuffer> untagged_globals_;
   Handle<FixedArray> tagged_globals_;
   std::vector<Handle<WasmTagObject>> tags_wrappers_;
@@ -971,6 +998,9 @@ MaybeHandle<Object> InstanceBuilder::LookupImportAsm(
 void InstanceBuilder::LoadDataSegments(Handle<WasmInstanceObject> instance) {
   base::Vector<const uint8_t> wire_bytes =
       module_object_->native_module()->wire_bytes();
+  // End of the highest range written so far. In fresh memory, everything
+  // above it is still zero; segments are usually laid out in ascending order.
+  size_t written_end = 0;
   for (const WasmDataSegment& segment : module_->data_segments) {
     uint32_t size = segment.source.length();
 
@@ -1002,8 +1032,15 @@ void InstanceBuilder::LoadDataSegments(Handle<WasmInstanceObject> instance) {
       return;
     }
 
-    std::memcpy(instance->memory_start() + dest_offset,
-                wire_bytes.begin() + segment.source.offset(), size);
+    if (size == 0) continue;
+    byte* dest = instance->memory_start() + dest_offset;
+    const byte* src = wire_bytes.begin() + segment.source.offset();
+    if (memory_is_fresh_ && dest_offset >= written_end) {
+      CopyToFreshMemory(dest, src, size);
+    } else {
+      std::memcpy(dest, src, size);
+    }
+    written_end = std::max(written_end, dest_offset + size);
   }
 }
 
@@ -1720,6 +1757,7 @@ bool InstanceBuilder::AllocateMemory() {
   }
   memory_buffer_ =
       Handle<JSArrayBuffer>(memory_object_->array_buffer(), isolate_);
+  memory_is_fresh_ = true;
   return true;
 }
 
@@ -0,0 +1,175 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include <map>
+
+#include "src/base/strings.h"
+#include "src/flags/flags.h"
+#include "src/utils/utils.h"
+#include "src/wasm/decoder.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-module.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+// The profile is a sequence of LEB128 encoded values:
+//   u32v: number of hot functions, followed by, for each of them,
+//   u32v: function index
+//   u32v: number of times the function was detected as hot
+//   u32v: number of call_ref feedback entries, followed by pairs of
+//         i32v: inlining target (-1 if not inlineable)
+//         i32v: absolute call frequency
+//   u32v: number of call_ref positions, followed by pairs of
+//         u32v: position in the wire bytes
+//         u32v: index of the feedback entry
+base::OwnedVector<uint8_t> SerializeTieringProfile(const WasmModule* module) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer buffer(&zone);
+  {
+    base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+    const auto& feedback_for_function =
+        module->type_feedback.feedback_for_function;
+    uint32_t num_hot_functions = 0;
+    for (const auto& entry : feedback_for_function) {
+      if (entry.second.tierup_priority > 0) num_hot_functions++;
+    }
+    buffer.write_u32v(num_hot_functions);
+    for (const auto& entry : feedback_for_function) {
+      const FunctionTypeFeedback& feedback = entry.second;
+      if (feedback.tierup_priority <= 0) continue;
+      buffer.write_u32v(entry.first);
+      buffer.write_u32v(feedback.tierup_priority);
+      buffer.write_size(feedback.feedback_vector.size());
+      for (const CallSiteFeedback& call_site : feedback.feedback_vector) {
+        buffer.write_i32v(call_site.function_index);
+        buffer.write_i32v(call_site.absolute_call_frequency);
+      }
+      buffer.write_size(feedback.positions.size());
+      for (const auto& position : feedback.positions) {
+        buffer.write_u32v(position.first);
+        buffer.write_u32v(position.second);
+      }
+    }
+  }
+  return base::OwnedVector<uint8_t>::Of(
+      base::VectorOf(buffer.begin(), buffer.size()));
+}
+
+bool DeserializeTieringProfile(const WasmModule* module,
+                               base::Vector<const uint8_t> profile) {
+  // Decode and check the whole profile before merging any of it.
+  std::map<uint32_t, FunctionTypeFeedback> imported;
+  Decoder decoder(profile.begin(), profile.end());
+  const uint32_t first_declared = module->num_imported_functions;
+  const uint32_t end_declared = first_declared + module->num_declared_functions;
+  const int num_functions = static_cast<int>(module->functions.size());
+  uint32_t num_hot_functions = decoder.consume_u32v("number of functions");
+  for (uint32_t i = 0; i < num_hot_functions && decoder.ok(); i++) {
+    uint32_t func_index = decoder.consume_u32v("function index");
+    uint32_t priority = decoder.consume_u32v("tier-up priority");
+    if (func_index < first_declared || func_index >= end_declared ||
+        priority == 0 || priority > static_cast<uint32_t>(kMaxInt) ||
+        imported.count(func_index)) {
+      return false;
+    }
+    const WasmFunction& function = module->functions[func_index];
+    FunctionTypeFeedback& feedback = imported[func_index];
+    feedback.tierup_priority = static_cast<int>(priority);
+
+    uint32_t num_call_sites = decoder.consume_u32v("number of call sites");
+    // Each call site takes more than one byte.
+    if (num_call_sites > profile.size()) return false;
+    for (uint32_t j = 0; j < num_call_sites && decoder.ok(); j++) {
+      int target = decoder.consume_i32v("inlining target");
+      int frequency = decoder.consume_i32v("call frequency");
+      if (target < -1 || target >= num_functions || frequency < -1) {
+        return false;
+      }
+      feedback.feedback_vector.push_back({target, frequency});
+    }
+
+    uint32_t num_positions = decoder.consume_u32v("number of positions");
+    if (num_call_sites != 0 && num_positions != num_call_sites) return false;
+    for (uint32_t j = 0; j < num_positions && decoder.ok(); j++) {
+      uint32_t position = decoder.consume_u32v("call site position");
+      uint32_t index = decoder.consume_u32v("call site index");
+      if (position < function.code.offset() ||
+          position >= function.code.end_offset() ||
+          (num_call_sites != 0 && index >= num_call_sites) ||
+          index > static_cast<uint32_t>(kMaxInt)) {
+        return false;
+      }
+      feedback.positions[static_cast<WasmCodePosition>(position)] =
+          static_cast<int>(index);
+    }
+  }
+  if (decoder.failed() || decoder.more()) return false;
+
+  base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+  for (auto& entry : imported) {
+    FunctionTypeFeedback& feedback =
+        module->type_feedback.feedback_for_function[entry.first];
+    // Count the function as scheduled for tier-up once, so that it is only
+    // scheduled again with fresh feedback if it keeps getting hot.
+    if (feedback.tierup_priority == 0) feedback.tierup_priority = 1;
+    if (!FLAG_wasm_speculative_inlining) continue;
+    if (!feedback.feedback_vector.empty()) continue;
+    // Liftoff records the same positions, so these never conflict.
+    feedback.feedback_vector = std::move(entry.second.feedback_vector);
+    feedback.positions.insert(entry.second.positions.begin(),
+                              entry.second.positions.end());
+  }
+  return true;
+}
+
+bool IsHotInTieringProfile(const WasmModule* module, uint32_t func_index) {
+  base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+  const auto& feedback_for_function =
+      module->type_feedback.feedback_for_function;
+  auto feedback = feedback_for_function.find(func_index);
+  return feedback != feedback_for_function.end() &&
+         feedback->second.tierup_priority > 0;
+}
+
+namespace {
+
+std::string GetProfileFileName(base::Vector<const uint8_t> wire_bytes) {
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "profile-wasm-%08zx",
+           NativeModuleCache::WireBytesHash(wire_bytes));
+  return std::string(filename.begin());
+}
+
+}  // namespace
+
+void DumpTieringProfileToFile(const WasmModule* module,
+                              base::Vector<const uint8_t> wire_bytes) {
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module);
+  std::string filename = GetProfileFileName(wire_bytes);
+  WriteBytes(filename.c_str(), profile.begin(),
+             static_cast<int>(profile.size()), false);
+}
+
+void LoadTieringProfileFromFile(const WasmModule* module,
+                                base::Vector<const uint8_t> wire_bytes) {
+  std::string filename = GetProfileFileName(wire_bytes);
+  bool exists = false;
+  std::string profile = ReadFile(filename.c_str(), &exists, false);
+  if (!exists) return;
+  // Malformed profiles are ignored; the module then tiers up as usual.
+  DeserializeTieringProfile(
+      module, base::Vector<const uint8_t>(
+                  reinterpret_cast<const uint8_t*>(profile.data()),
+                  profile.size()));
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
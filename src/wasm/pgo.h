@@ -0,0 +1,52 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_WASM_PGO_H_
+#define V8_WASM_PGO_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+struct WasmModule;
+
+// Tiering profiles let dynamic tiering start where a previous process left
+// off. A profile lists the functions of a module that got hot enough to be
+// tiered up, together with how often that happened and the call_ref feedback
+// collected for speculative inlining. Functions that are hot in an imported
+// profile are compiled with TurboFan right away instead of waiting for their
+// tiering budget to run out.
+
+// Serializes the tiering profile stored in the type feedback of {module}.
+V8_EXPORT_PRIVATE base::OwnedVector<uint8_t> SerializeTieringProfile(
+    const WasmModule* module);
+
+// Merges a profile created by {SerializeTieringProfile} for the same module
+// into the type feedback of {module}. Returns false and leaves {module}
+// unchanged if the profile is malformed or does not fit the module.
+V8_EXPORT_PRIVATE bool DeserializeTieringProfile(
+    const WasmModule* module, base::Vector<const uint8_t> profile);
+
+// Whether {func_index} was hot in an imported profile (or got hot since).
+bool IsHotInTieringProfile(const WasmModule* module, uint32_t func_index);
+
+// Write the profile of {module} to, or load it from, the file named after the
+// hash of {wire_bytes} in the current working directory (see
+// --wasm-tiering-profile-to-file and --wasm-tiering-profile-from-file).
+void DumpTieringProfileToFile(const WasmModule* module,
+                              base::Vector<const uint8_t> wire_bytes);
+void LoadTieringProfileFromFile(const WasmModule* module,
+                                base::Vector<const uint8_t> wire_bytes);
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_PGO_H_
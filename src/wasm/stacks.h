@@ -9,6 +9,8 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <vector>
+
 #include "src/base/build_config.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -31,6 +33,48 @@ constexpr int kJmpBufFpOffset = offsetof(JumpBuffer, fp);
 constexpr int kJmpBufPcOffset = offsetof(JumpBuffer, pc);
 constexpr int kJmpBufStackLimitOffset = offsetof(JumpBuffer, stack_limit);
 
+// Keeps the memory of dead stacks for reuse, so that suspendable calls don't
+// have to map a fresh segment (and fault in its pages) every time. All owned
+// stack segments of an isolate have the same size.
+class StackPool {
+ public:
+  StackPool() = default;
+  StackPool(const StackPool&) = delete;
+  StackPool& operator=(const StackPool&) = delete;
+  ~StackPool() {
+    PageAllocator* allocator = GetPlatformPageAllocator();
+    for (byte* segment : segments_) {
+      CHECK(allocator->FreePages(segment, segment_size_));
+    }
+  }
+
+  // Returns a segment of {size} bytes, or nullptr if none is pooled.
+  byte* Get(size_t size) {
+    if (segments_.empty()) return nullptr;
+    DCHECK_EQ(size, segment_size_);
+    byte* segment = segments_.back();
+    segments_.pop_back();
+    return segment;
+  }
+
+  // Takes ownership of {segment}, keeping it for reuse unless the pool is full.
+  void Add(byte* segment, size_t size) {
+    DCHECK(segments_.empty() || size == segment_size_);
+    if (segments_.size() >= kMaxPooledSegments) {
+      CHECK(GetPlatformPageAllocator()->FreePages(segment, size));
+      return;
+    }
+    segment_size_ = size;
+    segments_.push_back(segment);
+  }
+
+ private:
+  static constexpr size_t kMaxPooledSegments = 16;
+
+  std::vector<byte*> segments_;
+  size_t segment_size_ = 0;
+};
+
 class StackMemory {
  public:
   static StackMemory* New(Isolate* isolate) { return new StackMemory(isolate); }
@@ -46,8 +90,7 @@ class StackMemory {
     if (FLAG_trace_wasm_stack_switching) {
       PrintF("Delete stack #%d\n", id_);
     }
-    PageAllocator* allocator = GetPlatformPageAllocator();
-    if (owned_) allocator->DecommitPages(limit_, size_);
+    if (owned_) isolate_->wasm_stack_pool()->Add(limit_, size_);
     // We don't need to handle removing the last stack from the list (next_ ==
     // this). This only happens on isolate tear down, otherwise there is always
     // at least one reachable stack (the active stack).
@@ -93,11 +136,17 @@ class StackMemory {
     int kJsStackSizeKB = 4;
     size_ = (kJsStackSizeKB + kJSLimitOffsetKB) * KB;
     size_ = RoundUp(size_, allocator->AllocatePageSize());
-    limit_ = static_cast<byte*>(
-        allocator->AllocatePages(nullptr, size_, allocator->AllocatePageSize(),
-                                 PageAllocator::kReadWrite));
-    if (FLAG_trace_wasm_stack_switching) {
-      PrintF("Allocate stack #%d\n", id_);
+    limit_ = isolate->wasm_stack_pool()->Get(size_);
+    if (limit_ == nullptr) {
+      limit_ = static_cast<byte*>(allocator->AllocatePages(
+          nullptr, size_, allocator->AllocatePageSize(),
+          PageAllocator::kReadWrite));
+      CHECK_NOT_NULL(limit_);
+      if (FLAG_trace_wasm_stack_switching) {
+        PrintF("Allocate stack #%d\n", id_);
+      }
+    } else if (FLAG_trace_wasm_stack_switching) {
+      PrintF("Reuse pooled memory for stack #%d\n", id_);
     }
   }
 
@@ -31,6 +31,7 @@
 #include "src/wasm/jump-table-assembler.h"
 #include "src/wasm/memory-protection-key.h"
 #include "src/wasm/module-compiler.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-import-wrapper-cache.h"
@@ -747,18 +748,7 @@ base::Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
   // start is already committed (or we start at the beginning of a page).
   // The end needs to be committed all through the end of the page.
   if (commit_start < commit_end) {
-    for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
-             {commit_start, commit_end - commit_start}, owned_code_space_)) {
-      code_manager->Commit(split_range);
-    }
-    committed_code_space_.fetch_add(commit_end - commit_start);
-    // Committed code cannot grow bigger than maximum code space size.
-    DCHECK_LE(committed_code_space_.load(), FLAG_wasm_max_code_space * MB);
-    if (protect_code_memory_) {
-      DCHECK_LT(0, writers_count_);
-      InsertIntoWritableRegions({commit_start, commit_end - commit_start},
-                                false);
-    }
+    CommitPages(code_space, {commit_start, commit_end - commit_start});
   }
   DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
   allocated_code_space_.Merge(code_space);
@@ -769,6 +759,77 @@ base::Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
   return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
 }
 
+void WasmCodeAllocator::CommitPages(base::AddressRegion code_space,
+                                    base::AddressRegion pages) {
+  // Pages that were committed ahead only need to be taken out of
+  // {precommitted_code_space_}.
+  std::vector<base::AddressRegion> precommitted_pages;
+  for (base::AddressRegion region : precommitted_code_space_.regions()) {
+    if (region.begin() >= pages.end()) break;
+    base::AddressRegion overlap = region.GetOverlap(pages);
+    if (!overlap.is_empty()) precommitted_pages.push_back(overlap);
+  }
+  std::vector<base::AddressRegion> pages_to_commit;
+  Address next_page = pages.begin();
+  for (base::AddressRegion overlap : precommitted_pages) {
+    base::AddressRegion removed =
+        precommitted_code_space_.AllocateInRegion(overlap.size(), overlap);
+    DCHECK_EQ(overlap, removed);
+    USE(removed);
+    if (next_page < overlap.begin()) {
+      pages_to_commit.push_back({next_page, overlap.begin() - next_page});
+    }
+    next_page = overlap.end();
+  }
+  Address commit_end = pages.end();
+  if (next_page < commit_end) {
+    // Each commit changes page permissions, so commit the following free pages
+    // along with these. This is skipped with mprotect-based write protection,
+    // which needs another permission change to use the pages anyway, and when
+    // getting close to the limit of committed code space.
+    size_t batch_size =
+        static_cast<size_t>(std::max(0, FLAG_wasm_code_commit_batch_size)) * KB;
+    size_t max_committed = size_t{FLAG_wasm_max_code_space} * MB;
+    if (!protect_code_memory_ && batch_size > 0 &&
+        GetWasmCodeManager()->committed_code_space() + batch_size <
+            max_committed / 2) {
+      // Only commit pages of the free region after the allocation.
+      Address batch_end = commit_end;
+      for (base::AddressRegion region : free_code_space_.regions()) {
+        if (region.begin() != code_space.end()) continue;
+        batch_end = std::min(RoundUp(next_page + batch_size, CommitPageSize()),
+                             RoundDown(region.end(), CommitPageSize()));
+        break;
+      }
+      for (base::AddressRegion region : precommitted_code_space_.regions()) {
+        if (region.begin() < commit_end) continue;
+        batch_end = std::min(batch_end, region.begin());
+        break;
+      }
+      if (batch_end > commit_end) {
+        precommitted_code_space_.Merge({commit_end, batch_end - commit_end});
+        commit_end = batch_end;
+      }
+    }
+    pages_to_commit.push_back({next_page, commit_end - next_page});
+  }
+
+  auto* code_manager = GetWasmCodeManager();
+  for (base::AddressRegion region : pages_to_commit) {
+    for (base::AddressRegion split_range :
+         SplitRangeByReservationsIfNeeded(region, owned_code_space_)) {
+      code_manager->Commit(split_range);
+    }
+    committed_code_space_.fetch_add(region.size());
+    // Committed code cannot grow bigger than maximum code space size.
+    DCHECK_LE(committed_code_space_.load(), FLAG_wasm_max_code_space * MB);
+    if (protect_code_memory_) {
+      DCHECK_LT(0, writers_count_);
+      InsertIntoWritableRegions(region, false);
+    }
+  }
+}
+
 // TODO(dlehmann): Ensure that {AddWriter()} is always paired up with a
 // {RemoveWriter}, such that eventually the code space is write protected.
 // One solution is to make the API foolproof by hiding {SetWritable()} and
@@ -1167,6 +1228,55 @@ void NativeModule::UseLazyStub(uint32_t func_index) {
   PatchJumpTablesLocked(slot_index, lazy_compile_target);
 }
 
+size_t NativeModule::DemoteColdFunctions() {
+  DCHECK_LT(0, FLAG_wasm_code_aging_epochs);
+  if (compilation_state_->dynamic_tiering() == DynamicTiering::kDisabled) {
+    return 0;
+  }
+  const uint32_t num_functions = module_->num_declared_functions;
+  if (num_functions == 0) return 0;
+  WasmCodeRefScope code_ref_scope;
+  CodeSpaceWriteScope code_space_write_scope(this);
+  base::RecursiveMutexGuard guard(&allocation_mutex_);
+  // Debugging relies on the installed code, and frozen modules can't compile.
+  if (tiering_state_ == kTieredDown || lazy_compile_frozen_) return 0;
+  // The lazy compile table can only be created in a single code space.
+  if (!lazy_compile_table_ && code_space_data_.size() != 1) return 0;
+
+  if (!code_ages_) {
+    // Without earlier budgets, it is unknown what ran; start aging from here.
+    aging_tiering_budgets_ = std::make_unique<uint32_t[]>(num_functions);
+    std::copy_n(tiering_budgets_.get(), num_functions,
+                aging_tiering_budgets_.get());
+    code_ages_ = std::make_unique<int[]>(num_functions);
+    return 0;
+  }
+
+  size_t num_demoted = 0;
+  for (uint32_t slot_index = 0; slot_index < num_functions; ++slot_index) {
+    // Liftoff code decrements the budget on execution; a concurrent update
+    // just delays the demotion.
+    uint32_t budget = tiering_budgets_[slot_index];
+    WasmCode* code = code_table_[slot_index];
+    if (code == nullptr || !code->is_liftoff() || code->for_debugging() ||
+        budget != aging_tiering_budgets_[slot_index]) {
+      aging_tiering_budgets_[slot_index] = budget;
+      code_ages_[slot_index] = 0;
+      continue;
+    }
+    if (++code_ages_[slot_index] < FLAG_wasm_code_aging_epochs) continue;
+    code_ages_[slot_index] = 0;
+
+    code_table_[slot_index] = nullptr;
+    UseLazyStub(module_->num_imported_functions + slot_index);
+    // Running frames keep using the code until the code GC finds it dead.
+    WasmCodeRefScope::AddRef(code);
+    code->DecRefOnLiveCode();
+    ++num_demoted;
+  }
+  return num_demoted;
+}
+
 std::unique_ptr<WasmCode> NativeModule::AddCode(
     int index, const CodeDesc& desc, int stack_slots,
     uint32_t tagged_parameter_slots,
@@ -1860,6 +1970,9 @@ NativeModule::~NativeModule() {
   // Cancel all background compilation before resetting any field of the
   // NativeModule or freeing anything.
   compilation_state_->CancelCompilation();
+  if (FLAG_wasm_tiering_profile_to_file && !wire_bytes().empty()) {
+    DumpTieringProfileToFile(module(), wire_bytes());
+  }
   GetWasmEngine()->FreeNativeModule(this);
   // Free the import wrapper cache before releasing the {WasmCode} objects in
   // {owned_code_}. The destructor of {WasmImportWrapperCache} still needs to
@@ -1974,15 +2087,27 @@ VirtualMemory WasmCodeManager::TryAllocate(size_t size, void* hint) {
   size_t allocate_page_size = page_allocator->AllocatePageSize();
   size = RoundUp(size, allocate_page_size);
   if (hint == nullptr) hint = page_allocator->GetRandomMmapAddr();
+  // Align reservations that can hold huge pages, such that the jump tables at
+  // their start share a huge page with the code allocated after them.
+  bool use_huge_pages =
+      FLAG_transparent_huge_pages && size >= size_t{kHugePageSize};
+  size_t alignment = use_huge_pages
+                         ? std::max(allocate_page_size, size_t{kHugePageSize})
+                         : allocate_page_size;
 
   // When we start exposing Wasm in jitless mode, then the jitless flag
   // will have to determine whether we set kMapAsJittable or not.
   DCHECK(!FLAG_jitless);
-  VirtualMemory mem(page_allocator, size, hint, allocate_page_size,
+  VirtualMemory mem(page_allocator, size, hint, alignment,
                     VirtualMemory::kMapAsJittable);
   if (!mem.IsReserved()) return {};
   TRACE_HEAP("VMem alloc: 0x%" PRIxPTR ":0x%" PRIxPTR " (%zu)\n", mem.address(),
              mem.end(), mem.size());
+  if (use_huge_pages) {
+    // This is advisory; regular pages are used if the OS refuses.
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(mem.address()),
+                                  mem.size()));
+  }
 
   // TODO(v8:8462): Remove eager commit once perf supports remapping.
   if (FLAG_perf_prof) {
@@ -2277,7 +2402,9 @@ std::vector<std::unique_ptr<WasmCode>> NativeModule::AddCompiledCode(
     base::Vector<WasmCompilationResult> results) {
   TRACE_EVENT1(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
                "wasm.AddCompiledCode", "num", results.size());
-  DCHECK(!results.empty());
+  // Background compilation drops the results of speculatively compiled
+  // functions that failed validation, leaving nothing to add.
+  if (results.empty()) return {};
   // First, allocate code space for all the results.
   size_t total_code_space = 0;
   for (auto& result : results) {
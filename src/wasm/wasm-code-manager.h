@@ -580,6 +580,10 @@ class WasmCodeAllocator {
   void InsertIntoWritableRegions(base::AddressRegion region,
                                  bool switch_to_writable);
 
+  // Commit the given pages for the allocation {code_space}, which was just
+  // taken from {free_code_space_}. Pages after them might get committed ahead.
+  void CommitPages(base::AddressRegion code_space, base::AddressRegion pages);
+
   //////////////////////////////////////////////////////////////////////////////
   // These fields are protected by the mutex in {NativeModule}.
 
@@ -591,6 +595,9 @@ class WasmCodeAllocator {
   // Code space that was allocated before but is dead now. Full pages within
   // this region are discarded. It's still a subset of {owned_code_space_}.
   DisjointAllocationPool freed_code_space_;
+  // Free code space that was committed ahead of allocations (subset of
+  // {free_code_space_}).
+  DisjointAllocationPool precommitted_code_space_;
   std::vector<VirtualMemory> owned_code_space_;
 
   // The following two fields are only used if {protect_code_memory_} is true.
@@ -848,6 +855,12 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   uint32_t* tiering_budget_array() { return tiering_budgets_.get(); }
 
+  // Replaces Liftoff code that did not run during the last
+  // {FLAG_wasm_code_aging_epochs} calls by the lazy compile stub, so that the
+  // code can be freed by the next code GC. Only Liftoff code of dynamic tiering
+  // counts its executions. Returns the number of demoted functions.
+  size_t DemoteColdFunctions();
+
   Counters* counters() const { return code_allocator_.counters(); }
 
  private:
@@ -991,6 +1004,12 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   TieringState tiering_state_ = kTieredUp;
 
+  // For each declared function, the tiering budget seen by the last call to
+  // {DemoteColdFunctions}, and the number of calls since it last changed.
+  // Allocated on the first call.
+  std::unique_ptr<uint32_t[]> aging_tiering_budgets_;
+  std::unique_ptr<int[]> code_ages_;
+
   // Cache both baseline and top-tier code if we are debugging, to speed up
   // repeated enabling/disabling of the debugger or profiler.
   // Maps <tier, function_index> to WasmCode.
@@ -347,6 +347,9 @@ struct WasmEngine::CurrentGCInfo {
   // The start time of this GC; used for tracing and sampled via {Counters}.
   // Can be null ({TimeTicks::IsNull()}) if timer is not high resolution.
   base::TimeTicks start_time;
+
+  // Native modules whose cold functions were already demoted during this GC.
+  std::unordered_set<NativeModule*> aged_native_modules;
 };
 
 struct WasmEngine::IsolateInfo {
@@ -1385,6 +1388,9 @@ void ReportLiveCodeFromFrameForGC(
 }  // namespace
 
 void WasmEngine::ReportLiveCodeFromStackForGC(Isolate* isolate) {
+  // Demote before scanning the stack, so that demoted code which is still
+  // running stays alive.
+  if (FLAG_wasm_code_aging_epochs > 0) DemoteColdFunctionsForGC(isolate);
   wasm::WasmCodeRefScope code_ref_scope;
   std::unordered_set<wasm::WasmCode*> live_wasm_code;
   if (FLAG_experimental_wasm_stack_switching) {
@@ -1593,6 +1599,32 @@ void WasmEngine::TriggerGC(int8_t gc_sequence_index) {
          !current_gc_info_->outstanding_isolates.empty());
 }
 
+void WasmEngine::DemoteColdFunctionsForGC(Isolate* isolate) {
+  std::vector<std::shared_ptr<NativeModule>> native_modules;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (current_gc_info_ == nullptr) return;
+    DCHECK_EQ(1, isolates_.count(isolate));
+    for (NativeModule* native_module : isolates_[isolate]->native_modules) {
+      // Modules shared between isolates only age once per GC.
+      if (!current_gc_info_->aged_native_modules.insert(native_module).second) {
+        continue;
+      }
+      DCHECK_EQ(1, native_modules_.count(native_module));
+      if (auto shared = native_modules_[native_module]->weak_ptr.lock()) {
+        native_modules.emplace_back(std::move(shared));
+      }
+    }
+  }
+  // Demoting adds potentially dead code, which takes the {mutex_}.
+  for (auto& native_module : native_modules) {
+    size_t num_demoted = native_module->DemoteColdFunctions();
+    if (num_demoted == 0) continue;
+    TRACE_CODE_GC("Demoted %zu cold function%s of module %p.\n", num_demoted,
+                  num_demoted == 1 ? "" : "s", native_module.get());
+  }
+}
+
 bool WasmEngine::RemoveIsolateFromCurrentGC(Isolate* isolate) {
   DCHECK(!mutex_.TryLock());
   DCHECK_NOT_NULL(current_gc_info_);
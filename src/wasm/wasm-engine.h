@@ -374,6 +374,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   void TriggerGC(int8_t gc_sequence_index);
 
+  // Demote cold functions of the modules used by the given isolate, once per
+  // GC (see {FLAG_wasm_code_aging_epochs}). Do not hold {mutex_}.
+  void DemoteColdFunctionsForGC(Isolate*);
+
   // Remove an isolate from the outstanding isolates of the current GC. Returns
   // true if the isolate was still outstanding, false otherwise. Hold {mutex_}
   // when calling this method.
@@ -8,19 +8,32 @@
 
 #include "src/logging/counters.h"
 #include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-engine.h"
 
 namespace v8 {
 namespace internal {
 namespace wasm {
 
+WasmImportWrapperCache::WasmImportWrapperCache()
+    : signature_zone_(GetWasmEngine()->allocator(), ZONE_NAME) {}
+
 WasmCode*& WasmImportWrapperCache::ModificationScope::operator[](
     const CacheKey& key) {
-  return cache_->entry_map_[key];
+  return (*cache_)[key];
 }
 
 WasmCode*& WasmImportWrapperCache::operator[](
     const WasmImportWrapperCache::CacheKey& key) {
-  return entry_map_[key];
+  auto it = entry_map_.find(key);
+  if (it != entry_map_.end()) return it->second;
+  const FunctionSig* sig = key.signature;
+  FunctionSig::Builder builder(&signature_zone_, sig->return_count(),
+                               sig->parameter_count());
+  for (ValueType ret : sig->returns()) builder.AddReturn(ret);
+  for (ValueType param : sig->parameters()) builder.AddParam(param);
+  CacheKey owned_key = key;
+  owned_key.signature = builder.Build();
+  return entry_map_[owned_key];
 }
 
 WasmCode* WasmImportWrapperCache::Get(compiler::WasmImportCallKind kind,
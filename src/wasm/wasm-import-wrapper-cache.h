@@ -11,6 +11,7 @@
 
 #include "src/base/platform/mutex.h"
 #include "src/compiler/wasm-compiler.h"
+#include "src/zone/zone.h"
 
 namespace v8 {
 namespace internal {
@@ -24,7 +25,9 @@ class WasmEngine;
 
 using FunctionSig = Signature<ValueType>;
 
-// Implements a cache for import wrappers.
+// Implements a cache for import wrappers. Signatures are compared by their
+// value types, so imports of equal signatures share wrappers even if they use
+// different type indices.
 class WasmImportWrapperCache {
  public:
   struct CacheKey {
@@ -38,7 +41,7 @@ class WasmImportWrapperCache {
           suspend(_suspend) {}
 
     bool operator==(const CacheKey& rhs) const {
-      return kind == rhs.kind && signature == rhs.signature &&
+      return kind == rhs.kind && *signature == *rhs.signature &&
              expected_arity == rhs.expected_arity && suspend == rhs.suspend;
     }
 
@@ -51,7 +54,8 @@ class WasmImportWrapperCache {
   class CacheKeyHash {
    public:
     size_t operator()(const CacheKey& key) const {
-      return base::hash_combine(static_cast<uint8_t>(key.kind), key.signature,
+      return base::hash_combine(static_cast<uint8_t>(key.kind),
+                                hash_value(*key.signature),
                                 key.expected_arity);
     }
   };
@@ -81,11 +85,15 @@ class WasmImportWrapperCache {
   WasmCode* MaybeGet(compiler::WasmImportCallKind kind, const FunctionSig* sig,
                      int expected_arity, Suspend suspend) const;
 
+  WasmImportWrapperCache();
   ~WasmImportWrapperCache();
 
  private:
   mutable base::Mutex mutex_;
   std::unordered_map<CacheKey, WasmCode*, CacheKeyHash> entry_map_;
+  // Holds copies of the signatures of all keys in {entry_map_}, since the
+  // signatures that keys are created with can be short-lived.
+  Zone signature_zone_;
 };
 
 }  // namespace wasm
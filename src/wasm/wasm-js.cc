@@ -15,6 +15,7 @@
 #include "src/base/logging.h"
 #include "src/base/overflowing-math.h"
 #include "src/base/platform/wrappers.h"
+#include "src/builtins/accessors.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
@@ -2763,6 +2764,24 @@ Handle<JSObject> SetupConstructor(Isolate* isolate,
   return proto;
 }
 
+namespace {
+
+// Whether the {WebAssembly} property of {global} is still the lazy accessor
+// defined by {WasmJs::InstallLazily}.
+bool HasLazyWebAssemblyAccessor(Isolate* isolate,
+                                Handle<JSGlobalObject> global) {
+  LookupIterator it(isolate, global, isolate->factory()->WebAssembly_string(),
+                    global, LookupIterator::OWN_SKIP_INTERCEPTOR);
+  if (it.state() == LookupIterator::ACCESS_CHECK) {
+    if (!it.HasAccess()) return false;
+    it.Next();
+  }
+  return it.state() == LookupIterator::ACCESSOR &&
+         *it.GetAccessors() == *isolate->factory()->webassembly_accessor();
+}
+
+}  // namespace
+
 // static
 void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
   Handle<JSGlobalObject> global = isolate->global_object();
@@ -2810,7 +2829,13 @@ void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
 
   // Expose the API on the global object if configured to do so.
   if (exposed_on_global_object) {
-    JSObject::AddProperty(isolate, global, name, webassembly, DONT_ENUM);
+    if (HasLazyWebAssemblyAccessor(isolate, global)) {
+      Accessors::ReplaceAccessorWithDataProperty(isolate, global, global, name,
+                                                 webassembly)
+          .Check();
+    } else {
+      JSObject::AddProperty(isolate, global, name, webassembly, DONT_ENUM);
+    }
   }
 
   // Setup Module
@@ -2981,6 +3006,29 @@ void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
                         runtime_error, DONT_ENUM);
 }
 
+// static
+void WasmJs::InstallLazily(Isolate* isolate) {
+  Handle<JSGlobalObject> global = isolate->global_object();
+  JSObject::SetAccessor(global, isolate->factory()->WebAssembly_string(),
+                        isolate->factory()->webassembly_accessor(), DONT_ENUM)
+      .Check();
+}
+
+// static
+void WasmJs::EnsureInstalled(Isolate* isolate) {
+  Handle<Context> context(isolate->native_context(), isolate);
+  if (!context->get(Context::WASM_MODULE_CONSTRUCTOR_INDEX)
+           .IsUndefined(isolate)) {
+    return;
+  }
+  bool exposed_on_global_object =
+      HasLazyWebAssemblyAccessor(isolate, isolate->global_object());
+  Install(isolate, exposed_on_global_object);
+  // Conditional features requested while the accessor was pending have been
+  // skipped, see below.
+  if (exposed_on_global_object) InstallConditionalFeatures(isolate, context);
+}
+
 // static
 void WasmJs::InstallConditionalFeatures(Isolate* isolate,
                                         Handle<Context> context) {
@@ -2989,6 +3037,9 @@ void WasmJs::InstallConditionalFeatures(Isolate* isolate,
   auto enabled_features = i::wasm::WasmFeatures::FromContext(isolate, context);
   if (enabled_features.has_eh()) {
     Handle<JSGlobalObject> global = handle(context->global_object(), isolate);
+    // Do not force the installation of a lazy {WebAssembly} object; it picks
+    // up the enabled features once it gets installed.
+    if (HasLazyWebAssemblyAccessor(isolate, global)) return;
     MaybeHandle<Object> maybe_webassembly =
         JSObject::GetProperty(isolate, global, "WebAssembly");
     Handle<Object> webassembly_obj;
@@ -27,6 +27,14 @@ class WasmJs {
   V8_EXPORT_PRIVATE static void Install(Isolate* isolate,
                                         bool exposed_on_global_object);
 
+  // Defines the {WebAssembly} property of the current global object as a lazy
+  // accessor, which installs the JS API on first access.
+  V8_EXPORT_PRIVATE static void InstallLazily(Isolate* isolate);
+
+  // Installs the JS API in the current native context unless that already
+  // happened. Replaces a pending lazy {WebAssembly} accessor.
+  V8_EXPORT_PRIVATE static void EnsureInstalled(Isolate* isolate);
+
   V8_EXPORT_PRIVATE static void InstallConditionalFeatures(
       Isolate* isolate, Handle<Context> context);
 };
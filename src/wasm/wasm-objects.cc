@@ -26,6 +26,7 @@
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-js.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
@@ -121,6 +122,7 @@ Handle<WasmModuleObject> WasmModuleObject::New(
     managed_native_module = Managed<wasm::NativeModule>::FromSharedPtr(
         isolate, memory_estimate, std::move(native_module));
   }
+  WasmJs::EnsureInstalled(isolate);
   Handle<WasmModuleObject> module_object = Handle<WasmModuleObject>::cast(
       isolate->factory()->NewJSObject(isolate->wasm_module_constructor()));
   module_object->set_export_wrappers(*export_wrappers);
@@ -212,6 +214,7 @@ Handle<WasmTableObject> WasmTableObject::New(
     max = isolate->factory()->undefined_value();
   }
 
+  WasmJs::EnsureInstalled(isolate);
   Handle<JSFunction> table_ctor(
       isolate->native_context()->wasm_table_constructor(), isolate);
   auto table_obj = Handle<WasmTableObject>::cast(
@@ -818,6 +821,7 @@ MaybeHandle<WasmMemoryObject> WasmMemoryObject::New(
     buffer = isolate->factory()->NewJSArrayBuffer(std::move(backing_store));
   }
 
+  WasmJs::EnsureInstalled(isolate);
   Handle<JSFunction> memory_ctor(
       isolate->native_context()->wasm_memory_constructor(), isolate);
 
@@ -1029,6 +1033,7 @@ MaybeHandle<WasmGlobalObject> WasmGlobalObject::New(
     MaybeHandle<JSArrayBuffer> maybe_untagged_buffer,
     MaybeHandle<FixedArray> maybe_tagged_buffer, wasm::ValueType type,
     int32_t offset, bool is_mutable) {
+  WasmJs::EnsureInstalled(isolate);
   Handle<JSFunction> global_ctor(
       isolate->native_context()->wasm_global_constructor(), isolate);
   auto global_obj = Handle<WasmGlobalObject>::cast(
@@ -1173,6 +1178,7 @@ const WasmModule* WasmInstanceObject::module() {
 
 Handle<WasmInstanceObject> WasmInstanceObject::New(
     Isolate* isolate, Handle<WasmModuleObject> module_object) {
+  WasmJs::EnsureInstalled(isolate);
   Handle<JSFunction> instance_cons(
       isolate->native_context()->wasm_instance_constructor(), isolate);
   Handle<JSObject> instance_object =
@@ -1624,6 +1630,7 @@ wasm::WasmValue WasmArray::GetElement(uint32_t index) {
 Handle<WasmTagObject> WasmTagObject::New(Isolate* isolate,
                                          const wasm::FunctionSig* sig,
                                          Handle<HeapObject> tag) {
+  WasmJs::EnsureInstalled(isolate);
   Handle<JSFunction> tag_cons(isolate->native_context()->wasm_tag_constructor(),
                               isolate);
 
@@ -1801,6 +1808,7 @@ Handle<WasmContinuationObject> WasmContinuationObject::New(
 
 // static
 Handle<WasmSuspenderObject> WasmSuspenderObject::New(Isolate* isolate) {
+  WasmJs::EnsureInstalled(isolate);
   Handle<JSFunction> suspender_cons(
       isolate->native_context()->wasm_suspender_constructor(), isolate);
   // Suspender objects should be at least as long-lived as the instances of
@@ -1979,6 +1987,7 @@ Handle<WasmExportedFunction> WasmExportedFunction::New(
   Handle<Map> function_map;
   switch (instance->module()->origin) {
     case wasm::kWasmOrigin:
+      WasmJs::EnsureInstalled(isolate);
       function_map = isolate->wasm_exported_function_map();
       break;
     case wasm::kAsmJsSloppyOrigin:
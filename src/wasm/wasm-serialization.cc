@@ -278,7 +278,8 @@ static_assert(std::is_trivially_destructible<ExternalReferenceList>::value,
 
 class V8_EXPORT_PRIVATE NativeModuleSerializer {
  public:
-  NativeModuleSerializer(const NativeModule*, base::Vector<WasmCode* const>);
+  NativeModuleSerializer(const NativeModule*, base::Vector<WasmCode* const>,
+                         base::Vector<const byte> previous);
   NativeModuleSerializer(const NativeModuleSerializer&) = delete;
   NativeModuleSerializer& operator=(const NativeModuleSerializer&) = delete;
 
@@ -286,31 +287,103 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   bool Write(Writer* writer);
 
  private:
-  size_t MeasureCode(const WasmCode*) const;
+  // The serialized TurboFan code of a function in an earlier serialization.
+  struct PreviousCode {
+    base::Vector<const byte> data;  // Starting with the code kind.
+    size_t code_size = 0;
+  };
+
+  void ReadPreviousCode(base::Vector<const byte> previous);
+  const PreviousCode* GetReusableCode(size_t index) const;
+  size_t MeasureCode(size_t index) const;
   void WriteHeader(Writer*, size_t total_code_size);
-  void WriteCode(const WasmCode*, Writer*);
+  void WriteCode(size_t index, Writer*);
 
   const NativeModule* const native_module_;
   const base::Vector<WasmCode* const> code_table_;
+  // Empty if there is no usable earlier serialization.
+  std::vector<PreviousCode> previous_code_;
   bool write_called_ = false;
   size_t total_written_code_ = 0;
   int num_turbofan_functions_ = 0;
 };
 
 NativeModuleSerializer::NativeModuleSerializer(
-    const NativeModule* module, base::Vector<WasmCode* const> code_table)
+    const NativeModule* module, base::Vector<WasmCode* const> code_table,
+    base::Vector<const byte> previous)
     : native_module_(module), code_table_(code_table) {
   DCHECK_NOT_NULL(native_module_);
   // TODO(mtrofin): persist the export wrappers. Ideally, we'd only persist
   // the unique ones, i.e. the cache.
+  if (!previous.empty()) ReadPreviousCode(previous);
 }
 
-size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
+void NativeModuleSerializer::ReadPreviousCode(
+    base::Vector<const byte> previous) {
+  // Code serialized by other versions or with other flags can't be reused.
+  if (!IsSupportedVersion(previous)) return;
+  Reader reader(previous + WasmSerializer::kHeaderSize);
+  if (reader.current_size() < kHeaderSize) return;
+  reader.Skip(kHeaderSize);
+  std::vector<PreviousCode> previous_code(code_table_.size());
+  for (PreviousCode& code : previous_code) {
+    if (reader.current_size() < sizeof(uint8_t)) return;
+    const byte* start = reader.current_location();
+    uint8_t code_kind = reader.Read<uint8_t>();
+    if (code_kind == kLazyFunction || code_kind == kLiftoffFunction) continue;
+    if (code_kind != kTurboFanFunction) return;
+    if (reader.current_size() < kCodeHeaderSize - sizeof(uint8_t)) return;
+    // Skip the offsets, stack slots and tagged parameter slots.
+    reader.Skip(7 * sizeof(int));
+    int code_size = reader.Read<int>();
+    int reloc_size = reader.Read<int>();
+    int source_position_size = reader.Read<int>();
+    int protected_instructions_size = reader.Read<int>();
+    WasmCode::Kind kind = reader.Read<WasmCode::Kind>();
+    ExecutionTier tier = reader.Read<ExecutionTier>();
+    if (kind != WasmCode::kWasmFunction || tier != ExecutionTier::kTurbofan ||
+        code_size < 0 || !IsAligned(code_size, kCodeAlignment)) {
+      return;
+    }
+    for (int size : {code_size, reloc_size, source_position_size,
+                     protected_instructions_size}) {
+      if (size < 0 || static_cast<size_t>(size) > reader.current_size()) {
+        return;
+      }
+      reader.Skip(size);
+    }
+    code.data = {start, static_cast<size_t>(reader.current_location() - start)};
+    code.code_size = static_cast<size_t>(code_size);
+  }
+  // The serialization must be of a module with the same number of functions.
+  if (reader.current_size() != 0) return;
+  previous_code_ = std::move(previous_code);
+}
+
+const NativeModuleSerializer::PreviousCode*
+NativeModuleSerializer::GetReusableCode(size_t index) const {
+  if (previous_code_.empty() || previous_code_[index].data.empty()) {
+    return nullptr;
+  }
+  // Functions that are not TurboFan code anymore (e.g. after tier-down for
+  // debugging) are serialized as usual.
+  const WasmCode* code = code_table_[index];
+  if (code == nullptr || code->tier() != ExecutionTier::kTurbofan) {
+    return nullptr;
+  }
+  return &previous_code_[index];
+}
+
+size_t NativeModuleSerializer::MeasureCode(size_t index) const {
+  const WasmCode* code = code_table_[index];
   if (code == nullptr) return sizeof(uint8_t);
   DCHECK_EQ(WasmCode::kWasmFunction, code->kind());
   if (code->tier() != ExecutionTier::kTurbofan) {
     return sizeof(uint8_t);
   }
+  if (const PreviousCode* previous = GetReusableCode(index)) {
+    return previous->data.size();
+  }
   return kCodeHeaderSize + code->instructions().size() +
          code->reloc_info().size() + code->source_positions().size() +
          code->protected_instructions_data().size();
@@ -318,8 +391,8 @@ size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
 
 size_t NativeModuleSerializer::Measure() const {
   size_t size = kHeaderSize;
-  for (WasmCode* code : code_table_) {
-    size += MeasureCode(code);
+  for (size_t i = 0; i < code_table_.size(); ++i) {
+    size += MeasureCode(i);
   }
   return size;
 }
@@ -332,7 +405,8 @@ void NativeModuleSerializer::WriteHeader(Writer* writer,
   writer->Write(total_code_size);
 }
 
-void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
+void NativeModuleSerializer::WriteCode(size_t index, Writer* writer) {
+  const WasmCode* code = code_table_[index];
   if (code == nullptr) {
     writer->Write(kLazyFunction);
     return;
@@ -358,6 +432,12 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   }
 
   ++num_turbofan_functions_;
+  if (const PreviousCode* previous = GetReusableCode(index)) {
+    // The previous serialization holds relocated code already.
+    writer->WriteVector(previous->data);
+    total_written_code_ += previous->code_size;
+    return;
+  }
   writer->Write(kTurboFanFunction);
   // Write the size of the entire code section, followed by the code header.
   writer->Write(code->constant_pool_offset());
@@ -454,16 +534,20 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   write_called_ = true;
 
   size_t total_code_size = 0;
-  for (WasmCode* code : code_table_) {
+  for (size_t i = 0; i < code_table_.size(); ++i) {
+    WasmCode* code = code_table_[i];
     if (code && code->tier() == ExecutionTier::kTurbofan) {
-      DCHECK(IsAligned(code->instructions().size(), kCodeAlignment));
-      total_code_size += code->instructions().size();
+      const PreviousCode* previous = GetReusableCode(i);
+      size_t code_size =
+          previous ? previous->code_size : code->instructions().size();
+      DCHECK(IsAligned(code_size, kCodeAlignment));
+      total_code_size += code_size;
     }
   }
   WriteHeader(writer, total_code_size);
 
-  for (WasmCode* code : code_table_) {
-    WriteCode(code, writer);
+  for (size_t i = 0; i < code_table_.size(); ++i) {
+    WriteCode(i, writer);
   }
   // If not a single function was written, serialization was not successful.
   if (num_turbofan_functions_ == 0) return false;
@@ -478,15 +562,21 @@ WasmSerializer::WasmSerializer(NativeModule* native_module)
     : native_module_(native_module),
       code_table_(native_module->SnapshotCodeTable()) {}
 
+WasmSerializer::WasmSerializer(NativeModule* native_module,
+                               base::Vector<const byte> previous)
+    : native_module_(native_module),
+      code_table_(native_module->SnapshotCodeTable()),
+      previous_(previous) {}
+
 size_t WasmSerializer::GetSerializedNativeModuleSize() const {
-  NativeModuleSerializer serializer(native_module_,
-                                    base::VectorOf(code_table_));
+  NativeModuleSerializer serializer(native_module_, base::VectorOf(code_table_),
+                                    previous_);
   return kHeaderSize + serializer.Measure();
 }
 
 bool WasmSerializer::SerializeNativeModule(base::Vector<byte> buffer) const {
-  NativeModuleSerializer serializer(native_module_,
-                                    base::VectorOf(code_table_));
+  NativeModuleSerializer serializer(native_module_, base::VectorOf(code_table_),
+                                    previous_);
   size_t measured_size = kHeaderSize + serializer.Measure();
   if (buffer.size() < measured_size) return false;
 
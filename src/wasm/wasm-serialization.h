@@ -23,6 +23,15 @@ class V8_EXPORT_PRIVATE WasmSerializer {
  public:
   explicit WasmSerializer(NativeModule* native_module);
 
+  // Serialize incrementally, based on an earlier serialization of the same
+  // module: functions that are TurboFan code both in {previous} and in the
+  // module are copied over from {previous} instead of being serialized again.
+  // The result is a regular serialization that does not depend on {previous}.
+  // If {previous} was not created by this V8 version with the same flags, it
+  // is ignored. {previous} has to stay alive while this serializer is used.
+  WasmSerializer(NativeModule* native_module,
+                 base::Vector<const byte> previous);
+
   // Measure the required buffer size needed for serialization.
   size_t GetSerializedNativeModuleSize() const;
 
@@ -50,6 +59,7 @@ class V8_EXPORT_PRIVATE WasmSerializer {
   // The {WasmCodeRefScope} keeps the pointers in {code_table_} alive.
   WasmCodeRefScope code_ref_scope_;
   std::vector<WasmCode*> code_table_;
+  base::Vector<const byte> previous_;
 };
 
 // Support for deserializing WebAssembly {NativeModule} objects.
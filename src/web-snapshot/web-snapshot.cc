@@ -333,6 +333,7 @@ void WebSnapshotSerializer::SerializePendingItems() {
 
 // Format (full snapshot):
 // - Magic number (4 bytes)
+// - Format version
 // - String count
 // - For each string:
 //   - Serialized string
@@ -361,13 +362,14 @@ void WebSnapshotSerializer::WriteSnapshot(uint8_t*& buffer,
       map_serializer_.buffer_size_ + context_serializer_.buffer_size_ +
       function_serializer_.buffer_size_ + class_serializer_.buffer_size_ +
       array_serializer_.buffer_size_ + object_serializer_.buffer_size_ +
-      export_serializer_.buffer_size_ + 8 * sizeof(uint32_t);
+      export_serializer_.buffer_size_ + 9 * sizeof(uint32_t);
   if (total_serializer.ExpandBuffer(needed_size).IsNothing()) {
     Throw("Out of memory");
     return;
   }
 
   total_serializer.WriteRawBytes(kMagicNumber, 4);
+  total_serializer.WriteUint32(kVersion);
   WriteObjects(total_serializer, string_count(), string_serializer_, "strings");
   WriteObjects(total_serializer, map_count(), map_serializer_, "maps");
   WriteObjects(total_serializer, context_count(), context_serializer_,
@@ -412,6 +414,7 @@ bool WebSnapshotSerializer::InsertIntoIndexMap(ObjectCacheIndexMap& map,
 }
 
 // Format:
+// - StringEncoding
 // - Length
 // - Raw bytes (data)
 void WebSnapshotSerializer::SerializeString(Handle<String> string,
@@ -420,13 +423,13 @@ void WebSnapshotSerializer::SerializeString(Handle<String> string,
     return;
   }
 
-  // TODO(v8:11525): Always write strings as UTF-8.
   string = String::Flatten(isolate_, string);
   DisallowGarbageCollection no_gc;
   String::FlatContent flat = string->GetFlatContent(no_gc);
   DCHECK(flat.IsFlat());
   if (flat.IsOneByte()) {
     base::Vector<const uint8_t> chars = flat.ToOneByteVector();
+    string_serializer_.WriteUint32(StringEncoding::ONE_BYTE);
     string_serializer_.WriteUint32(chars.length());
     string_serializer_.WriteRawBytes(chars.begin(),
                                      chars.length() * sizeof(uint8_t));
@@ -436,6 +439,7 @@ void WebSnapshotSerializer::SerializeString(Handle<String> string,
     int length = api_string->Utf8Length(v8_isolate);
     std::unique_ptr<char[]> buffer(new char[length]);
     api_string->WriteUtf8(v8_isolate, buffer.get(), length);
+    string_serializer_.WriteUint32(StringEncoding::UTF8);
     string_serializer_.WriteUint32(length);
     string_serializer_.WriteRawBytes(buffer.get(), length * sizeof(uint8_t));
   } else {
@@ -1246,6 +1250,11 @@ bool WebSnapshotDeserializer::DeserializeSnapshot() {
     Throw("Invalid magic number");
     return false;
   }
+  uint32_t version;
+  if (!deserializer_.ReadUint32(&version) || version != kVersion) {
+    Throw("Unsupported snapshot version");
+    return false;
+  }
 
   DeserializeStrings();
   DeserializeMaps();
@@ -1308,8 +1317,25 @@ void WebSnapshotDeserializer::DeserializeStrings() {
   strings_handle_ = factory()->NewFixedArray(string_count_);
   strings_ = *strings_handle_;
   for (uint32_t i = 0; i < string_count_; ++i) {
-    MaybeHandle<String> maybe_string =
-        deserializer_.ReadUtf8String(AllocationType::kOld);
+    uint32_t encoding;
+    if (!deserializer_.ReadUint32(&encoding)) {
+      Throw("Malformed string");
+      return;
+    }
+    MaybeHandle<String> maybe_string;
+    switch (encoding) {
+      case StringEncoding::ONE_BYTE:
+        // Latin-1 bytes are copied as is, without going through the UTF-8
+        // decoder.
+        maybe_string = deserializer_.ReadOneByteString(AllocationType::kOld);
+        break;
+      case StringEncoding::UTF8:
+        maybe_string = deserializer_.ReadUtf8String(AllocationType::kOld);
+        break;
+      default:
+        Throw("Unsupported string encoding");
+        return;
+    }
     Handle<String> string;
     if (!maybe_string.ToHandle(&string)) {
       Throw("Malformed string");
@@ -1386,7 +1412,7 @@ void WebSnapshotDeserializer::DeserializeMaps() {
       Map empty_map =
           isolate_->native_context()->object_function().initial_map();
       maps_.set(i, empty_map);
-      return;
+      continue;
     }
 
     Handle<DescriptorArray> descriptors =
@@ -1405,10 +1431,10 @@ void WebSnapshotDeserializer::DeserializeMaps() {
 
       Handle<String> key(ReadString(true), isolate_);
 
-      // Use the "none" representation until we see the first object having this
-      // map. At that point, modify the representation.
+      // All values are stored tagged, so the representation is known up front
+      // and objects sharing this map don't need to update it.
       Descriptor desc = Descriptor::DataField(
-          isolate_, key, i.as_int(), attributes, Representation::None());
+          isolate_, key, i.as_int(), attributes, Representation::Tagged());
       descriptors->Set(i, &desc);
     }
     DCHECK_EQ(descriptors->number_of_descriptors(), property_count);
@@ -1790,31 +1816,14 @@ void WebSnapshotDeserializer::DeserializeObjects() {
       Throw("Malformed object");
       return;
     }
-    Map raw_map = Map::cast(maps_.get(map_id));
-    Handle<DescriptorArray> descriptors =
-        handle(raw_map.instance_descriptors(kRelaxedLoad), isolate_);
-    int no_properties = raw_map.NumberOfOwnDescriptors();
+    Handle<Map> map(Map::cast(maps_.get(map_id)), isolate_);
+    int no_properties = map->NumberOfOwnDescriptors();
     // TODO(v8:11525): In-object properties.
-    Handle<Map> map(raw_map, isolate_);
     Handle<PropertyArray> property_array =
         factory()->NewPropertyArray(no_properties);
     for (int i = 0; i < no_properties; ++i) {
       Object value = ReadValue(property_array, i);
       DisallowGarbageCollection no_gc;
-      // Read the representation from the map.
-      DescriptorArray raw_descriptors = *descriptors;
-      PropertyDetails details = raw_descriptors.GetDetails(InternalIndex(i));
-      CHECK_EQ(details.location(), PropertyLocation::kField);
-      CHECK_EQ(PropertyKind::kData, details.kind());
-      Representation r = details.representation();
-      if (r.IsNone()) {
-        // Switch over to wanted_representation.
-        details = details.CopyWithRepresentation(Representation::Tagged());
-        raw_descriptors.SetDetails(InternalIndex(i), details);
-      } else if (!r.Equals(Representation::Tagged())) {
-        // TODO(v8:11525): Support this case too.
-        UNREACHABLE();
-      }
       property_array->set(i, value);
     }
     Handle<JSObject> object = factory()->NewJSObjectFromMap(map);
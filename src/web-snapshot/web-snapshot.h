@@ -57,6 +57,12 @@ class WebSnapshotSerializerDeserializer {
   };
 
   static constexpr uint8_t kMagicNumber[4] = {'+', '+', '+', ';'};
+  // Bumped whenever the format changes incompatibly.
+  static constexpr uint32_t kVersion = 1;
+
+  // One-byte strings are stored as raw Latin-1 bytes, two-byte strings as
+  // UTF-8.
+  enum StringEncoding : uint8_t { ONE_BYTE, UTF8 };
 
   enum ContextType : uint8_t { FUNCTION, BLOCK };
 
@@ -4,12 +4,15 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -70,7 +73,8 @@ AccountingAllocator::AccountingAllocator()
     : zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
       zone_backing_free_(
-          V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetFreeFn()) {
+          V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetFreeFn()),
+      max_pooled_bytes_(FLAG_zone_segment_pool_size * KB) {
   if (COMPRESS_ZONES_BOOL) {
     v8::PageAllocator* platform_page_allocator = GetPlatformPageAllocator();
     VirtualMemory memory = ReserveAddressSpace(platform_page_allocator);
@@ -80,7 +84,48 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { TrimSegmentPool(); }
+
+// static
+size_t AccountingAllocator::PooledSizeClass(size_t bytes) {
+  DCHECK_LE(bytes, kMaxPooledSegmentSize);
+  const size_t rounded = base::bits::RoundUpToPowerOfTwo64(
+      std::max<size_t>(bytes, kMinPooledSegmentSize));
+  const size_t size_class =
+      base::bits::WhichPowerOfTwo(rounded) -
+      base::bits::WhichPowerOfTwo(kMinPooledSegmentSize);
+  DCHECK_LT(size_class, kNumberOfPooledSizeClasses);
+  return size_class;
+}
+
+Segment* AccountingAllocator::TryAllocateFromPool(size_t bytes) {
+  base::MutexGuard guard(&segment_pool_mutex_);
+  std::vector<Segment*>& pool = segment_pool_[PooledSizeClass(bytes)];
+  if (pool.empty()) return nullptr;
+  Segment* segment = pool.back();
+  pool.pop_back();
+  DCHECK_GE(pooled_bytes_, bytes);
+  pooled_bytes_ -= bytes;
+  return segment;
+}
+
+bool AccountingAllocator::TryReturnToPool(Segment* segment, size_t bytes) {
+  base::MutexGuard guard(&segment_pool_mutex_);
+  if (pooled_bytes_ + bytes > max_pooled_bytes_) return false;
+  segment_pool_[PooledSizeClass(bytes)].push_back(segment);
+  pooled_bytes_ += bytes;
+  return true;
+}
+
+void AccountingAllocator::TrimSegmentPool() {
+  base::MutexGuard guard(&segment_pool_mutex_);
+  for (std::vector<Segment*>& pool : segment_pool_) {
+    for (Segment* segment : pool) zone_backing_free_(segment);
+    pool.clear();
+    pool.shrink_to_fit();
+  }
+  pooled_bytes_ = 0;
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -90,6 +135,13 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (max_pooled_bytes_ > 0 && bytes <= kMaxPooledSegmentSize) {
+    // Only power-of-two sizes are pooled so that returned segments can be
+    // handed out again for any request of the same size class.
+    bytes = base::bits::RoundUpToPowerOfTwo64(
+        std::max<size_t>(bytes, kMinPooledSegmentSize));
+    memory = TryAllocateFromPool(bytes);
+    if (memory == nullptr) memory = AllocWithRetry(bytes, zone_backing_malloc_);
   } else {
     memory = AllocWithRetry(bytes, zone_backing_malloc_);
   }
@@ -114,6 +166,10 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
+  } else if (max_pooled_bytes_ > 0 && segment_size <= kMaxPooledSegmentSize &&
+             base::bits::IsPowerOfTwo(segment_size) &&
+             TryReturnToPool(segment, segment_size)) {
+    // The segment is reused by a later allocation of the same size class.
   } else {
     zone_backing_free_(segment);
   }
@@ -7,9 +7,12 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -38,6 +41,9 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Releases all pooled segments, e.g. on memory pressure.
+  void TrimSegmentPool();
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -67,6 +73,19 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments of up to kMaxPooledSegmentSize bytes are rounded up to a power of
+  // two, starting at kMinPooledSegmentSize, and freed segments of these sizes
+  // are kept for reuse when --zone-segment-pool-size is set. Compressed
+  // segments are not pooled.
+  static constexpr size_t kMinPooledSegmentSize = 8 * KB;
+  static constexpr size_t kMaxPooledSegmentSize = 64 * KB;
+  static constexpr size_t kNumberOfPooledSizeClasses = 4;
+
+  static size_t PooledSizeClass(size_t bytes);
+
+  Segment* TryAllocateFromPool(size_t bytes);
+  bool TryReturnToPool(Segment* segment, size_t bytes);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
@@ -75,6 +94,11 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
   ZoneBackingAllocator::MallocFn zone_backing_malloc_ = nullptr;
   ZoneBackingAllocator::FreeFn zone_backing_free_ = nullptr;
+
+  const size_t max_pooled_bytes_;
+  base::Mutex segment_pool_mutex_;
+  std::vector<Segment*> segment_pool_[kNumberOfPooledSizeClasses];
+  size_t pooled_bytes_ = 0;
 };
 
 }  // namespace internal
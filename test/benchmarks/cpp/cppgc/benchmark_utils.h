@@ -18,20 +18,25 @@ class BenchmarkWithHeap : public benchmark::Fixture {
   static void InitializeProcess();
   static void ShutdownProcess();
 
+  static std::shared_ptr<testing::TestPlatform> GetPlatform() {
+    return platform_;
+  }
+
  protected:
   void SetUp(::benchmark::State& state) override {
-    heap_ = cppgc::Heap::Create(GetPlatform());
+    heap_ = cppgc::Heap::Create(GetPlatform(), GetHeapOptions());
   }
 
   void TearDown(::benchmark::State& state) override { heap_.reset(); }
 
+  // Allows benchmarks to set up the heap with e.g. custom spaces.
+  virtual cppgc::Heap::HeapOptions GetHeapOptions() {
+    return cppgc::Heap::HeapOptions::Default();
+  }
+
   cppgc::Heap& heap() const { return *heap_.get(); }
 
  private:
-  static std::shared_ptr<testing::TestPlatform> GetPlatform() {
-    return platform_;
-  }
-
   static std::shared_ptr<testing::TestPlatform> platform_;
 
   std::unique_ptr<cppgc::Heap> heap_;
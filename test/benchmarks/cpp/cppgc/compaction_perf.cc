@@ -0,0 +1,123 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/custom-space.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/compactor.h"
+#include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/heap.h"
+#include "src/heap/cppgc/marker.h"
+#include "src/heap/cppgc/sweeper.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+
+class CompactableBenchmarkSpace
+    : public CustomSpace<CompactableBenchmarkSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 0;
+  static constexpr bool kSupportsCompaction = true;
+};
+
+namespace internal {
+namespace {
+
+class CompactableNode final : public GarbageCollected<CompactableNode> {
+ public:
+  void Trace(Visitor* visitor) const {
+    visitor->Trace(next);
+    visitor->RegisterMovableReference(next.GetSlotForTesting());
+  }
+
+  Member<CompactableNode> next;
+};
+
+// Lives in a regular space and holds the only reference into the compactable
+// space that is not itself part of the list.
+class ListHead final : public GarbageCollected<ListHead> {
+ public:
+  void Trace(Visitor* visitor) const {
+    visitor->Trace(first);
+    visitor->RegisterMovableReference(first.GetSlotForTesting());
+  }
+
+  Member<CompactableNode> first;
+};
+
+}  // namespace
+}  // namespace internal
+
+template <>
+struct SpaceTrait<internal::CompactableNode> {
+  using Space = CompactableBenchmarkSpace;
+};
+
+namespace internal {
+namespace {
+
+class Compaction : public testing::BenchmarkWithHeap {
+ public:
+  cppgc::Heap::HeapOptions GetHeapOptions() override {
+    cppgc::Heap::HeapOptions options;
+    options.custom_spaces.emplace_back(
+        std::make_unique<CompactableBenchmarkSpace>());
+    return options;
+  }
+};
+
+constexpr size_t kNumberOfNodes = 50000;
+
+// Builds a list in the compactable space and unlinks every other node, which
+// leaves the compactable pages half empty. Only the compaction step itself is
+// measured.
+BENCHMARK_F(Compaction, HalfFragmentedSpace)(benchmark::State& st) {
+  Heap& cpp_heap = *Heap::From(&heap());
+  Compactor& compactor = cpp_heap.compactor();
+  Persistent<ListHead> head(
+      MakeGarbageCollected<ListHead>(cpp_heap.GetAllocationHandle()));
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    head->first = nullptr;
+    for (size_t i = 0; i < kNumberOfNodes; ++i) {
+      CompactableNode* node =
+          MakeGarbageCollected<CompactableNode>(cpp_heap.GetAllocationHandle());
+      node->next = head->first;
+      head->first = node;
+    }
+    for (CompactableNode* node = head->first; node && node->next;
+         node = node->next) {
+      node->next = node->next->next;
+    }
+    compactor.EnableForNextGCForTesting();
+    compactor.InitializeIfShouldCompact(
+        GarbageCollector::Config::MarkingType::kIncremental,
+        GarbageCollector::Config::StackState::kNoHeapPointers);
+    cpp_heap.StartIncrementalGarbageCollection(
+        GarbageCollector::Config::PreciseIncrementalConfig());
+    cpp_heap.marker()->FinishMarking(
+        GarbageCollector::Config::StackState::kNoHeapPointers);
+    cpp_heap.GetMarkerRefForTesting().reset();
+    st.ResumeTiming();
+
+    compactor.CompactSpacesIfEnabled();
+
+    st.PauseTiming();
+    const Sweeper::SweepingConfig sweeping_config{
+        Sweeper::SweepingConfig::SweepingType::kAtomic,
+        Sweeper::SweepingConfig::CompactableSpaceHandling::kIgnore};
+    cpp_heap.sweeper().Start(sweeping_config);
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfNodes / 2);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
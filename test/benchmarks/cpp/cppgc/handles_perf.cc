@@ -0,0 +1,112 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using Handles = testing::BenchmarkWithHeap;
+
+class GCed final : public GarbageCollected<GCed> {
+ public:
+  void Trace(Visitor* visitor) const { visitor->Trace(member); }
+
+  Member<GCed> member;
+};
+
+constexpr size_t kNumberOfHandles = 1024;
+
+BENCHMARK_F(Handles, PersistentCreateAndDestroy)(benchmark::State& st) {
+  Persistent<GCed> object(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  for (auto _ : st) {
+    USE(_);
+    std::vector<Persistent<GCed>> handles;
+    handles.reserve(kNumberOfHandles);
+    for (size_t i = 0; i < kNumberOfHandles; ++i) {
+      handles.emplace_back(object.Get());
+    }
+    benchmark::DoNotOptimize(handles.data());
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfHandles);
+}
+
+BENCHMARK_F(Handles, WeakPersistentCreateAndDestroy)(benchmark::State& st) {
+  Persistent<GCed> object(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  for (auto _ : st) {
+    USE(_);
+    std::vector<WeakPersistent<GCed>> handles;
+    handles.reserve(kNumberOfHandles);
+    for (size_t i = 0; i < kNumberOfHandles; ++i) {
+      handles.emplace_back(object.Get());
+    }
+    benchmark::DoNotOptimize(handles.data());
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfHandles);
+}
+
+BENCHMARK_F(Handles, PersistentReassign)(benchmark::State& st) {
+  Persistent<GCed> first(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  Persistent<GCed> second(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  Persistent<GCed> handle;
+  for (auto _ : st) {
+    USE(_);
+    for (size_t i = 0; i < kNumberOfHandles; ++i) {
+      handle = (i & 1) ? first.Get() : second.Get();
+      handle.Clear();
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfHandles);
+}
+
+BENCHMARK_F(Handles, MemberAssign)(benchmark::State& st) {
+  Persistent<GCed> holder(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  Persistent<GCed> first(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  Persistent<GCed> second(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  for (auto _ : st) {
+    USE(_);
+    for (size_t i = 0; i < kNumberOfHandles; ++i) {
+      holder->member = (i & 1) ? first.Get() : second.Get();
+    }
+    benchmark::DoNotOptimize(holder->member.Get());
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfHandles);
+}
+
+BENCHMARK_F(Handles, UntracedMemberAssign)(benchmark::State& st) {
+  Persistent<GCed> first(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  Persistent<GCed> second(
+      MakeGarbageCollected<GCed>(heap().GetAllocationHandle()));
+  UntracedMember<GCed> member;
+  for (auto _ : st) {
+    USE(_);
+    for (size_t i = 0; i < kNumberOfHandles; ++i) {
+      member = (i & 1) ? first.Get() : second.Get();
+    }
+    benchmark::DoNotOptimize(member.Get());
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfHandles);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
@@ -0,0 +1,83 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using Marking = testing::BenchmarkWithHeap;
+
+class TreeNode final : public GarbageCollected<TreeNode> {
+ public:
+  TreeNode(AllocationHandle& handle, size_t depth) {
+    if (depth == 0) return;
+    left_ = MakeGarbageCollected<TreeNode>(handle, depth - 1);
+    right_ = MakeGarbageCollected<TreeNode>(handle, depth - 1);
+  }
+
+  void Trace(Visitor* visitor) const {
+    visitor->Trace(left_);
+    visitor->Trace(right_);
+  }
+
+ private:
+  Member<TreeNode> left_;
+  Member<TreeNode> right_;
+};
+
+// 2^17 - 1 live objects.
+constexpr size_t kTreeDepth = 16;
+constexpr size_t kNumberOfNodes = (size_t{1} << (kTreeDepth + 1)) - 1;
+
+// All objects are live, so the time is dominated by marking. Sweeping is
+// atomic and only has to walk the pages.
+void RunMarkingBenchmark(benchmark::State& st, Heap& heap,
+                         GarbageCollector::Config config) {
+  Persistent<TreeNode> root(MakeGarbageCollected<TreeNode>(
+      heap.GetAllocationHandle(), kTreeDepth));
+  for (auto _ : st) {
+    USE(_);
+    if (config.marking_type == GarbageCollector::Config::MarkingType::kAtomic) {
+      heap.CollectGarbage(config);
+      continue;
+    }
+    heap.StartIncrementalGarbageCollection(config);
+    // Process the incremental marking tasks that were posted when starting.
+    testing::BenchmarkWithHeap::GetPlatform()->RunAllForegroundTasks();
+    heap.FinalizeIncrementalGarbageCollectionIfRunning(config);
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfNodes);
+}
+
+BENCHMARK_F(Marking, Atomic)(benchmark::State& st) {
+  RunMarkingBenchmark(st, *Heap::From(&heap()),
+                      GarbageCollector::Config::PreciseAtomicConfig());
+}
+
+BENCHMARK_F(Marking, Incremental)(benchmark::State& st) {
+  RunMarkingBenchmark(st, *Heap::From(&heap()),
+                      GarbageCollector::Config::PreciseIncrementalConfig());
+}
+
+BENCHMARK_F(Marking, IncrementalAndConcurrent)(benchmark::State& st) {
+  GarbageCollector::Config config =
+      GarbageCollector::Config::PreciseIncrementalConfig();
+  config.marking_type =
+      GarbageCollector::Config::MarkingType::kIncrementalAndConcurrent;
+  RunMarkingBenchmark(st, *Heap::From(&heap()), config);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
@@ -0,0 +1,74 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/heap.h"
+#include "src/heap/cppgc/sweeper.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using Sweeping = testing::BenchmarkWithHeap;
+
+class TriviallyDestructibleObject final
+    : public GarbageCollected<TriviallyDestructibleObject> {
+ public:
+  void Trace(Visitor*) const {}
+
+ private:
+  char payload_[32];
+};
+
+class ObjectWithFinalizer final : public GarbageCollected<ObjectWithFinalizer> {
+ public:
+  ~ObjectWithFinalizer() { benchmark::DoNotOptimize(payload_); }
+  void Trace(Visitor*) const {}
+
+ private:
+  char payload_[32];
+};
+
+constexpr size_t kNumberOfObjects = 100000;
+
+// Measures sweeping of |kNumberOfObjects| dead objects of type T. Allocation
+// and marking are excluded from the measurement by deferring sweeping to the
+// incremental sweeper and finishing it synchronously.
+template <typename T>
+void RunSweepingBenchmark(benchmark::State& st, Heap& heap) {
+  const GarbageCollector::Config config = {
+      GarbageCollector::Config::CollectionType::kMajor,
+      GarbageCollector::Config::StackState::kNoHeapPointers,
+      GarbageCollector::Config::MarkingType::kAtomic,
+      GarbageCollector::Config::SweepingType::kIncremental};
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    for (size_t i = 0; i < kNumberOfObjects; ++i) {
+      benchmark::DoNotOptimize(
+          MakeGarbageCollected<T>(heap.GetAllocationHandle()));
+    }
+    heap.CollectGarbage(config);
+    st.ResumeTiming();
+    heap.sweeper().FinishIfRunning();
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfObjects);
+}
+
+BENCHMARK_F(Sweeping, WithoutFinalizers)(benchmark::State& st) {
+  RunSweepingBenchmark<TriviallyDestructibleObject>(st, *Heap::From(&heap()));
+}
+
+BENCHMARK_F(Sweeping, WithFinalizers)(benchmark::State& st) {
+  RunSweepingBenchmark<ObjectWithFinalizer>(st, *Heap::From(&heap()));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
@@ -0,0 +1,80 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using WriteBarrier = testing::BenchmarkWithHeap;
+
+class Node final : public GarbageCollected<Node> {
+ public:
+  void Trace(Visitor* visitor) const { visitor->Trace(next); }
+
+  Member<Node> next;
+};
+
+class NodeArray final : public GarbageCollected<NodeArray> {
+ public:
+  static constexpr size_t kSize = 1024;
+
+  explicit NodeArray(AllocationHandle& handle) {
+    for (size_t i = 0; i < kSize; ++i) {
+      nodes[i] = MakeGarbageCollected<Node>(handle);
+    }
+  }
+
+  void Trace(Visitor* visitor) const {
+    for (size_t i = 0; i < kSize; ++i) visitor->Trace(nodes[i]);
+  }
+
+  Member<Node> nodes[kSize];
+};
+
+// Stores |NodeArray::kSize| references per iteration, each of which goes
+// through the write barrier.
+void RunWriteBarrierBenchmark(benchmark::State& st, NodeArray& array) {
+  size_t offset = 0;
+  for (auto _ : st) {
+    USE(_);
+    for (size_t i = 0; i < NodeArray::kSize; ++i) {
+      array.nodes[i]->next =
+          array.nodes[(i + offset) % NodeArray::kSize].Get();
+    }
+    offset++;
+  }
+  st.SetItemsProcessed(st.iterations() * NodeArray::kSize);
+}
+
+BENCHMARK_F(WriteBarrier, NoMarking)(benchmark::State& st) {
+  Persistent<NodeArray> array(
+      MakeGarbageCollected<NodeArray>(heap().GetAllocationHandle(),
+                                      heap().GetAllocationHandle()));
+  RunWriteBarrierBenchmark(st, *array);
+}
+
+BENCHMARK_F(WriteBarrier, DuringIncrementalMarking)(benchmark::State& st) {
+  Heap& cpp_heap = *Heap::From(&heap());
+  Persistent<NodeArray> array(MakeGarbageCollected<NodeArray>(
+      cpp_heap.GetAllocationHandle(), cpp_heap.GetAllocationHandle()));
+  const GarbageCollector::Config config =
+      GarbageCollector::Config::PreciseIncrementalConfig();
+  cpp_heap.StartIncrementalGarbageCollection(config);
+  RunWriteBarrierBenchmark(st, *array);
+  cpp_heap.FinalizeIncrementalGarbageCollectionIfRunning(config);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
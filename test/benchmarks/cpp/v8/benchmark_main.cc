@@ -0,0 +1,25 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-initialization.h"
+#include "test/benchmarks/cpp/v8/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+// Expanded macro BENCHMARK_MAIN() to allow per-process setup.
+int main(int argc, char** argv) {
+  // Every benchmark iteration must do the full work rather than hit a cache,
+  // and the RegExp benchmarks need the experimental engine.
+  v8::V8::SetFlagsFromString(
+      "--no-compilation-cache --enable-experimental-regexp-engine");
+  v8::internal::benchmarking::BenchmarkWithIsolate::InitializeProcess(argv[0]);
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  v8::internal::benchmarking::BenchmarkWithIsolate::ShutdownProcess();
+  return 0;
+}
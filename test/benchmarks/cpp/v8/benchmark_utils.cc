@@ -0,0 +1,99 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/v8/benchmark_utils.h"
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-initialization.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+
+// static
+std::unique_ptr<v8::Platform> BenchmarkWithIsolate::platform_;
+
+// static
+void BenchmarkWithIsolate::InitializeProcess(const char* argv0) {
+  v8::V8::InitializeICUDefaultLocation(argv0);
+  v8::V8::InitializeExternalStartupData(argv0);
+  platform_ = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform_.get());
+#ifdef V8_SANDBOX
+  CHECK(v8::V8::InitializeSandbox());
+#endif
+  v8::V8::Initialize();
+}
+
+// static
+void BenchmarkWithIsolate::ShutdownProcess() {
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  platform_.reset();
+}
+
+void BenchmarkWithIsolate::SetUp(::benchmark::State& state) {
+  allocator_ = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator_;
+  isolate_ = v8::Isolate::New(create_params);
+  isolate_->Enter();
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = v8::Context::New(isolate_);
+  context->Enter();
+  context_.Reset(isolate_, context);
+}
+
+void BenchmarkWithIsolate::TearDown(::benchmark::State& state) {
+  {
+    v8::HandleScope handle_scope(isolate_);
+    context()->Exit();
+  }
+  context_.Reset();
+  isolate_->Exit();
+  isolate_->Dispose();
+  isolate_ = nullptr;
+  delete allocator_;
+  allocator_ = nullptr;
+}
+
+// static
+std::string BenchmarkWithIsolate::MakeScriptSource(size_t size) {
+  std::string source;
+  for (int i = 0; source.size() < size; i++) {
+    std::string n = std::to_string(i);
+    source += "function f" + n + "(a, b) {\n";
+    source += "  const o = {x: a, y: b, name: 'f" + n + "', list: [1, 2, 3]};\n";
+    source += "  let sum = 0;\n";
+    source += "  for (let i = 0; i < o.list.length; i++) sum += o.list[i];\n";
+    source += "  if (sum > a) { return `${o.name}:${sum}`; }\n";
+    source += "  return (() => o.x * o.y + sum)();\n";
+    source += "}\n";
+    source += "class C" + n + " { constructor() { this.v = f" + n +
+              "(1, 2); } get value() { return this.v; } }\n";
+  }
+  return source;
+}
+
+// static
+std::string BenchmarkWithIsolate::MakeJsonSource(size_t size) {
+  std::string json = "[";
+  for (int i = 0; json.size() < size; i++) {
+    if (i > 0) json += ",";
+    std::string n = std::to_string(i);
+    json += "{\"id\":" + n + ",\"name\":\"item " + n +
+            "\",\"escaped\":\"line\\nbreak \\\"quoted\\\" \\u00e9\","
+            "\"price\":" +
+            n + ".25,\"active\":" + (i % 2 ? "true" : "false") +
+            ",\"tags\":[\"a\",\"b\",\"c\"],\"nested\":{\"depth\":1,"
+            "\"values\":[1,2.5,-3e10,null]}}";
+  }
+  json += "]";
+  return json;
+}
+
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,59 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_V8_BENCHMARK_UTILS_H_
+#define TEST_BENCHMARK_CPP_V8_BENCHMARK_UTILS_H_
+
+#include <memory>
+#include <string>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-platform.h"
+#include "src/execution/isolate.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+
+// Fixture that provides a fresh isolate with an entered context for every
+// benchmark. Inputs are generated deterministically so that results are
+// comparable across V8 versions and machines.
+class BenchmarkWithIsolate : public benchmark::Fixture {
+ public:
+  static void InitializeProcess(const char* argv0);
+  static void ShutdownProcess();
+
+  // Returns a JavaScript source of roughly |size| bytes made of functions,
+  // object literals, loops and string operations.
+  static std::string MakeScriptSource(size_t size);
+  // Returns a JSON document of roughly |size| bytes with nested objects,
+  // arrays, numbers and escaped strings.
+  static std::string MakeJsonSource(size_t size);
+
+ protected:
+  void SetUp(::benchmark::State& state) override;
+  void TearDown(::benchmark::State& state) override;
+
+  v8::Isolate* v8_isolate() const { return isolate_; }
+  Isolate* isolate() const { return reinterpret_cast<Isolate*>(isolate_); }
+  v8::Local<v8::Context> context() const { return context_.Get(isolate_); }
+
+ private:
+  static std::unique_ptr<v8::Platform> platform_;
+
+  v8::ArrayBuffer::Allocator* allocator_ = nullptr;
+  v8::Isolate* isolate_ = nullptr;
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_V8_BENCHMARK_UTILS_H_
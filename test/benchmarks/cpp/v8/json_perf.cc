@@ -0,0 +1,56 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-json.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/v8/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using Json = benchmarking::BenchmarkWithIsolate;
+
+BENCHMARK_DEFINE_F(Json, Parse)(benchmark::State& st) {
+  std::string json = MakeJsonSource(st.range(0));
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::String> source =
+      v8::String::NewFromUtf8(v8_isolate(), json.c_str(),
+                              v8::NewStringType::kNormal,
+                              static_cast<int>(json.size()))
+          .ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Parse(context(), source).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * json.size());
+}
+BENCHMARK_REGISTER_F(Json, Parse)->Arg(16 * KB)->Arg(1 * MB);
+
+BENCHMARK_DEFINE_F(Json, Stringify)(benchmark::State& st) {
+  std::string json = MakeJsonSource(st.range(0));
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Value> value =
+      v8::JSON::Parse(context(), v8::String::NewFromUtf8(
+                                     v8_isolate(), json.c_str(),
+                                     v8::NewStringType::kNormal,
+                                     static_cast<int>(json.size()))
+                                     .ToLocalChecked())
+          .ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Stringify(context(), value).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * json.size());
+}
+BENCHMARK_REGISTER_F(Json, Stringify)->Arg(16 * KB)->Arg(1 * MB);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
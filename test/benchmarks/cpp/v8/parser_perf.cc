@@ -0,0 +1,51 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/v8/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using Parse = benchmarking::BenchmarkWithIsolate;
+
+void CompileScript(benchmark::State& st, v8::Isolate* isolate,
+                   v8::Local<v8::Context> context,
+                   v8::ScriptCompiler::CompileOptions options) {
+  std::string source = Parse::MakeScriptSource(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(isolate);
+    v8::ScriptCompiler::Source script_source(
+        v8::String::NewFromUtf8(isolate, source.c_str(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(source.size()))
+            .ToLocalChecked());
+    benchmark::DoNotOptimize(
+        v8::ScriptCompiler::Compile(context, &script_source, options)
+            .ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * source.size());
+}
+
+// Top-level functions are only preparsed.
+BENCHMARK_DEFINE_F(Parse, Lazy)(benchmark::State& st) {
+  CompileScript(st, v8_isolate(), context(),
+                v8::ScriptCompiler::kNoCompileOptions);
+}
+BENCHMARK_REGISTER_F(Parse, Lazy)->Arg(16 * KB)->Arg(256 * KB);
+
+// All functions are fully parsed and compiled to bytecode.
+BENCHMARK_DEFINE_F(Parse, Eager)(benchmark::State& st) {
+  CompileScript(st, v8_isolate(), context(),
+                v8::ScriptCompiler::kEagerCompile);
+}
+BENCHMARK_REGISTER_F(Parse, Eager)->Arg(16 * KB)->Arg(256 * KB);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
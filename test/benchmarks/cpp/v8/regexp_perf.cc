@@ -0,0 +1,106 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-regexp.h"
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/v8/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using Regexp = benchmarking::BenchmarkWithIsolate;
+
+constexpr const char* kPattern =
+    "([a-z0-9._%+-]+)@([a-z0-9.-]+)\\.(com|org|net)";
+
+std::string MakeSubject(size_t size) {
+  std::string subject;
+  for (int i = 0; subject.size() < size; i++) {
+    subject += "some filler text without addresses " + std::to_string(i) +
+               " user" + std::to_string(i) + "@example.org ";
+  }
+  return subject;
+}
+
+v8::Local<v8::RegExp> NewRegExp(v8::Local<v8::Context> context,
+                                v8::RegExp::Flags flags) {
+  v8::Isolate* isolate = context->GetIsolate();
+  return v8::RegExp::New(context,
+                         v8::String::NewFromUtf8(isolate, kPattern)
+                             .ToLocalChecked(),
+                         flags)
+      .ToLocalChecked();
+}
+
+// Creates a fresh RegExp per iteration, so that every first Exec() compiles
+// the pattern.
+void CompileAndExec(benchmark::State& st, v8::Local<v8::Context> context,
+                    v8::RegExp::Flags flags) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::Local<v8::String> subject =
+      v8::String::NewFromUtf8(isolate, "contact: user@example.org")
+          .ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(isolate);
+    benchmark::DoNotOptimize(
+        NewRegExp(context, flags)->Exec(context, subject).ToLocalChecked());
+  }
+}
+
+// Reuses one RegExp and runs a global match over a large subject.
+void Exec(benchmark::State& st, v8::Local<v8::Context> context,
+          v8::RegExp::Flags flags) {
+  v8::Isolate* isolate = context->GetIsolate();
+  std::string subject_string = MakeSubject(st.range(0));
+  v8::Local<v8::String> subject =
+      v8::String::NewFromUtf8(isolate, subject_string.c_str(),
+                              v8::NewStringType::kNormal,
+                              static_cast<int>(subject_string.size()))
+          .ToLocalChecked();
+  v8::Local<v8::RegExp> regexp =
+      NewRegExp(context, static_cast<v8::RegExp::Flags>(
+                             flags | v8::RegExp::kGlobal));
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(isolate);
+    CHECK(regexp
+              ->Set(context, v8::String::NewFromUtf8Literal(isolate,
+                                                            "lastIndex"),
+                    v8::Integer::New(isolate, 0))
+              .FromJust());
+    while (!regexp->Exec(context, subject).ToLocalChecked()->IsNull()) {
+    }
+  }
+  st.SetBytesProcessed(st.iterations() * subject_string.size());
+}
+
+BENCHMARK_F(Regexp, CompileIrregexp)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  CompileAndExec(st, context(), v8::RegExp::kNone);
+}
+
+BENCHMARK_F(Regexp, CompileExperimental)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  CompileAndExec(st, context(), v8::RegExp::kLinear);
+}
+
+BENCHMARK_DEFINE_F(Regexp, ExecIrregexp)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  Exec(st, context(), v8::RegExp::kNone);
+}
+BENCHMARK_REGISTER_F(Regexp, ExecIrregexp)->Arg(64 * KB);
+
+BENCHMARK_DEFINE_F(Regexp, ExecExperimental)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  Exec(st, context(), v8::RegExp::kLinear);
+}
+BENCHMARK_REGISTER_F(Regexp, ExecExperimental)->Arg(64 * KB);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,71 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/vector.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/strings/string-search.h"
+#include "test/benchmarks/cpp/v8/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using Strings = benchmarking::BenchmarkWithIsolate;
+
+// Internalizes the same set of property-name-like strings in every
+// iteration, which after the first iteration measures StringTable lookups.
+BENCHMARK_DEFINE_F(Strings, Internalize)(benchmark::State& st) {
+  std::vector<std::string> names;
+  for (int i = 0; i < st.range(0); i++) {
+    names.push_back("property_name_" + std::to_string(i));
+  }
+  for (auto _ : st) {
+    USE(_);
+    HandleScope handle_scope(isolate());
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(isolate()->factory()->InternalizeUtf8String(
+          base::VectorOf(name.data(), name.size())));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * names.size());
+}
+BENCHMARK_REGISTER_F(Strings, Internalize)->Arg(1024)->Arg(64 * 1024);
+
+void Search(benchmark::State& st, Isolate* isolate, const char* pattern) {
+  std::string subject;
+  while (subject.size() < static_cast<size_t>(st.range(0))) {
+    subject += "the quick brown fox jumps over the lazy dog ";
+  }
+  subject += pattern;
+  base::Vector<const uint8_t> subject_vector = base::OneByteVector(subject.data(), subject.size());
+  base::Vector<const uint8_t> pattern_vector = base::OneByteVector(pattern);
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        SearchString(isolate, subject_vector, pattern_vector, 0));
+  }
+  st.SetBytesProcessed(st.iterations() * subject.size());
+}
+
+// Short patterns use the linear search, longer ones Boyer-Moore-Horspool.
+BENCHMARK_DEFINE_F(Strings, SearchShort)(benchmark::State& st) {
+  Search(st, isolate(), "fox!");
+}
+BENCHMARK_REGISTER_F(Strings, SearchShort)->Arg(64 * KB);
+
+BENCHMARK_DEFINE_F(Strings, SearchLong)(benchmark::State& st) {
+  Search(st, isolate(), "the quick brown fox jumps over the lazy cat");
+}
+BENCHMARK_REGISTER_F(Strings, SearchLong)->Arg(64 * KB);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
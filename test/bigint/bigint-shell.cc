@@ -2,9 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -29,15 +32,17 @@ int PrintHelp(char** argv) {
   return 1;
 }
 
-#define TESTS(V)                     \
-  V(kBarrett, "barrett")             \
-  V(kBurnikel, "burnikel")           \
-  V(kFFT, "fft")                     \
-  V(kFromString, "fromstring")       \
-  V(kFromStringBase2, "fromstring2") \
-  V(kKaratsuba, "karatsuba")         \
-  V(kToom, "toom")                   \
-  V(kToString, "tostring")
+#define TESTS(V)                      \
+  V(kBarrett, "barrett")              \
+  V(kBurnikel, "burnikel")            \
+  V(kFFT, "fft")                      \
+  V(kFFTParallel, "fft-parallel")     \
+  V(kFromString, "fromstring")        \
+  V(kFromStringBase2, "fromstring2")  \
+  V(kKaratsuba, "karatsuba")          \
+  V(kToom, "toom")                    \
+  V(kToString, "tostring")            \
+  V(kToStringLarge, "tostring-large")
 
 enum Operation { kNoOp, kList, kTest };
 
@@ -123,6 +128,25 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs parallel tasks on a few threads of its own.
+class ThreadPlatform : public Platform {
+ public:
+  static constexpr int kThreads = 4;
+
+  int MaxParallelism() override { return kThreads; }
+
+  void RunInParallel(Task* task, int count) override {
+    std::atomic<int> next_index{0};
+    auto run = [&]() {
+      for (int i = next_index++; i < count; i = next_index++) task->Run(i);
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < kThreads; i++) threads.emplace_back(run);
+    run();
+    for (std::thread& thread : threads) thread.join();
+  }
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -130,12 +154,17 @@ class Runner {
   void Initialize() {
     rng_.Initialize(random_seed_);
     processor_.reset(Processor::New(new Platform()));
+    parallel_processor_.reset(Processor::New(new ThreadPlatform()));
   }
 
   ProcessorImpl* processor() {
     return static_cast<ProcessorImpl*>(processor_.get());
   }
 
+  ProcessorImpl* parallel_processor() {
+    return static_cast<ProcessorImpl*>(parallel_processor_.get());
+  }
+
   int Run() {
     if (op_ == kList) {
       ListTests();
@@ -200,6 +229,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestFFT(&count);
       }
+    } else if (test_ == kFFTParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestFFTParallel(&count);
+      }
     } else if (test_ == kKaratsuba) {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
@@ -212,6 +245,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestToString(&count);
       }
+    } else if (test_ == kToStringLarge) {
+      for (int i = 0; i < runs_; i++) {
+        TestToStringLarge(&count);
+      }
     } else if (test_ == kFromString) {
       for (int i = 0; i < runs_; i++) {
         TestFromString(&count);
@@ -311,6 +348,39 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestFFTParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    // Sizes around the threshold at which the pointwise multiplications are
+    // split, and a few far above it.
+    for (int size : {kFftParallelThreshold / 4, kFftParallelThreshold / 2,
+                     kFftParallelThreshold, 3 * kFftParallelThreshold}) {
+      uint64_t random_bits = rng_.NextUint64();
+      int left_size = size + static_cast<int>(random_bits & 1023);
+      int right_size = size - static_cast<int>((random_bits >> 10) & 1023);
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_sequential(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      parallel_processor()->MultiplyFFT(result, A, B);
+      // Using single-threaded FFT as reference, which the "fft" test covers.
+      processor()->MultiplyFFT(result_sequential, A, B);
+      AssertEquals(A, B, result_sequential, result);
+      if (error_) return;
+      // Squaring multiplies the same parts on several threads.
+      ScratchDigits square(MultiplyResultLength(A, A));
+      ScratchDigits square_sequential(MultiplyResultLength(A, A));
+      parallel_processor()->MultiplyFFT(square, A, A);
+      processor()->MultiplyFFT(square_sequential, A, A);
+      AssertEquals(A, A, square_sequential, square);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
@@ -412,6 +482,38 @@ class Runner {
     }
   }
 
+  // Formats numbers of growing and shrinking sizes, so that the cached radix
+  // powers get extended and reused, and the largest ones are formatted in
+  // parallel without the cache.
+  void TestToStringLarge(int* count) {
+    constexpr int kSizes[] = {100,
+                              kToStringParallelThreshold * 2,
+                              500,
+                              kToStringCacheMaxDivisorLength,
+                              kToStringParallelThreshold,
+                              kToStringCacheMaxDivisorLength * 2 + 1};
+    int random_radix = 2 + static_cast<int>(rng_.NextUint64() % 35);
+    for (int size : kSizes) {
+      ScratchDigits X(size);
+      GenerateRandom(X);
+      for (int radix : {10, random_radix}) {
+        int chars_required = ToStringResultLength(X, radix, false);
+        int result_len = chars_required;
+        int reference_len = chars_required;
+        std::unique_ptr<char[]> result(new char[result_len]);
+        std::unique_ptr<char[]> reference(new char[reference_len]);
+        parallel_processor()->ToStringImpl(result.get(), &result_len, X, radix,
+                                           false, true);
+        processor()->ToStringImpl(reference.get(), &reference_len, X, radix,
+                                  false, false);
+        AssertEquals(X, radix, reference.get(), reference_len, result.get(),
+                     result_len);
+        if (error_) return;
+        (*count)++;
+      }
+    }
+  }
+
   void TestFromString(int* count) {
     constexpr int kMaxDigits = 1 << 20;  // Any large-enough value will do.
     constexpr int kMin = kFromStringLargeThreshold / 2;
@@ -601,6 +703,7 @@ class Runner {
   int64_t random_seed_{314159265359};
   RNG rng_;
   std::unique_ptr<Processor, Processor::Destroyer> processor_;
+  std::unique_ptr<Processor, Processor::Destroyer> parallel_processor_;
 };
 
 }  // namespace test
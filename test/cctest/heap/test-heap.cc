@@ -3595,6 +3595,46 @@ TEST(DetailedErrorStackTraceBuiltinExit) {
   });
 }
 
+TEST(ErrorStackFrameRecords) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+
+  Handle<JSObject> error = Handle<JSObject>::cast(v8::Utils::OpenHandle(
+      *CompileRun("function inner() { return new Error(); }"
+                  "function outer() { return inner(); }"
+                  "var error = outer();"
+                  "error")));
+
+  // Constructing the error only records the frames.
+  Handle<Object> error_stack = JSReceiver::GetDataProperty(
+      isolate, error, isolate->factory()->error_stack_symbol());
+  CHECK(error_stack->IsFixedArray());
+  Handle<FixedArray> frames = Handle<FixedArray>::cast(error_stack);
+  CHECK_EQ(3 * CallSiteInfo::kFrameRecordSize, frames->length());
+  CHECK(frames->get(CallSiteInfo::kFrameRecordFlagsIndex).IsSmi());
+
+  Handle<FixedArray> call_site_infos = isolate->GetSimpleStackTrace(error);
+  CHECK_EQ(3, call_site_infos->length());
+  const char* names[] = {"inner", "outer"};
+  for (int i = 0; i < call_site_infos->length(); ++i) {
+    Handle<CallSiteInfo> info(CallSiteInfo::cast(call_site_infos->get(i)),
+                              isolate);
+    Handle<Object> name = CallSiteInfo::GetFunctionName(info);
+    if (i == static_cast<int>(arraysize(names))) {
+      CHECK(name->IsNull(isolate));
+    } else {
+      CHECK(String::cast(*name).IsOneByteEqualTo(base::CStrVector(names[i])));
+    }
+    CHECK_EQ(1, CallSiteInfo::GetLineNumber(info));
+  }
+
+  v8::Local<v8::Value> stack = CompileRun("error.stack");
+  v8::String::Utf8Value stack_string(CcTest::isolate(), stack);
+  CHECK_NOT_NULL(strstr(*stack_string, "at inner"));
+  CHECK_NOT_NULL(strstr(*stack_string, "at outer"));
+}
+
 TEST(Regress169928) {
   FLAG_allow_natives_syntax = true;
 #ifndef V8_LITE_MODE
@@ -7326,6 +7366,28 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+TEST(SampledObjectStats) {
+  if (TracingFlags::is_gc_stats_enabled()) return;
+  FLAG_sample_gc_object_stats = 1;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Factory* factory = CcTest::i_isolate()->factory();
+  HandleScope scope(CcTest::i_isolate());
+  const int kArrays = 100;
+  Handle<FixedArray> arrays =
+      factory->NewFixedArray(kArrays, AllocationType::kOld);
+  for (int i = 0; i < kArrays; i++) {
+    arrays->set(i, *factory->NewFixedArray(16, AllocationType::kOld));
+  }
+  CcTest::CollectAllGarbage();
+  v8::HeapObjectStatistics stats;
+  CHECK(isolate->GetHeapObjectStatisticsAtLastGC(&stats, FIXED_ARRAY_TYPE));
+  CHECK_EQ(0, strcmp("FIXED_ARRAY_TYPE", stats.object_type()));
+  CHECK_LE(static_cast<size_t>(kArrays + 1), stats.object_count());
+  CHECK_LE(static_cast<size_t>(kArrays * FixedArray::SizeFor(16)),
+           stats.object_size());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -227,6 +227,52 @@ TEST(LazyMemoryMeasurement) {
   CHECK(!platform.TaskPosted());
 }
 
+namespace {
+class CountingMeasureMemoryDelegate : public v8::MeasureMemoryDelegate {
+ public:
+  explicit CountingMeasureMemoryDelegate(int* completed)
+      : completed_(completed) {}
+
+  bool ShouldMeasure(v8::Local<v8::Context> context) override { return true; }
+
+  void MeasurementComplete(
+      const std::vector<std::pair<v8::Local<v8::Context>, size_t>>&
+          context_sizes_in_bytes,
+      size_t unattributed_size_in_bytes) override {
+    (*completed_)++;
+  }
+
+ private:
+  int* completed_;
+};
+
+void PumpMessageLoop() {
+  while (v8::platform::PumpMessageLoop(v8::internal::V8::GetCurrentPlatform(),
+                                       CcTest::isolate())) {
+  }
+}
+}  // namespace
+
+TEST(CachedMemoryMeasurement) {
+  LocalContext env;
+  int completed = 0;
+  // The first request has nothing cached and waits for the next GC.
+  CcTest::isolate()->MeasureMemory(
+      std::make_unique<CountingMeasureMemoryDelegate>(&completed),
+      v8::MeasureMemoryExecution::kCached);
+  PumpMessageLoop();
+  CHECK_EQ(0, completed);
+  CcTest::CollectAllGarbage();
+  PumpMessageLoop();
+  CHECK_EQ(1, completed);
+  // Later requests are answered from the sizes computed by that GC.
+  CcTest::isolate()->MeasureMemory(
+      std::make_unique<CountingMeasureMemoryDelegate>(&completed),
+      v8::MeasureMemoryExecution::kCached);
+  PumpMessageLoop();
+  CHECK_EQ(2, completed);
+}
+
 TEST(PartiallyInitializedJSFunction) {
   LocalContext env;
   Isolate* isolate = CcTest::i_isolate();
@@ -410,6 +410,46 @@ TEST(Utf8SingleByteChunks) {
   }
 }
 
+TEST(Utf8SeekOverAsciiRuns) {
+  // Seeking into a chunk skips over its ascii runs in bulk. The runs are
+  // longer than the stream's buffer, so that the seeks below have to search
+  // the chunk, and are interrupted by non-ascii characters.
+  std::string utf8;
+  std::vector<uint16_t> utf16;
+  for (int run = 0; run < 3; run++) {
+    for (int i = 0; i < 300 + run; i++) {
+      utf8 += static_cast<char>('a' + run);
+      utf16.push_back('a' + run);
+    }
+    utf8 += "\xC3\xA4\xE2\x82\xAC";  // U+00E4, U+20AC
+    utf16.push_back(0x00E4);
+    utf16.push_back(0x20AC);
+  }
+  utf8 += "\xF0\x90\x8C\x80";  // U+10300
+  utf16.push_back(0xD800);
+  utf16.push_back(0xDF00);
+
+  const char* chunks[] = {utf8.c_str(), ""};
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+  // Fetch all chunks first, so that all seeks below are within the data.
+  for (size_t i = 0; i < utf16.size(); i++) stream->Advance();
+  CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+           stream->Advance());
+
+  for (size_t i = 0; i < utf16.size(); i++) {
+    stream->Seek(i);
+    CHECK_EQ(utf16[i], stream->Advance());
+  }
+  for (size_t i = utf16.size(); i > 0; i--) {
+    stream->Seek(i - 1);
+    CHECK_EQ(utf16[i - 1], stream->Advance());
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
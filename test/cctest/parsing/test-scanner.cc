@@ -105,5 +105,30 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(WordAtATimeScanning) {
+  // Comments and string literals are scanned a word at a time. Shift the
+  // source to move the interesting characters across word boundaries.
+  for (int padding = 0; padding <= 2 * kUIntptrSize; padding++) {
+    std::string src(padding, ' ');
+    src +=
+        "'abcdefghijklmnopqrstuvwxyz' 'abcdefghij\\x41klmnop' "
+        "// single * line / comment\n"
+        "/* multi ** line / comment */ a "
+        "/* multi ** line\n comment ** with * newline */ b";
+    auto scanner = make_scanner(src.c_str());
+    CHECK_TOK(Token::STRING, scanner->Next());
+    CHECK(scanner->CurrentLiteralEquals("abcdefghijklmnopqrstuvwxyz"));
+    CHECK_TOK(Token::STRING, scanner->Next());
+    CHECK(scanner->CurrentLiteralEquals("abcdefghijAklmnop"));
+    CHECK(scanner->HasLineTerminatorBeforeNext());
+    CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+    CHECK(scanner->CurrentLiteralEquals("a"));
+    CHECK(scanner->HasLineTerminatorBeforeNext());
+    CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+    CHECK(scanner->CurrentLiteralEquals("b"));
+    CHECK_TOK(Token::EOS, scanner->Next());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
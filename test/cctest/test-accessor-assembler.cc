@@ -21,8 +21,14 @@ using compiler::Node;
 
 namespace {
 
-void TestStubCacheOffsetCalculation(StubCache::Table table) {
+void TestStubCacheOffsetCalculation(
+    StubCache::Table table,
+    int primary_table_bits = StubCache::kDefaultPrimaryTableBits,
+    int secondary_table_bits = StubCache::kDefaultSecondaryTableBits) {
   Isolate* isolate(CcTest::InitIsolateOnce());
+  StubCache stub_cache_instance(isolate, primary_table_bits,
+                                secondary_table_bits);
+  StubCache* stub_cache = &stub_cache_instance;
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
@@ -31,13 +37,13 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,11 +85,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -104,6 +110,14 @@ TEST(StubCacheSecondaryOffset) {
   TestStubCacheOffsetCalculation(StubCache::kSecondary);
 }
 
+TEST(StubCachePrimaryOffsetWithLargeTables) {
+  TestStubCacheOffsetCalculation(StubCache::kPrimary, 14, 12);
+}
+
+TEST(StubCacheSecondaryOffsetWithLargeTables) {
+  TestStubCacheOffsetCalculation(StubCache::kSecondary, 14, 12);
+}
+
 namespace {
 
 Handle<Code> CreateCodeOfKind(CodeKind kind) {
@@ -165,21 +179,23 @@ TEST(TryProbeStubCache) {
   Factory* factory = isolate->factory();
 
   // Generate some number of names.
-  for (int i = 0; i < StubCache::kPrimaryTableSize / 7; i++) {
+  for (int i = 0; i < stub_cache.primary_table_size() / 7; i++) {
     Handle<Name> name;
     switch (rand_gen.NextInt(3)) {
       case 0: {
         // Generate string.
         std::stringstream ss;
         ss << "s" << std::hex
-           << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+           << (rand_gen.NextInt(Smi::kMaxValue) %
+               stub_cache.primary_table_size());
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
       case 1: {
         // Generate number string.
         std::stringstream ss;
-        ss << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+        ss << (rand_gen.NextInt(Smi::kMaxValue) %
+               stub_cache.primary_table_size());
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
@@ -195,7 +211,7 @@ TEST(TryProbeStubCache) {
   }
 
   // Generate some number of receiver maps and receivers.
-  for (int i = 0; i < StubCache::kSecondaryTableSize / 2; i++) {
+  for (int i = 0; i < stub_cache.secondary_table_size() / 2; i++) {
     Handle<Map> map = Map::Create(isolate, 0);
     receivers.push_back(factory->NewJSObjectFromMap(map));
   }
@@ -210,7 +226,8 @@ TEST(TryProbeStubCache) {
   DisallowGarbageCollection no_gc;
 
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N =
+      stub_cache.primary_table_size() + stub_cache.secondary_table_size();
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
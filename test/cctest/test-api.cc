@@ -63,6 +63,7 @@
 #include "src/heap/evacuation-allocator.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/json/json-parser.h"
 #include "src/logging/metrics.h"
 #include "src/objects/feedback-vector-inl.h"
 #include "src/objects/feedback-vector.h"
@@ -5075,6 +5076,54 @@ THREADED_TEST(Array) {
                   .FromJust());
 }
 
+THREADED_TEST(ArrayNewFromNumbers) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  const double doubles[] = {1.5, -0.0, std::numeric_limits<double>::quiet_NaN(),
+                            4};
+  Local<v8::Array> array =
+      v8::Array::New(isolate, doubles, arraysize(doubles));
+  CHECK_EQ(arraysize(doubles), array->Length());
+  i::Handle<i::JSArray> js_array = v8::Utils::OpenHandle(*array);
+  CHECK_EQ(i::PACKED_DOUBLE_ELEMENTS, js_array->GetElementsKind());
+  CHECK_EQ(1.5, array->Get(context.local(), 0)
+                    .ToLocalChecked()
+                    ->NumberValue(context.local())
+                    .FromJust());
+  CHECK(array->Get(context.local(), 1).ToLocalChecked()->SameValue(
+      v8_num(-0.0)));
+  CHECK(std::isnan(array->Get(context.local(), 2)
+                       .ToLocalChecked()
+                       ->NumberValue(context.local())
+                       .FromJust()));
+  CHECK(array->Has(context.local(), 2).FromJust());
+
+  const int32_t smis[] = {1, -2, 3};
+  array = v8::Array::New(isolate, smis, arraysize(smis));
+  js_array = v8::Utils::OpenHandle(*array);
+  CHECK_EQ(i::PACKED_SMI_ELEMENTS, js_array->GetElementsKind());
+  CHECK_EQ(-2, array->Get(context.local(), 1)
+                   .ToLocalChecked()
+                   ->Int32Value(context.local())
+                   .FromJust());
+
+  const int32_t ints[] = {1, std::numeric_limits<int32_t>::max()};
+  array = v8::Array::New(isolate, ints, arraysize(ints));
+  js_array = v8::Utils::OpenHandle(*array);
+  CHECK_EQ(i::Smi::IsValid(ints[1]) ? i::PACKED_SMI_ELEMENTS
+                                     : i::PACKED_DOUBLE_ELEMENTS,
+           js_array->GetElementsKind());
+  CHECK_EQ(ints[1], array->Get(context.local(), 1)
+                        .ToLocalChecked()
+                        ->Int32Value(context.local())
+                        .FromJust());
+
+  array = v8::Array::New(isolate, static_cast<const double*>(nullptr), 0);
+  CHECK_EQ(0u, array->Length());
+}
+
 
 void HandleF(const v8::FunctionCallbackInfo<v8::Value>& args) {
   v8::EscapableHandleScope scope(args.GetIsolate());
@@ -8792,6 +8841,52 @@ THREADED_TEST(Utf16Trailing3Byte) {
 }
 
 
+THREADED_TEST(WriteUtf8MixedOneByte) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // Runs of ASCII characters of varying length, separated by Latin-1
+  // characters that need two bytes in UTF-8.
+  const int kLength = 100;
+  uint8_t latin1[kLength];
+  std::string expected;
+  for (int i = 0; i < kLength; i++) {
+    uint8_t c = static_cast<uint8_t>(i % 13 == 12 ? 0xE9 : 'a' + i % 26);
+    latin1[i] = c;
+    if (c < 0x80) {
+      expected.push_back(static_cast<char>(c));
+    } else {
+      expected.push_back(static_cast<char>(0xC0 | (c >> 6)));
+      expected.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+    }
+  }
+  v8::Local<v8::String> str =
+      v8::String::NewFromOneByte(isolate, latin1, v8::NewStringType::kNormal,
+                                 kLength)
+          .ToLocalChecked();
+  CHECK_EQ(static_cast<int>(expected.size()), str->Utf8Length(isolate));
+
+  char buffer[2 * kLength + 1];
+  int nchars;
+  int written = str->WriteUtf8(isolate, buffer, -1, &nchars);
+  CHECK_EQ(kLength, nchars);
+  CHECK_EQ(static_cast<int>(expected.size()) + 1, written);
+  CHECK_EQ(0, strcmp(expected.c_str(), buffer));
+
+  // With a limited capacity only complete characters are written.
+  for (int capacity = 0; capacity < static_cast<int>(expected.size());
+       capacity++) {
+    memset(buffer, 0, sizeof(buffer));
+    written = str->WriteUtf8(isolate, buffer, capacity, &nchars,
+                             v8::String::NO_NULL_TERMINATION);
+    CHECK_LE(written, capacity);
+    CHECK_GE(written, capacity - 1);
+    CHECK_EQ(0, memcmp(expected.data(), buffer, written));
+  }
+}
+
+
 THREADED_TEST(ToArrayIndex) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -16870,6 +16965,157 @@ TEST(GetHeapSpaceStatistics) {
   CHECK_EQ(total_physical_size, heap_statistics.total_physical_size());
 }
 
+TEST(ICTransitionStatistics) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  std::vector<v8::ICTransitionStatistics> statistics;
+  isolate->GetICTransitionStatistics(&statistics);
+  CHECK(statistics.empty());
+
+  isolate->SetICTransitionSampleInterval(1);
+  const char* source =
+      "function mega(o) { return o.x; }\n"
+      "function mono(o) { return o.x; }\n"
+      "%EnsureFeedbackVectorForFunction(mega);\n"
+      "%EnsureFeedbackVectorForFunction(mono);\n"
+      "for (let i = 0; i < 10; i++) mega({x: 1, ['y' + i]: i});\n"
+      "mono({x: 1});\n"
+      "mono({x: 2});\n";
+  CompileRun(source);
+
+  isolate->GetICTransitionStatistics(&statistics);
+  const v8::ICTransitionStatistics* mega = nullptr;
+  const v8::ICTransitionStatistics* mono = nullptr;
+  for (const v8::ICTransitionStatistics& entry : statistics) {
+    if (entry.function_name() == "mega") mega = &entry;
+    if (entry.function_name() == "mono") mono = &entry;
+  }
+  CHECK_NOT_NULL(mega);
+  CHECK_NOT_NULL(mono);
+  // Megamorphic sites are reported first.
+  CHECK_EQ(&statistics[0], mega);
+
+  CHECK_EQ("LoadIC", mega->ic_type());
+  CHECK_EQ(0, strcmp("MEGAMORPHIC", mega->state()));
+  CHECK_EQ(1u, mega->monomorphic_transitions());
+  CHECK_EQ(1u, mega->polymorphic_transitions());
+  CHECK_EQ(1u, mega->megamorphic_transitions());
+  // The position is that of the return statement or of the property load.
+  std::string source_string(source);
+  CHECK_LE(static_cast<int>(source_string.find("return")), mega->position());
+  CHECK_GE(static_cast<int>(source_string.find("o.x")) + 2, mega->position());
+
+  CHECK_EQ(0, strcmp("MONOMORPHIC", mono->state()));
+  CHECK_EQ(1u, mono->monomorphic_transitions());
+  CHECK_EQ(0u, mono->polymorphic_transitions());
+  CHECK_EQ(0u, mono->megamorphic_transitions());
+  CHECK_LE(static_cast<int>(source_string.rfind("return")), mono->position());
+  CHECK_GE(static_cast<int>(source_string.rfind("o.x")) + 2, mono->position());
+
+  // Disabling sampling discards the samples.
+  isolate->SetICTransitionSampleInterval(0);
+  isolate->GetICTransitionStatistics(&statistics);
+  CHECK(statistics.empty());
+}
+
+TEST(SetMaxPolymorphicMapCount) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  int default_count = i_isolate->max_valid_polymorphic_map_count();
+  CHECK_EQ(i::FLAG_max_valid_polymorphic_map_count, default_count);
+
+  auto state_of = [&](const char* function_name) -> std::string {
+    std::vector<v8::ICTransitionStatistics> statistics;
+    isolate->GetICTransitionStatistics(&statistics);
+    for (const v8::ICTransitionStatistics& entry : statistics) {
+      if (entry.function_name() == function_name) return entry.state();
+    }
+    return "";
+  };
+
+  isolate->SetICTransitionSampleInterval(1);
+  isolate->SetMaxPolymorphicMapCount(8);
+  CompileRun(
+      "function wide(o) { return o.x; }\n"
+      "%EnsureFeedbackVectorForFunction(wide);\n"
+      "for (let i = 0; i < 8; i++) wide({x: 1, ['y' + i]: i});\n");
+  CHECK_EQ("POLYMORPHIC", state_of("wide"));
+
+  isolate->SetMaxPolymorphicMapCount(2);
+  CompileRun(
+      "function narrow(o) { return o.x; }\n"
+      "%EnsureFeedbackVectorForFunction(narrow);\n"
+      "for (let i = 0; i < 3; i++) narrow({x: 1, ['y' + i]: i});\n");
+  CHECK_EQ("MEGAMORPHIC", state_of("narrow"));
+
+  isolate->SetICTransitionSampleInterval(0);
+  isolate->SetMaxPolymorphicMapCount(default_count);
+}
+
+TEST(MapStatistics) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  CompileRun(
+      "function Shape(n) { for (let i = 0; i < n; i++) this['f' + i] = i; }\n"
+      "var shapes = [];\n"
+      "for (let n = 0; n < 20; n++) shapes.push(new Shape(n));\n"
+      "var dict = new Shape(3);\n"
+      "delete dict.f1;\n");
+
+  std::vector<v8::MapStatistics> statistics;
+  isolate->GetMapStatistics(&statistics);
+  const v8::MapStatistics* shape = nullptr;
+  for (const v8::MapStatistics& entry : statistics) {
+    if (entry.constructor_name() == "Shape") shape = &entry;
+  }
+  CHECK_NOT_NULL(shape);
+  // The initial map, one map per added field and the dictionary map.
+  CHECK_LE(21u, shape->map_count());
+  CHECK_LE(1u, shape->dictionary_map_count());
+  CHECK_LE(shape->map_count() * i::Map::kSize,
+           shape->map_and_descriptor_size());
+  for (size_t i = 1; i < statistics.size(); i++) {
+    CHECK_GE(statistics[i - 1].map_count(), statistics[i].map_count());
+  }
+}
+
+TEST(RuntimeCallStatistics) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  std::vector<v8::RuntimeCallStatistics> statistics;
+#ifdef V8_RUNTIME_CALL_STATS
+  v8::Isolate::SetRuntimeCallStatsEnabled(true);
+  CompileRun("var o = {}; for (let i = 0; i < 100; i++) o['p' + i] = i;");
+  CHECK(isolate->GetRuntimeCallStatistics(&statistics));
+  v8::Isolate::SetRuntimeCallStatsEnabled(false);
+  CHECK(!statistics.empty());
+  bool found_run = false;
+  for (size_t i = 0; i < statistics.size(); i++) {
+    CHECK_LT(0, statistics[i].count());
+    if (strcmp(statistics[i].name(), "API_Script_Run") == 0) {
+      found_run = true;
+    }
+    if (i > 0) {
+      CHECK_GE(statistics[i - 1].time_in_microseconds(),
+               statistics[i].time_in_microseconds());
+    }
+  }
+  CHECK(found_run);
+#else
+  CHECK(!isolate->GetRuntimeCallStatistics(&statistics));
+  CHECK(statistics.empty());
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
 TEST(NumberOfNativeContexts) {
   static const size_t kNumTestContexts = 10;
   i::Isolate* isolate = CcTest::i_isolate();
@@ -18477,6 +18723,37 @@ TEST(IsolateNewDispose) {
 }
 
 
+UNINITIALIZED_TEST(IsolatePool) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  std::vector<v8::Isolate*> isolates;
+  {
+    v8::IsolatePool pool(create_params, 2);
+    // Taking more isolates than the pool holds creates them on demand.
+    for (int i = 0; i < 3; i++) {
+      v8::Global<v8::Context> global_context;
+      v8::Isolate* isolate = pool.Take(&global_context);
+      CHECK_NOT_NULL(isolate);
+      CHECK(!global_context.IsEmpty());
+      for (v8::Isolate* other : isolates) CHECK_NE(other, isolate);
+      isolates.push_back(isolate);
+      v8::Locker locker(isolate);
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = global_context.Get(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::Value> result =
+          CompileRunChecked(isolate, "[1, 2, 3].map(x => x * 2).join()");
+      CHECK(result->IsString());
+      v8::String::Utf8Value value(isolate, result);
+      CHECK_EQ(0, strcmp("2,4,6", *value));
+      global_context.Reset();
+    }
+    // The pool disposes the isolates it still holds.
+  }
+  for (v8::Isolate* isolate : isolates) isolate->Dispose();
+}
+
 UNINITIALIZED_TEST(DisposeIsolateWhenInUse) {
   v8::Isolate::CreateParams create_params;
   create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
@@ -21294,6 +21571,47 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+THREADED_TEST(JSONStreamingParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  v8::JSON::StreamingParser parser;
+
+  // Chunks may split tokens and UTF-8 sequences.
+  const char* chunks[] = {"{\"a\":[1,", "2.5],\"\xE2", "\x82\xAC\":\"x",
+                          "y\"}"};
+  for (const char* chunk : chunks) parser.Append(chunk, strlen(chunk));
+  Local<Value> value = parser.Finish(context.local()).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), value).FromJust();
+  ExpectString("JSON.stringify(obj)",
+               "{\"a\":[1,2.5],\"\xE2\x82\xAC\":\"xy\"}");
+
+  // The parser can be reused. Large ASCII input is parsed from an external
+  // string.
+  std::string large = "[";
+  while (large.size() < i::JsonChunkedSource::kMinExternalLength) {
+    large += "\"abcdefghijklmnopqrstuvwxyz\",";
+  }
+  large += "0]";
+  for (size_t i = 0; i < large.size(); i += 1000) {
+    parser.Append(large.data() + i, std::min<size_t>(1000, large.size() - i));
+  }
+  value = parser.Finish(context.local()).ToLocalChecked();
+  CHECK(value->IsArray());
+  CHECK_EQ((large.size() - 3) / 29 + 1, value.As<v8::Array>()->Length());
+
+  // Syntax errors throw like v8::JSON::Parse.
+  v8::TryCatch try_catch(isolate);
+  parser.Append("[1,", 3);
+  CHECK(parser.Finish(context.local()).IsEmpty());
+  CHECK(try_catch.HasCaught());
+  try_catch.Reset();
+
+  // Empty input is a syntax error too.
+  CHECK(parser.Finish(context.local()).IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -22282,6 +22600,40 @@ THREADED_TEST(ObjectNew) {
   }
 }
 
+THREADED_TEST(ObjectGetOwnPropertyValues) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "var proto = {inherited: 1};"
+      "var obj = Object.create(proto);"
+      "obj.a = 'a';"
+      "obj[1] = 'one';"
+      "Object.defineProperty(obj, 'getter', {get() { return 'got'; }});");
+  Local<v8::Object> obj = Local<v8::Object>::Cast(
+      env->Global()->Get(env.local(), v8_str("obj")).ToLocalChecked());
+  Local<v8::Name> keys[] = {v8_str("a"), v8_str("1"), v8_str("getter"),
+                            v8_str("inherited"), v8_str("missing")};
+  Local<v8::Value> values[arraysize(keys)];
+  CHECK(obj->GetOwnPropertyValues(env.local(), keys, values, arraysize(keys))
+            .FromJust());
+  CHECK(v8_str("a")->SameValue(values[0]));
+  CHECK(v8_str("one")->SameValue(values[1]));
+  CHECK(v8_str("got")->SameValue(values[2]));
+  CHECK(values[3]->IsUndefined());
+  CHECK(values[4]->IsUndefined());
+
+  // Exceptions thrown by accessors are propagated.
+  CompileRun(
+      "Object.defineProperty(obj, 'thrower', {get() { throw 'boom'; }});");
+  Local<v8::Name> throwing_keys[] = {v8_str("a"), v8_str("thrower")};
+  v8::TryCatch try_catch(isolate);
+  CHECK(obj->GetOwnPropertyValues(env.local(), throwing_keys, values,
+                                  arraysize(throwing_keys))
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 TEST(EscapableHandleScope) {
   HandleScope outer_scope(CcTest::isolate());
   LocalContext context;
@@ -29202,6 +29554,21 @@ void FastCallback4Scalar(v8::Local<v8::Object> receiver, int arg0, float arg1) {
 void FastCallback5DifferentArity(v8::Local<v8::Object> receiver, int arg0,
                                  v8::Local<v8::Array> arg1, float arg2) {}
 
+void FastCallbackOneByteString(v8::Local<v8::Object> receiver,
+                               const v8::FastOneByteString& string) {
+  Trivial* self = UnwrapTrivialObject(receiver);
+  CHECK_NOT_NULL(self);
+  CHECK_EQ('a', string.data[0]);
+  self->set_x(static_cast<int>(string.length));
+}
+
+void OneByteStringSlowCallback(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Trivial* self = UnwrapTrivialObject(args.This());
+  CHECK_NOT_NULL(self);
+  self->set_x(-1);
+}
+
 void SequenceSlowCallback(const v8::FunctionCallbackInfo<v8::Value>& args) {
   v8::Isolate* isolate = args.GetIsolate();
   Trivial* self = UnwrapTrivialObject(args.This());
@@ -29296,6 +29663,55 @@ TEST(FastApiSequenceOverloads) {
 #endif  // V8_LITE_MODE
 }
 
+TEST(FastApiOneByteString) {
+#ifndef V8_LITE_MODE
+  if (i::FLAG_jitless) return;
+
+  v8::internal::FLAG_opt = true;
+  v8::internal::FLAG_turbo_fast_api_calls = true;
+  v8::internal::FLAG_allow_natives_syntax = true;
+  // Disable --always_opt, otherwise we haven't generated the necessary
+  // feedback to go down the "best optimization" path for the fast call.
+  v8::internal::FLAG_always_opt = false;
+  v8::internal::FlagList::EnforceFlagImplications();
+
+  v8::Isolate* isolate = CcTest::isolate();
+  HandleScope handle_scope(isolate);
+  LocalContext env;
+
+  v8::CFunction c_function =
+      v8::CFunctionBuilder().Fn(FastCallbackOneByteString).Build();
+  Local<v8::FunctionTemplate> callback_templ = v8::FunctionTemplate::New(
+      isolate, OneByteStringSlowCallback, v8::Local<v8::Value>(),
+      v8::Local<v8::Signature>(), 1, v8::ConstructorBehavior::kThrow,
+      v8::SideEffectType::kHasSideEffect, &c_function);
+
+  v8::Local<v8::ObjectTemplate> object_template =
+      v8::ObjectTemplate::New(isolate);
+  object_template->SetInternalFieldCount(kV8WrapperObjectIndex + 1);
+  object_template->Set(isolate, "api_func", callback_templ);
+
+  std::unique_ptr<Trivial> rcv(new Trivial(42));
+  v8::Local<v8::Object> object =
+      object_template->NewInstance(env.local()).ToLocalChecked();
+  object->SetAlignedPointerInInternalField(kV8WrapperObjectIndex, rcv.get());
+
+  CHECK(
+      (env)->Global()->Set(env.local(), v8_str("receiver"), object).FromJust());
+  USE(CompileRun(
+      "function func(str) { return receiver.api_func(str); }"
+      "%PrepareFunctionForOptimization(func);"
+      "func('abc');"
+      "%OptimizeFunctionOnNextCall(func);"
+      "func('abcd');"));
+  CHECK_EQ(4, rcv->x());
+
+  // A cons string is not sequential and takes the slow path.
+  USE(CompileRun("func('a'.repeat(20) + 'b'.repeat(20));"));
+  CHECK_EQ(-1, rcv->x());
+#endif  // V8_LITE_MODE
+}
+
 TEST(FastApiOverloadResolution) {
 #ifndef V8_LITE_MODE
   if (i::FLAG_jitless) return;
@@ -47,6 +47,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -399,6 +400,39 @@ TEST(FeedbackVectorUnaffectedByScopeChanges) {
   CHECK(f->has_feedback_vector() || f->has_closure_feedback_cell_array());
 }
 
+TEST(UnoptimizedMetadataSharedBetweenFunctions) {
+  FLAG_dedupe_unoptimized_metadata = true;
+  FLAG_stress_compaction = false;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "function f(o) { try { return o.foo + 1.5; } catch { return 0; } }"
+      "function g(o) { try { return o.foo + 1.5; } catch { return 0; } }"
+      "f({}); g({});");
+  Handle<JSFunction> f = Handle<JSFunction>::cast(GetGlobalProperty("f"));
+  Handle<JSFunction> g = Handle<JSFunction>::cast(GetGlobalProperty("g"));
+  CHECK(f->shared().HasBytecodeArray());
+  CHECK(g->shared().HasBytecodeArray());
+
+  Isolate* isolate = CcTest::i_isolate();
+  BytecodeArray f_bytecode = f->shared().GetBytecodeArray(isolate);
+  BytecodeArray g_bytecode = g->shared().GetBytecodeArray(isolate);
+  // The bytecode arrays stay per function, the tables hanging off them are
+  // shared.
+  CHECK_NE(f_bytecode, g_bytecode);
+  CHECK_EQ(f_bytecode.constant_pool(), g_bytecode.constant_pool());
+  CHECK_EQ(f_bytecode.handler_table(), g_bytecode.handler_table());
+  CHECK_EQ(f->shared().feedback_metadata(), g->shared().feedback_metadata());
+  Handle<FixedArray> f_constant_pool(f_bytecode.constant_pool(), isolate);
+
+  // Functions with different constants keep their own constant pool.
+  CompileRun("function h(o) { return o.bar + 1.5; } h({});");
+  Handle<JSFunction> h = Handle<JSFunction>::cast(GetGlobalProperty("h"));
+  CHECK_NE(h->shared().GetBytecodeArray(isolate).constant_pool(),
+           *f_constant_pool);
+}
+
 // Test that optimized code for different closures is actually shared.
 TEST(OptimizedCodeSharing1) {
   FLAG_stress_compaction = false;
@@ -864,6 +898,138 @@ TEST(DeepEagerCompilation) {
   }
 }
 
+namespace {
+
+struct CompileHints {
+  int eager_position;
+  std::vector<int> queried_positions;
+};
+
+bool EagerCompileHintForPosition(int position, void* data) {
+  CompileHints* hints = static_cast<CompileHints*>(data);
+  hints->queried_positions.push_back(position);
+  return position == hints->eager_position;
+}
+
+}  // namespace
+
+TEST(CompileHintsEagerCompilation) {
+  if (!i::FLAG_lazy) return;
+  i::FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "function f(x) {"
+      "  return x + x;"
+      "}"
+      "function g(x) {"
+      "  return x * x;"
+      "}"
+      "f(2)";
+  std::string source_string(source);
+  int f_position = static_cast<int>(source_string.find("("));
+  int g_position = static_cast<int>(source_string.find("(", f_position + 1));
+  CompileHints hints{f_position, {}};
+  v8::ScriptOrigin origin(CcTest::isolate(), v8_str("test"));
+  v8::ScriptCompiler::Source script_source(v8_str(source), origin,
+                                           EagerCompileHintForPosition, &hints);
+  v8::Local<v8::Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &script_source,
+                                  v8::ScriptCompiler::kConsumeCompileHints)
+          .ToLocalChecked();
+  CHECK_EQ(2u, hints.queried_positions.size());
+  CHECK_EQ(f_position, hints.queried_positions[0]);
+  CHECK_EQ(g_position, hints.queried_positions[1]);
+  {
+    v8::internal::DisallowCompilation no_compile_expected(isolate);
+    v8::Local<v8::Value> result = script->Run(env.local()).ToLocalChecked();
+    CHECK_EQ(4, result->Int32Value(env.local()).FromJust());
+  }
+  Handle<JSFunction> g = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(CompileRun("g"))));
+  CHECK(!g->shared().is_compiled());
+}
+
+namespace {
+
+Handle<SharedFunctionInfo> GetSharedFunctionInfo(v8::Isolate* isolate,
+                                                 const char* name) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::String> name_string =
+      v8::String::NewFromUtf8(isolate, name).ToLocalChecked();
+  v8::Local<v8::Value> function =
+      context->Global()->Get(context, name_string).ToLocalChecked();
+  return handle(
+      Handle<JSFunction>::cast(v8::Utils::OpenHandle(*function))->shared(),
+      reinterpret_cast<i::Isolate*>(isolate));
+}
+
+}  // namespace
+
+TEST(TieringHints) {
+  if (!i::FLAG_opt || !i::FLAG_lazy_feedback_allocation || i::FLAG_always_opt) {
+    return;
+  }
+  i::FLAG_allow_natives_syntax = true;
+  const char* source =
+      "function f(x) {"
+      "  return x + 1;"
+      "}"
+      "function g(x) {"
+      "  return x * 2;"
+      "}";
+  int f_position = static_cast<int>(std::string(source).find("("));
+
+  // Optimize {f} in a first isolate and collect the hints.
+  std::vector<v8::Isolate::TieringHint> hints;
+  CcTest::InitializeVM();
+  {
+    LocalContext env;
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun(source);
+    CompileRun(
+        "%PrepareFunctionForOptimization(f);"
+        "f(1);"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f(2);"
+        "g(1);");
+    CcTest::isolate()->GetTieringHints(&hints);
+  }
+  CHECK_EQ(1u, hints.size());
+  CHECK_EQ(f_position, hints[0].function_position);
+  CHECK(hints[0].reached_turbofan);
+
+  // A second isolate runs the same script with the hints, but without the
+  // optimizing compiler, so that only the hints mark {f} as optimized before.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    isolate->SetTieringHints(hints);
+    FlagScope<bool> no_opt(&i::FLAG_opt, false);
+    CompileRunChecked(isolate, source);
+    CompileRunChecked(isolate,
+                      "for (let i = 0; i < 100000; i++) {"
+                      "  f(i);"
+                      "  g(i);"
+                      "}");
+    CHECK(GetSharedFunctionInfo(isolate, "f")->has_optimized_at_least_once());
+    CHECK(!GetSharedFunctionInfo(isolate, "g")->has_optimized_at_least_once());
+
+    std::vector<v8::Isolate::TieringHint> new_hints;
+    isolate->GetTieringHints(&new_hints);
+    CHECK_EQ(1u, new_hints.size());
+    CHECK_EQ(hints[0].script_hash, new_hints[0].script_hash);
+  }
+  isolate->Dispose();
+}
+
 TEST(DeepEagerCompilationPeakMemory) {
   i::FLAG_always_opt = false;
   CcTest::InitializeVM();
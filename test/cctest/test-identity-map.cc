@@ -154,6 +154,7 @@ class IdentityMapTester : public HandleAndZoneScope {
       }
     }
     map.gc_counter_ = -1;
+    map.ms_counter_ = -1;
   }
 
   void CheckFind(Handle<Object> key, void* value) {
@@ -703,6 +704,34 @@ TEST(ExplicitGC) {
   }
 }
 
+TEST(ExplicitGCOldKeys) {
+  IdentityMapTester t;
+  Factory* factory = t.isolate()->factory();
+  Handle<Object> num_keys[] = {
+      factory->NewHeapNumber<AllocationType::kOld>(2.1),
+      factory->NewHeapNumber<AllocationType::kOld>(2.4),
+      factory->NewHeapNumber<AllocationType::kOld>(3.3),
+      factory->NewHeapNumber<AllocationType::kOld>(4.3),
+      factory->NewHeapNumber<AllocationType::kOld>(7.5)};
+
+  // Insert some objects that are in old space, which a scavenge cannot move.
+  for (size_t i = 0; i < arraysize(num_keys); i++) {
+    t.map.Insert(num_keys[i], &num_keys[i]);
+  }
+
+  t.heap()->CollectGarbage(i::NEW_SPACE, i::GarbageCollectionReason::kTesting);
+  for (size_t i = 0; i < arraysize(num_keys); i++) {
+    t.CheckFind(num_keys[i], &num_keys[i]);
+  }
+
+  t.heap()->CollectAllGarbage(i::Heap::kNoGCFlags,
+                              i::GarbageCollectionReason::kTesting);
+  for (size_t i = 0; i < arraysize(num_keys); i++) {
+    t.CheckFind(num_keys[i], &num_keys[i]);
+    t.CheckFindOrInsert(num_keys[i], &num_keys[i]);
+  }
+}
+
 TEST(CanonicalHandleScope) {
   Isolate* isolate = CcTest::i_isolate();
   Heap* heap = CcTest::heap();
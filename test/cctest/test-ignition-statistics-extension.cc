@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/interpreter/bytecode-dispatch-sampler.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/interpreter/interpreter.h"
 #include "test/cctest/test-api.h"
@@ -125,5 +126,34 @@ TEST(IgnitionStatisticsExtension) {
   CHECK(non_empty_result->BooleanValue(isolate));
 }
 
+TEST(IgnitionStatisticsExtensionSampledDispatches) {
+  if (FLAG_always_opt) return;
+  FLAG_expose_ignition_statistics = true;
+  FLAG_sample_ignition_dispatches = true;
+  FLAG_interrupt_budget = 1024;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  interpreter::BytecodeDispatchSampler* sampler =
+      CcTest::i_isolate()->interpreter()->dispatch_sampler();
+  CHECK_NOT_NULL(sampler);
+
+  const char* kSampleTest = R"(
+    function hotLoop(n) {
+      var sum = 0;
+      for (var i = 0; i < n; i++) sum += i;
+      return sum;
+    }
+    hotLoop(10000);
+    var samples = getIgnitionSampledDispatches();
+    var hot = samples.functions.find(f => f.name === "hotLoop");
+    hot !== undefined && hot.samples > 0 && hot.bytecodes.JumpLoop > 0 &&
+        hot.dispatches.JumpLoop !== undefined &&
+        samples.dispatches.JumpLoop !== undefined;)";
+  Local<Value> sample_result = CompileRun(kSampleTest);
+  CHECK(sample_result->BooleanValue(isolate));
+  CHECK_LT(0u, sampler->sample_count());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -664,6 +664,53 @@ TEST(NoSamples) {
   CHECK_EQ(1, profile->samples_count());
 }
 
+TEST(TakeSamples) {
+  TestSetup test_setup;
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfiler profiler(isolate);
+  CpuProfilesCollection profiles(isolate);
+  profiles.set_cpu_profiler(&profiler);
+  profiles.StartProfiling("", {CpuProfilingMode::kLeafNodeLineNumbers, 2});
+  CodeEntryStorage storage;
+  CodeMap code_map(storage);
+  Symbolizer symbolizer(&code_map);
+  CodeEntry* entry1 = storage.Create(i::Logger::FUNCTION_TAG, "aaa");
+  symbolizer.code_map()->AddCode(ToAddress(0x1500), entry1, 0x200);
+
+  TickSample sample;
+  sample.pc = ToPointer(0x1600);
+  sample.stack[0] = ToPointer(0x1510);
+  sample.frames_count = 1;
+  auto symbolized = symbolizer.SymbolizeTickSample(sample);
+  auto add_sample = [&]() {
+    profiles.AddPathToCurrentProfiles(
+        v8::base::TimeTicks::Now(), symbolized.stack_trace,
+        symbolized.src_line, true, base::TimeDelta(), StateTag::JS,
+        EmbedderStateTag::EMPTY);
+  };
+
+  std::deque<CpuProfile::SampleInfo> samples;
+  CHECK(!profiles.TakeSamples("other", &samples));
+  add_sample();
+  add_sample();
+  add_sample();
+  // The third sample exceeds the limit of two samples.
+  CHECK(profiles.TakeSamples("", &samples));
+  CHECK_EQ(2u, samples.size());
+
+  // Taken samples no longer count towards the limit.
+  add_sample();
+  CHECK(profiles.TakeSamples("", &samples));
+  CHECK_EQ(3u, samples.size());
+  CHECK_EQ(samples[0].node, samples[2].node);
+  CHECK_LE(samples[1].timestamp, samples[2].timestamp);
+
+  add_sample();
+  CpuProfile* profile = profiles.StopProfiling("");
+  CHECK_EQ(1, profile->samples_count());
+  CHECK_EQ(samples[0].node, profile->sample(0).node);
+}
+
 static const ProfileNode* PickChild(const ProfileNode* parent,
                                     const char* name) {
   for (const ProfileNode* child : *parent->children()) {
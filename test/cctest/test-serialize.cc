@@ -32,14 +32,18 @@
 #include "include/v8-function.h"
 #include "include/v8-locker.h"
 #include "src/api/api-inl.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler-inl.h"
+#include "src/codegen/process-script-cache.h"
+#include "src/codegen/script-disk-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/common/assert-scope.h"
 #include "src/debug/debug.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
 #include "src/heap/spaces.h"
@@ -459,6 +463,18 @@ UNINITIALIZED_TEST(SnapshotCompression) {
       i::SnapshotCompression::Decompress(compressed.RawData());
   CHECK_EQ(context_blob, decompressed.RawData());
 
+  // The startup snapshot spans several chunks, which decompress the same on
+  // the main thread and in parallel.
+  SnapshotData original_startup_data(startup_blob);
+  SnapshotData compressed_startup =
+      i::SnapshotCompression::Compress(&original_startup_data);
+  for (bool parallel : {false, true}) {
+    FLAG_parallel_snapshot_decompression = parallel;
+    SnapshotData decompressed_startup =
+        i::SnapshotCompression::Decompress(compressed_startup.RawData());
+    CHECK_EQ(startup_blob, decompressed_startup.RawData());
+  }
+
   startup_blob.Dispose();
   read_only_blob.Dispose();
   shared_space_blob.Dispose();
@@ -2690,6 +2706,365 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+namespace {
+
+SharedFunctionInfo FindSharedFunctionInfoByName(
+    Isolate* isolate, v8::Local<v8::UnboundScript> unbound_script,
+    const char* name) {
+  Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*unbound_script);
+  SharedFunctionInfo::ScriptIterator it(isolate,
+                                        Script::cast(toplevel->script()));
+  for (SharedFunctionInfo info = it.Next(); !info.is_null(); info = it.Next()) {
+    if (info.Name().IsOneByteEqualTo(base::CStrVector(name))) return info;
+  }
+  return SharedFunctionInfo();
+}
+
+}  // namespace
+
+TEST(CodeSerializerPreservesOptimizationHint) {
+  if (!FLAG_opt || FLAG_lite_mode) return;
+  FLAG_allow_natives_syntax = true;
+  const char* js_source =
+      "function f() { return 'abc'; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // The hint was recorded in the first isolate and read back from the cache.
+    // Check before running the script, which would set the bit again.
+    SharedFunctionInfo f = FindSharedFunctionInfoByName(
+        reinterpret_cast<Isolate*>(isolate2), script, "f");
+    CHECK(!f.is_null());
+    CHECK(f.has_optimized_at_least_once());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerPreservesFeedbackVectorHint) {
+  if (!FLAG_lazy_feedback_allocation || !FLAG_feedback_vector_warm_start) {
+    return;
+  }
+  FLAG_allow_natives_syntax = true;
+  const char* js_source =
+      "function f(x) { return x; };"
+      "function g(x) { return x; };"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "f(1) + g(2)";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+    SharedFunctionInfo f_shared =
+        FindSharedFunctionInfoByName(i_isolate2, script, "f");
+    CHECK(!f_shared.is_null());
+    CHECK(f_shared.has_feedback_vector_at_least_once());
+    SharedFunctionInfo g_shared =
+        FindSharedFunctionInfoByName(i_isolate2, script, "g");
+    CHECK(!g_shared.is_null());
+    CHECK(!g_shared.has_feedback_vector_at_least_once());
+
+    // Without the hint, a single call would not allocate a feedback vector.
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f")));
+    CHECK(f->has_feedback_vector());
+    Handle<JSFunction> g = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("g")));
+    CHECK(!g->has_feedback_vector());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerPreservesPreparseData) {
+  // {outer} is never called before the cache is created, so it stays lazy and
+  // keeps the preparse data that lets its lazy compile skip {inner}.
+  const char* js_source =
+      "function outer(x) {"
+      "  function inner() { return x; }"
+      "  return inner;"
+      "};"
+      "'abc'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    SharedFunctionInfo outer = FindSharedFunctionInfoByName(
+        reinterpret_cast<Isolate*>(isolate2), script, "outer");
+    CHECK(!outer.is_null());
+    CHECK(outer.HasUncompiledDataWithPreparseData());
+
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    v8::Local<v8::Value> result = CompileRun("outer(42)()");
+    CHECK_EQ(42, result->Int32Value(context).FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(ScriptDiskCache) {
+  FLAG_script_cache_dir = ".";
+  const char* js_source = "function f() { return 42; }; f()";
+  const char* origin = "script-disk-cache-test";
+
+  LocalContext env;
+  v8::Isolate* isolate1 = env->GetIsolate();
+  v8::HandleScope scope(isolate1);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  std::string path = ScriptDiskCache::EntryPath(
+      i_isolate1, v8::Utils::OpenHandle(*v8_str(js_source)),
+      ScriptDetails(v8::Utils::OpenHandle(*v8_str(origin))));
+  base::OS::Remove(path.c_str());
+  {
+    v8::ScriptOrigin script_origin(isolate1, v8_str(origin));
+    v8::ScriptCompiler::Source source(v8_str(js_source), script_origin);
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(env.local(), &source).ToLocalChecked();
+    CHECK_EQ(42, script->Run(env.local())
+                     .ToLocalChecked()
+                     ->Int32Value(env.local())
+                     .FromJust());
+  }
+
+  // The entry is written on a worker thread and renamed into place once it
+  // is complete.
+  FILE* entry = nullptr;
+  for (int i = 0; i < 1000 && entry == nullptr; ++i) {
+    entry = base::OS::FOpen(path.c_str(), "rb");
+    if (entry == nullptr) {
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(10));
+    }
+  }
+  CHECK_NOT_NULL(entry);
+  fclose(entry);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope2(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin script_origin(isolate2, v8_str(origin));
+    v8::ScriptCompiler::Source source(v8_str(js_source), script_origin);
+    v8::Local<v8::Script> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::Compile(context, &source).ToLocalChecked();
+    }
+    v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+    CHECK_EQ(42, result->Int32Value(context).FromJust());
+  }
+  isolate2->Dispose();
+  base::OS::Remove(path.c_str());
+  FLAG_script_cache_dir = nullptr;
+}
+
+TEST(ProcessScriptCache) {
+  FLAG_process_script_cache = true;
+  const char* js_source = "function f() { return 42; }; f()";
+  const char* origin = "process-script-cache-test";
+
+  LocalContext env;
+  v8::Isolate* isolate1 = env->GetIsolate();
+  {
+    v8::HandleScope scope(isolate1);
+    v8::ScriptOrigin script_origin(isolate1, v8_str(origin));
+    v8::ScriptCompiler::Source source(v8_str(js_source), script_origin);
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(env.local(), &source).ToLocalChecked();
+    CHECK_EQ(42, script->Run(env.local())
+                     .ToLocalChecked()
+                     ->Int32Value(env.local())
+                     .FromJust());
+  }
+
+  // The second isolate deserializes the script compiled by the first one.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin script_origin(isolate2, v8_str(origin));
+    v8::ScriptCompiler::Source source(v8_str(js_source), script_origin);
+    v8::Local<v8::Script> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::Compile(context, &source).ToLocalChecked();
+    }
+    v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+    CHECK_EQ(42, result->Int32Value(context).FromJust());
+  }
+  isolate2->Dispose();
+  ProcessScriptCache::Clear();
+  FLAG_process_script_cache = false;
+}
+
+#ifdef V8_ENABLE_MAGLEV
+TEST(CodeSerializerPreservesMaglevHint) {
+  if (!FLAG_opt || FLAG_lite_mode) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_maglev = true;
+  FlagList::EnforceFlagImplications();
+  const char* js_source =
+      "function f(x) { return x; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1);"
+      "%OptimizeMaglevOnNextCall(f);"
+      "f(2)";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Check before running the script, which would set the bit again.
+    SharedFunctionInfo f = FindSharedFunctionInfoByName(
+        reinterpret_cast<Isolate*>(isolate2), script, "f");
+    CHECK(!f.is_null());
+    CHECK(f.has_maglev_code_at_least_once());
+  }
+  isolate2->Dispose();
+}
+#endif  // V8_ENABLE_MAGLEV
+
+#if ENABLE_SPARKPLUG
+TEST(CodeSerializerCompilesBaselineCodeOnWarmStart) {
+  if (FLAG_jitless) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_sparkplug = true;
+  FLAG_always_sparkplug = false;
+  FLAG_sparkplug_code_cache_warm_start = true;
+  FlagList::EnforceFlagImplications();
+  const char* js_source =
+      "function f(x) { return x; };"
+      "function g(x) { return x; };"
+      "%CompileBaseline(f);"
+      "f(1) + g(2)";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the function that had baseline code in the first isolate gets it
+    // after deserialization.
+    Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+    Handle<SharedFunctionInfo> f(
+        FindSharedFunctionInfoByName(i_isolate2, script, "f"), i_isolate2);
+    CHECK(!f.is_null());
+    CHECK(f->has_baseline_code_at_least_once());
+    if (FLAG_concurrent_sparkplug) {
+      // The code is compiled on a background thread and installed later.
+      for (int i = 0; i < 1000 && !f->HasBaselineCode(); ++i) {
+        {
+          ParkedScope parked(i_isolate2->main_thread_local_heap());
+          base::OS::Sleep(base::TimeDelta::FromMilliseconds(10));
+        }
+        i_isolate2->baseline_batch_compiler()->InstallBatch();
+      }
+    }
+    CHECK(f->HasBaselineCode());
+    SharedFunctionInfo g =
+        FindSharedFunctionInfoByName(i_isolate2, script, "g");
+    CHECK(!g.is_null());
+    CHECK(!g.HasBaselineCode());
+  }
+  isolate2->Dispose();
+}
+#endif  // ENABLE_SPARKPLUG
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
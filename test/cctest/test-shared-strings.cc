@@ -402,6 +402,85 @@ UNINITIALIZED_TEST(ConcurrentInternalizationHit) {
   TestConcurrentInternalization(kTestHit);
 }
 
+class ConcurrentCopyInternalizationThread final
+    : public ConcurrentStringThreadBase {
+ public:
+  ConcurrentCopyInternalizationThread(MultiClientIsolateTest* test,
+                                      Handle<FixedArray> shared_strings,
+                                      base::Semaphore* sema_ready,
+                                      base::Semaphore* sema_execute_start,
+                                      base::Semaphore* sema_execute_complete)
+      : ConcurrentStringThreadBase("ConcurrentCopyInternalizationThread", test,
+                                   shared_strings, sema_ready,
+                                   sema_execute_start, sema_execute_complete) {}
+
+  void Setup() override { factory = i_isolate->factory(); }
+
+  void RunForString(Handle<String> input_string) override {
+    // Young strings are internalized by inserting a shared copy, which the
+    // threads race to insert without excluding each other.
+    std::unique_ptr<char[]> chars = input_string->ToCString();
+    Handle<String> young = factory->NewStringFromAsciiChecked(chars.get());
+    CHECK(Heap::InYoungGeneration(*young));
+    Handle<String> interned = factory->InternalizeString(young);
+    CHECK(interned->IsShared());
+    CHECK(String::Equals(i_isolate, input_string, interned));
+    Handle<String> again = factory->InternalizeString(
+        factory->NewStringFromAsciiChecked(chars.get()));
+    CHECK_EQ(*interned, *again);
+  }
+
+ private:
+  Factory* factory;
+};
+
+UNINITIALIZED_TEST(ConcurrentInternalizationOfCopies) {
+  if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
+  if (!COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) return;
+  if (FLAG_single_generation) return;
+
+  FLAG_shared_string_table = true;
+
+  MultiClientIsolateTest test;
+
+  constexpr int kThreads = 4;
+  constexpr int kStrings = 4096;
+
+  v8::Isolate* isolate = test.NewClientIsolate();
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Factory* factory = i_isolate->factory();
+
+  HandleScope scope(i_isolate);
+
+  Handle<FixedArray> shared_strings =
+      CreateSharedOneByteStrings(i_isolate, factory, kStrings, false);
+  int elements_before = i_isolate->string_table()->NumberOfElements();
+
+  base::Semaphore sema_ready(0);
+  base::Semaphore sema_execute_start(0);
+  base::Semaphore sema_execute_complete(0);
+  std::vector<std::unique_ptr<ConcurrentCopyInternalizationThread>> threads;
+  for (int i = 0; i < kThreads; i++) {
+    auto thread = std::make_unique<ConcurrentCopyInternalizationThread>(
+        &test, shared_strings, &sema_ready, &sema_execute_start,
+        &sema_execute_complete);
+    CHECK(thread->Start());
+    threads.push_back(std::move(thread));
+  }
+
+  for (int i = 0; i < kThreads; i++) sema_ready.Wait();
+  for (int i = 0; i < kThreads; i++) sema_execute_start.Signal();
+  for (int i = 0; i < kThreads; i++) sema_execute_complete.Wait();
+
+  // Every string was inserted once, no matter how many threads raced for it.
+  CHECK_LE(i_isolate->string_table()->NumberOfElements() - elements_before,
+           kStrings);
+
+  for (auto& thread : threads) {
+    thread->Join();
+  }
+}
+
 class ConcurrentStringTableLookupThread final
     : public ConcurrentStringThreadBase {
  public:
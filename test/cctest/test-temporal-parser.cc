@@ -1945,6 +1945,70 @@ TEST(TemporalCalendarStringIllegal) {
   VERIFY_PARSE_FAIL(TemporalCalendarString, "20210304[u-ca=abcdefghijkl]");
 }
 
+// The canonical forms produced by toString() take a fast path in the parser,
+// which must give the same results as the general grammar.
+TEST(TemporalCanonicalDateTimeString) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  VerifyParseTemporalDateTimeStringSuccess(isolate, "2021-11-09", 2021, 11, 9,
+                                           kUndefined, kUndefined, kUndefined,
+                                           kUndefined, "");
+  VerifyParseTemporalDateTimeStringSuccess(isolate, "2021-11-09T07:08", 2021,
+                                           11, 9, 7, 8, kUndefined, kUndefined,
+                                           "");
+  VerifyParseTemporalDateTimeStringSuccess(isolate, "0000-01-31T23:59:60",
+                                           0, 1, 31, 23, 59, 60, kUndefined,
+                                           "");
+  VerifyParseTemporalDateTimeStringSuccess(
+      isolate, "2021-11-09T07:08:09.1Z", 2021, 11, 9, 7, 8, 9, 100000000, "");
+  VerifyParseTemporalDateTimeStringSuccess(isolate,
+                                           "2021-11-09T07:08:09.123456789Z",
+                                           2021, 11, 9, 7, 8, 9, 123456789, "");
+  VerifyParseTemporalDateStringSuccess(isolate, "2021-11-09T07:08:09Z", 2021,
+                                       11, 9, "");
+  VerifyParseTemporalYearMonthStringSuccess(isolate, "2021-11-09", 2021, 11, 9,
+                                            "");
+  VerifyParseTemporalMonthDayStringSuccess(isolate, "2021-11-09T07:08", 2021,
+                                           11, 9, "");
+  VerifyParseTemporalRelativeToStringSuccess(isolate, "2021-11-09T07:08:09",
+                                             2021, 11, 9, 7, 8, 9, kUndefined,
+                                             "");
+  VerifyParseTemporalInstantStringSuccess(isolate, "2021-11-09Z", true,
+                                          kUndefined, kUndefined, kUndefined,
+                                          kUndefined, kUndefined);
+  VerifyParseTemporalInstantStringSuccess(isolate, "2021-11-09T07:08:09.123Z",
+                                          true, kUndefined, kUndefined,
+                                          kUndefined, kUndefined, kUndefined);
+
+  // Close to canonical, handled by the general grammar.
+  VerifyParseTemporalDateTimeStringSuccess(isolate, "2021-11-09t07:08:09,5z",
+                                           2021, 11, 9, 7, 8, 9, 500000000, "");
+  VerifyParseTemporalDateTimeStringSuccess(isolate, "2021-11-09T0708", 2021,
+                                           11, 9, 7, 8, kUndefined, kUndefined,
+                                           "");
+  VerifyParseTemporalDateTimeStringSuccess(isolate, "2021-11-09T07:08:09+01",
+                                           2021, 11, 9, 7, 8, 9, kUndefined,
+                                           "");
+  VerifyParseTemporalDateTimeStringSuccess(
+      isolate, "2021-11-09T07:08:09[u-ca=iso8601]", 2021, 11, 9, 7, 8, 9,
+      kUndefined, "iso8601");
+  VerifyParseTemporalInstantStringSuccess(isolate, "2021-11-09T07:08:09-01:30",
+                                          false, -1, 1, 30, kUndefined,
+                                          kUndefined);
+
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-13-09");
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-11-32");
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-11-09T24:08");
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-11-09T07:60");
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-11-09T07:08:61");
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-11-09T07:08:09.");
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-11-09T07:08:09.1234567890");
+  VERIFY_PARSE_FAIL(TemporalDateTimeString, "2021-11-09T07:08:09ZZ");
+  VERIFY_PARSE_FAIL(TemporalInstantString, "2021-11-09");
+  VERIFY_PARSE_FAIL(TemporalInstantString, "2021-11-09T07:08:09");
+}
+
 void CheckDuration(const ParsedISO8601Duration& actual, int64_t sign,
                    int64_t years, int64_t months, int64_t weeks, int64_t days,
                    int64_t whole_hours, int64_t hours_fraction,
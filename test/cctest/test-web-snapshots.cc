@@ -110,6 +110,21 @@ TEST(EmptyObject) {
                            kObjectCount);
 }
 
+TEST(OneByteAndTwoByteStrings) {
+  // Latin-1 characters outside of ASCII must survive the one-byte encoding.
+  const char* snapshot_source =
+      "var foo = {'a': 'caf\\xe9', 'b': 'snow\\u2603'};";
+  const char* test_source = "foo.a + foo.b";
+  const char* expected_result = "caf\xc3\xa9snow\xe2\x98\x83";
+  uint32_t kStringCount = 5;  // 'foo', 'a', 'b', 'caf\xe9', 'snow\u2603'
+  uint32_t kMapCount = 1;
+  uint32_t kContextCount = 0;
+  uint32_t kFunctionCount = 0;
+  uint32_t kObjectCount = 1;
+  TestWebSnapshot(snapshot_source, test_source, expected_result, kStringCount,
+                  kMapCount, kContextCount, kFunctionCount, kObjectCount);
+}
+
 TEST(Numbers) {
   const char* snapshot_source =
       "var foo = {'a': 6,\n"
@@ -843,5 +858,43 @@ TEST(CompactedSourceCode) {
   }
 }
 
+// Test that snapshots written in a different format version are rejected.
+TEST(VersionMismatch) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+
+  WebSnapshotData snapshot_data;
+  {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> new_context = CcTest::NewContext();
+    v8::Context::Scope context_scope(new_context);
+
+    CompileRun("var foo = {a: 1};");
+    v8::Local<v8::PrimitiveArray> exports = v8::PrimitiveArray::New(isolate, 1);
+    exports->Set(isolate, 0, v8_str("foo"));
+    WebSnapshotSerializer serializer(isolate);
+    CHECK(serializer.TakeSnapshot(new_context, exports, snapshot_data));
+    CHECK(!serializer.has_error());
+  }
+
+  // The version directly follows the magic number and fits in one byte.
+  STATIC_ASSERT(WebSnapshotSerializerDeserializer::kVersion < 0x7F);
+  size_t version_offset =
+      sizeof(WebSnapshotSerializerDeserializer::kMagicNumber);
+  CHECK_EQ(WebSnapshotSerializerDeserializer::kVersion,
+           snapshot_data.buffer[version_offset]);
+  snapshot_data.buffer[version_offset]++;
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> new_context = CcTest::NewContext();
+    v8::Context::Scope context_scope(new_context);
+    WebSnapshotDeserializer deserializer(isolate, snapshot_data.buffer,
+                                         snapshot_data.buffer_size);
+    CHECK(!deserializer.Deserialize());
+    CHECK(deserializer.has_error());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
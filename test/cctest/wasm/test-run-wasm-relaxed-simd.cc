@@ -27,6 +27,11 @@ namespace test_run_wasm_relaxed_simd {
     EXPERIMENTAL_FLAG_SCOPE(relaxed_simd);                      \
     RunWasm_##name##_Impl(TestExecutionTier::kTurbofan);        \
   }                                                             \
+  TEST(RunWasm_##name##_liftoff) {                              \
+    if (!CpuFeatures::SupportsWasmSimd128()) return;            \
+    EXPERIMENTAL_FLAG_SCOPE(relaxed_simd);                      \
+    RunWasm_##name##_Impl(TestExecutionTier::kLiftoff);         \
+  }                                                             \
   TEST(RunWasm_##name##_interpreter) {                          \
     EXPERIMENTAL_FLAG_SCOPE(relaxed_simd);                      \
     RunWasm_##name##_Impl(TestExecutionTier::kInterpreter);     \
@@ -144,6 +144,43 @@ TEST(CacheHitMissSig) {
   CHECK_EQ(c2, c4);
 }
 
+TEST(CacheHitEqualSig) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+  WasmImportWrapperCache::ModificationScope cache_scope(
+      module->import_wrapper_cache());
+
+  auto kind = compiler::WasmImportCallKind::kJSFunctionArityMatch;
+  auto sig1 = sigs.i_i();
+  int expected_arity = static_cast<int>(sig1->parameter_count());
+
+  WasmCode* c1 =
+      CompileImportWrapper(module.get(), isolate->counters(), kind, sig1,
+                           expected_arity, kNoSuspend, &cache_scope);
+
+  CHECK_NOT_NULL(c1);
+
+  // A signature with the same types hits the cache, also after the signature
+  // the wrapper was compiled for is gone.
+  ValueType i_i_reps[] = {kWasmI32, kWasmI32};
+  FunctionSig sig2(1, 1, i_i_reps);
+  WasmCode* c2 = cache_scope[{kind, &sig2, expected_arity, kNoSuspend}];
+
+  CHECK_EQ(c1, c2);
+
+  {
+    TestSignatures other_sigs;
+    WasmCode* c3 = cache_scope[{kind, other_sigs.i_ii(), expected_arity + 1,
+                                kNoSuspend}];
+    CHECK_NULL(c3);
+  }
+  ValueType i_ii_reps[] = {kWasmI32, kWasmI32, kWasmI32};
+  FunctionSig i_ii(1, 2, i_ii_reps);
+  CHECK_NULL(cache_scope[{kind, &i_ii, expected_arity + 1, kNoSuspend}]);
+}
+
 }  // namespace test_wasm_import_wrapper_cache
 }  // namespace wasm
 }  // namespace internal
@@ -363,6 +363,47 @@ TEST(SerializeLiftoffModuleFails) {
   CHECK(!wasm_serializer.SerializeNativeModule({buffer.get(), buffer_size}));
 }
 
+TEST(SerializeIncrementally) {
+  FlagScope<bool> no_wasm_dynamic_tiering(&FLAG_wasm_dynamic_tiering, false);
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator, "test_zone");
+
+  CcTest::InitIsolateOnce();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  ZoneBuffer wire_bytes_buffer(&zone);
+  WasmSerializationTest::BuildWireBytes(&zone, &wire_bytes_buffer);
+
+  ErrorThrower thrower(isolate, "Test");
+  MaybeHandle<WasmModuleObject> maybe_module_object =
+      GetWasmEngine()->SyncCompile(
+          isolate, WasmFeatures::All(), &thrower,
+          ModuleWireBytes(wire_bytes_buffer.begin(), wire_bytes_buffer.end()));
+  Handle<WasmModuleObject> module_object =
+      maybe_module_object.ToHandleChecked();
+  NativeModule* native_module = module_object->native_module();
+  native_module->compilation_state()->WaitForTopTierFinished();
+
+  auto Serialize = [native_module](base::Vector<const byte> previous) {
+    WasmSerializer wasm_serializer(native_module, previous);
+    size_t buffer_size = wasm_serializer.GetSerializedNativeModuleSize();
+    std::vector<byte> buffer(buffer_size);
+    CHECK(wasm_serializer.SerializeNativeModule(base::VectorOf(buffer)));
+    return buffer;
+  };
+  std::vector<byte> full = Serialize({});
+
+  // Code copied from the previous serialization is the same as the one that
+  // is serialized again.
+  CHECK(Serialize(base::VectorOf(full)) == full);
+
+  // Unusable previous serializations are ignored.
+  CHECK(Serialize(base::VectorOf(full).SubVector(0, full.size() - 1)) == full);
+  std::vector<byte> other_version = full;
+  other_version[WasmSerializer::kVersionHashOffset]++;
+  CHECK(Serialize(base::VectorOf(other_version)) == full);
+}
+
 }  // namespace test_wasm_serialization
 }  // namespace wasm
 }  // namespace internal
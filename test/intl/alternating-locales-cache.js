@@ -0,0 +1,22 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString and localeCompare cache a few ICU objects per locale. Check
+// that alternating between more locales than fit in the cache still gives
+// the same results as fresh formatters.
+
+const kLocales = ['en', 'de', 'fr', 'ja', 'ar', 'hi', undefined];
+const kNumber = 1234567.891;
+const kDate = new Date(2020, 0, 2, 3, 4, 5);
+
+for (let round = 0; round < 3; round++) {
+  for (const locale of kLocales) {
+    assertEquals(new Intl.NumberFormat(locale).format(kNumber),
+                 kNumber.toLocaleString(locale));
+    assertEquals(new Intl.DateTimeFormat(locale).format(kDate),
+                 kDate.toLocaleDateString(locale));
+    assertEquals(new Intl.Collator(locale).compare('a', 'B'),
+                 'a'.localeCompare('B', locale));
+  }
+}
@@ -0,0 +1,94 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Large arrays are searched in C++, a block of elements at a time. Check
+// matches at every position relative to the blocks, and the semantics of
+// holes, -0 and NaN.
+
+const kLength = 100;
+
+function check(array, value, index) {
+  assertEquals(index, array.indexOf(value));
+  assertEquals(index >= 0, array.includes(value));
+  for (const from of [0, 1, 3, index, index + 1, kLength - 40, -50]) {
+    const start = from < 0 ? kLength + from : from;
+    const expected = index >= start ? index : -1;
+    assertEquals(expected, array.indexOf(value, from));
+    assertEquals(expected >= 0, array.includes(value, from));
+  }
+}
+
+(function PackedSmi() {
+  for (let index = 0; index < kLength; index++) {
+    const array = Array.from({length: kLength}, (_, i) => i == index ? -7 : i);
+    assertTrue(%HasSmiElements(array));
+    check(array, -7, index);
+  }
+  const array = Array.from({length: kLength}, (_, i) => i);
+  check(array, kLength, -1);
+  check(array, 2 ** 40, -1);
+  assertEquals(5, array.indexOf(5.0));
+  assertEquals(-1, array.indexOf('5'));
+})();
+
+(function HoleySmi() {
+  const array = new Array(kLength);
+  for (let i = 0; i < kLength; i += 2) array[i] = i;
+  assertTrue(%HasSmiElements(array));
+  assertTrue(%HasHoleyElements(array));
+  check(array, 60, 60);
+  check(array, 61, -1);
+  assertEquals(-1, array.indexOf(undefined));
+  assertTrue(array.includes(undefined));
+})();
+
+(function Objects() {
+  const objects = Array.from({length: kLength}, () => ({}));
+  for (let index = 0; index < kLength; index++) {
+    check(objects, objects[index], index);
+  }
+  check(objects, {}, -1);
+  const symbols = Array.from({length: kLength}, () => Symbol());
+  check(symbols, symbols[kLength - 1], kLength - 1);
+  const mixed = objects.concat([null, true, 1.5, 'x']);
+  assertEquals(kLength, mixed.indexOf(null));
+  assertEquals(kLength + 1, mixed.indexOf(true));
+  assertEquals(kLength + 2, mixed.indexOf(1.5));
+  assertEquals(kLength + 3, mixed.indexOf('x'));
+  assertEquals(-1, mixed.indexOf(undefined));
+})();
+
+(function Doubles() {
+  for (let index = 0; index < kLength; index++) {
+    const array =
+        Array.from({length: kLength}, (_, i) => i == index ? 0.25 : i + 0.5);
+    assertTrue(%HasDoubleElements(array));
+    check(array, 0.25, index);
+  }
+  const array = Array.from({length: kLength}, (_, i) => i + 0.5);
+  check(array, 0.75, -1);
+  array[70] = 3;
+  check(array, 3, 70);
+  array[80] = -0;
+  check(array, 0, 80);
+  check(array, -0, 80);
+  array[90] = NaN;
+  assertEquals(-1, array.indexOf(NaN));
+  assertTrue(array.includes(NaN));
+  assertFalse(array.includes(NaN, 91));
+})();
+
+(function HoleyDoubles() {
+  const array = new Array(kLength);
+  for (let i = 0; i < kLength; i += 2) array[i] = i + 0.5;
+  assertTrue(%HasDoubleElements(array));
+  assertTrue(%HasHoleyElements(array));
+  check(array, 40.5, 40);
+  check(array, 41.5, -1);
+  assertEquals(-1, array.indexOf(undefined));
+  assertTrue(array.includes(undefined));
+  assertFalse(array.includes(NaN));
+})();
@@ -112,3 +112,16 @@ assertEquals("abcd", a.join(""));  // Must not throw.
   assertEquals("a,b,", Array.prototype.join.call(p));
   assertEquals(["length", "0", "1", "2"], log);
 }
+
+// Multi-character and two-byte separators, including holes that produce
+// runs of separators.
+{
+  var a = ['a', 'b', , , 'c', 'd'];
+  assertEquals('a, b, , , c, d', a.join(', '));
+  assertEquals('a b   c d', a.join(' '));
+  assertEquals('a<->b<-><-><->c<->d', a.join('<->'));
+  assertEquals('aé bé é é c' +
+               'é d', a.join('é '));
+  assertEquals(', , a', [, , 'a'].join(', '));
+  assertEquals('a, , ', ['a', , ,].join(', '));
+}
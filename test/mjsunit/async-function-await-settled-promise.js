@@ -0,0 +1,88 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --async-stack-traces
+
+// Awaiting an already settled native promise resumes the async function from
+// a dedicated microtask. Check that it is scheduled and resumed exactly like
+// the general await.
+
+// Interleaving with other reactions on the same promises.
+(function() {
+  const log = [];
+  async function f(p) {
+    log.push('enter');
+    try {
+      log.push(await p);
+    } catch (e) {
+      log.push('caught ' + e);
+    }
+    log.push('exit');
+  }
+
+  const resolved = Promise.resolve(1);
+  const rejected = Promise.reject(2);
+  f(resolved);
+  resolved.then(() => log.push('then'));
+  f(rejected);
+  rejected.catch(() => log.push('catch'));
+  %PerformMicrotaskCheckpoint();
+  assertEquals(
+      ['enter', 'enter', 1, 'exit', 'then', 'caught 2', 'exit', 'catch'], log);
+})();
+
+// Many awaits in a row, mixed with pending promises, in optimized code too.
+(function() {
+  async function sum(promises) {
+    let result = 0;
+    for (const p of promises) result += await p;
+    return result;
+  }
+
+  function makePromises() {
+    const promises = [];
+    for (let i = 0; i < 100; i++) {
+      promises.push(
+          i % 3 == 0 ? new Promise(resolve => setTimeout(resolve, 0, i)) :
+                       Promise.resolve(i));
+    }
+    return promises;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertPromiseResult(sum(makePromises()), v => assertEquals(4950, v));
+  %PerformMicrotaskCheckpoint();
+  %OptimizeFunctionOnNextCall(sum);
+  assertPromiseResult(sum(makePromises()), v => assertEquals(4950, v));
+})();
+
+// A rejection is handled by the await, so it is not reported as unhandled.
+(function() {
+  async function f() {
+    try {
+      await Promise.reject(new Error('handled'));
+      assertUnreachable();
+    } catch (e) {
+      return e.message;
+    }
+  }
+  assertPromiseResult(f(), v => assertEquals('handled', v));
+})();
+
+// The async stack trace continues through the resumed function.
+(function() {
+  async function two() {
+    await Promise.resolve();
+    throw new Error();
+  }
+
+  async function one() {
+    await two();
+  }
+
+  assertPromiseResult(one(), assertUnreachable, e => {
+    assertInstanceof(e, Error);
+    assertMatches(/Error.+at two.+at async one/ms, e.stack);
+  });
+})();
@@ -0,0 +1,27 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --concurrent-sparkplug
+// Flags: --baseline-batch-compilation --baseline-batch-compilation-threshold=0
+// Flags: --interrupt-budget-factor-for-feedback-allocation=1
+// Flags: --no-always-opt --allow-natives-syntax
+
+// Baseline code is compiled on a background thread and installed at the next
+// interrupt check. Whichever tier ends up running, the results must match.
+function MakeFunction(i) {
+  return new Function('a', 'b', `
+    let sum = ${i};
+    for (let k = 0; k < a; k++) sum += b;
+    return sum;
+  `);
+}
+
+const functions = [];
+for (let i = 0; i < 50; i++) functions.push(MakeFunction(i));
+
+for (let iteration = 0; iteration < 100; iteration++) {
+  for (let i = 0; i < functions.length; i++) {
+    assertEquals(i + 10 * iteration, functions[i](10, iteration));
+  }
+}
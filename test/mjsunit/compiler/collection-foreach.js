@@ -0,0 +1,162 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+
+// Map.prototype.forEach and Set.prototype.forEach are inlined into optimized
+// code. Check that they follow the same iteration order as the builtins when
+// the collection is modified from the callback, and resume correctly after a
+// lazy deopt from within the callback.
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  f(...args);
+  %OptimizeFunctionOnNextCall(f);
+  return f(...args);
+}
+
+// Plain iteration.
+(function() {
+  function sumMap(map) {
+    let sum = 0;
+    map.forEach((value, key, m) => {
+      assertSame(map, m);
+      sum += key * value;
+    });
+    return sum;
+  }
+  function sumSet(set) {
+    let sum = 0;
+    set.forEach((value, key, s) => {
+      assertSame(set, s);
+      assertSame(key, value);
+      sum += value;
+    });
+    return sum;
+  }
+
+  const map = new Map([[1, 2], [3, 4], [5, 6]]);
+  const set = new Set([1, 2, 3, 4]);
+  assertEquals(44, optimize(sumMap, map));
+  assertOptimized(sumMap);
+  assertEquals(10, optimize(sumSet, set));
+  assertOptimized(sumSet);
+  assertEquals(0, sumMap(new Map));
+  assertEquals(0, sumSet(new Set));
+})();
+
+// The thisArg and non-callable callbacks.
+(function() {
+  function forEach(map, callback, thisArg) {
+    const result = [];
+    map.forEach(function(value) { result.push(callback.call(this, value)); },
+                thisArg);
+    return result;
+  }
+  const receiver = {};
+  assertEquals([1, 2], optimize(forEach, new Map([['a', 1], ['b', 2]]),
+                                 function(value) {
+                                   assertSame(receiver, this);
+                                   return value;
+                                 },
+                                 receiver));
+
+  function notCallable(set, callback) { set.forEach(callback); }
+  optimize(notCallable, new Set([1]), () => {});
+  assertThrows(() => notCallable(new Set([1]), 1), TypeError);
+})();
+
+// Deleting, adding and clearing entries during the iteration, which also
+// rehashes the table.
+(function() {
+  function visit(map) {
+    const visited = [];
+    map.forEach((value, key) => {
+      visited.push(key);
+      if (key === 0) {
+        map.delete(1);
+        for (let i = 10; i < 30; i++) map.set(i, i);
+      }
+      if (key === 12) map.clear();
+      if (key === 2) map.set(key, value);
+    });
+    return visited;
+  }
+  const expected = [0, 2, 3, 10, 11, 12];
+  const makeMap = () => new Map([[0, 0], [1, 1], [2, 2], [3, 3]]);
+  %PrepareFunctionForOptimization(visit);
+  assertEquals(expected, visit(makeMap()));
+  assertEquals(expected, visit(makeMap()));
+  %OptimizeFunctionOnNextCall(visit);
+  assertEquals(expected, visit(makeMap()));
+  assertOptimized(visit);
+
+  function visitSet(set) {
+    const visited = [];
+    set.forEach(value => {
+      visited.push(value);
+      if (value === 'a') {
+        set.delete('b');
+        set.add('d');
+      }
+    });
+    return visited;
+  }
+  const makeSet = () => new Set(['a', 'b', 'c']);
+  assertEquals(['a', 'c', 'd'], optimize(visitSet, makeSet()));
+  assertOptimized(visitSet);
+})();
+
+// Lazy deopt from the callback continues the iteration in the builtin.
+(function() {
+  let deopt = false;
+  function forEach(map) {
+    const visited = [];
+    map.forEach((value, key) => {
+      visited.push(key);
+      if (deopt && key === 'b') {
+        map.delete('c');
+        map.set('d', 4);
+        %DeoptimizeFunction(forEach);
+      }
+    });
+    return visited;
+  }
+  const makeMap = () => new Map([['a', 1], ['b', 2], ['c', 3]]);
+  assertEquals(['a', 'b', 'c'], optimize(forEach, makeMap()));
+  deopt = true;
+  assertEquals(['a', 'b', 'd'], forEach(makeMap()));
+  assertUnoptimized(forEach);
+
+  let deoptSet = false;
+  function forEachSet(set) {
+    let sum = 0;
+    set.forEach(value => {
+      sum += value;
+      if (deoptSet && value === 2) %DeoptimizeFunction(forEachSet);
+    });
+    return sum;
+  }
+  assertEquals(6, optimize(forEachSet, new Set([1, 2, 3])));
+  deoptSet = true;
+  assertEquals(6, forEachSet(new Set([1, 2, 3])));
+})();
+
+// Exceptions thrown by the callback.
+(function() {
+  function forEach(set) {
+    try {
+      set.forEach(value => {
+        if (value === 2) throw value;
+      });
+    } catch (e) {
+      return e;
+    }
+    return 0;
+  }
+  assertEquals(2, optimize(forEach, new Set([1, 2, 3])));
+  assertOptimized(forEach);
+  assertEquals(0, forEach(new Set([1, 3])));
+})();
@@ -0,0 +1,25 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --concurrent-osr
+// Flags: --concurrent-recompilation --no-always-opt
+
+// The OSR request at the first armed back edge only queues a background job.
+// Once the job is finalized, the next back edge enters the OSR code.
+function f() {
+  let sum = 0;
+  let status = 0;
+  for (let i = 0; i < 20; i++) {
+    if (i == 5) %OptimizeOsr();
+    if (i == 10) %FinalizeOptimization();
+    status = %GetOptimizationStatus(f);
+    sum += i;
+  }
+  return [sum, status];
+}
+
+%PrepareFunctionForOptimization(f);
+const [sum, status] = f();
+assertEquals(190, sum);
+assertTrue((status & V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0);
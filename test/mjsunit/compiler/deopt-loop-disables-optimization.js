@@ -0,0 +1,35 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --max-deopts-before-disabling-optimization=2
+
+function f(x) {
+  return x + 1;
+}
+
+%PrepareFunctionForOptimization(f);
+f(1);
+%OptimizeFunctionOnNextCall(f);
+f(1);
+assertOptimized(f);
+// First deoptimization: a string operand.
+f('a');
+assertUnoptimized(f);
+
+%PrepareFunctionForOptimization(f);
+f(1);
+%OptimizeFunctionOnNextCall(f);
+f(1);
+assertOptimized(f);
+// Second deoptimization: an object operand.
+f({});
+assertUnoptimized(f);
+
+// Optimization is now disabled for f.
+%PrepareFunctionForOptimization(f);
+f(1);
+%OptimizeFunctionOnNextCall(f);
+f(1);
+assertUnoptimized(f);
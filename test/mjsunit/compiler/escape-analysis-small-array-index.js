@@ -0,0 +1,35 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// Loads from small non-escaping arrays with a variable index are turned into
+// selects over the element values.
+
+function sum3(a, b, c) {
+  const tuple = [a, b, c];
+  let result = 0;
+  for (let i = 0; i < 3; i++) result += tuple[i];
+  return result;
+}
+
+function pick4(a, b, c, d, i) {
+  const tuple = [a, b, c, d];
+  return tuple[i & 3];
+}
+
+%PrepareFunctionForOptimization(sum3);
+assertEquals(6, sum3(1, 2, 3));
+assertEquals(6, sum3(1, 2, 3));
+%OptimizeFunctionOnNextCall(sum3);
+assertEquals(6, sum3(1, 2, 3));
+assertEquals(1.5, sum3(0.5, 0.5, 0.5));
+assertEquals("abc", sum3("a", "b", "c").substring(1));
+
+%PrepareFunctionForOptimization(pick4);
+for (let i = 0; i < 4; i++) assertEquals(i + 10, pick4(10, 11, 12, 13, i));
+%OptimizeFunctionOnNextCall(pick4);
+for (let i = 0; i < 8; i++) {
+  assertEquals((i & 3) + 10, pick4(10, 11, 12, 13, i));
+}
@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-bounds-check-elimination
+
+(function TestLoopConditionOnLength() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  const a = new Int32Array([1, 2, 3, 4, 5]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(15, sum(a));
+  assertEquals(15, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(15, sum(a));
+  assertEquals(0, sum(new Int32Array(0)));
+  assertEquals(3, sum(new Int32Array([1, 2])));
+})();
+
+(function TestCapturedLength() {
+  function scale(a, k) {
+    const n = a.length;
+    for (let i = 0; i < n; i++) a[i] *= k;
+    return a;
+  }
+  %PrepareFunctionForOptimization(scale);
+  assertEquals([2, 4, 6], Array.from(scale(new Float32Array([1, 2, 3]), 2)));
+  %OptimizeFunctionOnNextCall(scale);
+  assertEquals([3, 6, 9], Array.from(scale(new Float32Array([1, 2, 3]), 3)));
+})();
+
+(function TestUnrelatedBoundStillChecked() {
+  // The loop bound is not the array length, so the check has to stay and the
+  // out-of-bounds read has to produce undefined.
+  function read(a, n) {
+    let last;
+    for (let i = 0; i < n; i++) last = a[i];
+    return last;
+  }
+  const a = new Int32Array([7, 8, 9]);
+  %PrepareFunctionForOptimization(read);
+  assertEquals(9, read(a, 3));
+  %OptimizeFunctionOnNextCall(read);
+  assertEquals(9, read(a, 3));
+  assertEquals(undefined, read(a, 4));
+})();
@@ -0,0 +1,25 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+// Flags: --turbo-top-tier-regalloc-max-virtual-registers=0
+
+// Every function exceeds the virtual register limit, so TurboFan has to use
+// the mid-tier register allocator and still produce correct code.
+function f(a, b, c) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i] * b + (i & 1 ? c : -c);
+  }
+  return sum;
+}
+
+const input = [1, 2, 3, 4, 5];
+%PrepareFunctionForOptimization(f);
+assertEquals(44, f(input, 3, 1));
+assertEquals(44, f(input, 3, 1));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(44, f(input, 3, 1));
+assertOptimized(f);
+assertEquals(35.5, f(input, 2.5, 2));
@@ -0,0 +1,108 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Named loads and {in} checks on proxies call the proxy builtins directly in
+// optimized code.
+
+(function TestLoad() {
+  const log = [];
+  const handler = {
+    get(target, name, receiver) {
+      log.push(name);
+      return name === 'x' ? 42 : target[name];
+    }
+  };
+  const proxy = new Proxy({y: 1}, handler);
+
+  function load(o) { return o.x + o.y; }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(43, load(proxy));
+  assertEquals(43, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  log.length = 0;
+  assertEquals(43, load(proxy));
+  assertOptimized(load);
+  assertEquals(['x', 'y'], log);
+
+  // The trap is looked up on every access.
+  handler.get = () => 1;
+  assertEquals(2, load(proxy));
+  delete handler.get;
+  assertNaN(load(proxy));
+  assertOptimized(load);
+
+  // Other receivers deoptimize.
+  assertEquals(3, load({x: 1, y: 2}));
+  assertUnoptimized(load);
+})();
+
+(function TestLoadInvariants() {
+  const target = {};
+  Object.defineProperty(target, 'x', {value: 1, configurable: false});
+  const proxy = new Proxy(target, {get() { return 2; }});
+
+  function load(o) {
+    try {
+      return o.x;
+    } catch (e) {
+      return e.constructor;
+    }
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(TypeError, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(TypeError, load(proxy));
+  assertOptimized(load);
+})();
+
+(function TestRevoked() {
+  const {proxy, revoke} = Proxy.revocable({x: 1}, {});
+
+  function load(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load(proxy));
+  revoke();
+  assertThrows(() => load(proxy), TypeError);
+})();
+
+(function TestHas() {
+  const log = [];
+  const proxy = new Proxy({}, {
+    has(target, name) {
+      log.push(name);
+      return name === 'x';
+    }
+  });
+
+  function has(o) { return 'x' in o; }
+
+  %PrepareFunctionForOptimization(has);
+  assertTrue(has(proxy));
+  assertTrue(has(proxy));
+  %OptimizeFunctionOnNextCall(has);
+  log.length = 0;
+  assertTrue(has(proxy));
+  assertOptimized(has);
+  assertEquals(['x'], log);
+  assertFalse(has({}));
+})();
+
+(function TestCallableProxy() {
+  const proxy = new Proxy(function() {}, {get: () => 7});
+
+  function load(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(7, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(7, load(proxy));
+  assertOptimized(load);
+})();
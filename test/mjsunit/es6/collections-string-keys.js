@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Map and Set lookups with string keys skip candidates whose hash differs.
+// Check that keys in different string representations are still found.
+
+function flat(s) {
+  return %FlattenString(s);
+}
+
+const kCount = 1000;
+const map = new Map();
+const set = new Set();
+for (let i = 0; i < kCount; i++) {
+  // Mix array index strings, short strings and cons strings.
+  const key = i % 3 == 0 ? String(i) :
+      i % 3 == 1 ? 'k' + i : 'a long prefix for a cons string key ' + i;
+  map.set(key, i);
+  set.add(key);
+}
+assertEquals(kCount, map.size);
+
+for (let i = 0; i < kCount; i++) {
+  // Look up with freshly built strings that have no computed hash, and with
+  // flattened copies.
+  const key = i % 3 == 0 ? String(i) :
+      i % 3 == 1 ? 'k' + i : 'a long prefix for a cons string key ' + i;
+  assertEquals(i, map.get(key));
+  assertTrue(set.has(key));
+  assertEquals(i, map.get(flat(key)));
+  assertTrue(map.has('' + key));
+  assertFalse(map.has(key + ' '));
+  assertFalse(set.has(key.substring(1)));
+}
+
+// Deleting and re-adding with a different string object keeps one entry.
+for (let i = 0; i < kCount; i += 2) {
+  assertTrue(map.delete('k' + i) || map.delete(String(i)) ||
+             map.delete('a long prefix for a cons string key ' + i));
+}
+assertEquals(kCount / 2, map.size);
+map.set(flat('k' + 1), -1);
+assertEquals(kCount / 2, map.size);
+assertEquals(-1, map.get('k1'));
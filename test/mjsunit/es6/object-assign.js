@@ -285,3 +285,22 @@ assertSame(Object.assign(o, {}), o);
   }
 
 })();
+
+(function testDictionaryModeSource() {
+  const source = {a: 1, b: 2, c: 3, [Symbol.iterator]: 4};
+  delete source.b;
+  assertFalse(%HasFastProperties(source));
+  Object.defineProperty(source, 'hidden', {value: 5, enumerable: false});
+  Object.defineProperty(source, 'getter', {
+    get() { delete this.later; return 6; },
+    enumerable: true
+  });
+  source.later = 7;
+  source[3] = 8;
+  const result = Object.assign({}, source);
+  assertEquals(['3', 'a', 'c', 'getter'], Object.keys(result));
+  assertEquals(6, result.getter);
+  assertEquals(4, result[Symbol.iterator]);
+  assertFalse('hidden' in result);
+  assertFalse('later' in result);
+})();
@@ -409,3 +409,32 @@ function TestElementKinds(withWarmup) {
 
 TestElementKinds();
 TestElementKinds(true);
+
+function TestNonEnumerableAccessorAndElements() {
+  let getter_calls = 0;
+  function make(i) {
+    let o = {a: i, b: 'x'};
+    Object.defineProperty(o, 'hidden', {
+      get() { getter_calls++; return 0; },
+      enumerable: false
+    });
+    o.c = i + 1;
+    return o;
+  }
+  for (let i = 0; i < 5; ++i) {
+    // Warm up the enum cache, then take the cached path.
+    for (const key in make(i)) {}
+    assertEquals([['a', i], ['b', 'x'], ['c', i + 1]], Object.entries(make(i)));
+    assertEquals([i, 'x', i + 1], Object.values(make(i)));
+  }
+  assertEquals(0, getter_calls);
+
+  let with_elements = {0: 'zero', 1: 'one', a: 1, [Symbol()]: 2, b: 2};
+  for (const key in with_elements) {}
+  for (let i = 0; i < 3; ++i) {
+    assertEquals([['0', 'zero'], ['1', 'one'], ['a', 1], ['b', 2]],
+                 Object.entries(with_elements));
+    assertEquals(['zero', 'one', 1, 2], Object.values(with_elements));
+  }
+}
+TestNonEnumerableAccessorAndElements();
@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --enable-mega-dom-ic --mega-dom-ic-map-threshold=2
+// Flags: --max-valid-polymorphic-map-count=16 --allow-natives-syntax
+
+// With a MegaDOM threshold below the polymorphism limit, API accessor sites
+// switch to the MegaDOM state as soon as they see a second receiver map.
+
+function makeDivs(count) {
+  const divs = [];
+  for (let i = 0; i < count; i++) {
+    const div = new d8.dom.Div();
+    div['p' + i] = i;
+    divs.push(div);
+  }
+  return divs;
+}
+
+function load(obj) {
+  return obj.nodeType;
+}
+%PrepareFunctionForOptimization(load);
+
+const divs = makeDivs(8);
+function test(objs) {
+  let result = 0;
+  for (const obj of objs) result += load(obj);
+  return result;
+}
+%PrepareFunctionForOptimization(test);
+assertEquals(8, test(divs));
+assertEquals(8, test(divs));
+
+// Receivers that are not API objects still work after the upgrade.
+assertEquals(undefined, load({}));
+assertEquals('foo', load({nodeType: 'foo'}));
+assertEquals(8, test(divs));
+
+%OptimizeFunctionOnNextCall(test);
+assertEquals(8, test(divs));
+
+// A site that saw a receiver the accessor does not accept must not be
+// upgraded, otherwise that receiver would fail the signature check.
+function load2(obj) {
+  return obj.nodeType;
+}
+%PrepareFunctionForOptimization(load2);
+const plain = {nodeType: 'plain'};
+assertEquals('plain', load2(plain));
+for (const div of divs) assertEquals(1, load2(div));
+assertEquals('plain', load2(plain));
@@ -0,0 +1,59 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition-trim-generator-registers
+
+(function testGeneratorLocalsAcrossYields() {
+  function* gen(n) {
+    let a = n + 1;
+    let dead = [n, n, n];
+    yield dead.length;
+    let b = a * 2;
+    yield a;
+    try {
+      let c = yield b;
+      yield c + a + b;
+    } finally {
+      yield 'finally ' + a;
+    }
+  }
+  for (let i = 0; i < 3; ++i) {
+    const g = gen(i);
+    assertEquals(3, g.next().value);
+    assertEquals(i + 1, g.next().value);
+    assertEquals((i + 1) * 2, g.next().value);
+    assertEquals(10 + (i + 1) * 3, g.next(10).value);
+    assertEquals('finally ' + (i + 1), g.next().value);
+    assertTrue(g.next().done);
+  }
+})();
+
+(function testThrowIntoGenerator() {
+  function* gen(x) {
+    let keep = {x};
+    try {
+      yield 1;
+    } catch (e) {
+      yield e + keep.x;
+    }
+  }
+  const g = gen(5);
+  g.next();
+  assertEquals(7, g.throw(2).value);
+})();
+
+(function testAsyncFunction() {
+  async function f(x) {
+    let sum = 0;
+    for (let i = 0; i < x; ++i) {
+      let tmp = {i};
+      sum += await tmp.i;
+    }
+    return sum;
+  }
+  let result;
+  f(5).then(v => result = v);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(10, result);
+})();
@@ -0,0 +1,55 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-opt --no-sparkplug
+
+// Test bytecodes followed by JumpIfTrue/JumpIfFalse are dispatched together
+// by the interpreter. Exercise both branch directions for each test.
+
+function Compare(a, b) {
+  let result = '';
+  if (a == b) result += 'eq ';
+  if (a === b) result += 'seq ';
+  if (a < b) result += 'lt ';
+  if (a > b) result += 'gt ';
+  if (a <= b) result += 'le ';
+  if (a >= b) result += 'ge ';
+  return result;
+}
+
+assertEquals('eq seq le ge ', Compare(1, 1));
+assertEquals('lt le ', Compare(1, 2));
+assertEquals('gt ge ', Compare(2, 1));
+assertEquals('eq le ge ', Compare(1, '1'));
+assertEquals('', Compare(NaN, NaN));
+
+function Classify(x) {
+  if (x === null) return 'null';
+  if (x === undefined) return 'undefined';
+  if (typeof x == 'number') return 'number';
+  if (x instanceof Array) return 'array';
+  if ('key' in x) return 'keyed';
+  return 'other';
+}
+
+for (let i = 0; i < 3; i++) {
+  assertEquals('null', Classify(null));
+  assertEquals('undefined', Classify(undefined));
+  assertEquals('number', Classify(1));
+  assertEquals('array', Classify([]));
+  assertEquals('keyed', Classify({key: 1}));
+  assertEquals('other', Classify({}));
+}
+
+// Loops whose condition is a test directly followed by a conditional jump.
+function Count(n) {
+  let count = 0;
+  for (let i = 0; i < n; i++) {
+    if (i % 3 == 0) continue;
+    count++;
+  }
+  return count;
+}
+assertEquals(0, Count(0));
+assertEquals(66, Count(100));
@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// One-byte JSON strings are scanned a word at a time. Put quotes, escapes and
+// control characters at every offset of a word to check that none are
+// skipped.
+
+const kFiller = 'abcdefghijklmnopqrstuvwxyz\xe9\xff0123456789';
+
+for (let length = 0; length < 40; length++) {
+  const plain = kFiller.substring(0, length);
+  assertEquals(plain, JSON.parse(`"${plain}"`));
+  assertEquals({[plain]: plain}, JSON.parse(`{"${plain}":"${plain}"}`));
+
+  for (let i = 0; i <= length; i++) {
+    const before = plain.substring(0, i);
+    const after = plain.substring(i);
+    assertEquals(before + '"' + after, JSON.parse(`"${before}\\"${after}"`));
+    assertEquals(before + '\n' + after, JSON.parse(`"${before}\\n${after}"`));
+    assertEquals(
+        before + '€' + after, JSON.parse(`"${before}\\u20ac${after}"`));
+    assertEquals([before, after], JSON.parse(`["${before}","${after}"]`));
+    assertThrows(() => JSON.parse(`"${before}\x01${after}"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${before}\x1f${after}"`), SyntaxError);
+  }
+  assertThrows(() => JSON.parse(`"${plain}`), SyntaxError);
+}
@@ -0,0 +1,42 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// One-byte strings are copied into the JSON output a word at a time up to
+// the next character that needs escaping. Put such characters at every
+// offset of a word and compare against a per-character reference.
+
+function reference(s) {
+  let result = '"';
+  for (const c of s) {
+    const code = c.charCodeAt(0);
+    if (c == '"') result += '\\"';
+    else if (c == '\\') result += '\\\\';
+    else if (c == '\n') result += '\\n';
+    else if (c == '\t') result += '\\t';
+    else if (code < 0x20) {
+      result += '\\u' + code.toString(16).padStart(4, '0');
+    } else {
+      result += c;
+    }
+  }
+  return result + '"';
+}
+
+const kFiller = 'abcdefghijklmnopqrstuvwxyz !#\x7f\xe9\xff0123456789';
+const kSpecials = ['"', '\\', '\n', '\t', '\x01', '\x1f'];
+
+for (let length = 0; length < 40; length++) {
+  const plain = kFiller.substring(0, length);
+  assertEquals(reference(plain), JSON.stringify(plain));
+  for (let i = 0; i <= length; i++) {
+    for (const special of kSpecials) {
+      const s = plain.substring(0, i) + special + plain.substring(i);
+      assertEquals(reference(s), JSON.stringify(s));
+      assertEquals(`{${reference(s)}:${reference(s)}}`,
+                   JSON.stringify({[s]: s}));
+      // Also when the output is two-byte.
+      assertEquals(`["€",${reference(s)}]`, JSON.stringify(['€', s]));
+    }
+  }
+}
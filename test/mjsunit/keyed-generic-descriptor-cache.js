@@ -0,0 +1,72 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// The generic keyed load and store builtins consult the DescriptorLookupCache
+// for maps with many own descriptors. Exercise hits, negative results and
+// entries that must not survive map changes or GC.
+
+const kNames = [];
+for (let i = 0; i < 40; i++) kNames.push('p' + i);
+
+function makeObject(shape) {
+  // Use a literal so that the object keeps fast properties.
+  const properties = kNames.map(
+      (name, i) => `${name}${i % 4 == shape ? 'x' : ''}: ${i * 10 + shape}`);
+  const o = eval(`({${properties.join(', ')}})`);
+  assertTrue(%HasFastProperties(o));
+  return o;
+}
+
+function load(o, key) {
+  return o[key];
+}
+function store(o, key, value) {
+  o[key] = value;
+}
+%NeverOptimizeFunction(load);
+%NeverOptimizeFunction(store);
+
+const objects = [];
+for (let shape = 0; shape < 4; shape++) objects.push(makeObject(shape));
+
+function check(offset) {
+  for (let round = 0; round < 3; round++) {
+    for (let shape = 0; shape < objects.length; shape++) {
+      const o = objects[shape];
+      for (let i = 0; i < kNames.length; i++) {
+        const renamed = i % 4 == shape;
+        const value = offset(i) + shape;
+        assertEquals(renamed ? undefined : value, load(o, kNames[i]));
+        assertEquals(renamed ? value : undefined, load(o, kNames[i] + 'x'));
+      }
+      assertEquals(undefined, load(o, 'missing'));
+    }
+  }
+}
+
+check(i => i * 10);
+
+// Stores to existing fields go through the same lookup.
+for (let shape = 0; shape < objects.length; shape++) {
+  const o = objects[shape];
+  for (let i = 0; i < kNames.length; i++) {
+    const key = kNames[i] + (i % 4 == shape ? 'x' : '');
+    store(o, key, -i * 10 + shape);
+  }
+}
+check(i => -i * 10);
+
+// Adding a property changes the map; negative results for the old map must
+// not be reused for the new one.
+const o = objects[0];
+assertEquals(undefined, load(o, 'added'));
+store(o, 'added', 42);
+assertTrue(%HasFastProperties(o));
+assertEquals(42, load(o, 'added'));
+
+gc();
+check(i => -i * 10);
+assertEquals(42, load(o, 'added'));
@@ -0,0 +1,63 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// Megamorphic keyed stores that add properties cache the transition target
+// in the store stub cache. Check that cached transitions produce the same
+// objects as uncached ones and respect later changes to the prototype chain.
+
+function store(o, key, value) {
+  o[key] = value;
+}
+%NeverOptimizeFunction(store);
+
+const kKeys = ['alpha', 'beta', 'gamma', 'delta', 'epsilon', 'zeta'];
+
+function build(proto, shape) {
+  const o = Object.create(proto);
+  store(o, 'shape' + shape, shape);
+  for (const key of kKeys) store(o, key, key + shape);
+  return o;
+}
+
+function checkObject(o, shape) {
+  assertEquals(shape, o['shape' + shape]);
+  assertEquals(['shape' + shape, ...kKeys], Object.keys(o));
+  for (const key of kKeys) assertEquals(key + shape, o[key]);
+  assertTrue(%HasFastProperties(o));
+}
+
+// Make the store megamorphic and build the same shapes repeatedly.
+const proto = {};
+for (let round = 0; round < 5; round++) {
+  for (let shape = 0; shape < 8; shape++) {
+    const o = build(proto, shape);
+    checkObject(o, shape);
+    if (round > 0) assertTrue(%HaveSameMap(o, build(proto, shape)));
+  }
+}
+
+// A setter added to the prototype after the transitions were cached must be
+// called instead of following the transition.
+const calls = [];
+Object.defineProperty(proto, 'gamma', {
+  set(value) { calls.push(value); },
+  configurable: true
+});
+const o = build(proto, 3);
+assertEquals(['gamma3'], calls);
+assertFalse(o.hasOwnProperty('gamma'));
+
+// Same for a read-only property.
+delete proto.gamma;
+Object.defineProperty(proto, 'delta', {value: 'fixed', writable: false});
+const p = build(proto, 4);
+assertEquals('fixed', p.delta);
+assertFalse(p.hasOwnProperty('delta'));
+
+// Cached entries do not survive GC, rebuilding afterwards still works.
+gc();
+const fresh = {};
+for (let shape = 0; shape < 8; shape++) checkObject(build(fresh, shape), shape);
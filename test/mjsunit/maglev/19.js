@@ -0,0 +1,22 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --opt
+
+// Maglev doesn't support array literals yet. A failed Maglev compile must not
+// keep the function from tiering up to TurboFan.
+function f(x) {
+  return [x, x + 1];
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals([1, 2], f(1));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals([2, 3], f(2));
+assertUnoptimized(f);
+
+%OptimizeFunctionOnNextCall(f);
+assertEquals([3, 4], f(3));
+assertOptimized(f);
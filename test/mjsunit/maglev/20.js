@@ -0,0 +1,27 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+class Point {
+  constructor(x) { this.x_ = x; }
+  x() { return this.x_; }
+}
+
+// The call to the getter is inlined as a map check and a field load.
+function f(p) {
+  return p.x();
+}
+
+const p = new Point(1);
+%PrepareFunctionForOptimization(f);
+assertEquals(1, f(p));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals(1, f(p));
+assertEquals(2, f(new Point(2)));
+
+// A different receiver map deopts back to the generic call.
+const q = { x() { return 3; } };
+assertEquals(3, f(q));
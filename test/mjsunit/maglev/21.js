@@ -0,0 +1,25 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+// With Smi feedback the loop counter stays a Smi without calling into the
+// Increment and LessThan builtins.
+function f(n) {
+  let i = 0;
+  while (i < n) {
+    i++;
+  }
+  return i;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(10, f(10));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals(10, f(10));
+assertEquals(0, f(-1));
+
+// Non-Smi inputs deopt and take the generic path.
+assertEquals(1.5, f(1.5) - 0.5);
@@ -0,0 +1,64 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lazily compiled functions in a module with many module variables look them
+// up through a hash-sorted table instead of a linear scan.
+
+import * as self from "modules-many-module-variables.mjs";
+
+export let v0 = 0;
+export let v1 = 1;
+export let v2 = 2;
+export let v3 = 3;
+export let v4 = 4;
+export let v5 = 5;
+export let v6 = 6;
+export let v7 = 7;
+export let v8 = 8;
+export let v9 = 9;
+export let v10 = 10;
+export let v11 = 11;
+export let v12 = 12;
+export let v13 = 13;
+export let v14 = 14;
+export let v15 = 15;
+export let v16 = 16;
+export let v17 = 17;
+export let v18 = 18;
+export let v19 = 19;
+export let v20 = 20;
+export let v21 = 21;
+export let v22 = 22;
+export let v23 = 23;
+export let v24 = 24;
+export let v25 = 25;
+export let v26 = 26;
+export let v27 = 27;
+export let v28 = 28;
+export let v29 = 29;
+export let v30 = 30;
+export let v31 = 31;
+export let v32 = 32;
+export let v33 = 33;
+export let v34 = 34;
+export let v35 = 35;
+export let v36 = 36;
+export let v37 = 37;
+export let v38 = 38;
+export let v39 = 39;
+
+function sum() {
+  return v0 + v8 + v16 + v24 + v32;
+}
+
+function update() {
+  v39 = 100;
+  return typeof Math + typeof notDefinedAnywhere;
+}
+
+assertEquals(0 + 8 + 16 + 24 + 32, sum());
+assertEquals('objectundefined', update());
+assertEquals(100, v39);
+assertEquals(100, self.v39);
+assertEquals(7, (() => v7)());
@@ -0,0 +1,7 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+export * from "modules-skip-star-exports-diamond-inner.mjs";
+export * from "modules-skip-star-exports-diamond-left.mjs";
+export const right = "right";
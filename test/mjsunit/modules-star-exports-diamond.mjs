@@ -0,0 +1,22 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Several importers resolve names through star exports that share a
+// sub-graph, so failed lookups in the shared part are answered from the
+// per-instantiation cache.
+import {a, left} from "modules-skip-star-exports-diamond-left.mjs";
+import {a as a2, b, inner, left as left2, right}
+    from "modules-skip-star-exports-diamond-right.mjs";
+import * as ns from "modules-skip-star-exports-diamond-right.mjs";
+import * as inner_ns from "modules-skip-star-exports-diamond-inner.mjs";
+
+assertEquals(1, a);
+assertEquals(1, a2);
+assertEquals(2, b);
+assertEquals("inner", inner);
+assertEquals("left", left);
+assertEquals("left", left2);
+assertEquals("right", right);
+assertEquals(["a", "b", "inner", "left", "right"], Object.keys(ns));
+assertEquals(["a", "b", "inner"], Object.keys(inner_ns));
@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --lazy-compile-dispatcher --parallel-compile-tasks-for-eager-toplevel
+// Flags: --parallel-compile-tasks-for-lazy --parallel-compile-eval-min-length=0
+
+var outer_var = 42;
+
+var f = new Function('a', 'b', `
+  function lazy_inner(x) { return x + outer_var; }
+  var eager_inner = (function(x) { return x * 2; });
+  return lazy_inner(a) + eager_inner(b);
+`);
+assertEquals(42 + 1 + 4, f(1, 2));
+assertEquals(42 + 1 + 4, f(1, 2));
+
+// Two-byte source.
+var g = new Function('s', `
+  var suffix = "☃";
+  return (function(x) { return x + suffix; })(s);
+`);
+assertEquals('snow☃', g('snow'));
+
+var h = eval(`(function() {
+  function lazy_inner() { return outer_var + 1; }
+  return lazy_inner;
+})()`);
+assertEquals(43, h());
+
+// Same source again hits the eval cache.
+var f2 = new Function('a', 'b', `
+  function lazy_inner(x) { return x + outer_var; }
+  var eager_inner = (function(x) { return x * 2; });
+  return lazy_inner(a) + eager_inner(b);
+`);
+assertEquals(47, f2(1, 2));
@@ -0,0 +1,51 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --streaming-compile --parallel-compile-tasks-for-streaming
+
+// Top-level IIFEs of a streamed script are compiled by parallel tasks; they
+// must still see the variables of the script scope and each other.
+
+var outer_var = 42;
+
+function lazy_outer() {
+ return outer_var;
+}
+
+var module_a = (function(exports) {
+ exports.value = outer_var;
+ exports.get = function() { return lazy_outer(); };
+ return exports;
+})({});
+
+var module_b = (function(a, ...rest) {
+ return { sum: rest.reduce((x, y) => x + y, a.value) };
+})(module_a, 1, 2, 3);
+
+assertEquals(42, module_a.value);
+assertEquals(42, module_a.get());
+assertEquals(48, module_b.sum);
+
+var gen = (function*() {
+ yield 1;
+ yield 2;
+})();
+
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+
+var result = (function recursive(a=0) {
+ if (a == 3) return a;
+ return recursive(a + 1);
+})();
+
+assertEquals(3, result);
+
+(function() {
+ let inner = 1;
+ (function() {
+   inner++;
+ })();
+ assertEquals(2, inner);
+})();
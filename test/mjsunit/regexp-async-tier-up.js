@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1 --regexp-async-tier-up
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+// With --regexp-async-tier-up, the interpreter keeps running until a task has
+// compiled and installed the native code.
+
+const kLatin1 = true;
+const kUnicode = false;
+
+function IsInterpreted(regexp, is_latin1) {
+  return %RegexpHasBytecode(regexp, is_latin1);
+}
+
+function IsTieredUp(regexp, is_latin1) {
+  return !%RegexpHasBytecode(regexp, is_latin1) &&
+         %RegexpHasNativeCode(regexp, is_latin1);
+}
+
+const re = /(a+|b+)c/;
+
+// The first execution uses up the tier-up ticks.
+assertEquals(['aac', 'aa'], re.exec('aac'));
+assertTrue(IsInterpreted(re, kLatin1));
+
+// The next ones post the tier-up task and keep interpreting.
+assertEquals(['bbc', 'bb'], re.exec('bbc'));
+assertTrue(IsInterpreted(re, kLatin1));
+assertNull(re.exec('abab'));
+assertTrue(IsInterpreted(re, kLatin1));
+
+// Two-byte subjects are interpreted too until then.
+assertEquals(['bc', 'b'], re.exec('π bc'));
+assertTrue(IsInterpreted(re, kUnicode));
+
+// Long subjects still tier up right away.
+const long_re = /(a+|b+)d/;
+assertEquals(['ad', 'a'], long_re.exec('ad'));
+assertEquals(['bd', 'b'], long_re.exec('x'.repeat(1000) + 'bd'));
+assertTrue(IsTieredUp(long_re, kLatin1));
+
+setTimeout(() => {
+  // The task has compiled both encodings.
+  assertTrue(IsTieredUp(re, kLatin1));
+  assertTrue(IsTieredUp(re, kUnicode));
+  assertEquals(['aac', 'aa'], re.exec('aac'));
+  assertEquals(['bc', 'b'], re.exec('π bc'));
+  assertNull(re.exec('abab'));
+}, 0);
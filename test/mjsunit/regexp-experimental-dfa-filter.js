@@ -0,0 +1,88 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-dfa-filter
+
+// The experimental engine skips searches that can't succeed, and the part of
+// the subject before the next match, using a lazily built DFA. Check that
+// results are unaffected, including for programs whose DFA grows too large
+// and for the cases not handled by the DFA.
+
+function Test(regexp, subject, expected) {
+  assertEquals("EXPERIMENTAL", %RegexpTypeTag(regexp));
+  if (regexp.global) {
+    assertEquals(expected, subject.match(regexp));
+  } else {
+    const result = regexp.exec(subject);
+    assertEquals(expected, result === null ? null : [...result]);
+  }
+}
+
+const longNoMatch = 'x'.repeat(10000);
+
+// No match at all.
+Test(/abc/, longNoMatch, null);
+Test(/a|b|c/, longNoMatch, null);
+Test(/(?:ab)*c/, 'ab'.repeat(1000), null);
+Test(/\d+x/, '12345'.repeat(100), null);
+Test(/(a)(b)?c/, longNoMatch + 'abab', null);
+Test(/abc/y, 'xabc', null);
+
+// Matches at the end of a long input.
+Test(/abc/, longNoMatch + 'abc', ['abc']);
+Test(/(a)(b)?c/, longNoMatch + 'ac', ['ac', 'a', undefined]);
+Test(/x{3}y/, longNoMatch + 'y', ['xxxy']);
+
+// Late matches whose start is found by the DFA, with earlier partial matches.
+Test(/(a+)(b)/, 'a'.repeat(50) + longNoMatch + 'aab', ['aab', 'aa', 'b']);
+Test(/(a|ab)(c|bcd)/, longNoMatch + 'abcd', ['abcd', 'a', 'bcd']);
+Test(/a(?:b|bc)?c/, 'abab' + longNoMatch + 'ababcc', ['abc']);
+Test(/x(y+)/g, 'xyy' + ' '.repeat(5000) + 'xy', ['xyy', 'xy']);
+
+// Global matching, with the last search failing.
+Test(/a./g, 'a1b2a3', ['a1', 'a3']);
+Test(/a*/g, 'baab', ['', 'aa', '', '']);
+Test(/[0-9]+/g, 'a1bb22ccc333', ['1', '22', '333']);
+Test(/q/g, longNoMatch, null);
+
+// Empty patterns and zero-length matches.
+Test(new RegExp(''), 'abc', ['']);
+Test(/(?:)/, '', ['']);
+Test(/b*/, 'aaa', ['']);
+
+// Two-byte subjects.
+Test(/쁰d섊/, '123쁰d섊abc', ['쁰d섊']);
+Test(/[가-힣]+/, 'abc한국어def', ['한국어']);
+Test(/[가-힣]+/, 'abc def', null);
+Test(/ /g, 'a b ', [' ', ' ']);
+
+// The DFA for this program has a state for every combination of the last
+// 17 characters, so it is abandoned and the interpreter runs on its own.
+const large = /[ab]*a[ab]{16}c/;
+let largeSubject = '';
+for (let i = 0, seed = 1; i < 20000; i++) {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  largeSubject += seed & 0x10000 ? 'a' : 'b';
+}
+Test(large, largeSubject, null);
+const tail = 'a' + 'b'.repeat(16) + 'c';
+Test(large, largeSubject + tail, [largeSubject + tail]);
+
+// This DFA has more states than fit into the cache, but most of them are
+// visited often enough that the cache is flushed and rebuilt.
+const flushed = /a[ab]{13}c/;
+let flushedSubject = '';
+for (let i = 0, seed = 1; i < 300000; i++) {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  flushedSubject += seed & 0x10000 ? 'a' : 'b';
+}
+Test(flushed, flushedSubject, null);
+Test(flushed, flushedSubject + 'a'.repeat(14) + 'c', ['a'.repeat(14) + 'c']);
+
+// Assertions are not handled by the DFA.
+Test(/^abc$/, 'abc', ['abc']);
+Test(/\bfoo\b/, 'a foo b', ['foo']);
+Test(/^abc/m, 'x\nabc', ['abc']);
+Test(/^abc/, longNoMatch, null);
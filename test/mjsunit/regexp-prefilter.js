@@ -0,0 +1,64 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-prefilter
+
+// Irregexp searches for a literal that every match contains before running
+// the regexp code, rejecting subjects without it and skipping the part of
+// the subject that is too far ahead of it. Check that matches are unaffected.
+
+const pad = 'x'.repeat(1000);
+
+function Test(regexp, subject, expected, expected_index) {
+  const result = regexp.exec(subject);
+  if (expected === null) {
+    assertNull(result);
+    return;
+  }
+  assertEquals(expected, [...result]);
+  assertEquals(expected_index, result.index);
+}
+
+// Required literals after a bounded prefix.
+Test(/(\d{1,3})foo/, pad + '12foo', ['12foo', '12'], 1000);
+Test(/(\d{1,3})foo/, pad + '12fo', null);
+Test(/a.{0,5}foo/, pad + 'a1234foo', ['a1234foo'], 1000);
+Test(/ab(c)(d)e/, pad + 'abcde', ['abcde', 'c', 'd'], 1000);
+Test(/(?:ab|cd)(ef)/, pad + 'cdef', ['cdef', 'ef'], 1000);
+
+// Unbounded prefixes only allow rejecting the subject.
+Test(/a.*foo/, pad + 'a' + pad + 'foo', ['a' + pad + 'foo'], 1000);
+Test(/(?:x\d)+bar/, pad + 'x1x2bar', ['x1x2bar'], 1000);
+Test(/(?:x\d)+bar/, pad + 'x1x2ba', null);
+
+// Assertions and lookbehinds look at the input before the skipped part.
+Test(/(?<=ab)cfoo/, pad + 'abcfoo', ['cfoo'], 1002);
+Test(/^foo/, pad + 'foo', null);
+Test(/^foo/m, pad + '\nfoo', ['foo'], 1001);
+Test(/\bfoo/, pad + 'foo', null);
+Test(/\bfoo/, pad + ' foo', ['foo'], 1001);
+
+// Sticky regexps must match at lastIndex.
+const sticky = /x{0,3}foo/y;
+Test(sticky, pad + 'foo', null);
+sticky.lastIndex = 997;
+Test(sticky, pad + 'foo', ['xxxfoo'], 997);
+const unbounded_sticky = /x*foo/y;
+Test(unbounded_sticky, pad + 'foo', [pad + 'foo'], 0);
+
+// Global regexps, and the runtime paths of replace and split.
+assertEquals(['1foo', '2foo'],
+             (pad + '1foo' + pad + '2foo' + pad).match(/\dfoo/g));
+assertEquals('xa<b>', (pad + 'a1b').replace(/\d(b)/, '<$1>').slice(-5));
+assertEquals([1001, 1, 1002, 1, 0],
+             (pad + 'a1bz' + pad + 'a2b').split(/\d(b)/).map(s => s.length));
+
+// Case-insensitive regexps are not prefiltered.
+Test(/FOO\d/i, pad + 'foo1', ['foo1'], 1000);
+
+// Two-byte subjects and literals.
+Test(/한(국)어/, pad + '한국어', ['한국어', '국'], 1000);
+Test(/한(국)어/, pad + '한국', null);
+Test(/[a-z]한/, '한'.repeat(100) + 'a한', ['a한'], 100);
+Test(/\d한/, pad + '1', null);
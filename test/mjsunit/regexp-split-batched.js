@@ -0,0 +1,54 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long subjects are split by the runtime instead of the builtin. Check that
+// both agree with the spec path, which is taken for modified regexps.
+
+const pad = 'x'.repeat(300);
+
+function SlowSplit(regexp, subject, limit) {
+  const slow = new RegExp(regexp.source, regexp.flags);
+  // An own property takes the regexp off the fast path.
+  slow.exec = RegExp.prototype.exec;
+  return slow[Symbol.split](subject, limit);
+}
+
+function Test(regexp, subject, limit) {
+  assertEquals(SlowSplit(regexp, subject, limit),
+               subject.split(regexp, limit));
+}
+
+const subjects = [
+  pad,
+  pad + ',' + pad,
+  ',' + pad + ',,a,b,' + pad + ',',
+  pad.split('').join(' '),
+  '\u{1F600}'.repeat(200) + 'a' + '\u{1F600}',
+  'ab\uD83Dcd'.repeat(100),
+];
+
+const regexps = [
+  /,/, /,/g, /(,)/, /(,)|(x)/, /x*/, /x*/g, /(?:)/, /(?:)/u, /\s+/, /(\s)?/,
+  /$/, /(?=x)/, /(?<=x)/m, /\uD83D/, /\uD83D/u, /./u, /(a)|b/
+];
+
+for (const subject of subjects) {
+  for (const regexp of regexps) {
+    Test(regexp, subject);
+    Test(regexp, subject, 0);
+    Test(regexp, subject, 1);
+    Test(regexp, subject, 7);
+  }
+}
+
+// The last match info is updated once, with the last match that is not at the
+// end of the subject.
+(pad + 'a1b2c').split(/(\d)/);
+assertEquals('2', RegExp.lastMatch);
+assertEquals('2', RegExp.$1);
+(pad + 'a1b2c').split(/(\d)/, 2);
+assertEquals('1', RegExp.lastMatch);
+'za'.split(/(a)/);
+(pad + 'a1b').split(/(\d)?$/);
+assertEquals('a', RegExp.$1);
@@ -399,6 +399,29 @@ const arrayBufferCtors = [[ArrayBuffer, (b) => b.resizable],
   }
 })();
 
+(function TestRABMemoryInitializedToZeroAfterShrinkAndGrowManyPages() {
+  // Shrinking across page boundaries decommits the tail pages.
+  const page_size = 64 * 1024;
+  const rab = CreateResizableArrayBuffer(8 * page_size, 8 * page_size);
+  const i8a = new Int8Array(rab);
+  for (let i = 0; i < 8 * page_size; i += 512) {
+    i8a[i] = 1;
+  }
+  i8a[8 * page_size - 1] = 1;
+  rab.resize(page_size + 100);
+  assertEquals(1, i8a[page_size]);
+  rab.resize(8 * page_size);
+  assertEquals(1, i8a[page_size]);
+  for (let i = page_size + 100; i < 8 * page_size; ++i) {
+    assertEquals(0, i8a[i]);
+  }
+  rab.resize(0);
+  rab.resize(page_size);
+  for (let i = 0; i < page_size; ++i) {
+    assertEquals(0, i8a[i]);
+  }
+})();
+
 (function TestGSABBasics() {
   const gsab = CreateGrowableSharedArrayBuffer(10, 20);
   assertFalse(gsab instanceof ArrayBuffer);
@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
-// Flags: --shared-string-table --harmony-struct
+// Flags: --shared-string-table --harmony-struct --allow-natives-syntax
 
 "use strict";
 
@@ -52,3 +52,21 @@ let S = new SharedStructType(['field']);
   }
   assertThrows(() => { new SharedStructType(field_names); });
 })();
+
+(function TestOptimizedStores() {
+  function storeSmi(s) { s.field = 42; }
+  function storeValue(s, v) { s.field = v; }
+  %PrepareFunctionForOptimization(storeSmi);
+  %PrepareFunctionForOptimization(storeValue);
+  let s = new S();
+  storeSmi(s);
+  storeValue(s, 1);
+  %OptimizeFunctionOnNextCall(storeSmi);
+  %OptimizeFunctionOnNextCall(storeValue);
+  storeSmi(s);
+  assertEquals(42, s.field);
+  storeValue(s, "foo");
+  assertEquals("foo", s.field);
+  assertThrows(() => storeValue(s, {}));
+  assertEquals("foo", s.field);
+})();
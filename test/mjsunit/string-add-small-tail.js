@@ -0,0 +1,45 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Appending short strings to a rope merges them into its last segment
+// instead of adding a node each time. Check that the result is unchanged,
+// including when one-byte and two-byte pieces are mixed.
+
+function build(pieces) {
+  let s = 'a long enough prefix';
+  for (const piece of pieces) s += piece;
+  return s;
+}
+
+function check(pieces) {
+  const expected = 'a long enough prefix' + pieces.join('');
+  const result = build(pieces);
+  assertEquals(expected.length, result.length);
+  assertEquals(expected, result);
+  for (let i = 0; i < expected.length; i++) {
+    assertEquals(expected.charCodeAt(i), result.charCodeAt(i));
+  }
+}
+
+const oneByte = [];
+const mixed = [];
+const growing = [];
+for (let i = 0; i < 200; i++) {
+  oneByte.push(String.fromCharCode(97 + i % 26));
+  mixed.push(i % 3 == 0 ? '€' : 'x' + i);
+  growing.push('y'.repeat(i % 15));
+}
+
+%PrepareFunctionForOptimization(build);
+for (let i = 0; i < 3; i++) {
+  check(oneByte);
+  check(mixed);
+  check(growing);
+}
+%OptimizeFunctionOnNextCall(build);
+check(oneByte);
+check(mixed);
+check(growing);
@@ -83,3 +83,19 @@ for (var i = 1; i <= 128; i <<= 1); {
     }
   }
 }
+
+// Strings that are already in the requested case, possibly with a late
+// character that still needs conversion.
+(function testUnchangedPrefix() {
+  for (var len = 0; len < 40; len++) {
+    var lower = "content-type: text/html;".repeat(2).substring(0, len);
+    var upper = lower.toUpperCase();
+    assertEquals(lower, lower.toLowerCase());
+    assertEquals(upper, upper.toUpperCase());
+    assertEquals(lower + "x", (lower + "X").toLowerCase());
+    assertEquals(upper + "X", (upper + "x").toUpperCase());
+    assertEquals(lower + "é", (lower + "É").toLowerCase());
+    assertEquals(upper + "É", (upper + "é").toUpperCase());
+    assertEquals(upper + "SS", (upper + "ß").toUpperCase());
+  }
+})();
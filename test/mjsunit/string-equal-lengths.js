@@ -0,0 +1,40 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String equality and comparison work on blocks of characters. Check strings
+// differing at every position around the block boundaries, for one-byte,
+// two-byte and mixed-width pairs.
+
+function make(length, base, diff_at) {
+  let s = '';
+  for (let i = 0; i < length; i++) {
+    s += String.fromCharCode(base + (i % 7) + (i == diff_at ? 1 : 0));
+  }
+  return s;
+}
+
+// Returns a two-byte string with the contents of {s}.
+function twoByte(s) {
+  return (s + 'ሴ').slice(0, -1);
+}
+
+function equal(a, b) {
+  return a == b;
+}
+
+for (let length = 1; length < 40; length++) {
+  for (const base of [0x61, 0x3b1]) {
+    const a = make(length, base, -1);
+    assertTrue(equal(a, make(length, base, -1)));
+    assertTrue(equal(a, twoByte(a)));
+    for (let i = 0; i < length; i++) {
+      for (const b of [make(length, base, i), twoByte(make(length, base, i))]) {
+        assertFalse(equal(a, b));
+        assertFalse(equal(b, a));
+        assertTrue(a < b);
+        assertTrue(b > a);
+      }
+    }
+  }
+}
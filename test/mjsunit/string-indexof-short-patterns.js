@@ -0,0 +1,39 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns in one-byte subjects are searched for eight positions at a
+// time. Compare against a naive search for matches at every offset and near
+// the end of the subject.
+
+function naiveIndexOf(subject, pattern, start) {
+  outer: for (let i = Math.max(start, 0); i + pattern.length <= subject.length;
+              i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[i + j] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+const kSubjects = [
+  'aaaaaaaaaaaaaaaaaaaaaaaaaaaaab',
+  'abababababababababababababababx',
+  'the quick brown fox jumps over the lazy dog\xff\xfe\x80',
+  'xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxab',
+];
+const kPatterns =
+    ['ab', 'aab', 'ba', 'bx', 'the ', 'lazy', 'dog\xff', '\xfe\x80', 'abx',
+     'xab', 'fox j', 'over t', 'zz', 'aaaab'];
+
+for (const subject of kSubjects) {
+  for (const pattern of kPatterns) {
+    for (let start = 0; start <= subject.length; start++) {
+      assertEquals(naiveIndexOf(subject, pattern, start),
+                   subject.indexOf(pattern, start), `${subject} ${pattern}`);
+    }
+    assertEquals(naiveIndexOf(subject, pattern, 0) >= 0,
+                 subject.includes(pattern));
+  }
+}
@@ -0,0 +1,91 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Bulk conversions between typed arrays of different element types, and from
+// arrays of numbers, must produce the same values as converting the elements
+// one at a time.
+
+const kConstructors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+
+const kLength = 300;
+
+function values(special) {
+  const result = [];
+  for (let i = 0; i < kLength; i++) {
+    result.push((i % 2 ? -1 : 1) * i * 1.25 * 2 ** (i % 34));
+  }
+  // Out of range values in separate chunks exercise both the cast and the
+  // element-wise conversion.
+  if (special) {
+    result[200] = NaN;
+    result[201] = Infinity;
+    result[202] = -Infinity;
+    result[203] = -0;
+    result[204] = 2 ** 31;
+    result[205] = -(2 ** 31) - 1;
+    result[206] = 2 ** 32 + 0.5;
+    result[207] = 3.5e38;
+    result[208] = 2.5;
+    result[209] = 254.5;
+  }
+  return result;
+}
+
+function convertOneByOne(constructor, source) {
+  const result = new constructor(source.length);
+  for (let i = 0; i < source.length; i++) result[i] = source[i];
+  return result;
+}
+
+function checkEquals(expected, actual) {
+  assertEquals(expected.length, actual.length);
+  for (let i = 0; i < expected.length; i++) {
+    assertTrue(Object.is(expected[i], actual[i]), `index ${i}`);
+  }
+}
+
+for (const special of [false, true]) {
+  const doubles = values(special);
+  for (const sourceConstructor of kConstructors) {
+    const source = new sourceConstructor(doubles);
+    for (const constructor of kConstructors) {
+      const expected = convertOneByOne(constructor, source);
+      const target = new constructor(kLength);
+      target.set(source);
+      checkEquals(expected, target);
+
+      const offset = new constructor(kLength + 3);
+      offset.set(source, 3);
+      checkEquals(expected, offset.subarray(3));
+
+      // slice() converts when the species constructor has another type.
+      class Species extends sourceConstructor {
+        static get [Symbol.species]() { return constructor; }
+      }
+      checkEquals(expected, new Species(source).slice());
+    }
+  }
+
+  // Packed double and Smi arrays.
+  const smis = doubles.map(value => value | 0);
+  for (const constructor of kConstructors) {
+    const target = new constructor(kLength);
+    target.set(doubles);
+    checkEquals(convertOneByOne(constructor, doubles), target);
+    target.set(smis);
+    checkEquals(convertOneByOne(constructor, smis), target);
+  }
+}
+
+// Overlapping source and target with different element types.
+const buffer = new ArrayBuffer(4 * kLength);
+const bytes = new Uint8Array(buffer);
+for (let i = 0; i < bytes.length; i++) bytes[i] = i;
+const words = new Uint32Array(buffer);
+const expected = convertOneByOne(Uint32Array, bytes.subarray(0, kLength));
+words.set(bytes.subarray(0, kLength));
+checkEquals(expected, words);
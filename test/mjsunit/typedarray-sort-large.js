@@ -0,0 +1,67 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large typed arrays are sorted with a radix sort. Check that it orders like
+// the comparator-based sort, including -0 and NaN.
+
+function compare(a, b) {
+  if (a < b) return -1;
+  if (a > b) return 1;
+  if (a === 0 && b === 0) return Object.is(b, -0) - Object.is(a, -0);
+  if (a !== a) return b !== b ? 0 : 1;
+  if (b !== b) return -1;
+  return 0;
+}
+
+function checkSorted(expected, actual) {
+  assertEquals(expected.length, actual.length);
+  for (let i = 0; i < expected.length; i++) {
+    assertTrue(Object.is(expected[i], actual[i]), `index ${i}`);
+  }
+}
+
+let seed = 1;
+function random() {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+const kLength = 10000;
+const kConstructors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+
+for (const constructor of kConstructors) {
+  const array = new constructor(kLength);
+  for (let i = 0; i < kLength; i++) {
+    array[i] = (random() - 0.5) * 2 ** 40;
+  }
+  if (constructor === Float32Array || constructor === Float64Array) {
+    const kSpecial = [NaN, -0, 0, -Infinity, Infinity];
+    for (let i = 0; i < kLength; i += 7) array[i] = kSpecial[i % 5];
+  }
+  const expected = Array.from(array).sort(compare);
+  checkSorted(expected, array.sort());
+
+  // Arrays with few distinct values skip most of the passes.
+  array.fill(3);
+  array[kLength >> 1] = 1;
+  checkSorted([1, ...new Array(kLength - 1).fill(3)], array.sort());
+}
+
+for (const constructor of [BigInt64Array, BigUint64Array]) {
+  const array = new constructor(kLength);
+  for (let i = 0; i < kLength; i++) {
+    array[i] = BigInt(Math.floor((random() - 0.5) * 2 ** 52)) << 12n;
+  }
+  const expected = Array.from(array).sort((a, b) => (a < b ? -1 : a > b ? 1 : 0));
+  checkSorted(expected, array.sort());
+}
+
+// Arrays backed by a SharedArrayBuffer are sorted on a copy.
+const shared = new Float64Array(new SharedArrayBuffer(8 * kLength));
+for (let i = 0; i < kLength; i++) shared[i] = random() - 0.5;
+const expected = Array.from(shared).sort(compare);
+checkSorted(expected, shared.sort());
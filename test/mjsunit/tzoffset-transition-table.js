@@ -0,0 +1,67 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --icu-timezone-data
+// Environment Variables: TZ=America/New_York
+
+// After a number of queries, local time offsets come from a table of
+// transitions that grows by whole years. Visit the years out of order and
+// check the offsets around each transition.
+
+function nthSunday(year, month, n) {
+  const first = new Date(Date.UTC(year, month, 1)).getUTCDay();
+  return 1 + (7 - first) % 7 + (n - 1) * 7;
+}
+
+function lastSunday(year, month) {
+  const last = new Date(Date.UTC(year, month + 1, 0));
+  return last.getUTCDate() - last.getUTCDay();
+}
+
+function checkYear(year) {
+  let spring_month, spring_day, fall_month, fall_day;
+  if (year >= 2007) {
+    spring_month = 2;
+    spring_day = nthSunday(year, 2, 2);
+    fall_month = 10;
+    fall_day = nthSunday(year, 10, 1);
+  } else {
+    spring_month = 3;
+    spring_day = nthSunday(year, 3, 1);
+    fall_month = 9;
+    fall_day = lastSunday(year, 9);
+  }
+
+  // 02:00 : UTC-5 => UTC-4
+  const spring = (h, m) => new Date(year, spring_month, spring_day, h, m);
+  const spring_utc = (h, m) =>
+      new Date(Date.UTC(year, spring_month, spring_day, h, m));
+  assertEquals(spring_utc(6, 59), spring(1, 59));
+  assertEquals(spring_utc(7, 0), spring(2, 0));
+  assertEquals(spring_utc(7, 30), spring(2, 30));
+  assertEquals(spring_utc(7, 0), spring(3, 0));
+  assertEquals(300, spring_utc(6, 59).getTimezoneOffset());
+  assertEquals(240, spring_utc(7, 0).getTimezoneOffset());
+
+  // 02:00 : UTC-4 => UTC-5
+  const fall = (h, m) => new Date(year, fall_month, fall_day, h, m);
+  const fall_utc = (h, m) =>
+      new Date(Date.UTC(year, fall_month, fall_day, h, m));
+  assertEquals(fall_utc(4, 59), fall(0, 59));
+  assertEquals(fall_utc(5, 0), fall(1, 0));
+  assertEquals(fall_utc(5, 30), fall(1, 30));
+  assertEquals(fall_utc(7, 0), fall(2, 0));
+  assertEquals(240, fall_utc(5, 59).getTimezoneOffset());
+  assertEquals(300, fall_utc(6, 0).getTimezoneOffset());
+
+  // Mid-year and mid-winter.
+  assertEquals(240, new Date(year, 6, 1).getTimezoneOffset());
+  assertEquals(300, new Date(year, 0, 1).getTimezoneOffset());
+  assertEquals(12, new Date(year, 6, 1, 12).getHours());
+  assertEquals(12, new Date(year, 0, 1, 12).getHours());
+}
+
+for (let year = 2010; year < 2030; year++) checkYear(year);
+for (let year = 2009; year >= 1990; year--) checkYear(year);
+for (let year = 2000; year < 2020; year += 3) checkYear(year);
@@ -98,3 +98,15 @@ test("ab\u1234<\u0123");
   assertEquals('abc', encodeURI('abc'));
   assertEquals('abc', decodeURI('abc'));
 })();
+
+(function TestEncodeRuns() {
+  assertEquals('a-b_c.d~e', encodeURIComponent('a-b_c.d~e'));
+  assertEquals('a%2Fb%3Fc', encodeURIComponent('a/b?c'));
+  assertEquals('a/b?c', encodeURI('a/b?c'));
+  assertEquals('abc%20def%C3%A9', encodeURIComponent('abc defé'));
+  assertEquals('abc%E1%88%B4def', encodeURIComponent('abcሴdef'));
+  assertEquals('x%F0%9F%98%80y', encodeURIComponent('x😀y'));
+  assertThrows(() => encodeURIComponent('abc\ud83d'), URIError);
+  assertThrows(() => encodeURIComponent('abc\ud83ddef'), URIError);
+  assertThrows(() => encodeURIComponent('abc\ude00def'), URIError);
+})();
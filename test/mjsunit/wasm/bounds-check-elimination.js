@@ -0,0 +1,108 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-wasm-trap-handler
+// Flags: --experimental-wasm-memory64
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+// TurboFan omits explicit bounds checks that are covered by a dominating check
+// of the same index.
+
+function TestBoundsCheckElimination(is_memory64) {
+  print(is_memory64 ? 'memory64' : 'memory32');
+  const builder = new WasmModuleBuilder();
+  if (is_memory64) {
+    builder.addMemory64(1, 2, true);
+  } else {
+    builder.addMemory(1, 2, true);
+  }
+  const index_type = is_memory64 ? kWasmI64 : kWasmI32;
+  const sig = makeSig([index_type], [kWasmI32]);
+  // The first access checks the largest offset.
+  builder.addFunction('descending', sig)
+      .addBody([
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 8,
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 0, kExprI32Add,
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 4, kExprI32Add,
+      ])
+      .exportFunc();
+  // The second access needs its own check.
+  builder.addFunction('ascending', sig)
+      .addBody([
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 8, kExprI32Add,
+      ])
+      .exportFunc();
+  // Checks before branches and loops cover the accesses inside of them.
+  builder.addFunction('nested', sig)
+      .addBody([
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 4,
+        kExprIf, kWasmI32,
+          kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+        kExprElse,
+          kExprLoop, kWasmI32,
+            kExprLocalGet, 0, kExprI32LoadMem, 0, 2,
+          kExprEnd,
+        kExprEnd,
+      ])
+      .exportFunc();
+  // Accesses after a merge are checked again.
+  builder.addFunction('merge', makeSig([index_type, kWasmI32], [kWasmI32]))
+      .addBody([
+        kExprLocalGet, 1,
+        kExprIf, kWasmVoid,
+          kExprLocalGet, 0, kExprI32LoadMem, 0, 8, kExprDrop,
+        kExprEnd,
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 8,
+      ])
+      .exportFunc();
+  // Growing the memory keeps earlier checks valid.
+  builder.addFunction('grow', sig)
+      .addBody([
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 4, kExprDrop,
+        kExprI32Const, 1, kExprMemoryGrow, 0, kExprDrop,
+        kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+      ])
+      .exportFunc();
+
+  const instance = builder.instantiate();
+  const exports = {};
+  for (const {name, index} of builder.functions) {
+    %WasmTierUpFunction(instance, index);
+    const func = instance.exports[name];
+    exports[name] = is_memory64 ? (i, ...args) => func(BigInt(i), ...args) :
+                                  func;
+  }
+  const kEnd = kPageSize;
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  memory[0] = 1;
+  memory[1] = 2;
+  memory[2] = 4;
+  memory[kEnd / 4 - 1] = 8;
+
+  assertEquals(7, exports.descending(0));
+  assertEquals(8, exports.descending(kEnd - 12));
+  assertTraps(kTrapMemOutOfBounds, () => exports.descending(kEnd - 11));
+
+  assertEquals(5, exports.ascending(0));
+  assertEquals(8, exports.ascending(kEnd - 12));
+  assertTraps(kTrapMemOutOfBounds, () => exports.ascending(kEnd - 8));
+
+  assertEquals(1, exports.nested(0));
+  assertEquals(0, exports.nested(8));
+  assertEquals(0, exports.nested(kEnd - 8));
+  assertTraps(kTrapMemOutOfBounds, () => exports.nested(kEnd - 7));
+
+  assertEquals(4, exports.merge(0, 0));
+  assertEquals(4, exports.merge(0, 1));
+  assertTraps(kTrapMemOutOfBounds, () => exports.merge(kEnd - 8, 0));
+  assertTraps(kTrapMemOutOfBounds, () => exports.merge(kEnd - 8, 1));
+
+  assertEquals(0, exports.grow(kEnd - 8));
+  assertEquals(0x08000000, exports.descending(kEnd - 11));
+}
+
+TestBoundsCheckElimination(false);
+TestBoundsCheckElimination(true);
@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --wasm-dynamic-tiering
+// Flags: --wasm-code-aging-epochs=1 --stress-wasm-code-gc
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Liftoff code that did not run between two code GCs is replaced by the lazy
+// compile stub, and compiled again on the next call.
+const builder = new WasmModuleBuilder();
+for (const name of ['hot', 'cold']) {
+  builder.addFunction(name, kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add])
+      .exportFunc();
+}
+// Tiering up these replaces their Liftoff code, which triggers code GCs.
+const first_trigger = builder.addFunction('first_trigger', kSig_v_v)
+                          .addBody([])
+                          .exportFunc();
+const second_trigger = builder.addFunction('second_trigger', kSig_v_v)
+                           .addBody([])
+                           .exportFunc();
+const instance = builder.instantiate();
+const exports = instance.exports;
+
+assertEquals(2, exports.hot(1));
+assertEquals(2, exports.cold(1));
+exports.first_trigger();
+exports.second_trigger();
+assertTrue(%IsLiftoffFunction(exports.cold));
+%WasmTierUpFunction(instance, first_trigger.index);
+
+setTimeout(() => {
+  // The first GC only starts aging.
+  assertTrue(%IsLiftoffFunction(exports.cold));
+  assertEquals(3, exports.hot(2));
+  %WasmTierUpFunction(instance, second_trigger.index);
+
+  setTimeout(() => {
+    // {hot} ran since the first GC, but further GCs may demote it as well.
+    assertEquals(3, exports.hot(2));
+    assertFalse(%IsLiftoffFunction(exports.cold));
+    assertFalse(%IsTurboFanFunction(exports.cold));
+    assertEquals(4, exports.cold(3));
+    assertTrue(%IsLiftoffFunction(exports.cold));
+  }, 0);
+}, 0);
@@ -61,3 +61,33 @@ function GlobalImportedInitTest(pad) {
 GlobalImportedInitTest(0);
 GlobalImportedInitTest(1);
 GlobalImportedInitTest(4);
+
+// Pages that a segment only fills with zeros are skipped in freshly allocated
+// memory. Check that this does not lose data, including for segments that
+// overwrite earlier ones.
+(function LargeSparseSegmentsTest() {
+  print("LargeSparseSegmentsTest...");
+  var builder = new WasmModuleBuilder();
+  builder.addMemory(2, 2, true);
+  const kSize = 3 * 16384 + 100;
+  var data = new Array(kSize).fill(0);
+  data[3] = 1;
+  data[20000] = 2;
+  data[kSize - 1] = 3;
+  builder.addDataSegment(1, data);
+  // Overlaps the first segment and writes zeros over non-zero data.
+  var ones = new Array(8192).fill(7);
+  builder.addDataSegment(70000, ones);
+  builder.addDataSegment(69632, new Array(16384).fill(0));
+
+  var instance = builder.instantiate();
+  var view = new Uint8Array(instance.exports.memory.buffer);
+  assertEquals(0, view[0]);
+  assertEquals(1, view[4]);
+  assertEquals(2, view[20001]);
+  assertEquals(3, view[kSize]);
+  for (var i = 69632; i < 69632 + 16384; i += 512) {
+    assertEquals(0, view[i]);
+  }
+  assertEquals(0, view[kSize + 1]);
+})();
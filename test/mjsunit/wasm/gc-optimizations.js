@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-// Flags: --experimental-wasm-gc --no-liftoff
+// Flags: --experimental-wasm-gc --no-liftoff --expose-gc
 
 // This tests are meant to examine if Turbofan CsaLoadElimination works
 // correctly for wasm. The TurboFan graphs can be examined with --trace-turbo.
@@ -373,6 +373,129 @@ d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
   assertEquals(42, instance.exports.main(42));
 })();
 
+(function EscapeAnalysisWithComparisons() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI32, true)]);
+
+  // TF should eliminate both allocations in this function, as they are only
+  // compared with other references.
+  builder.addFunction("main", kSig_i_i)
+    .addLocals(wasmOptRefType(struct), 2)
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprRttCanon, struct,
+      kGCPrefix, kExprStructNewWithRtt, struct,
+      kExprLocalSet, 1,
+      kExprLocalGet, 0,
+      kGCPrefix, kExprRttCanon, struct,
+      kGCPrefix, kExprStructNewWithRtt, struct,
+      kExprLocalSet, 2,
+
+      kExprLocalGet, 1,  // local1 == local1 => 4
+      kExprLocalGet, 1,
+      kExprRefEq,
+      kExprI32Const, 2,
+      kExprI32Shl,
+
+      kExprLocalGet, 1,  // local1 == local2 => 0
+      kExprLocalGet, 2,
+      kExprRefEq,
+      kExprI32Const, 1,
+      kExprI32Shl,
+      kExprI32Add,
+
+      kExprLocalGet, 2,  // local2 == null => 0
+      kExprRefIsNull,
+      kExprI32Add,
+
+      kExprLocalGet, 0,
+      kExprI32Add])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(46, instance.exports.main(42));
+})();
+
+(function EscapeAnalysisArrayInit() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let array = builder.addArray(kWasmI32, true);
+  let array_i8 = builder.addArray(kWasmI8, false);
+
+  // TF should eliminate the allocation and forward the stored values.
+  builder.addFunction("main", kSig_i_i)
+    .addLocals(wasmOptRefType(array), 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32Const, 1,
+      kExprLocalGet, 0,
+      kExprI32Const, 2,
+      kExprI32Add,
+      kGCPrefix, kExprRttCanon, array,
+      kGCPrefix, kExprArrayInit, array, 3,
+      kExprLocalSet, 1,
+
+      kExprLocalGet, 1,  // local1[1] = 7
+      kExprI32Const, 1,
+      kExprI32Const, 7,
+      kGCPrefix, kExprArraySet, array,
+
+      kExprLocalGet, 1,  // local1[0] + local1[1] + local1[2] + len(local1)
+      kExprI32Const, 0,
+      kGCPrefix, kExprArrayGet, array,
+      kExprLocalGet, 1,
+      kExprI32Const, 1,
+      kGCPrefix, kExprArrayGet, array,
+      kExprI32Add,
+      kExprLocalGet, 1,
+      kExprI32Const, 2,
+      kGCPrefix, kExprArrayGet, array,
+      kExprI32Add,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprArrayLen, array,
+      kExprI32Add])
+    .exportFunc();
+
+  // Arrays which escape are still initialized correctly.
+  builder.addFunction("make", makeSig([kWasmI32], [wasmRefType(array_i8)]))
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32Const, 1,
+      kExprI32Const, 2,
+      kExprI32Const, 3,
+      kExprI32Const, 4,
+      kGCPrefix, kExprRttCanon, array_i8,
+      kGCPrefix, kExprArrayInit, array_i8, 5])
+    .exportFunc();
+
+  builder.addFunction("get", makeSig([wasmRefType(array_i8), kWasmI32],
+                                     [kWasmI32]))
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprArrayGetS, array_i8])
+    .exportFunc();
+
+  builder.addFunction("len", makeSig([wasmRefType(array_i8)], [kWasmI32]))
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprArrayLen, array_i8])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(10 + 7 + 12 + 3, instance.exports.main(10));
+  let made = instance.exports.make(-1);
+  gc();
+  assertEquals(5, instance.exports.len(made));
+  assertEquals(-1, instance.exports.get(made, 0));
+  assertEquals(4, instance.exports.get(made, 4));
+  assertThrows(() => instance.exports.get(made, 5), WebAssembly.RuntimeError,
+               'array element access out of bounds');
+})();
+
 (function AllocationFolding() {
   print(arguments.callee.name);
   var builder = new WasmModuleBuilder();
@@ -0,0 +1,41 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --wasm-lazy-validation
+// Flags: --wasm-lazy-compile-callees
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Calling a lazily compiled function compiles its direct callees in the
+// background. Invalid callees must still only fail once they get called.
+(function testCompileCalleesInBackground() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const inc = builder.addFunction('inc', kSig_i_i)
+                  .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add])
+                  .exportFunc();
+  const bad = builder.addFunction('bad', kSig_i_i)
+                  .addBody([kExprLocalGet, 0, kExprI64Const, 1, kExprI32Add])
+                  .exportFunc();
+  builder.addFunction('main', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0,                       // -
+        kExprIf, kWasmI32,                      // -
+          kExprLocalGet, 0,                     // -
+          kExprCallFunction, inc.index,         // -
+        kExprElse,                              // -
+          kExprLocalGet, 0,                     // -
+          kExprCallFunction, bad.index,         // -
+        kExprEnd
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+
+  assertEquals(42, instance.exports.main(41));
+  assertEquals(2, instance.exports.inc(1));
+  assertEquals(7, instance.exports.main(6));
+  assertThrows(() => instance.exports.main(0), WebAssembly.CompileError);
+  assertThrows(() => instance.exports.bad(0), WebAssembly.CompileError);
+  assertEquals(3, instance.exports.main(2));
+})();
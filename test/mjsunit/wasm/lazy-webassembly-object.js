@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The {WebAssembly} object is installed on first access. Until then the
+// global property must behave like the plain data property it replaces.
+
+(function testPropertyDescriptor() {
+  print(arguments.callee.name);
+  const desc = Object.getOwnPropertyDescriptor(globalThis, 'WebAssembly');
+  assertEquals('object', typeof desc.value);
+  assertTrue(desc.writable);
+  assertFalse(desc.enumerable);
+  assertTrue(desc.configurable);
+  assertSame(desc.value, WebAssembly);
+  assertFalse(Object.keys(globalThis).includes('WebAssembly'));
+})();
+
+(function testInstalledOnce() {
+  print(arguments.callee.name);
+  const first = WebAssembly;
+  assertSame(first, globalThis.WebAssembly);
+  assertEquals('WebAssembly', first[Symbol.toStringTag]);
+  assertEquals('function', typeof first.Module);
+  assertSame(first.Module.prototype,
+             Object.getPrototypeOf(new first.Module(new Uint8Array(
+                 [0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00]))));
+})();
+
+(function testOverwriteInOtherRealm() {
+  print(arguments.callee.name);
+  const realm = Realm.create();
+  Realm.eval(realm, 'globalThis.WebAssembly = 42;');
+  assertEquals(42, Realm.eval(realm, 'WebAssembly'));
+  assertEquals('object', typeof WebAssembly);
+})();
+
+(function testDeleteInOtherRealm() {
+  print(arguments.callee.name);
+  const realm = Realm.create();
+  assertTrue(Realm.eval(realm, 'delete globalThis.WebAssembly'));
+  assertEquals('undefined', Realm.eval(realm, 'typeof WebAssembly'));
+})();
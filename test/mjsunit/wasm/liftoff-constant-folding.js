@@ -0,0 +1,67 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Liftoff folds i32 operations on constants, also if they flow through locals.
+
+(function testFoldArithmetic() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const cases = [
+    [kExprI32Add, 0x7fffffff, 1, -0x80000000],
+    [kExprI32Sub, -0x80000000, 1, 0x7fffffff],
+    [kExprI32Mul, 0x10000, 0x10001, 0x10000],
+    [kExprI32And, 0xff00, 0x0ff0, 0x0f00],
+    [kExprI32Ior, 0xff00, 0x0ff0, 0xfff0],
+    [kExprI32Xor, 0xff00, 0x0ff0, 0xf0f0],
+    [kExprI32Shl, 3, 33, 6],
+    [kExprI32ShrS, -16, 34, -4],
+    [kExprI32ShrU, -16, 34, 0x3ffffffc],
+  ];
+  cases.forEach(([opcode, lhs, rhs], i) => {
+    builder.addFunction('fold' + i, kSig_i_v)
+        .addLocals(kWasmI32, 1)
+        .addBody([
+          ...wasmI32Const(lhs), kExprLocalSet, 0,
+          kExprLocalGet, 0, ...wasmI32Const(rhs), opcode,
+        ])
+        .exportFunc();
+  });
+  const instance = builder.instantiate();
+  cases.forEach(([opcode, lhs, rhs, expected], i) => {
+    const func = instance.exports['fold' + i];
+    assertTrue(%IsLiftoffFunction(func));
+    assertEquals(expected, func());
+  });
+})();
+
+(function testFoldAddress() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, true);
+  // A constant base in a local plus a constant offset.
+  function addLoad(name, base, offset) {
+    builder.addFunction(name, kSig_i_v)
+        .addLocals(kWasmI32, 1)
+        .addBody([
+          ...wasmI32Const(base), kExprLocalSet, 0,
+          kExprLocalGet, 0, ...wasmI32Const(offset), kExprI32Add,
+          kExprI32LoadMem, 0, 0,
+        ])
+        .exportFunc();
+  }
+  addLoad('in_bounds', kPageSize - 16, 12);
+  addLoad('out_of_bounds', kPageSize - 16, 13);
+  addLoad('wrapped', -4, 8);
+  const instance = builder.instantiate();
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  memory[1] = 11;
+  memory[kPageSize / 4 - 1] = 17;
+  assertEquals(17, instance.exports.in_bounds());
+  assertTraps(kTrapMemOutOfBounds, () => instance.exports.out_of_bounds());
+  assertEquals(11, instance.exports.wrapped());
+})();
@@ -226,3 +226,35 @@ load("test/mjsunit/wasm/wasm-module-builder.js");
       wrapped_export.apply(null, args);
   combined_promise.then(v => assertEquals(reduce(args), v));
 })();
+
+// Stacks of finished calls are returned to a per-isolate pool when their
+// continuation is collected, and new calls reuse them.
+(function TestStackSwitchReuseStacks() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addGlobal(kWasmI32, true).exportAs('g');
+  let import_index = builder.addImport('m', 'import', kSig_i_v);
+  builder.addFunction("test", kSig_i_v)
+      .addBody([
+          kExprCallFunction, import_index, // suspend
+          kExprGlobalGet, 0,
+          kExprI32Add,
+          kExprGlobalSet, 0, // resume
+          kExprGlobalGet, 0,
+      ]).exportFunc();
+  let suspender = new WebAssembly.Suspender();
+  function js_import() {
+    return 1;
+  };
+  let wasm_js_import = new WebAssembly.Function(
+      {parameters: [], results: ['externref']}, js_import);
+  let suspending_wasm_js_import =
+      suspender.suspendOnReturnedPromise(wasm_js_import);
+  let instance = builder.instantiate({m: {import: suspending_wasm_js_import}});
+  let wrapped_export = suspender.returnPromiseOnSuspend(instance.exports.test);
+  for (let i = 0; i < 50; i++) {
+    wrapped_export();
+    if (i % 10 == 0) gc();
+  }
+  assertEquals(50, instance.exports.g.value);
+})();
@@ -0,0 +1,60 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/v8-array-buffer.h"
+#include "src/flags/flags.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+
+namespace {
+
+std::unique_ptr<ArrayBuffer::Allocator> NewPooledAllocator() {
+  i::SaveFlags save_flags;
+  i::FLAG_array_buffer_pool_size = 1;
+  return std::unique_ptr<ArrayBuffer::Allocator>(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+}
+
+}  // namespace
+
+TEST(ArrayBufferAllocator, PooledAllocatorRecyclesBackingStores) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator = NewPooledAllocator();
+  const size_t kLength = 64 * i::KB;
+  uint8_t* data = static_cast<uint8_t*>(allocator->Allocate(kLength));
+  ASSERT_NE(nullptr, data);
+  memset(data, 0xAB, kLength);
+  allocator->Free(data, kLength);
+
+  // Lengths of the same size class reuse the freed block, which is cleared
+  // for initialized allocations.
+  const size_t kRecycledLength = kLength - i::KB;
+  uint8_t* recycled =
+      static_cast<uint8_t*>(allocator->Allocate(kRecycledLength));
+  EXPECT_EQ(data, recycled);
+  for (size_t index = 0; index < kRecycledLength; index++) {
+    ASSERT_EQ(0, recycled[index]);
+  }
+  allocator->Free(recycled, kRecycledLength);
+}
+
+TEST(ArrayBufferAllocator, PooledAllocatorRespectsPoolSize) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator = NewPooledAllocator();
+  const size_t kLength = 1 * i::MB;
+  void* first = allocator->AllocateUninitialized(kLength);
+  void* second = allocator->AllocateUninitialized(kLength);
+  ASSERT_NE(nullptr, first);
+  ASSERT_NE(nullptr, second);
+  // Only one of the blocks fits into the 1 MB pool.
+  allocator->Free(first, kLength);
+  allocator->Free(second, kLength);
+  void* recycled = allocator->AllocateUninitialized(kLength);
+  EXPECT_EQ(first, recycled);
+  allocator->Free(recycled, kLength);
+}
+
+}  // namespace v8
@@ -0,0 +1,58 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-profile.h"
+
+#include <sstream>
+
+#include "src/flags/flags.h"
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+TEST(InliningProfileTest, ParsesAndSumsEdges) {
+  std::istringstream stream(
+      "main,parse,100\n"
+      "main,parse,50\n"
+      "main,format,7\n"
+      ",format,3\n");
+  InliningProfile profile;
+  profile.Parse(stream);
+  EXPECT_EQ(3u, profile.edge_count());
+  EXPECT_EQ(150, profile.CallCount("main", "parse"));
+  // Edges without a caller apply to every caller.
+  EXPECT_EQ(10, profile.CallCount("main", "format"));
+  EXPECT_EQ(3, profile.CallCount("other", "format"));
+  EXPECT_EQ(0, profile.CallCount("other", "parse"));
+}
+
+TEST(InliningProfileTest, IgnoresMalformedLines) {
+  std::istringstream stream(
+      "main\n"
+      "main,parse\n"
+      "main,,10\n"
+      "main,parse,lots\n"
+      "main,parse,-1\n"
+      "main,parse,4\n");
+  InliningProfile profile;
+  profile.Parse(stream);
+  EXPECT_EQ(1u, profile.edge_count());
+  EXPECT_EQ(4, profile.CallCount("main", "parse"));
+}
+
+TEST(InliningProfileTest, HotThreshold) {
+  FlagScope<double> hot_count(&FLAG_turbo_inlining_profile_hot_count, 100);
+  std::istringstream stream("main,parse,100\nmain,format,99\n");
+  InliningProfile profile;
+  profile.Parse(stream);
+  EXPECT_TRUE(profile.IsHot("main", "parse"));
+  EXPECT_FALSE(profile.IsHot("main", "format"));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -5,6 +5,7 @@
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/access-builder.h"
 #include "src/compiler/js-graph.h"
+#include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
 #include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/graph-reducer-unittest.h"
@@ -89,6 +90,41 @@ TEST_F(LoadEliminationTest, StoreElementAndLoadElement) {
   EXPECT_EQ(value, r.replacement());
 }
 
+TEST_F(LoadEliminationTest, LoadElementAndStoreElementAtOtherOffset) {
+  Node* object = Parameter(Type::Any(), 0);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+  Node* index = Parameter(Type::UnsignedSmall(), 1);
+  Node* value = Parameter(Type::Any(), 2);
+  ElementAccess const access = {kTaggedBase, kTaggedSize, Type::Any(),
+                                MachineType::AnyTagged(), kNoWriteBarrier};
+
+  StrictMock<MockAdvancedReducerEditor> editor;
+  LoadElimination load_elimination(&editor, jsgraph(), zone());
+
+  load_elimination.Reduce(graph()->start());
+
+  Node* load1 = effect = graph()->NewNode(simplified()->LoadElement(access),
+                                          object, index, effect, control);
+  load_elimination.Reduce(load1);
+
+  // Storing to a[index + 1] cannot clobber a[index].
+  Node* next_index = graph()->NewNode(simplified()->NumberAdd(), index,
+                                      NumberConstant(1));
+  NodeProperties::SetType(next_index, Type::UnsignedSmall());
+  Node* store = effect =
+      graph()->NewNode(simplified()->StoreElement(access), object, next_index,
+                       value, effect, control);
+  load_elimination.Reduce(store);
+
+  Node* load2 = effect = graph()->NewNode(simplified()->LoadElement(access),
+                                          object, index, effect, control);
+  EXPECT_CALL(editor, ReplaceWithValue(load2, load1, store, _));
+  Reduction r = load_elimination.Reduce(load2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
 TEST_F(LoadEliminationTest, StoreElementAndStoreFieldAndLoadElement) {
   Node* object = Parameter(Type::Any(), 0);
   Node* effect = graph()->start();
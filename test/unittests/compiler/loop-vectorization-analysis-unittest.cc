@@ -0,0 +1,114 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/linkage.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopVectorizationAnalysisTest : public GraphTest {
+ public:
+  LoopVectorizationAnalysisTest() : GraphTest(4), simplified_(zone()) {}
+
+ protected:
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  // Builds `for (i = 0; i < n; i++) a[i] = a[i] + 1` over a typed array with
+  // elements of {type}. If {with_call} is set, the loop body additionally
+  // contains a call.
+  void BuildLoop(ExternalArrayType type, bool with_call) {
+    Node* array = Parameter(0);
+    Node* n = Parameter(1);
+    Node* base = Parameter(2);
+    Node* external = Parameter(3);
+
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* phi =
+        graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                         NumberConstant(0), NumberConstant(0), loop);
+    Node* cond = graph()->NewNode(simplified()->NumberLessThan(), phi, n);
+    Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+
+    Node* effect = effect_phi;
+    Node* load =
+        graph()->NewNode(simplified()->LoadTypedElement(type), array, base,
+                         external, phi, effect, if_true);
+    effect = load;
+    Node* value =
+        graph()->NewNode(simplified()->NumberAdd(), load, NumberConstant(1));
+    effect = graph()->NewNode(simplified()->StoreTypedElement(type), array,
+                              base, external, phi, value, effect, if_true);
+    if (with_call) {
+      const CallDescriptor* descriptor = Linkage::GetSimplifiedCDescriptor(
+          zone(), MachineSignature::Builder(zone(), 0, 0).Build());
+      effect = graph()->NewNode(common()->Call(descriptor), Int32Constant(0),
+                                effect, if_true);
+    }
+    Node* inc = graph()->NewNode(simplified()->NumberAdd(), phi,
+                                 NumberConstant(1));
+
+    loop->ReplaceInput(1, if_true);
+    effect_phi->ReplaceInput(1, effect);
+    phi->ReplaceInput(1, inc);
+
+    Node* exit = graph()->NewNode(common()->LoopExit(), if_false, loop);
+    Node* exit_effect =
+        graph()->NewNode(common()->LoopExitEffect(), effect_phi, exit);
+    Node* ret = graph()->NewNode(common()->Return(), Int32Constant(0),
+                                 UndefinedConstant(), exit_effect, exit);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  LoopVectorizationAnalysis::Result Analyze(
+      LoopVectorizationAnalysis::Candidate* candidate) {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    EXPECT_EQ(1u, loop_tree->outer_loops().size());
+    return LoopVectorizationAnalysis(loop_tree).Analyze(
+        loop_tree->outer_loops()[0], candidate);
+  }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(LoopVectorizationAnalysisTest, Float32ElementWiseLoop) {
+  BuildLoop(kExternalFloat32Array, false);
+  LoopVectorizationAnalysis::Candidate candidate;
+  EXPECT_EQ(LoopVectorizationAnalysis::Result::kVectorizable,
+            Analyze(&candidate));
+  EXPECT_EQ(kExternalFloat32Array, candidate.element_type);
+  EXPECT_EQ(4, candidate.lanes);
+  ASSERT_NE(nullptr, candidate.induction_variable);
+  EXPECT_EQ(IrOpcode::kPhi, candidate.induction_variable->opcode());
+}
+
+TEST_F(LoopVectorizationAnalysisTest, NarrowElementsAreRejected) {
+  BuildLoop(kExternalUint8Array, false);
+  LoopVectorizationAnalysis::Candidate candidate;
+  EXPECT_EQ(LoopVectorizationAnalysis::Result::kUnsupportedElementType,
+            Analyze(&candidate));
+}
+
+TEST_F(LoopVectorizationAnalysisTest, CallsAreRejected) {
+  BuildLoop(kExternalInt32Array, true);
+  LoopVectorizationAnalysis::Candidate candidate;
+  EXPECT_EQ(LoopVectorizationAnalysis::Result::kHasCall, Analyze(&candidate));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -4,6 +4,7 @@
 #ifdef V8_INTL_SUPPORT
 #include "src/base/platform/platform.h"
 #include "src/date/date.h"
+#include "src/objects/intl-objects.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "unicode/strenum.h"
 #include "unicode/timezone.h"
@@ -103,6 +104,43 @@ TEST(DateCache, AdoptDefaultMixed) {
   t4.Join();
 }
 
+TEST(DateCache, OffsetTransitions) {
+  for (const char* id : {"America/New_York", "Australia/Lord_Howe",
+                         "Europe/Moscow", "Asia/Kolkata"}) {
+    icu::TimeZone::adoptDefault(
+        icu::TimeZone::createTimeZone(icu::UnicodeString(id, -1, US_INV)));
+    DateCache date_cache;
+    std::unique_ptr<base::TimezoneCache> reference(Intl::CreateTimeZoneCache());
+    // Walk forward, then backward from the start time, so that the lookup
+    // table is extended in both directions, and also cover the times that
+    // local times around transitions map to.
+    const int64_t kStep = 15 * DateCache::kMsPerMin;
+    const int64_t kSteps = 2 * 365 * DateCache::kMsPerDay / kStep;
+    for (int64_t step = -kSteps; step < kSteps; step++) {
+      int64_t time = kStartTime + (step < 0 ? step + kSteps : -step) * kStep;
+      for (bool is_utc : {true, false}) {
+        int expected = static_cast<int>(
+            reference->LocalTimeOffset(static_cast<double>(time), is_utc));
+        CHECK_EQ(expected, date_cache.LocalOffsetInMs(time, is_utc));
+      }
+    }
+  }
+}
+
+TEST(DateCache, YearMonthDayFromDays) {
+  DateCache date_cache;
+  // Cover the time range of JSDate, with a day in every month.
+  for (int days = -100000000; days <= 100000000; days += 17) {
+    int year, month, day;
+    date_cache.YearMonthDayFromDays(days, &year, &month, &day);
+    CHECK_LE(0, month);
+    CHECK_LT(month, 12);
+    CHECK_LE(1, day);
+    CHECK_LE(day, 31);
+    CHECK_EQ(days, date_cache.DaysFromYearMonth(year, month) + day - 1);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
 
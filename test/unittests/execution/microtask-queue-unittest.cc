@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "include/v8-function.h"
+#include "src/api/api.h"
 #include "src/heap/factory.h"
 #include "src/objects/foreign.h"
 #include "src/objects/js-array-inl.h"
@@ -647,6 +648,83 @@ TEST_P(MicrotaskQueueTest, MicrotasksScope) {
   EXPECT_TRUE(ran);
 }
 
+namespace {
+
+struct ContextAccount {
+  Local<v8::Context> context;
+  size_t microtask_count;
+};
+
+void RecordContextAccount(v8::Isolate* isolate, Local<v8::Context> context,
+                          size_t microtask_count, double run_time_ms,
+                          void* data) {
+  EXPECT_LE(0, run_time_ms);
+  static_cast<std::vector<ContextAccount>*>(data)->push_back(
+      {context, microtask_count});
+}
+
+}  // namespace
+
+TEST_P(MicrotaskQueueTest, ContextAccounting) {
+  Local<v8::Context> v8_context2 = v8::Context::New(v8_isolate());
+  Handle<Context> context2 = Utils::OpenHandle(*v8_context2, isolate());
+  context2->native_context().set_microtask_queue(isolate(), microtask_queue());
+
+  Handle<JSArray> ran = RunJS<JSArray>("var ran = []; ran");
+  Handle<JSFunction> task1 = RunJS<JSFunction>("() => ran.push(1)");
+  Handle<JSFunction> task2;
+  {
+    v8::Context::Scope scope(v8_context2);
+    v8_context2->Global()
+        ->Set(v8_context2, NewString("ran"), Utils::ToLocal(ran))
+        .FromJust();
+    task2 = RunJS<JSFunction>("() => ran.push(2)");
+  }
+
+  std::vector<ContextAccount> accounts;
+  microtask_queue()->SetMicrotasksContextAccountingCallback(
+      &RecordContextAccount, &accounts);
+
+  // Consecutive microtasks of the same context run in a single batch, but
+  // callback tasks run outside of it.
+  size_t entered_context_count =
+      isolate()->handle_scope_implementer()->EnteredContextCount();
+  size_t callback_entered_context_count = 0;
+  microtask_queue()->EnqueueMicrotask(
+      *factory()->NewCallableTask(task1, native_context()));
+  microtask_queue()->EnqueueMicrotask(
+      *factory()->NewCallableTask(task1, native_context()));
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([&] {
+    callback_entered_context_count =
+        isolate()->handle_scope_implementer()->EnteredContextCount();
+  }));
+  microtask_queue()->EnqueueMicrotask(
+      *factory()->NewCallableTask(task2, context2));
+  microtask_queue()->EnqueueMicrotask(
+      *factory()->NewCallableTask(task1, native_context()));
+  EXPECT_EQ(5, microtask_queue()->RunMicrotasks(isolate()));
+
+  EXPECT_EQ(entered_context_count, callback_entered_context_count);
+  EXPECT_EQ(entered_context_count,
+            isolate()->handle_scope_implementer()->EnteredContextCount());
+  EXPECT_EQ(4, Smi::ToInt(ran->length()));
+  ASSERT_EQ(2u, accounts.size());
+  EXPECT_EQ(context(), accounts[0].context);
+  EXPECT_EQ(3u, accounts[0].microtask_count);
+  EXPECT_EQ(v8_context2, accounts[1].context);
+  EXPECT_EQ(1u, accounts[1].microtask_count);
+
+  // Accounting is off again without a callback.
+  accounts.clear();
+  microtask_queue()->SetMicrotasksContextAccountingCallback(nullptr);
+  microtask_queue()->EnqueueMicrotask(
+      *factory()->NewCallableTask(task2, context2));
+  EXPECT_EQ(1, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_TRUE(accounts.empty());
+
+  v8_context2->DetachGlobal();
+}
+
 INSTANTIATE_TEST_SUITE_P(
     , MicrotaskQueueTest, ::testing::Values(false, true),
     [](const ::testing::TestParamInfo<MicrotaskQueueTest::ParamType>& info) {
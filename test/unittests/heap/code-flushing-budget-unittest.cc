@@ -0,0 +1,64 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/code-flushing-budget.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(CodeFlushingBudget, DisabledKeepsDefaultAge) {
+  CodeFlushingBudget budget;
+  EXPECT_FALSE(budget.is_enabled());
+  budget.UpdateFlushingAge();
+  EXPECT_EQ(BytecodeArray::kIsOldBytecodeAge, budget.flushing_age());
+}
+
+TEST(CodeFlushingBudget, WithinBudgetKeepsDefaultAge) {
+  CodeFlushingBudget budget;
+  budget.set_budget_in_bytes(1000);
+  budget.ResetSizes();
+  budget.RecordFlushableCode(BytecodeArray::kNoAgeBytecodeAge, 300);
+  budget.RecordFlushableCode(BytecodeArray::kQuadragenarianBytecodeAge, 300);
+  budget.RecordFlushableCode(BytecodeArray::kQuinquagenarianBytecodeAge, 300);
+  // Old code is flushed anyway and doesn't count against the budget.
+  budget.RecordFlushableCode(BytecodeArray::kOctogenarianBytecodeAge, 5000);
+  budget.UpdateFlushingAge();
+  EXPECT_EQ(BytecodeArray::kIsOldBytecodeAge, budget.flushing_age());
+}
+
+TEST(CodeFlushingBudget, OverBudgetFlushesLeastRecentlyExecutedFirst) {
+  CodeFlushingBudget budget;
+  budget.set_budget_in_bytes(1000);
+  budget.ResetSizes();
+  budget.RecordFlushableCode(BytecodeArray::kNoAgeBytecodeAge, 400);
+  budget.RecordFlushableCode(BytecodeArray::kQuadragenarianBytecodeAge, 400);
+  budget.RecordFlushableCode(BytecodeArray::kQuinquagenarianBytecodeAge, 400);
+  budget.UpdateFlushingAge();
+  EXPECT_EQ(BytecodeArray::kQuinquagenarianBytecodeAge, budget.flushing_age());
+
+  budget.ResetSizes();
+  budget.RecordFlushableCode(BytecodeArray::kNoAgeBytecodeAge, 400);
+  budget.RecordFlushableCode(BytecodeArray::kQuadragenarianBytecodeAge, 800);
+  budget.UpdateFlushingAge();
+  EXPECT_EQ(BytecodeArray::kQuadragenarianBytecodeAge, budget.flushing_age());
+}
+
+TEST(CodeFlushingBudget, RecentlyExecutedCodeIsNeverFlushedEarly) {
+  CodeFlushingBudget budget;
+  budget.set_budget_in_bytes(1000);
+  budget.ResetSizes();
+  budget.RecordFlushableCode(BytecodeArray::kNoAgeBytecodeAge, 5000);
+  budget.UpdateFlushingAge();
+  EXPECT_EQ(BytecodeArray::kNoAgeBytecodeAge + 1, budget.flushing_age());
+
+  // Once the budget is removed, the default age is used again.
+  budget.set_budget_in_bytes(0);
+  budget.UpdateFlushingAge();
+  EXPECT_EQ(BytecodeArray::kIsOldBytecodeAge, budget.flushing_age());
+}
+
+}  // namespace internal
+}  // namespace v8
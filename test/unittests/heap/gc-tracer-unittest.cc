@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 #include "src/base/platform/platform.h"
@@ -568,5 +569,41 @@ TEST_F(GCTracerTest, RecordScavengerHistograms) {
   GcHistogram::CleanUp();
 }
 
+TEST_F(GCTracerTest, ScopeDurationHistograms) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->RecordScopeDuration(GCTracer::Scope::MC_MARK, 0.0005);
+  tracer->RecordScopeDuration(GCTracer::Scope::MC_MARK, 0.003);
+  tracer->RecordScopeDuration(GCTracer::Scope::MC_MARK, 0.003);
+  tracer->RecordScopeDuration(GCTracer::Scope::MC_BACKGROUND_MARKING,
+                              1000000.0);
+  v8::metrics::GarbageCollectionScopeHistograms result =
+      tracer->GetScopeDurationHistograms();
+  const v8::metrics::GarbageCollectionScopeHistograms::Histogram* mark =
+      nullptr;
+  const v8::metrics::GarbageCollectionScopeHistograms::Histogram*
+      background_marking = nullptr;
+  for (const auto& histogram : result.histograms) {
+    if (strcmp(histogram.name, "V8.GC_MC_MARK") == 0) mark = &histogram;
+    if (strcmp(histogram.name, "V8.GC_MC_BACKGROUND_MARKING") == 0) {
+      background_marking = &histogram;
+    }
+  }
+  ASSERT_NE(nullptr, mark);
+  EXPECT_EQ(3, mark->count);
+  EXPECT_EQ(6, mark->total_duration_us);
+  // Below 1us.
+  EXPECT_EQ(1, mark->buckets[0]);
+  // 3us lies in [2^1, 2^2).
+  EXPECT_EQ(2, mark->buckets[2]);
+  EXPECT_EQ(4, v8::metrics::GarbageCollectionScopeHistograms::
+                   BucketUpperBoundUs(2));
+  ASSERT_NE(nullptr, background_marking);
+  EXPECT_EQ(1, background_marking->count);
+  // Long durations end up in the last bucket.
+  constexpr size_t kLastBucket =
+      v8::metrics::GarbageCollectionScopeHistograms::kNumberOfBuckets - 1;
+  EXPECT_EQ(1, background_marking->buckets[kLastBucket]);
+}
+
 }  // namespace internal
 }  // namespace v8
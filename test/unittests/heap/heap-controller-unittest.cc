@@ -108,5 +108,33 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST_F(MemoryControllerTest, ProcessHeapBudget) {
+  ProcessHeapBudget budget;
+  Heap* busy_heap = i_isolate()->heap();
+  // The idle heap is only used as a key and never dereferenced.
+  int idle_heap_storage = 0;
+  Heap* idle_heap = reinterpret_cast<Heap*>(&idle_heap_storage);
+  const size_t kBudget = 1000 * MB;
+
+  // A single heap gets all of the remaining budget.
+  EXPECT_EQ(kBudget,
+            budget.UpdateAndComputeMaxSize(busy_heap, kBudget, 100 * MB, 3));
+
+  // The headroom is split according to the allocation throughput.
+  EXPECT_EQ(200 * MB + 175 * MB,
+            budget.UpdateAndComputeMaxSize(idle_heap, kBudget, 200 * MB, 1));
+  EXPECT_EQ(100 * MB + 525 * MB,
+            budget.UpdateAndComputeMaxSize(busy_heap, kBudget, 100 * MB, 3));
+
+  // Without headroom heaps may not grow beyond their current size.
+  EXPECT_EQ(900 * MB,
+            budget.UpdateAndComputeMaxSize(busy_heap, kBudget, 900 * MB, 3));
+
+  // Removed heaps no longer count against the budget.
+  budget.RemoveHeap(idle_heap);
+  EXPECT_EQ(kBudget,
+            budget.UpdateAndComputeMaxSize(busy_heap, kBudget, 900 * MB, 3));
+}
+
 }  // namespace internal
 }  // namespace v8
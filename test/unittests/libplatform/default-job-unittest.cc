@@ -265,6 +265,79 @@ TEST(DefaultJobTest, LeakHandle) {
   handle->Join();
 }
 
+// Verify that workers of a best-effort job yield when a job of higher
+// priority needs one of their threads.
+TEST(DefaultJobTest, BestEffortJobYields) {
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform(kMaxTask);
+
+  // This Job occupies as many workers as it can until ShouldYield() returns
+  // true.
+  class BestEffortJob : public JobTask {
+   public:
+    ~BestEffortJob() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      running.fetch_add(1);
+      while (!delegate->ShouldYield()) {
+      }
+      running.fetch_sub(1);
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return kMaxTask;
+    }
+
+    std::atomic_size_t running{0};
+  };
+
+  // This Job runs on the joining thread until one of the best-effort workers
+  // has given way.
+  class UserBlockingJob : public JobTask {
+   public:
+    explicit UserBlockingJob(BestEffortJob* best_effort_job)
+        : best_effort_job_(best_effort_job) {}
+    ~UserBlockingJob() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      while (best_effort_job_->running.load() == kMaxTask) {
+      }
+      done.store(true);
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return done.load() ? 0 : 1;
+    }
+
+    std::atomic_bool done{false};
+
+   private:
+    BestEffortJob* best_effort_job_;
+  };
+
+  auto best_effort_job = std::make_unique<BestEffortJob>();
+  BestEffortJob* best_effort_job_raw = best_effort_job.get();
+  auto best_effort_state = std::make_shared<DefaultJobState>(
+      &platform, std::move(best_effort_job), TaskPriority::kBestEffort,
+      kMaxTask);
+  best_effort_state->NotifyConcurrencyIncrease();
+  while (best_effort_job_raw->running.load() < kMaxTask) {
+  }
+
+  auto user_blocking_job =
+      std::make_unique<UserBlockingJob>(best_effort_job_raw);
+  UserBlockingJob* user_blocking_job_raw = user_blocking_job.get();
+  auto user_blocking_state = std::make_shared<DefaultJobState>(
+      &platform, std::move(user_blocking_job), TaskPriority::kUserBlocking,
+      kMaxTask);
+  // Joining counts the calling thread as a worker of the user-blocking job,
+  // which leaves kMaxTask - 1 workers to the best-effort job.
+  user_blocking_state->Join();
+  EXPECT_TRUE(user_blocking_job_raw->done.load());
+
+  best_effort_state->CancelAndWait();
+}
+
 TEST(DefaultJobTest, AcquireTaskId) {
   class JobTest : public JobTask {
    public:
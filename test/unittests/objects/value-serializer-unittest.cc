@@ -1360,6 +1360,53 @@ TEST_F(ValueSerializerTest, DecodeDenseArrayContainingUndefined) {
       [this](Local<Value> value) { ExpectScriptTrue("!(0 in result)"); });
 }
 
+TEST_F(ValueSerializerTest, RoundTripDenseNumberArray) {
+  Local<Value> value = RoundTripTest("[1, -2, 1 << 30, -(1 << 30)]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(4u, Array::Cast(*value)->Length());
+  ExpectScriptTrue("result.toString() === '1,-2,1073741824,-1073741824'");
+
+  value = RoundTripTest("[0.5, NaN, -0, Infinity]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(i::PACKED_DOUBLE_ELEMENTS,
+            i::Handle<i::JSArray>::cast(Utils::OpenHandle(*value))
+                ->GetElementsKind());
+  ExpectScriptTrue("result[0] === 0.5");
+  ExpectScriptTrue("Number.isNaN(result[1])");
+  ExpectScriptTrue("Object.is(result[2], -0)");
+  ExpectScriptTrue("result[3] === Infinity");
+
+  // Properties are written after the elements.
+  value = RoundTripTest("Object.assign([1.5, 2], {foo: [3, 4]})");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.toString() === '1.5,2'");
+  ExpectScriptTrue("result.foo.toString() === '3,4'");
+
+  value = RoundTripTest("[]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(0u, Array::Cast(*value)->Length());
+}
+
+TEST_F(ValueSerializerTest, DecodeDenseNumberArray) {
+  // Smis are ZigZag-encoded without a tag each.
+  DecodeTestFutureVersions(
+      {0xFF, 0x10, 0x4A, 0x03, 0x02, 0x03, 0x06, 0x24, 0x00, 0x03},
+      [this](Local<Value> value) {
+        ASSERT_TRUE(value->IsArray());
+        EXPECT_EQ(i::PACKED_SMI_ELEMENTS,
+                  i::Handle<i::JSArray>::cast(Utils::OpenHandle(*value))
+                      ->GetElementsKind());
+        ExpectScriptTrue("result.toString() === '1,-2,3'");
+      });
+  // The tags are unknown before version 16.
+  InvalidDecodeTest(
+      {0xFF, 0x0F, 0x4A, 0x03, 0x02, 0x03, 0x06, 0x24, 0x00, 0x03});
+  // Truncated elements, and a length that doesn't match the data.
+  InvalidDecodeTest({0xFF, 0x10, 0x4A, 0x03, 0x02, 0x03});
+  InvalidDecodeTest({0xFF, 0x10, 0x4B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+                     0x00, 0xE0, 0x3F, 0x24, 0x00, 0x02});
+}
+
 TEST_F(ValueSerializerTest, RoundTripDate) {
   Local<Value> value = RoundTripTest("new Date(1e6)");
   ASSERT_TRUE(value->IsDate());
@@ -493,5 +493,31 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, MixedAsciiRuns) {
+  // Long ASCII runs between multi-byte sequences take the word-at-a-time path
+  // in Utf8Decoder; make sure it agrees with the incremental decoder.
+  std::vector<byte> bytes;
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 37; j++) bytes.push_back('a' + j % 26);
+    bytes.insert(bytes.end(), {0xC3, 0xA9});              // U+00E9
+    for (int j = 0; j < 3; j++) bytes.push_back('0' + j);
+    bytes.insert(bytes.end(), {0xF0, 0x9F, 0x98, 0x80});  // U+1F600
+  }
+  // Truncated sequence followed by ASCII.
+  bytes.insert(bytes.end(), {0xE2, 0x82});
+  for (int j = 0; j < 20; j++) bytes.push_back('z');
+
+  std::vector<unibrow::uchar> output_incremental;
+  DecodeIncrementally(bytes, &output_incremental);
+
+  std::vector<unibrow::uchar> output_utf16;
+  DecodeUtf16(bytes, &output_utf16);
+
+  CHECK_EQ(output_utf16.size(), output_incremental.size());
+  for (size_t i = 0; i < output_utf16.size(); ++i) {
+    CHECK_EQ(output_utf16[i], output_incremental[i]);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
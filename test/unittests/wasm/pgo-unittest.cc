@@ -0,0 +1,151 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include "src/wasm/module-decoder.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-module.h"
+#include "test/common/flag-utils.h"
+#include "test/common/wasm/test-signatures.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+class WasmTieringProfileTest : public TestWithIsolateAndZone {
+ public:
+  void SetUp() override {
+    WasmModuleBuilder builder(zone());
+    for (int i = 0; i < 3; i++) {
+      WasmFunctionBuilder* function = builder.AddFunction(sigs_.v_v());
+      for (int j = 0; j < 4; j++) function->Emit(kExprNop);
+      function->Emit(kExprEnd);
+    }
+    ZoneBuffer buffer(zone());
+    builder.WriteTo(&buffer);
+    wire_bytes_ = base::OwnedVector<uint8_t>::Of(
+        base::VectorOf(buffer.begin(), buffer.size()));
+  }
+
+  std::shared_ptr<const WasmModule> DecodeModule() {
+    ModuleResult result = DecodeWasmModule(
+        WasmFeatures::All(), wire_bytes_.begin(), wire_bytes_.end(), false,
+        kWasmOrigin, isolate()->counters(), isolate()->metrics_recorder(),
+        v8::metrics::Recorder::ContextId::Empty(), DecodingMethod::kSync,
+        GetWasmEngine()->allocator());
+    CHECK(result.ok());
+    return std::move(result).value();
+  }
+
+  // A position inside the code of {func_index}.
+  static WasmCodePosition CodePosition(const WasmModule* module,
+                                       uint32_t func_index, int offset) {
+    return static_cast<WasmCodePosition>(
+        module->functions[func_index].code.offset() + offset);
+  }
+
+  static FunctionTypeFeedback& FeedbackFor(const WasmModule* module,
+                                           uint32_t func_index) {
+    return module->type_feedback.feedback_for_function[func_index];
+  }
+
+  bool Deserialize(const WasmModule* module,
+                   const base::OwnedVector<uint8_t>& profile) {
+    return DeserializeTieringProfile(module, profile.as_vector());
+  }
+
+ private:
+  TestSignatures sigs_;
+  base::OwnedVector<uint8_t> wire_bytes_;
+};
+
+TEST_F(WasmTieringProfileTest, RoundTrip) {
+  FlagScope<bool> inlining(&FLAG_wasm_speculative_inlining, true);
+  std::shared_ptr<const WasmModule> module = DecodeModule();
+  FunctionTypeFeedback& hot = FeedbackFor(module.get(), 1);
+  hot.tierup_priority = 4;
+  hot.feedback_vector = {{2, 10}, {-1, -1}};
+  hot.positions[CodePosition(module.get(), 1, 1)] = 0;
+  hot.positions[CodePosition(module.get(), 1, 3)] = 1;
+  // Functions that never got hot are not part of the profile.
+  FeedbackFor(module.get(), 2).positions[CodePosition(module.get(), 2, 1)] = 0;
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module.get());
+
+  std::shared_ptr<const WasmModule> restored = DecodeModule();
+  EXPECT_TRUE(Deserialize(restored.get(), profile));
+  EXPECT_FALSE(IsHotInTieringProfile(restored.get(), 0));
+  EXPECT_TRUE(IsHotInTieringProfile(restored.get(), 1));
+  EXPECT_FALSE(IsHotInTieringProfile(restored.get(), 2));
+  EXPECT_EQ(0u, restored->type_feedback.feedback_for_function.count(2));
+
+  const FunctionTypeFeedback& imported = FeedbackFor(restored.get(), 1);
+  EXPECT_EQ(1, imported.tierup_priority);
+  ASSERT_EQ(2u, imported.feedback_vector.size());
+  EXPECT_EQ(2, imported.feedback_vector[0].function_index);
+  EXPECT_EQ(10, imported.feedback_vector[0].absolute_call_frequency);
+  EXPECT_EQ(-1, imported.feedback_vector[1].function_index);
+  EXPECT_EQ(hot.positions, imported.positions);
+
+  // Profiles of restored modules list the same hot functions.
+  base::OwnedVector<uint8_t> next_profile =
+      SerializeTieringProfile(restored.get());
+  std::shared_ptr<const WasmModule> restored_again = DecodeModule();
+  EXPECT_TRUE(Deserialize(restored_again.get(), next_profile));
+  EXPECT_TRUE(IsHotInTieringProfile(restored_again.get(), 1));
+}
+
+TEST_F(WasmTieringProfileTest, FeedbackRequiresSpeculativeInlining) {
+  std::shared_ptr<const WasmModule> module = DecodeModule();
+  FunctionTypeFeedback& hot = FeedbackFor(module.get(), 0);
+  hot.tierup_priority = 1;
+  hot.feedback_vector = {{1, 3}};
+  hot.positions[CodePosition(module.get(), 0, 2)] = 0;
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module.get());
+
+  FlagScope<bool> inlining(&FLAG_wasm_speculative_inlining, false);
+  std::shared_ptr<const WasmModule> restored = DecodeModule();
+  EXPECT_TRUE(Deserialize(restored.get(), profile));
+  EXPECT_TRUE(IsHotInTieringProfile(restored.get(), 0));
+  EXPECT_TRUE(FeedbackFor(restored.get(), 0).feedback_vector.empty());
+  EXPECT_TRUE(FeedbackFor(restored.get(), 0).positions.empty());
+}
+
+TEST_F(WasmTieringProfileTest, RejectMalformedProfiles) {
+  std::shared_ptr<const WasmModule> module = DecodeModule();
+  FunctionTypeFeedback& hot = FeedbackFor(module.get(), 0);
+  hot.tierup_priority = 2;
+  hot.feedback_vector = {{1, 3}};
+  hot.positions[CodePosition(module.get(), 0, 2)] = 0;
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module.get());
+
+  auto ExpectRejected = [&](base::Vector<const uint8_t> bytes) {
+    std::shared_ptr<const WasmModule> restored = DecodeModule();
+    EXPECT_FALSE(DeserializeTieringProfile(restored.get(), bytes));
+    EXPECT_TRUE(restored->type_feedback.feedback_for_function.empty());
+  };
+
+  // Truncated, or followed by garbage.
+  ExpectRejected(profile.as_vector().SubVector(0, profile.size() - 1));
+  base::OwnedVector<uint8_t> extended =
+      base::OwnedVector<uint8_t>::New(profile.size() + 1);
+  std::copy(profile.begin(), profile.end(), extended.begin());
+  ExpectRejected(extended.as_vector());
+
+  // Function indices outside of the module.
+  const uint8_t out_of_range[] = {1, 3, 1, 0, 0};
+  ExpectRejected(base::ArrayVector(out_of_range));
+
+  // Positions outside of the function.
+  FunctionTypeFeedback& misplaced = FeedbackFor(module.get(), 1);
+  misplaced.tierup_priority = 1;
+  misplaced.positions[CodePosition(module.get(), 2, 0)] = 0;
+  ExpectRejected(SerializeTieringProfile(module.get()).as_vector());
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -5,6 +5,8 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "src/zone/zone-segment.h"
+#include "test/common/flag-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace v8 {
@@ -22,5 +24,32 @@ TEST(Zone, 8ByteAlignment) {
   }
 }
 
+TEST(Zone, SegmentPool) {
+  FlagScope<size_t> pool_size(&FLAG_zone_segment_pool_size, 64);
+  AccountingAllocator allocator;
+
+  // Pooled segments are rounded up to a power of two.
+  Segment* segment = allocator.AllocateSegment(10 * KB, false);
+  ASSERT_NE(nullptr, segment);
+  EXPECT_EQ(16 * KB, segment->total_size());
+  allocator.ReturnSegment(segment, false);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+
+  // A request of the same size class gets the pooled segment back.
+  Segment* reused = allocator.AllocateSegment(12 * KB, false);
+  EXPECT_EQ(segment, reused);
+  EXPECT_EQ(16 * KB, allocator.GetCurrentMemoryUsage());
+  allocator.ReturnSegment(reused, false);
+
+  // Segments above the pooled sizes are not rounded.
+  Segment* large = allocator.AllocateSegment(100 * KB, false);
+  ASSERT_NE(nullptr, large);
+  EXPECT_EQ(100 * KB, large->total_size());
+  allocator.ReturnSegment(large, false);
+
+  allocator.TrimSegmentPool();
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -24,6 +24,10 @@ or plot a dispatch heatmap.
 
 Please note that those handlers that may not or will never dispatch
 (e.g. Return or Throw) do not show up in the results.
+
+Files written by d8 --sample-ignition-dispatches-output-file are accepted
+too. They contain sampled, approximate counts for the whole run and for each
+sampled function.
 """
 
 
@@ -47,6 +51,12 @@ examples:
 
   # Display the top 5 sources and destinations of dispatches to/from LdaZero
   $ tools/ignition/bytecode_dispatches_report.py -f LdaZero -n 5
+
+  # Print the 20 most sampled functions from a sampled dispatches file
+  $ tools/ignition/bytecode_dispatches_report.py -l -n 20 samples.json
+
+  # Print the top bytecode dispatch pairs of the sampled function "foo"
+  $ tools/ignition/bytecode_dispatches_report.py -t -F foo samples.json
 """
 
 __COUNTER_BITS = struct.calcsize("P") * 8  # Size in bits of a pointer
@@ -79,6 +89,39 @@ def print_top_bytecode_dispatch_pairs(dispatches_table, top_count):
     print("{:>12d}\t{} -> {}".format(counter, source, destination))
 
 
+def is_sampled_dispatches(data):
+  return "dispatches" in data and "functions" in data
+
+
+def extract_dispatches_table(data, function_name=None):
+  if not is_sampled_dispatches(data):
+    if function_name is not None:
+      raise ValueError("per-function tables require a sampled dispatches file")
+    return data
+  if function_name is None:
+    return data["dispatches"]
+  # Functions are sorted by sample count, so this picks the hottest function
+  # with the given name.
+  for function in data["functions"]:
+    if function["name"] == function_name:
+      return function["dispatches"]
+  raise ValueError("no samples for function {}".format(function_name))
+
+
+def find_top_functions(data, top_count):
+  return [(function["name"], function["scriptId"], function["position"],
+           function["samples"])
+          for function in data["functions"][:top_count]]
+
+
+def print_top_functions(data, top_count):
+  print("Top {} sampled functions:".format(top_count))
+  for name, script_id, position, samples in find_top_functions(data,
+                                                                top_count):
+    print("{:>12d}\t{} (script {}, position {})".format(
+        samples, name or "<anonymous>", script_id, position))
+
+
 def find_top_bytecodes(dispatches_table):
   top_bytecodes = []
   for bytecode, counters_from_bytecode in iteritems(dispatches_table):
@@ -212,13 +255,24 @@ def parse_command_line():
     metavar="N",
     type=int,
     default=10,
-    help="print N top entries when running with -t or -f (default 10)"
+    help="print N top entries when running with -t, -f or -l (default 10)"
   )
   command_line_parser.add_argument(
     "--top-dispatches-for-bytecode", "-f",
     metavar="<bytecode name>",
     help="print top dispatch sources and destinations to the specified bytecode"
   )
+  command_line_parser.add_argument(
+    "--top-functions", "-l",
+    action="store_true",
+    help="print the most sampled functions of a sampled dispatches file"
+  )
+  command_line_parser.add_argument(
+    "--function", "-F",
+    metavar="<function name>",
+    help=("restrict the report to the named function of a sampled dispatches "
+          "file")
+  )
   command_line_parser.add_argument(
     "--output-filename", "-o",
     metavar="<output filename>",
@@ -255,7 +309,13 @@ def main():
   program_options = parse_command_line()
 
   with open(program_options.input_filename) as stream:
-    dispatches_table = json.load(stream)
+    data = json.load(stream)
+
+  if program_options.top_functions:
+    print_top_functions(data, program_options.top_entries_count)
+    return
+
+  dispatches_table = extract_dispatches_table(data, program_options.function)
 
   warn_if_counter_may_have_saturated(dispatches_table)
 
@@ -60,3 +60,23 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ("a", 2, 0.2),
       ("c", 10, 0.1)
     ])
+
+  def test_extract_dispatches_table(self):
+    table = {"a": {"b": 1}}
+    self.assertIs(bdr.extract_dispatches_table(table), table)
+    sampled = {
+      "dispatches": {"a": {"b": 3}},
+      "functions": [
+        {"name": "f", "scriptId": 1, "position": 0, "samples": 2,
+         "bytecodes": {"a": 2, "b": 2}, "dispatches": {"a": {"b": 2}}},
+        {"name": "g", "scriptId": 1, "position": 10, "samples": 1,
+         "bytecodes": {"a": 1, "b": 1}, "dispatches": {"a": {"b": 1}}}
+      ]
+    }
+    self.assertDictEqual(bdr.extract_dispatches_table(sampled),
+                         {"a": {"b": 3}})
+    self.assertDictEqual(bdr.extract_dispatches_table(sampled, "g"),
+                         {"a": {"b": 1}})
+    self.assertListEqual(bdr.find_top_functions(sampled, 1), [
+      ("f", 1, 0, 2)
+    ])